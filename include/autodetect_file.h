@@ -32,7 +32,8 @@ typedef enum {
     MCC_CAPTIONS_FILE     = 2,
     MPEG_BINARY_FILE      = 3,
     MOV_BINARY_FILE       = 4,
-    MAX_FILE_TYPE         = 5
+    CC_DATA_BINARY_FILE   = 5,
+    MAX_FILE_TYPE         = 6
 } FileType;
 
 typedef enum {
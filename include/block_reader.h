@@ -0,0 +1,121 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef block_reader_h
+#define block_reader_h
+
+#include <stdio.h>
+#include <pthread.h>
+
+/* Reads are queued with io_uring where the kernel headers offer it, unless built with DONT_COMPILE_IO_URING */
+#if defined(__linux__) && !defined(DONT_COMPILE_IO_URING)
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define BLOCK_READER_IO_URING
+#endif
+#endif
+#endif
+
+#include "types.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+#define BLOCK_READER_DEFAULT_BLOCK_SIZE          (4*1024*1024)
+#define BLOCK_READER_ALIGNMENT                   4096
+
+/* Number of blocks held by a reader, one being consumed while the rest are read ahead */
+#define BLOCK_READER_NUM_BLOCKS                  4
+
+/* State of each block */
+#define BLOCK_READER_BLOCK_EMPTY                 0
+#define BLOCK_READER_BLOCK_REQUESTED             1
+#define BLOCK_READER_BLOCK_FILLED                2
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    uint8* dataPtr;
+    int64 fileOffset;
+    uint32 numBytes;
+    uint8 state;
+} ReaderBlock;
+
+#ifdef BLOCK_READER_IO_URING
+typedef struct {
+    int ringFd;
+    void* sqRingPtr;
+    size_t sqRingSize;
+    void* cqRingPtr;
+    size_t cqRingSize;
+    struct io_uring_sqe* sqesPtr;
+    size_t sqesSize;
+    unsigned* sqTailPtr;
+    unsigned* sqMaskPtr;
+    unsigned* sqArrayPtr;
+    unsigned* cqHeadPtr;
+    unsigned* cqTailPtr;
+    unsigned* cqMaskPtr;
+    struct io_uring_cqe* cqesPtr;
+    struct iovec ioVectors[BLOCK_READER_NUM_BLOCKS];
+} BlockReaderRing;
+#endif
+
+typedef struct {
+    int fileDescriptor;
+    int64 fileSize;
+    int64 position;
+    uint32 blockSize;
+    ReaderBlock blocks[BLOCK_READER_NUM_BLOCKS];
+    uint8 currentBlock;
+    boolean isRingEnabled;
+#ifdef BLOCK_READER_IO_URING
+    BlockReaderRing ring;
+#endif
+    pthread_t readaheadThread;
+    pthread_mutex_t mutex;
+    pthread_cond_t blockRequested;
+    pthread_cond_t blockFilled;
+    boolean isShuttingDown;
+} BlockReader;
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+BlockReader* BlockReaderOpen( char*, uint32 );
+int32 BlockReaderRead( BlockReader*, uint8*, uint32 );
+int64 BlockReaderSeek( BlockReader*, int64, int );
+void BlockReaderClose( BlockReader* );
+FILE* BlockReaderOpenStream( char* );
+
+#endif /* block_reader_h */
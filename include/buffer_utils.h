@@ -26,18 +26,40 @@
 /*----------------------------------------------------------------------------*/
 
 #define MAX_CALLER_FILE_NAME_SIZE                20
-#define MAX_BUFFER_ARRAY_SIZE                    10
+
+// Only one buffer from the source is in the pipeline at a time, but with
+// --parallel-sinks everything it spawns can be alive at once: the source's own
+// buffer, its pending frames buffer, the L21 and DTVCC annotations, the L21 and
+// DTVCC event buffers, a CAPTION_CUE from each decoder and the MCC Encode output.
+// That is 9 at worst, the rest is headroom.
+#define MAX_BUFFER_ARRAY_SIZE                    16
 
 #define BUFFER_TYPE_UNKNOWN                       0
 #define BUFFER_TYPE_BYTES                         1
 #define BUFFER_TYPE_LINE_21                       2
 #define BUFFER_TYPE_DTVCC                         3
-#define MAX_BUFFER_TYPE                           4
+#define BUFFER_TYPE_FILL                          4
+#define BUFFER_TYPE_CAPTION_CUE                   5
+#define BUFFER_TYPE_CC_DATA_FRAMES                6
+#define MAX_BUFFER_TYPE                           7
+
+#define MAX_FRAMES_PER_BUFFER                   256
+
+#define CC_DATA_PLANE_FIELD_1                     0
+#define CC_DATA_PLANE_FIELD_2                     1
+#define CC_DATA_PLANE_DTVCC                       2
+#define CC_DATA_NUM_PLANES                        3
 
 #define CAPTION_TIME_SOURCE_UNKNOWN               0
 #define CAPTION_TIME_FRAME_NUMBERING              1
 #define CAPTION_TIME_PTS_NUMBERING                2
 
+#define CAPTION_CUE_SOURCE_608                    1
+#define CAPTION_CUE_SOURCE_708                    2
+
+#define CAPTION_CUE_MAX_ROWS                     15
+#define CAPTION_CUE_MAX_ROW_TEXT                192   // 42 Columns of up to 4 Bytes of UTF-8, plus the NULL
+
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
 /*----------------------------------------------------------------------------*/
@@ -53,14 +75,86 @@ typedef struct {
     uint8 source;
 } CaptionTime;
 
+// The time and size of one of the frames of cc_data in a BUFFER_TYPE_CC_DATA_FRAMES buffer. The
+// frame rate, drop frame and source of the time are shared by every frame, and held by the buffer.
+typedef struct {
+    uint8 hour;
+    uint8 minute;
+    uint8 second;
+    uint8 frame;
+    uint16 millisecond;
+    uint16 numElements;                      // Bytes of cc_data, which follow those of the frame before
+} CcDataFrame;
+
+// The constructs of a single kind from the cc_data of a buffer, in order, with each byte of
+// the construct in a plane of its own so that a decoder reads only the bytes it consumes
+typedef struct {
+    uint16 numConstructs;
+    uint16* indexPtr;                        // Of the construct in the cc_data of the buffer
+    uint8* headerPtr;                        // Marker bits, Valid Flag and Type
+    uint8* data1Ptr;
+    uint8* data2Ptr;
+} CcDataPlane;
+
+// The cc_data of a buffer split by the source into a plane per Line 21 Field and one for DTVCC
 typedef struct {
+    CcDataPlane plane[CC_DATA_NUM_PLANES];
+} CcDataPlanes;
+
+// Releases the reference which kept the borrowed data of a buffer alive
+typedef void (*BufferReleaseFnPtr)( void* );
+
+typedef struct Buffer {
     uint8 bufferType;
     CaptionTime captionTime;
     uint8* dataPtr;
     uint16 numElements;
     uint16 maxNumElements;
+    struct Buffer* annotationPtr;            // Line 21 Decode of each construct, attached by an earlier sink
+    struct Buffer* dtvccAnnotationPtr;       // DTVCC Decode of each construct, attached by an earlier sink
+    CcDataFrame* framePtr;                   // Only for BUFFER_TYPE_CC_DATA_FRAMES
+    uint16 numFrames;
+    uint16 maxNumFrames;
+    CcDataPlanes* planesPtr;                 // Only for cc_data, when split by the source
+    void* dataRefPtr;                        // Owner of the data, when it is borrowed rather than allocated
+    BufferReleaseFnPtr releaseFnPtr;         // Releases dataRefPtr in place of freeing the data
 } Buffer;
 
+// Walks the frames of cc_data in a buffer, whether it carries one frame or several
+typedef struct {
+    uint16 frameIndex;
+    uint16 firstElement;                     // Of the current frame in the data of the buffer
+    uint16 numElements;
+    CaptionTime captionTime;
+} BufferFrame;
+
+// A run of consecutive frames which carry nothing but fill, in place of a buffer per frame
+typedef struct {
+    uint32 firstFrameNum;
+    uint32 numFrames;
+} FillRun;
+
+// A row of text that was on screen, indented from the left by the column it starts in
+typedef struct {
+    uint8 rowNumber;
+    uint8 column;
+    char text[CAPTION_CUE_MAX_ROW_TEXT];
+} CaptionCueRow;
+
+// Text that was on screen, unchanged, from the start time until the end time
+typedef struct {
+    uint8 source;                            // CAPTION_CUE_SOURCE_*
+    uint8 channelNum;                        // Line 21 Channel or DTVCC Service Number
+    CaptionTime startTime;
+    CaptionTime endTime;
+    uint8 numRows;
+    CaptionCueRow rows[CAPTION_CUE_MAX_ROWS];
+    uint8 windowId;                          // DTVCC Window that held the text, unused for Line 21
+    uint8 anchorId;                          // Point of the DTVCC Window that sits on the anchor
+    uint8 anchorVertPercent;                 // Position of the anchor, as a percentage of the screen
+    uint8 anchorHorzPercent;
+} CaptionCue;
+
 typedef struct {
     char callerFileName[MAX_CALLER_FILE_NAME_SIZE];
     int callerFileLine;
@@ -73,6 +167,8 @@ typedef struct {
 /*----------------------------------------------------------------------------*/
 
 #define NewBuffer(bt, sz) _NewBuffer(__FILE__, __LINE__, bt, sz)
+#define NewFramesBuffer(nf, sz) _NewFramesBuffer(__FILE__, __LINE__, nf, sz)
+#define NewRefBuffer(bt, dat, sz, ref, fn) _NewRefBuffer(__FILE__, __LINE__, bt, dat, sz, ref, fn)
 
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
@@ -84,6 +180,11 @@ typedef struct {
 
 void BufferPoolInit( void );
 Buffer* _NewBuffer( char*, int, uint8, uint16 );
+Buffer* _NewFramesBuffer( char*, int, uint16, uint16 );
+Buffer* _NewRefBuffer( char*, int, uint8, uint8*, uint16, void*, BufferReleaseFnPtr );
+boolean AddFrameToBuffer( Buffer*, CaptionTime*, uint8*, uint16 );
+void StartBufferFrames( Buffer*, BufferFrame* );
+boolean NextBufferFrame( Buffer*, BufferFrame* );
 void FreeBuffer( Buffer* );
 void AddReader( Buffer* );
 uint8 NumAllocatedBuffers( void );
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef cache_output_h
+#define cache_output_h
+
+#include "types.h"
+#include "pipeline_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+LinkInfo CacheOutInitialize( Context* );
+uint8 CacheOutProcNextBuffer( void*, Buffer* );
+uint8 CacheOutShutdown( void* );
+
+#endif /* cache_output_h */
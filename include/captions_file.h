@@ -27,6 +27,8 @@
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 
+#define SCC_WORDS_PER_CHUNK              32
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
@@ -52,4 +54,10 @@ boolean SccFileAddSink( Context*, LinkInfo );
 boolean MccFileProcNextBuffer( Context*, boolean* );
 boolean SccFileProcNextBuffer( Context*, boolean* );
 
+boolean MccFileBuildIndex( Context* );
+boolean SccFileBuildIndex( Context* );
+
+boolean MccFileSeekToTime( Context*, uint32 );
+boolean SccFileSeekToTime( Context*, uint32 );
+
 #endif /* captions_file_h */
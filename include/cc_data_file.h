@@ -0,0 +1,99 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef cc_data_file_h
+#define cc_data_file_h
+
+#include "types.h"
+#include "pipeline_utils.h"
+#include "context.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*
+ * Binary CC Data File - The cc_data of every frame of an asset, written by the
+ * Cache Output so that the outputs can be regenerated without reading the asset.
+ * All numbers are little endian.
+ *
+ *    Header:   Magic[4] Version[1] Time Source[1] Drop Frame[1] Reserved[1] Frame Rate x 100[4] Reserved[4]
+ *    Records:  Type[1] followed by one of:
+ *                 Frame:        Time[6] cc_count[1] cc_data[3 * cc_count]
+ *                 Padding Run:  Time[6] Num Frames[4] cc_count[1] cc_data[3 * cc_count]
+ *                 Fill Run:     First Frame Num[4] Num Frames[4]
+ *    Index:    { Time in Ms[4] Record Offset[4] } for a record after each run of bytes
+ *    Trailer:  Index Offset[4] Num Entries[4] Num Frames[4] Magic[4]
+ *
+ * Time is Hour[1] Minute[1] Second[1] Frame[1] Millisecond[2]. Each frame of a
+ * Padding Run carries the same cc_data, at the time frameTimeInRun() gives it.
+ */
+#define CC_DATA_FILE_MAGIC                      "CCDX"
+#define CC_DATA_FILE_MAGIC_SIZE                 4
+#define CC_DATA_FILE_VERSION                    1
+#define CC_DATA_FILE_EXTENSION                  "ccdx"
+
+#define CC_DATA_FILE_HEADER_SIZE                16
+#define CC_DATA_FILE_TRAILER_SIZE               16
+#define CC_DATA_FILE_TIME_SIZE                  6
+#define CC_DATA_FILE_INDEX_ENTRY_SIZE           8
+
+#define CC_DATA_RECORD_FRAME                    1
+#define CC_DATA_RECORD_PADDING_RUN              2
+#define CC_DATA_RECORD_FILL_RUN                 3
+
+#define CC_DATA_FILE_MAX_RECORD_SIZE            (1 + CC_DATA_FILE_TIME_SIZE + 4 + 1 + (3 * CC_DATA_FILE_MAX_CC_COUNT))
+
+/* A record after each run of this many bytes is indexed */
+#define CC_DATA_FILE_INDEX_SPACING_BYTES        4096
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    uint8 version;
+    uint8 timeSource;                        // CAPTION_TIME_*
+    boolean isDropFrame;
+    uint32 frameRateTimesOneHundred;
+} CcDataFileHeader;
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+#define CC_DATA_FILE_PUT_32(ptr, val)  { (ptr)[0] = (uint8)(val); (ptr)[1] = (uint8)((val) >> 8); \
+                                         (ptr)[2] = (uint8)((val) >> 16); (ptr)[3] = (uint8)((val) >> 24); }
+#define CC_DATA_FILE_GET_32(ptr)       ((uint32)(ptr)[0] | ((uint32)(ptr)[1] << 8) | \
+                                        ((uint32)(ptr)[2] << 16) | ((uint32)(ptr)[3] << 24))
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+boolean CcDataFileInitialize( Context*, char* );
+boolean CcDataFileAddSink( Context*, LinkInfo );
+boolean CcDataFileProcNextBuffer( Context*, boolean* );
+boolean CcDataFileSeekToTime( Context*, uint32 );
+boolean CcDataFileReadHeader( char*, CcDataFileHeader* );
+
+#endif /* cc_data_file_h */
@@ -26,7 +26,6 @@
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 #define UNKOWN_CHANNEL                                           0
-#define UNKNOWN_SERVICE                                          0
 #define CC_DATA_TYPE__FIELD_1                                    0
 #define CC_DATA_TYPE__FIELD_2                                    1
 #define CC_DATA_TYPE__PACKET_DATA                                2
@@ -46,30 +45,6 @@
 
 #define CEA708_ERROR_STR_SIZE                                   25
 
-#define CEA708_STATE_UNKNOWN                                     0
-#define CEA708_STATE_EXTENDED_SEQ_NUM                            1
-#define CEA708_STATE_DATA_WAIT                                   2
-#define CEA708_STATE_C0_CODE                                     3
-#define CEA708_STATE_C1_CODE                                     4
-#define CEA708_STATE_EXTENDED_CODE                               5
-
-#define CEA708_CODE_UNKNOWN                                      0
-#define CEA708_CODE_UNKNOWN_C0_1                                 1
-#define CEA708_CODE_UNKNOWN_C0_2                                 2
-#define CEA708_CODE_P16_C0                                       3
-#define CEA708_CODE_EXTENDED_CODE_UNKNOWN                        4
-#define CEA708_CODE_C2                                           5
-#define CEA708_CODE_G2                                           6
-#define CEA708_CODE_C3                                           7
-#define CEA708_CODE_G3                                           8
-#define CEA708_CODE_C1_BITMAP                                    9
-#define CEA708_CODE_C1_DLY                                      10
-#define CEA708_CODE_C1_SPA                                      11
-#define CEA708_CODE_C1_SPC                                      12
-#define CEA708_CODE_C1_SPL                                      13
-#define CEA708_CODE_C1_SWA                                      14
-#define CEA708_CODE_C1_DFW                                      15
-
 
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
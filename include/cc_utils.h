@@ -19,6 +19,8 @@
 #ifndef cc_utils_h
 #define cc_utils_h
 
+#include <stdio.h>
+
 #include "mcc_decode.h"
 
 /*----------------------------------------------------------------------------*/
@@ -50,14 +52,34 @@
 #define CC_COUNT_FRAME_RATE_50              12
 #define CC_COUNT_FRAME_RATE_60              10
 
+#define CC_TRIAGE_MAX_CONSTRUCTS            32
+#define CC_TRIAGE_ALL_CONSTRUCTS            0xFFFFFFFF
+
+#define INVALID_HEX_NIBBLE                  0xFF
+
+/* Once a time code search has narrowed to this many bytes the lines are simply read in turn */
+#define TIME_CODE_SEEK_SCAN_BYTES           4096
+
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
 /*----------------------------------------------------------------------------*/
 
+// Bit N of each mask is set when the Nth cc_data construct of a frame is of that kind.
+typedef struct {
+    uint32 field1Mask;       // Valid CEA-608 Field 1 with a non null byte pair
+    uint32 field2Mask;       // Valid CEA-608 Field 2 with a non null byte pair
+    uint32 dtvccStartMask;   // DTVCC Packet Start, valid or not, as either ends the prior packet
+    uint32 dtvccDataMask;    // Valid DTVCC Packet Data
+} CcDataTriage;
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
 
+// Gathers the movemask bits of the construct headers in lanes 0, 3, 6, 9 and 12
+#define CC_TRIAGE_HEADER_BITS(m)  (((m) & 0x01) | (((m) >> 2) & 0x02) | (((m) >> 4) & 0x04) | \
+                                   (((m) >> 6) & 0x08) | (((m) >> 8) & 0x10))
+
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
 /*----------------------------------------------------------------------------*/
@@ -76,5 +98,14 @@ uint8 cdpFramerateFromFramerate( uint32 );
 boolean isFramerateValid( uint32 frameRatePerSecTimesOneHundred );
 void frameToTimeCode( uint32, uint32, CaptionTime* );
 uint32 timeCodeToFrame( CaptionTime* );
+uint32 captionTimeToMs( CaptionTime* );
+void frameTimeInRun( CaptionTime*, uint32, CaptionTime* );
+void triageCcData( uint8*, uint16, CcDataTriage* );
+void splitCcData( Buffer* );
+void fillCcData( uint8*, uint8 );
+uint16 bytesFromHex( char*, uint16, uint8* );
+void bytesToHex( uint8*, uint16, char* );
+boolean timeCodeLineToMs( const char*, long, uint32, uint32* );
+boolean seekToTimeCode( FILE*, long, long, uint32, uint32 );
 
 #endif /* cc_utils_h */
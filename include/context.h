@@ -33,6 +33,9 @@
 
 #include "types.h"
 #include "pipeline_structs.h"
+#include "thread_pool.h"
+#include "block_reader.h"
+#include "timecode_index.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                               Constants                                --*/
@@ -43,17 +46,32 @@
 #define TEXT_FOUND                                           1
 #define TEXT_REPORTED                                        2
 
+/* Outputs which can be selected, each of which plumbs the branch of the Pipeline that writes it */
+#define PIPELINE_OUTPUT_NONE                              0x00
+#define PIPELINE_OUTPUT_MCC                               0x01
+#define PIPELINE_OUTPUT_608                               0x02
+#define PIPELINE_OUTPUT_708                               0x04
+#define PIPELINE_OUTPUT_CCD                               0x08
+#define PIPELINE_OUTPUT_ALL                               0x0F
+#define PIPELINE_OUTPUT_CACHE                             0x20   // Only when asked for, so not part of all
+
 /* Size Related Defines for the Specific Contexts */
 #define MAX_FILE_NAME_LEN                                  256
 #define LINE21_MAX_NUM_CHANNELS                              4
 #define DTVCC_MAX_NUM_SERVICES                              63
 #define LINE21_NUMBER_OF_FIELDS                              2
-
-/* Bytes we can always look ahead without going out of limits. Buffer Size is 2 Mb plus the safety pass  */
-#define ONEPASS                                            120
-#define BUFSIZE                                            (2048*1024+ONEPASS)
+#define LINE21_SCREEN_NUM_ROWS                              15
+#define LINE21_SCREEN_NUM_COLUMNS                           32
+#define DTVCC_NUM_WINDOWS                                    8
+#define DTVCC_WINDOW_MAX_ROWS                               15
+#define DTVCC_WINDOW_MAX_COLUMNS                            42
 
 #define DTVCC_MAX_PACKET_LENGTH                            128
+#define MCC_MAX_LINE_LENGTH                                256
+#define MCC_MAX_CC_DATA_BYTES                              (3*0x1F)
+#define MCC_DECODE_BATCH_LINES                             4096
+#define MCC_DECODE_LINES_PER_TASK                          128
+#define CC_DATA_FILE_MAX_CC_COUNT                          255
 
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
@@ -70,6 +88,16 @@ typedef struct {
     boolean matchPtsTime;                       // -p --match_pts_time
     boolean forceDropframe;                     // -d --dropframe (used)
     boolean forcedDropframe;                    // -d --dropframe (value)
+    uint8 numThreads;                           // -j --threads
+    uint8 decodeWhichChannels;                  // -c --channels (Bit per Channel; 0 is all)
+    uint64 decodeWhichServices;                 // -s --services (Bit per Service; 0 is all)
+    uint8 outputs;                              // --outputs (PIPELINE_OUTPUT_* bits)
+    boolean parallelSinks;                      // --parallel-sinks
+    uint16 framesPerBuffer;                     // --frames-per-buffer
+    boolean planarCcData;                       // --planar-cc-data
+    boolean fastDecode;                         // --fast-decode
+    uint32 startTimeMs;                         // --start
+    uint32 endTimeMs;                           // --end (0 is the end of the asset)
 } CaptionInspectorConfig;
 
 /* Caption Inspector Statistics */
@@ -87,6 +115,8 @@ typedef struct {
     char captionFileName[MAX_FILE_NAME_LEN];
     uint32 numCaptionsLinesRead;
     FILE* captionsFilePtr;
+    long firstLinePos;
+    TimeCodeIndex* timeCodeIndexPtr;
     uint32 frameRateTimesOneHundred;
 } SccFileCtx;
 
@@ -95,6 +125,8 @@ typedef struct {
     char captionFileName[MAX_FILE_NAME_LEN];
     uint32 numCaptionsLinesRead;
     FILE* captionsFilePtr;
+    long firstLinePos;
+    TimeCodeIndex* timeCodeIndexPtr;
     uint32 frameRateTimesOneHundred;
     boolean isDropFrame;
 // TODO - This is a kludge! Fully support the MCC 2.0 Stuff and remove this
@@ -104,15 +136,23 @@ typedef struct {
 typedef struct {
     Sinks sinks;
     char captionFileName[MAX_FILE_NAME_LEN];
-    uint32 numCaptionsLinesRead;
+    uint32 numFramesRead;
     FILE* captionsFilePtr;
+    long firstRecordPos;
+    long endOfRecordsPos;                    // Start of the index, or the end of a file without one
+    TimeCodeIndex* timeCodeIndexPtr;
+    uint32 skipUntilMs;                      // Records are read from an indexed one, before the time sought
     uint32 frameRateTimesOneHundred;
     boolean isDropFrame;
+    uint8 timeSource;
+    Buffer* framesBufferPtr;
 } CcDataFileCtx;
 
 #ifndef DONT_COMPILE_FFMPEG
 typedef struct {
     Sinks sinks;
+    BlockReader* readerPtr;
+    AVIOContext* ioContextPtr;
     AVFormatContext* formatContext;
     AVCodecContext* decoderContext;
     AVFrame* frame;
@@ -122,10 +162,10 @@ typedef struct {
     boolean isDropframe;
     boolean bailNoCaptions;
     int64 fileSize;
-    uint8 buffer[BUFSIZE];
-    uint32 len;
     int64 firstPts;
+    boolean isFirstPtsFound;                 // Found before seeking to --start, as it may be zero
     uint32 ccCountMismatchErrors;
+    Buffer* framesBufferPtr;
 } MpegFileCtx;
 #endif
 
@@ -154,8 +194,9 @@ typedef struct {
 typedef struct {
     Sinks sinks;
     boolean processOnly;
+    boolean annotate;                        // Leave the decode on the incoming buffer for the CC Data Output
     uint8 foundText;
-    uint8 decodeWhichChannels;
+    uint8 decodeWhichChannels;               // Bit per Channel (CC1 is bit 0), or DECODE_ALL_CHANNELS
     uint8 currentChannel[LINE21_NUMBER_OF_FIELDS+1];
     boolean dataFound[LINE21_MAX_NUM_CHANNELS+1];
     boolean isPopOnCaptioning[LINE21_MAX_NUM_CHANNELS+1];
@@ -165,10 +206,70 @@ typedef struct {
     boolean captioningStart[LINE21_MAX_NUM_CHANNELS+1];
 } Line21DecodeCtx;
 
+// Each cell holds the UTF-8 string of the character displayed in it, or NULL if it is empty
+typedef struct {
+    char* displayed[LINE21_SCREEN_NUM_ROWS][LINE21_SCREEN_NUM_COLUMNS];
+    char* nonDisplayed[LINE21_SCREEN_NUM_ROWS][LINE21_SCREEN_NUM_COLUMNS];
+    uint8 captionMode;
+    uint8 rollUpRows;
+    uint8 baseRow;
+    uint8 cursorRow;
+    uint8 cursorColumn;
+    boolean isCueOpen;
+    CaptionTime cueStartTime;
+    uint32 lastControlCode;                 // Signature of the last control code, to spot repeats
+} Line21Screen;
+
+typedef struct {
+    Sinks sinks;
+    Line21Screen screen[LINE21_MAX_NUM_CHANNELS];
+    CaptionTime lastCaptionTime;
+} Line21ScreenCtx;
+
+typedef struct {
+    boolean isDefined;
+    boolean isVisible;
+    boolean isRelativePosition;
+    uint8 verticalAnchor;
+    uint8 horizontalAnchor;
+    uint8 anchorId;
+    uint8 numRows;                           // Text may run past the defined Column Count, so only Rows are kept
+    uint8 penRow;
+    uint8 penColumn;
+    const char* text[DTVCC_WINDOW_MAX_ROWS][DTVCC_WINDOW_MAX_COLUMNS];
+    boolean isCueOpen;
+    CaptionTime cueStartTime;
+} DtvccWindow;
+
+typedef struct {
+    DtvccWindow window[DTVCC_NUM_WINDOWS];
+    uint8 currentWindow;
+} DtvccWindowService;
+
+typedef struct {
+    Sinks sinks;
+    DtvccWindowService* service[DTVCC_MAX_NUM_SERVICES];   // Allocated when a Service is first seen
+    CaptionTime lastCaptionTime;
+} DtvccWindowCtx;
+
+// Where the byte by byte walk of the packets, which annotates the incoming buffers, is up to
+typedef struct {
+    uint8 state;
+    uint8 packetBytesLeft;
+    uint8 blockBytesLeft;
+    uint8 serviceNumber;
+    uint8 dtvccType;                         // Element in progress, if any
+    uint8 code;
+    uint8 byteNum;
+    uint8 numBytes;
+} DtvccAnnotateState;
+
 typedef struct {
     Sinks sinks;
     boolean processOnly;
     boolean processedFine;
+    boolean annotate;                        // Leave the decode on the incoming buffer for the CC Data Output
+    DtvccAnnotateState annotateState;
     boolean firstPacket;
     uint8 foundText;
     uint32 numP16Cmds;
@@ -177,6 +278,7 @@ typedef struct {
     uint8 dtvccPacketLength;
     int8 lastSequence;
     uint64 activeServices;
+    uint64 decodeWhichServices;              // Bit per Service (Service 1 is bit 0), or DECODE_ALL_SERVICES
     boolean isPopOnCaptioning[DTVCC_MAX_NUM_SERVICES];
     boolean isRollUpCaptioning[DTVCC_MAX_NUM_SERVICES];
     boolean isTickerCaptioning[DTVCC_MAX_NUM_SERVICES];
@@ -184,9 +286,25 @@ typedef struct {
     boolean captioningStart[DTVCC_MAX_NUM_SERVICES];
 } DtvccDecodeCtx;
 
+// A single MCC line waiting in a batch to be decoded, and the cc_data decoded from it
+typedef struct {
+    CaptionTime captionTime;
+    uint32 charOffset;
+    uint16 numChars;
+    uint8 numCcDataBytes;
+    uint8 ccData[MCC_MAX_CC_DATA_BYTES];
+} MccDecodeLine;
+
 typedef struct {
     Sinks sinks;
     uint32 numCcCountMismatches;
+    ThreadPool* threadPoolPtr;
+    MccDecodeLine* batchLines;
+    uint16 numBatchLines;
+    char* batchChars;
+    uint32 numBatchChars;
+    uint32 maxBatchChars;
+    Buffer* framesBufferPtr;
 } MccDecodeCtx;
 
 typedef struct {
@@ -202,6 +320,7 @@ typedef struct {
     boolean fullSecondFound;
     uint32 totalSkew;
     uint8 framesPerSec[60];
+    char mccLine[MCC_MAX_LINE_LENGTH];
 } MccEncodeCtx;
 
 typedef struct {
@@ -220,12 +339,7 @@ typedef struct {
 typedef struct {
     FILE* fp;
     boolean wasHeaderWritten;
-    uint8 currentChannel[LINE21_NUMBER_OF_FIELDS];
-    uint8 currentService;
     uint16 cea708ErrNum;
-    uint8 cea708State;
-    uint8 cea708Code;
-    uint8 cea708BytesRemaining;
     char ccdFileName[MAX_FILE_NAME_LEN];
 } CcDataOutputCtx;
 
@@ -246,14 +360,39 @@ typedef struct {
     char outputFileName[MAX_FILE_NAME_LEN];
 } DtvccOutputCtx;
 
+typedef struct {
+    FILE* srtFp[LINE21_MAX_NUM_CHANNELS];
+    FILE* vttFp[LINE21_MAX_NUM_CHANNELS];
+    uint32 numCues[LINE21_MAX_NUM_CHANNELS];
+    FILE* serviceVttFp[DTVCC_MAX_NUM_SERVICES];
+    FILE* serviceJsonFp[DTVCC_MAX_NUM_SERVICES];
+    uint32 numServiceCues[DTVCC_MAX_NUM_SERVICES];
+    uint8 numProducers;                      // Elements feeding Cues in, each of which will Shut it Down
+    char outputFileName[MAX_FILE_NAME_LEN];
+} CueOutputCtx;
+
 typedef struct {
     FILE* fp;
     char mccFileName[MAX_FILE_NAME_LEN];
 } MccOutputCtx;
 
+typedef struct {
+    FILE* fp;
+    long filePos;
+    long nextIndexPos;
+    TimeCodeIndex* timeCodeIndexPtr;
+    uint32 numFramesWritten;
+    CaptionTime paddingTime;                 // Of the first frame of the Padding Run being gathered
+    uint32 numPaddingFrames;
+    uint8 paddingCcCount;
+    uint8 paddingData[3 * CC_DATA_FILE_MAX_CC_COUNT];
+    char cacheFileName[MAX_FILE_NAME_LEN];
+} CacheOutputCtx;
+
 typedef struct {
     CaptionInspectorConfig config;
     CaptionInspectorStats stats;
+    ThreadPool* sinkPoolPtr;                 // Runs the sinks of a buffer in parallel, for --parallel-sinks
     SccFileCtx* sccFileCtxPtr;
     MccFileCtx* mccFileCtxPtr;
     CcDataFileCtx* ccDataFileCtxPtr;
@@ -262,7 +401,9 @@ typedef struct {
 #endif
     MovFileCtx* movFileCtxPtr;
     Line21DecodeCtx* line21DecodeCtxPtr;
+    Line21ScreenCtx* line21ScreenCtxPtr;
     DtvccDecodeCtx* dtvccDecodeCtxPtr;
+    DtvccWindowCtx* dtvccWindowCtxPtr;
     MccDecodeCtx* mccDecodeCtxPtr;
     MccEncodeCtx* mccEncodeCtxPtr;
     SccEncodeCtx* sccEncodeCtxPtr;
@@ -270,7 +411,9 @@ typedef struct {
     CcDataOutputCtx* ccDataOutputCtxPtr;
     Line21OutputCtx* line21OutputCtxPtr;
     DtvccOutputCtx* dtvccOutputCtxPtr;
+    CueOutputCtx* cueOutputCtxPtr;
     MccOutputCtx* mccOutputCtxPtr;
+    CacheOutputCtx* cacheOutputCtxPtr;
 } Context;
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef cue_output_h
+#define cue_output_h
+
+#include "types.h"
+
+#include "pipeline_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+#define CUE_OUTPUT_TIME_STR_SIZE                            32
+
+// WebVTT places Line 21 text in the central 80% of the screen, per the 608 to WebVTT mapping
+#define CUE_OUTPUT_SAFE_AREA_OFFSET_PERCENT                 10
+#define CUE_OUTPUT_SAFE_AREA_SIZE_PERCENT                   80
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+LinkInfo CueOutInitialize( Context* );
+uint8 CueOutProcNextBuffer( void*, Buffer* );
+uint8 CueOutShutdown( void* );
+
+#endif /* cue_output_h */
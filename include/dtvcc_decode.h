@@ -38,6 +38,11 @@
 #define DTVCC_G2_CHAR                                        7
 #define DTVCC_G3_CHAR                                        8
 #define DTVCC_IGNORE_CMD_OR_CHAR                             9
+#define DTVCC_EXT1_CODE                                     10   // The remaining types are only found in a DtvccByte
+#define DTVCC_PACKET_HEADER                                 11
+#define DTVCC_BLOCK_HEADER                                  12
+#define DTVCC_EXT_SERVICE_NUM                               13
+#define DTVCC_PADDING                                       14
 
 #define PACKET_SEQ_NUM_MASK                               0xC0
 #define PACKET_SEQ_SHIFT                                     6
@@ -52,6 +57,12 @@
 
 #define DTVCC_NO_LAST_SEQUENCE                              -1
 
+#define DTVCC_ANNOTATE_NO_PACKET                             0
+#define DTVCC_ANNOTATE_BLOCK_HEADER                          1
+#define DTVCC_ANNOTATE_EXT_SERVICE_NUM                       2
+#define DTVCC_ANNOTATE_BLOCK_DATA                            3
+#define DTVCC_ANNOTATE_PADDING                               4
+
 #define DECODE_ALL_SERVICES                                  0
 
 //---------------------------------------------------------------------------------------
@@ -565,10 +576,34 @@ typedef struct {
     uint8 serviceNumber;
 } DtvccData;
 
+// A DTVCC element as it is carried down the pipeline in a BUFFER_TYPE_DTVCC buffer. Characters
+// and most commands are just the header, and only the commands which carry parameters are
+// followed by them, in the layout of the command in DtvccData.
+typedef struct {
+    uint8 dtvccType;
+    uint8 serviceSequence;                   // Sequence Number in the upper two bits, Service in the lower
+    uint8 code;                              // Character, or C0 / C1 Command Code
+    uint8 payloadSize;                       // Bytes of command parameters which follow the header
+} DtvccEvent;
+
+// What a single byte of a DTVCC Packet is, as DTVCC Decode leaves it on the incoming buffer
+// for the sinks after it (e.g. the CC Data Output). There are two for each construct of the
+// buffer, and those of constructs which carry no part of a packet are left DTVCC_UNKNOWN.
+typedef struct {
+    uint8 dtvccType;                         // Type of the element the byte is part of, or of the packet structure
+    uint8 code;                              // Character or Command Code of the element
+    uint8 byteNum;                           // Which byte of the element it is, from 1 for the code itself
+    uint8 serviceNumber;
+} DtvccByte;
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
 
+#define DTVCC_SERVICE_SELECT(svc)        ((uint64)1 << ((svc) - 1))
+#define DTVCC_MAX_EVENT_BYTES(n)         ((n) * sizeof(DtvccEvent))
+#define DTVCC_BYTES_PER_CONSTRUCT        2
+
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
 /*----------------------------------------------------------------------------*/
@@ -577,9 +612,11 @@ typedef struct {
 /*--                           Exposed Methods                              --*/
 /*----------------------------------------------------------------------------*/
 
-LinkInfo DtvccDecodeInitialize( Context*, boolean );
+LinkInfo DtvccDecodeInitialize( Context*, boolean, uint64 );
 boolean DtvccDecodeAddSink( Context*, LinkInfo );
 uint8 DtvccDecodeProcNextBuffer( void*, Buffer* );
 uint8 DtvccDecodeShutdown( void* );
+boolean DtvccDecodeAddEvent( Buffer*, DtvccData* );
+boolean DtvccDecodeNextEvent( Buffer*, uint16*, DtvccData* );
 
 #endif /* dtvcc_decode_h */
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef dtvcc_window_h
+#define dtvcc_window_h
+
+#include "types.h"
+#include "pipeline_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+// Anchor coordinates of windows which are not relatively positioned, on a 16:9 screen
+#define DTVCC_WINDOW_ABSOLUTE_MAX_VERTICAL                  75
+#define DTVCC_WINDOW_ABSOLUTE_MAX_HORIZONTAL               210
+
+#define DTVCC_WINDOW_RELATIVE_MAX_ANCHOR                   100
+
+// Anchor IDs are a 3x3 grid, numbered left to right and then top to bottom
+#define DTVCC_WINDOW_ANCHORS_PER_ROW                         3
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+LinkInfo DtvccWindowInitialize( Context* );
+boolean DtvccWindowAddSink( Context*, LinkInfo );
+uint8 DtvccWindowProcNextBuffer( void*, Buffer* );
+uint8 DtvccWindowShutdown( void* );
+
+#endif /* dtvcc_window_h */
@@ -39,6 +39,10 @@
 #define LINE21_CHANNEL_1_3                                                   5
 #define LINE21_CHANNEL_2_4                                                   6
 
+#define DECODE_ALL_CHANNELS                                                  0
+#define LINE21_FIELD_1_CHANNELS                                           0x03
+#define LINE21_FIELD_2_CHANNELS                                           0x0C
+
 #define LINE21_CODE_TYPE_UNKNOWN                                             0
 #define LINE21_NULL_DATA                                                     1
 #define LINE21_BASIC_CHARS                                                   2
@@ -49,6 +53,10 @@
 #define LINE21_TAB_CONTROL_CODE                                              7
 #define LINE21_MID_ROW_CONTROL_CODE                                          8
 
+#define LINE21_CODE_TABLE_SIZE                                          0x4000
+
+#define LINE21_EVENT_INLINE_CODE_SIZE                                        2
+
 //-----------------------------------------------------------------------------
 //
 //                              Character Sets
@@ -154,6 +162,7 @@
 #define SPCL_NA_CHAR_SET_CH_2_4                                          0x19
 
 #define SPCL_NA_CHAR_MASK                                                0x0F
+#define SPCL_NA_CHAR_TRANSPARENT_SPACE                                   0x09
 #define SPCL_NA_CHAR_SET_MASK                                            0x3F
 
 //-----------------------------------------------------------------------------
@@ -224,6 +233,7 @@
 #define EXT_W_EURO_CHAR_SET_MASK                                         0x3F
 
 #define EXT_W_EURO_CHAR_SET_TOGGLE_MASK                                  0x10
+#define EXT_W_EURO_CHAR_SET_FG_BIT                                       0x01
 
 //-----------------------------------------------------------------------------
 //
@@ -396,6 +406,8 @@
 #define PAC_STYLE_ADDR_MASK                                                0x10
 #define PAC_ADDRESS_SET                                                    0x10
 
+#define PAC_SECOND_BYTE_MASK                                               0x40
+
 #define PAC_ROW_1                                                          0x02
 #define PAC_ROW_2                                                          0x03
 #define PAC_ROW_3                                                          0x04
@@ -414,6 +426,7 @@
 
 #define PAC_ROW_UNKNOWN                                                    0x01
 #define PAC_ROW_POS_MASK                                                   0x07
+#define PAC_NUM_ROW_CODES                                                    16
 
 #define FG_COLOR_WHITE                                                     0x00
 #define FG_COLOR_GREEN                                                     0x02
@@ -605,10 +618,26 @@ typedef struct {
     } code;
 } Line21Code;
 
+// A Line 21 Code as it is carried down the pipeline in a BUFFER_TYPE_LINE_21 buffer. The first
+// bytes of the code travel in the header, and only Extended Characters, PACs and Mid-Row Codes
+// are followed by the rest of their code.
+typedef struct {
+    uint8 codeType;
+    uint8 fieldChannel;                      // Field Number in the upper nibble, Channel in the lower
+    uint8 code[LINE21_EVENT_INLINE_CODE_SIZE];
+} Line21Event;
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
 
+#define LINE21_CODE_TABLE_INDEX(d1, d2)  ((((d1) & LINE_21_PARITY_MASK) << 7) | ((d2) & LINE_21_PARITY_MASK))
+#define PAC_ROW_CODE(d1, d2)             ((((d1) & PAC_ROW_POS_MASK) << 1) | (((d2) & PAC_WHICH_ROW_MASK) >> 5))
+#define LINE21_MAX_CODES_PER_BUFFER(n)   (((n) + 2) / 3)
+#define LINE21_CHANNEL_SELECT(chan)      ((uint8)1 << ((chan) - 1))
+#define LINE21_EVENT_MAX_SIZE            (sizeof(Line21Event) + sizeof(PreambleAccessCodeType) - LINE21_EVENT_INLINE_CODE_SIZE)
+#define LINE21_MAX_EVENT_BYTES(n)        (LINE21_MAX_CODES_PER_BUFFER(n) * LINE21_EVENT_MAX_SIZE)
+
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
 /*----------------------------------------------------------------------------*/
@@ -617,10 +646,12 @@ typedef struct {
 /*--                           Exposed Methods                              --*/
 /*----------------------------------------------------------------------------*/
 
-LinkInfo Line21DecodeInitialize( Context*, boolean );
+LinkInfo Line21DecodeInitialize( Context*, boolean, uint8 );
 boolean Line21DecodeAddSink( Context*, LinkInfo );
 uint8 Line21DecodeProcNextBuffer( void*, Buffer* );
 uint8 Line21DecodeShutdown( void* );
 uint8 Line21PacDecodeRow( uint8, uint8 );
+boolean Line21DecodeAddEvent( Buffer*, Line21Code* );
+boolean Line21DecodeNextEvent( Buffer*, uint16*, Line21Code* );
 
 #endif /* line21_decode_h */
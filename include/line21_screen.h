@@ -0,0 +1,62 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef line21_screen_h
+#define line21_screen_h
+
+#include "types.h"
+#include "pipeline_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+#define LINE21_SCREEN_MODE_UNKNOWN                           0
+#define LINE21_SCREEN_MODE_POP_ON                            1
+#define LINE21_SCREEN_MODE_ROLL_UP                           2
+#define LINE21_SCREEN_MODE_PAINT_ON                          3
+#define LINE21_SCREEN_MODE_TEXT                              4
+
+#define LINE21_SCREEN_DEFAULT_BASE_ROW                      15
+#define LINE21_SCREEN_NO_CONTROL_CODE                        0
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+// Packs the code type and up to three fields of a control code, so a repeat can be spotted with one compare
+#define LINE21_CONTROL_SIGNATURE(type, a, b, c)  (((uint32)(type) << 24) | ((uint32)(a) << 16) | ((uint32)(b) << 8) | (uint32)(c))
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+LinkInfo Line21ScreenInitialize( Context* );
+boolean Line21ScreenAddSink( Context*, LinkInfo );
+uint8 Line21ScreenProcNextBuffer( void*, Buffer* );
+uint8 Line21ScreenShutdown( void* );
+
+#endif /* line21_screen_h */
@@ -48,10 +48,23 @@
 #define CDP_FRAME_RATE_59_94             0x07
 #define CDP_FRAME_RATE_60                0x08
 
+#define MCC_CHAR_SPURIOUS                0x00
+#define MCC_CHAR_HEX_DIGIT               0x01
+#define MCC_CHAR_EXPANSION_CODE          0x02
+#define MCC_CHAR_UNDEFINED_CODE          0x03
+#define MCC_CHAR_LINE_END                0x04
+
+#define MCC_MAX_EXPANSION_BYTES          4
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
 
+#define MCC_HEX_DIGIT(value)             { MCC_CHAR_HEX_DIGIT, (value), 0, 0, { 0 } }
+#define MCC_EXPANSION(repeats, num, ...) { MCC_CHAR_EXPANSION_CODE, 0, (repeats), (num), { __VA_ARGS__ } }
+#define MCC_UNDEFINED_CODE               { MCC_CHAR_UNDEFINED_CODE, 0, 0, 0, { 0 } }
+#define MCC_LINE_END                     { MCC_CHAR_LINE_END, 0, 0, 0, { 0 } }
+
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
 /*----------------------------------------------------------------------------*/
@@ -146,6 +159,25 @@ typedef struct {
     uint8 cs;   // Checksum
 } ANC_packet;
 
+typedef struct {
+    uint8 charType;                          // MCC_CHAR_*
+    uint8 nibble;                            // Value of a Hex Digit
+    uint8 numRepeats;                        // Times the expansion is repeated
+    uint8 numBytes;                          // Bytes in a single expansion
+    uint8 bytes[MCC_MAX_EXPANSION_BYTES];
+} MccCharCode;
+
+typedef struct {
+    char* mccChars;
+    uint16 numChars;
+    uint16 charIndex;
+    const MccCharCode* codePtr;              // Expansion in progress, if any
+    uint8 codeByteIndex;
+    uint8 codeRepeatsLeft;
+    boolean isExhausted;
+    CaptionTime* captionTimePtr;
+} MccLineReader;
+
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
 /*----------------------------------------------------------------------------*/
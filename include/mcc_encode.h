@@ -25,6 +25,9 @@
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 
+#define MCC_ANC_PACKET_OVERHEAD          17
+#define MCC_MAX_ANC_PACKET_SIZE          (MCC_ANC_PACKET_OVERHEAD + (3 * 0x1F))
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
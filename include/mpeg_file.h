@@ -35,11 +35,16 @@
 
 #include "types.h"
 #include "pipeline_utils.h"
+#include "block_reader.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 
+/* Size of each read of the input file, and of the buffer FFMPEG reads through */
+#define MPEG_FILE_READ_BLOCK_SIZE              BLOCK_READER_DEFAULT_BLOCK_SIZE
+#define MPEG_FILE_IO_BUFFER_SIZE               (256*1024)
+
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
 /*----------------------------------------------------------------------------*/
@@ -27,7 +27,8 @@
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 
-#define MAX_NUM_OUTPUT_FILES          25
+// Three files for each of the 63 DTVCC Services and 4 Line 21 Channels, plus the single file outputs
+#define MAX_NUM_OUTPUT_FILES         220
 
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
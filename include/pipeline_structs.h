@@ -27,7 +27,8 @@
 /*--                               Constants                                --*/
 /*----------------------------------------------------------------------------*/
 
-#define MAX_NUMBER_OF_SINKS                             5
+#define INITIAL_NUMBER_OF_SINKS                         2
+#define MAX_NUMBER_OF_SINKS                           255
 
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
@@ -44,7 +45,8 @@ typedef struct {
 typedef struct {
     uint8 linkType;
     uint8 numSinks;
-    LinkInfo sink[MAX_NUMBER_OF_SINKS];
+    uint8 maxSinks;                             // Number of sinks there is room for in the list
+    LinkInfo* sink;                             // Grown by AddSink(), freed by ShutdownSinks()
 } Sinks;
 
 /*----------------------------------------------------------------------------*/
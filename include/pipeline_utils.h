@@ -44,7 +44,10 @@
 #define DATA_TYPE_708_TXT_FILE                         10
 #define DATA_TYPE_MCC_DATA_TXT_FILE                    11
 #define DATA_TYPE_EXTERNAL_ADAPTOR                     12
-#define MAX_DATA_TYPE                                  13
+#define DATA_TYPE_CAPTION_CUE                          13
+#define DATA_TYPE_SUBTITLE_FILE                        14
+#define DATA_TYPE_CC_DATA_FILE                         15
+#define MAX_DATA_TYPE                                  16
 
 // WARNING: These defines need to match the text in pipeline_utils.c
 
@@ -70,18 +73,95 @@
 #define LINE21_DATA___EXTRNL_ADPTR                     14
 #define DTVCC_DATA___EXTRNL_ADPTR                      15
 
-#define MAX_LINK_TYPE                                  16
+// Transforms:
+#define LINE21_DATA___CAPTION_CUE                      16
+
+// Sinks:
+#define CAPTION_CUE___SUBTITLE_FILE                    17
+
+// Transforms:
+#define DTVCC_DATA___CAPTION_CUE                       18
+
+// Sources:
+#define CCD_FILE___CC_DATA                             19
+
+// Sinks:
+#define CC_DATA___CCD_FILE                             20
+
+#define MAX_LINK_TYPE                                  21
+
+// WARNING: These defines need to match the elements in pipeline_utils.c
+
+#define PIPELINE_ELEMENT_NONE                           0
+#define PIPELINE_ELEMENT_SCC_FILE                       1
+#define PIPELINE_ELEMENT_MCC_FILE                       2
+#define PIPELINE_ELEMENT_MPEG_FILE                      3
+#define PIPELINE_ELEMENT_MOV_FILE                       4
+#define PIPELINE_ELEMENT_CC_DATA_FILE                   5
+#define PIPELINE_ELEMENT_SCC_ENCODE                     6
+#define PIPELINE_ELEMENT_MCC_DECODE                     7
+#define PIPELINE_ELEMENT_MCC_ENCODE                     8
+#define PIPELINE_ELEMENT_LINE21_DECODE                  9
+#define PIPELINE_ELEMENT_DTVCC_DECODE                  10
+#define PIPELINE_ELEMENT_LINE21_SCREEN                 11
+#define PIPELINE_ELEMENT_DTVCC_WINDOW                  12
+#define PIPELINE_ELEMENT_MCC_OUTPUT                    13
+#define PIPELINE_ELEMENT_LINE21_OUTPUT                 14
+#define PIPELINE_ELEMENT_DTVCC_OUTPUT                  15   // Timestamps in Frames
+#define PIPELINE_ELEMENT_DTVCC_OUTPUT_MS               16   // Timestamps in Milliseconds
+#define PIPELINE_ELEMENT_CUE_OUTPUT                    17
+#define PIPELINE_ELEMENT_CC_DATA_OUTPUT                18
+#define PIPELINE_ELEMENT_CACHE_OUTPUT                  19
+#define PIPELINE_ELEMENT_EXTERNAL                      20   // Sink supplied by the caller of BuildPipeline()
+#define MAX_PIPELINE_ELEMENT                           21
+
+#define PIPELINE_MAX_NODES                             16
+#define PIPELINE_PARALLEL_SINK_THREADS                  3   // The most sinks run at once for a buffer in any pipeline, -j may lower it
+
+// Not a selectable output. BuildPipeline() asks for it when none of the decoded outputs
+// would be written, so that the decoders still find out whether the asset is captioned.
+#define PIPELINE_OUTPUT_DETECT                       0x10
 
 /*----------------------------------------------------------------------------*/
 /*--                              Structures                                --*/
 /*----------------------------------------------------------------------------*/
 
+// One buffer being passed to every sink in a list, with what each of the sinks returned
+typedef struct {
+    Context* ctxPtr;
+    Buffer* buffPtr;
+    Sinks* sinks;
+    char* basename;                             // Of the file which passed the buffer, for the logs
+    int lineNum;
+    uint8 results[MAX_NUMBER_OF_SINKS];
+} SinkPass;
+
+typedef struct {
+    uint8 element;                              // PIPELINE_ELEMENT_* plumbed by this node
+    uint8 parent;                               // PIPELINE_ELEMENT_* feeding this node, or PIPELINE_ELEMENT_NONE for the Source
+    uint8 neededFor;                            // PIPELINE_OUTPUT_* which need this node, whether or not it has sinks
+    LinkInfo* linkInfoPtr;                      // Only for PIPELINE_ELEMENT_EXTERNAL
+} PipelineNode;
+
+typedef struct {
+    const char* name;
+    uint8 sourceType;                           // DATA_TYPE_* consumed, DATA_TYPE_UNKNOWN for a Source
+    uint8 sinkType;                             // DATA_TYPE_* produced
+    boolean (*SourceInitFnPtr)(Context*);
+    LinkInfo (*InitFnPtr)(Context*, boolean);   // The boolean is whether any sinks will be added
+    boolean (*AddSinkFnPtr)(Context*, LinkInfo);
+} PipelineElement;
+
 /*----------------------------------------------------------------------------*/
 /*--                                Macros                                  --*/
 /*----------------------------------------------------------------------------*/
 
 #define PassToSinks(ctx, buf, snk) _PassToSinks(__FILE__, __LINE__, ctx, buf, snk)
+#define PassFrameToSinks(ctx, fb, ct, dat, sz, snk) _PassFrameToSinks(__FILE__, __LINE__, ctx, fb, ct, dat, sz, snk)
+#define FlushFramesToSinks(ctx, fb, snk) _FlushFramesToSinks(__FILE__, __LINE__, ctx, fb, snk)
+#define PassFrameRefToSinks(ctx, fb, ct, dat, sz, ref, fn, snk) _PassFrameRefToSinks(__FILE__, __LINE__, ctx, fb, ct, dat, sz, ref, fn, snk)
 #define ShutdownSinks(ctx, snk) _ShutdownSinks(__FILE__, __LINE__, ctx, snk)
+#define PIPELINE_GRAPH_SIZE(graph) ((uint8)(sizeof(graph) / sizeof(PipelineNode)))
 
 /*----------------------------------------------------------------------------*/
 /*--                          Exposed Variables                             --*/
@@ -94,11 +174,16 @@
 void InitSinks(Sinks*, uint8);
 boolean AddSink(Sinks*, LinkInfo*);
 uint8 _PassToSinks(char*, int, Context*, Buffer*, Sinks*);
+uint8 _PassFrameToSinks(char*, int, Context*, Buffer**, CaptionTime*, uint8*, uint16, Sinks*);
+uint8 _FlushFramesToSinks(char*, int, Context*, Buffer**, Sinks*);
+uint8 _PassFrameRefToSinks(char*, int, Context*, Buffer**, CaptionTime*, uint8*, uint16, void*, BufferReleaseFnPtr, Sinks*);
 uint8 _ShutdownSinks(char*, int, Context*, Sinks*);
+boolean BuildPipeline(Context*, const PipelineNode*, uint8, uint8);
 boolean PlumbSccPipeline(Context*);
 boolean PlumbMccPipeline(Context*);
 boolean PlumbMpegPipeline(Context*);
 boolean PlumbMovPipeline(Context*);
+boolean PlumbCcDataPipeline(Context*);
 void DrivePipeline(FileType, Context*);
 
 #endif /* pipeline_utils_h */
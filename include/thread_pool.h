@@ -0,0 +1,69 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef thread_pool_h
+#define thread_pool_h
+
+#include <pthread.h>
+
+#include "types.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+#define THREAD_POOL_MAX_THREADS                  32
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+// Runs a single task of a batch; the index identifies which task of the batch it is
+typedef void (*ThreadPoolTaskFnPtr)( void*, uint32 );
+
+typedef struct {
+    pthread_t threads[THREAD_POOL_MAX_THREADS];
+    uint8 numThreads;
+    pthread_mutex_t mutex;
+    pthread_cond_t workReady;
+    pthread_cond_t workDone;
+    ThreadPoolTaskFnPtr taskFnPtr;
+    void* taskArgPtr;
+    uint32 numTasks;
+    uint32 nextTask;
+    uint32 numTasksDone;
+    boolean isShuttingDown;
+} ThreadPool;
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+ThreadPool* ThreadPoolCreate( uint8 );
+void ThreadPoolRun( ThreadPool*, ThreadPoolTaskFnPtr, void*, uint32 );
+void ThreadPoolDestroy( ThreadPool* );
+
+#endif /* thread_pool_h */
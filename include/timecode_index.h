@@ -0,0 +1,66 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef timecode_index_h
+#define timecode_index_h
+
+#include "types.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                               Constants                                --*/
+/*----------------------------------------------------------------------------*/
+
+/* The first line after each run of this many bytes is indexed, so a lookup leaves little more to read */
+#define TIME_CODE_INDEX_SPACING_BYTES            4096
+#define TIME_CODE_INDEX_INITIAL_ENTRIES          1024
+
+/*----------------------------------------------------------------------------*/
+/*--                              Structures                                --*/
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+    uint32 timeInMs;
+    long fileOffset;
+} TimeCodeIndexEntry;
+
+typedef struct {
+    long firstLinePos;
+    uint32 numEntries;
+    uint32 maxEntries;
+    TimeCodeIndexEntry* entriesPtr;
+} TimeCodeIndex;
+
+/*----------------------------------------------------------------------------*/
+/*--                                Macros                                  --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                          Exposed Variables                             --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                           Exposed Methods                              --*/
+/*----------------------------------------------------------------------------*/
+
+TimeCodeIndex* TimeCodeIndexBuild( char*, long, uint32 );
+TimeCodeIndex* TimeCodeIndexNew( long );
+void TimeCodeIndexAdd( TimeCodeIndex*, uint32, long );
+void TimeCodeIndexLookup( TimeCodeIndex*, uint32, long*, long* );
+void TimeCodeIndexFree( TimeCodeIndex* );
+
+#endif /* timecode_index_h */
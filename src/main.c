@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <time.h>
 
 #include "debug.h"
@@ -26,6 +27,9 @@
 #include "mpeg_file.h"
 #include "mov_file.h"
 #include "output_utils.h"
+#include "line21_decode.h"
+#include "dtvcc_decode.h"
+#include "thread_pool.h"
 #include "getopt.h"
 #include "version.h"
 
@@ -49,10 +53,13 @@ static struct timespec startTime;
 
 static void printHelp( void );
 static void printVersion();
+static boolean parseSelection( const char*, uint8, uint64* );
+static boolean parseOutputs( const char*, uint8* );
+static boolean parseTime( const char*, uint32* );
 
 static char* executibleName;
  
-static const char *optString = "o:f:b:d:phv?";
+static const char *optString = "o:f:b:d:j:c:s:phv?";
 
 static struct option longOpts[] = {
     { "output",           required_argument, NULL, 'o' },
@@ -64,6 +71,16 @@ static struct option longOpts[] = {
     { "match-pts",        no_argument,       NULL, 'p' },
     { "bail_no_captions", required_argument, NULL, 'b' },
     { "dropframe",        required_argument, NULL, 'd' },
+    { "threads",          required_argument, NULL, 'j' },
+    { "channels",         required_argument, NULL, 'c' },
+    { "services",         required_argument, NULL, 's' },
+    { "outputs",          required_argument, NULL, 0 },
+    { "parallel-sinks",   no_argument,       NULL, 0 },
+    { "frames-per-buffer", required_argument, NULL, 0 },
+    { "planar-cc-data",   no_argument,       NULL, 0 },
+    { "fast-decode",      no_argument,       NULL, 0 },
+    { "start",            required_argument, NULL, 0 },
+    { "end",              required_argument, NULL, 0 },
     { 0, no_argument, NULL, 0 }
 };
 
@@ -102,6 +119,16 @@ int main( int argc, char* argv[] ) {
     ctx.config.matchPtsTime = FALSE;
     ctx.config.bailAfterMins = 0;
     ctx.config.forceDropframe = FALSE;
+    ctx.config.numThreads = 1;
+    ctx.config.decodeWhichChannels = DECODE_ALL_CHANNELS;
+    ctx.config.decodeWhichServices = DECODE_ALL_SERVICES;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
+    ctx.config.parallelSinks = FALSE;
+    ctx.config.framesPerBuffer = 1;
+    ctx.config.planarCcData = FALSE;
+    ctx.config.fastDecode = FALSE;
+    ctx.config.startTimeMs = 0;
+    ctx.config.endTimeMs = 0;
 
     ctx.stats.captionText608Found = FALSE;
     ctx.stats.captionText708Found = FALSE;
@@ -132,6 +159,38 @@ int main( int argc, char* argv[] ) {
                     ctx.config.debugFile = FALSE;
                 } else if( strcmp( "no-artifacts", longOpts[longIndex].name ) == 0 ) {
                     ctx.config.artifacts = FALSE;
+                } else if( strcmp( "outputs", longOpts[longIndex].name ) == 0 ) {
+                    if( parseOutputs(optarg, &ctx.config.outputs) == FALSE ) {
+                        printf("ERROR: Invalid Output List: %s\n", optarg);
+                        printHelp();
+                        exit(EXIT_FAILURE);
+                    }
+                } else if( strcmp( "parallel-sinks", longOpts[longIndex].name ) == 0 ) {
+                    ctx.config.parallelSinks = TRUE;
+                } else if( strcmp( "frames-per-buffer", longOpts[longIndex].name ) == 0 ) {
+                    long framesPerBuffer = strtol(optarg, NULL, 10);
+                    if( (framesPerBuffer < 1) || (framesPerBuffer > MAX_FRAMES_PER_BUFFER) ) {
+                        printf("ERROR: Invalid Frames per Buffer: %s\n", optarg);
+                        printHelp();
+                        exit(EXIT_FAILURE);
+                    }
+                    ctx.config.framesPerBuffer = (uint16)framesPerBuffer;
+                } else if( strcmp( "planar-cc-data", longOpts[longIndex].name ) == 0 ) {
+                    ctx.config.planarCcData = TRUE;
+                } else if( strcmp( "fast-decode", longOpts[longIndex].name ) == 0 ) {
+                    ctx.config.fastDecode = TRUE;
+                } else if( strcmp( "start", longOpts[longIndex].name ) == 0 ) {
+                    if( parseTime(optarg, &ctx.config.startTimeMs) == FALSE ) {
+                        printf("ERROR: Invalid Start Time: %s\n", optarg);
+                        printHelp();
+                        exit(EXIT_FAILURE);
+                    }
+                } else if( strcmp( "end", longOpts[longIndex].name ) == 0 ) {
+                    if( parseTime(optarg, &ctx.config.endTimeMs) == FALSE ) {
+                        printf("ERROR: Invalid End Time: %s\n", optarg);
+                        printHelp();
+                        exit(EXIT_FAILURE);
+                    }
                 } else {
                     printHelp();
                     exit(EXIT_FAILURE);
@@ -161,6 +220,33 @@ int main( int argc, char* argv[] ) {
             case 'b' :
                  ctx.config.bailAfterMins = (uint8)strtol(optarg, NULL, 10);
                  break;
+            case 'j' : {
+                 long numThreads = strtol(optarg, NULL, 10);
+                 if( (numThreads < 1) || (numThreads > THREAD_POOL_MAX_THREADS) ) {
+                     printf("ERROR: Invalid Number of Threads: %s\n", optarg);
+                     printHelp();
+                     exit(EXIT_FAILURE);
+                 }
+                 ctx.config.numThreads = (uint8)numThreads;
+                 break;
+            }
+            case 'c' : {
+                 uint64 selection;
+                 if( parseSelection(optarg, LINE21_MAX_NUM_CHANNELS, &selection) == FALSE ) {
+                     printf("ERROR: Invalid Channel List: %s\n", optarg);
+                     printHelp();
+                     exit(EXIT_FAILURE);
+                 }
+                 ctx.config.decodeWhichChannels = (uint8)selection;
+                 break;
+            }
+            case 's' :
+                 if( parseSelection(optarg, DTVCC_MAX_NUM_SERVICES, &ctx.config.decodeWhichServices) == FALSE ) {
+                     printf("ERROR: Invalid Service List: %s\n", optarg);
+                     printHelp();
+                     exit(EXIT_FAILURE);
+                 }
+                 break;
             default:
                  printHelp();
                  exit(EXIT_FAILURE);
@@ -171,6 +257,12 @@ int main( int argc, char* argv[] ) {
         ctx.config.inputFilename = argv[optind];
     }
 
+    if( (ctx.config.endTimeMs != 0) && (ctx.config.endTimeMs <= ctx.config.startTimeMs) ) {
+        printf("ERROR: End Time must be after the Start Time!\n");
+        printHelp();
+        exit(EXIT_FAILURE);
+    }
+
     if( ctx.config.inputFilename == NULL ) {
         printf("ERROR: Please supply an input file name!\n");
         printHelp();
@@ -201,6 +293,45 @@ int main( int argc, char* argv[] ) {
         LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Bail if no Captions before %d mins of Asset", ctx.config.bailAfterMins);
     }
 
+    if( ctx.config.numThreads > 1 ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Decoding with %d Threads", ctx.config.numThreads);
+    }
+
+    if( ctx.config.parallelSinks == TRUE ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Running Sinks in Parallel");
+    }
+
+    if( ctx.config.framesPerBuffer > 1 ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Passing up to %d Frames per Buffer", ctx.config.framesPerBuffer);
+    }
+
+    if( ctx.config.planarCcData == TRUE ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Splitting Caption Data into Planes for the Decoders");
+    }
+
+    if( ctx.config.fastDecode == TRUE ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Decoding Video with Fast Decode");
+    }
+
+    if( (ctx.config.startTimeMs != 0) || (ctx.config.endTimeMs != 0) ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Processing from %d ms to %d ms of Asset (0 is the End)", ctx.config.startTimeMs, ctx.config.endTimeMs);
+    }
+
+    if( ctx.config.decodeWhichChannels != DECODE_ALL_CHANNELS ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Decoding Line 21 Channel Mask: 0x%X", ctx.config.decodeWhichChannels);
+    }
+
+    if( ctx.config.decodeWhichServices != DECODE_ALL_SERVICES ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Decoding DTVCC Service Mask: 0x%llX", ctx.config.decodeWhichServices);
+    }
+
+    if( ctx.config.outputs != PIPELINE_OUTPUT_ALL ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Selected Outputs:%s%s%s%s%s%s", (ctx.config.outputs == PIPELINE_OUTPUT_NONE) ? " None" : "",
+            (ctx.config.outputs & PIPELINE_OUTPUT_MCC) ? " MCC" : "", (ctx.config.outputs & PIPELINE_OUTPUT_608) ? " 608" : "",
+            (ctx.config.outputs & PIPELINE_OUTPUT_708) ? " 708" : "", (ctx.config.outputs & PIPELINE_OUTPUT_CCD) ? " CCD" : "",
+            (ctx.config.outputs & PIPELINE_OUTPUT_CACHE) ? " Cache" : "");
+    }
+
     clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &startTime);
 
     FileType sourceType = DetermineFileType(ctx.config.inputFilename);
@@ -231,6 +362,9 @@ int main( int argc, char* argv[] ) {
         case MOV_BINARY_FILE:
             retval = PlumbMovPipeline(&ctx);
             break;
+        case CC_DATA_BINARY_FILE:
+            retval = PlumbCcDataPipeline(&ctx);
+            break;
         default:
             LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Impossible Branch - %d", sourceType);
     }
@@ -329,10 +463,130 @@ static void printHelp( void ) {
     printf("    -f|--framerate <num>         : Framerate * 100 (e.g. 3000, 2997). This is a requirement for SCC Files.\n");
     printf("    -b|--bail_no_captions <mins> : Bail if no captions are found x minutes into the asset.\n");
     printf("    -d|--dropframe <true/false>  : Force asset to be either dropframe or no dropframe.\n");
+    printf("    -j|--threads <num>           : Threads to decode MCC Files, --fast-decode video and run --parallel-sinks (at most %d) with, 1-%d (default 1 for MCC, automatic for video, %d for sinks).\n",
+           PIPELINE_PARALLEL_SINK_THREADS, THREAD_POOL_MAX_THREADS, PIPELINE_PARALLEL_SINK_THREADS);
+    printf("    -c|--channels <list>         : Only decode these Line 21 Channels (e.g. 1,3). Default is all.\n");
+    printf("    -s|--services <list>         : Only decode these DTVCC Services (e.g. 1,2). Default is all.\n");
     printf("    --no-debug                   : Don't create a debug file.\n");
     printf("    --no-artifacts               : Don't create artifact files.\n");
+    printf("    --outputs <list>             : Only create these outputs: mcc,608,708,ccd,cache or none (default all but cache).\n");
+    printf("    --parallel-sinks             : Run the sinks which share each buffer in parallel.\n");
+    printf("    --frames-per-buffer <num>    : Pass up to this many frames of captions down the pipeline at once (default 1).\n");
+    printf("    --planar-cc-data             : Split the captions by Line 21 Field and DTVCC once, for the decoders to read.\n");
+    printf("    --fast-decode                : Decode video as cheaply as possible, threaded and without picture detail.\n");
+    printf("    --start <time>               : Seek to this time ([[HH:]MM:]SS[.mmm]) and start processing there.\n");
+    printf("    --end <time>                 : Stop processing at this time ([[HH:]MM:]SS[.mmm]). Default is the end of the asset.\n");
 }  // printHelp()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    parseSelection()
+ |
+ | DESCRIPTION:
+ |    This function turns a comma separated list of Channel or Service numbers
+ |    (e.g. "1,3") into a mask with a bit set for each of them, where bit 0 is
+ |    number 1. It returns FALSE if any entry is not a number from 1 to maxNum.
+ -------------------------------------------------------------------------------*/
+static boolean parseSelection( const char* listStr, uint8 maxNum, uint64* selectionPtr ) {
+    const char* posPtr = listStr;
+    *selectionPtr = 0;
+
+    while( *posPtr != '\0' ) {
+        char* endPtr;
+        long number = strtol(posPtr, &endPtr, 10);
+        if( (endPtr == posPtr) || (number < 1) || (number > maxNum) ) return FALSE;
+        *selectionPtr = *selectionPtr | ((uint64)1 << (number - 1));
+        if( *endPtr == ',' ) {
+            endPtr++;
+        } else if( *endPtr != '\0' ) {
+            return FALSE;
+        }
+        posPtr = endPtr;
+    }
+
+    return (*selectionPtr != 0) ? TRUE : FALSE;
+}  // parseSelection()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    parseOutputs()
+ |
+ | DESCRIPTION:
+ |    This function turns a comma separated list of outputs (e.g. "mcc,708")
+ |    into the mask of outputs to plumb the pipeline for. It returns FALSE if
+ |    any entry is not a known output.
+ -------------------------------------------------------------------------------*/
+static boolean parseOutputs( const char* listStr, uint8* outputsPtr ) {
+    char tmpStr[MAX_FILE_NAME_LEN];
+    char* savePtr;
+
+    if( strlen(listStr) >= MAX_FILE_NAME_LEN ) return FALSE;
+    strcpy(tmpStr, listStr);
+    *outputsPtr = PIPELINE_OUTPUT_NONE;
+
+    for( char* tokenPtr = strtok_r(tmpStr, ",", &savePtr); tokenPtr != NULL; tokenPtr = strtok_r(NULL, ",", &savePtr) ) {
+        if( strcmp("mcc", tokenPtr) == 0 ) {
+            *outputsPtr = *outputsPtr | PIPELINE_OUTPUT_MCC;
+        } else if( strcmp("608", tokenPtr) == 0 ) {
+            *outputsPtr = *outputsPtr | PIPELINE_OUTPUT_608;
+        } else if( strcmp("708", tokenPtr) == 0 ) {
+            *outputsPtr = *outputsPtr | PIPELINE_OUTPUT_708;
+        } else if( strcmp("ccd", tokenPtr) == 0 ) {
+            *outputsPtr = *outputsPtr | PIPELINE_OUTPUT_CCD;
+        } else if( strcmp("cache", tokenPtr) == 0 ) {
+            *outputsPtr = *outputsPtr | PIPELINE_OUTPUT_CACHE;
+        } else if( strcmp("none", tokenPtr) != 0 ) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}  // parseOutputs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    parseTime()
+ |
+ | DESCRIPTION:
+ |    This function turns a time into milliseconds from the start of the asset.
+ |    The time is given as [[HH:]MM:]SS[.mmm] (e.g. "1:05:30", "90.5"). It
+ |    returns FALSE if the time is malformed.
+ -------------------------------------------------------------------------------*/
+static boolean parseTime( const char* timeStr, uint32* timeInMsPtr ) {
+    const char* posPtr = timeStr;
+    uint64 timeInMs = 0;
+    uint8 numFields = 0;
+
+    while( TRUE ) {
+        char* endPtr;
+        if( (*posPtr < '0') || (*posPtr > '9') ) return FALSE;
+        unsigned long number = strtoul(posPtr, &endPtr, 10);
+        if( (numFields != 0) && (number >= 60) ) return FALSE;
+        if( number > (UINT32_MAX / 1000) ) return FALSE;   // Also catches strtoul() saturating on overflow
+        timeInMs = (timeInMs * 60) + ((uint64)number * 1000);
+        numFields++;
+        if( (*endPtr == ':') && (numFields < 3) ) {
+            posPtr = endPtr + 1;
+        } else if( *endPtr == '.' ) {
+            uint32 scale = 100;
+            for( posPtr = endPtr + 1; (*posPtr >= '0') && (*posPtr <= '9'); posPtr++ ) {
+                timeInMs = timeInMs + ((*posPtr - '0') * scale);
+                scale = scale / 10;
+            }
+            if( (posPtr == endPtr + 1) || (*posPtr != '\0') ) return FALSE;
+            break;
+        } else if( *endPtr == '\0' ) {
+            break;
+        } else {
+            return FALSE;
+        }
+    }
+
+    if( timeInMs > UINT32_MAX ) return FALSE;
+    *timeInMsPtr = (uint32)timeInMs;
+    return TRUE;
+}  // parseTime()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    printVersion()
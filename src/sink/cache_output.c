@@ -0,0 +1,380 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "debug.h"
+
+#include "cache_output.h"
+#include "cc_data_file.h"
+#include "output_utils.h"
+#include "cc_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static boolean openCacheFile( CacheOutputCtx*, CaptionTime* );
+static void writeFrame( CacheOutputCtx*, CaptionTime*, uint8*, uint16 );
+static void writeFillRun( CacheOutputCtx*, CaptionTime*, FillRun* );
+static void flushPaddingRun( CacheOutputCtx* );
+static void writeRecord( CacheOutputCtx*, uint8*, uint16, uint32 );
+static uint16 putTime( uint8*, CaptionTime* );
+static boolean isSameTime( CaptionTime*, CaptionTime* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CacheOutInitialize()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    LinkInfo -  Information about this element of the pipeline, such that it can
+ |                be chained to elements that can consume the specific type of data
+ |                that it produces.
+ |
+ | DESCRIPTION:
+ |    This initializes this element of the pipeline.
+ -------------------------------------------------------------------------------*/
+LinkInfo CacheOutInitialize( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(!rootCtxPtr->cacheOutputCtxPtr);
+
+    rootCtxPtr->cacheOutputCtxPtr = malloc(sizeof(CacheOutputCtx));
+    CacheOutputCtx* ctxPtr = rootCtxPtr->cacheOutputCtxPtr;
+
+    ctxPtr->fp = NULL;
+    ctxPtr->filePos = 0;
+    ctxPtr->nextIndexPos = 0;
+    ctxPtr->timeCodeIndexPtr = NULL;
+    ctxPtr->numFramesWritten = 0;
+    ctxPtr->numPaddingFrames = 0;
+    ctxPtr->paddingCcCount = 0;
+    buildOutputPath(rootCtxPtr->config.inputFilename, rootCtxPtr->config.outputDirectory, CC_DATA_FILE_EXTENSION, ctxPtr->cacheFileName);
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = CC_DATA___CCD_FILE;
+    linkInfo.sourceType = DATA_TYPE_CC_DATA;
+    linkInfo.sinkType = DATA_TYPE_CC_DATA_FILE;
+    linkInfo.NextBufferFnPtr = &CacheOutProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &CacheOutShutdown;
+    return linkInfo;
+}  // CacheOutInitialize()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CacheOutProcNextBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Context Pointer.
+ |    buffPtr - Pointer to the buffer to process.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method processes an incoming buffer, writing the cc_data of each of
+ |    its frames into a binary CC Data File. Frames of nothing but padding are
+ |    gathered into runs, so the file holds little more than the captions.
+ -------------------------------------------------------------------------------*/
+uint8 CacheOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
+    ASSERT(buffPtr);
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->cacheOutputCtxPtr);
+    CacheOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->cacheOutputCtxPtr;
+
+    if( (ctxPtr->fp == NULL) && (openCacheFile(ctxPtr, &buffPtr->captionTime) == FALSE) ) {
+        FreeBuffer(buffPtr);
+        return PIPELINE_FAILURE;
+    }
+
+    if( buffPtr->bufferType == BUFFER_TYPE_FILL ) {
+        writeFillRun( ctxPtr, &buffPtr->captionTime, (FillRun*)buffPtr->dataPtr );
+    } else {
+        BufferFrame frame;
+        StartBufferFrames(buffPtr, &frame);
+        while( NextBufferFrame(buffPtr, &frame) == TRUE ) {
+            writeFrame( ctxPtr, &frame.captionTime, &buffPtr->dataPtr[frame.firstElement], frame.numElements );
+        }
+    }
+
+    FreeBuffer(buffPtr);
+    return PIPELINE_SUCCESS;
+} // CacheOutProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CacheOutShutdown()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Context Pointer.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is called when the previous element in the pipeline determines
+ |    that there is no more data coming down the pipline. The last Padding Run
+ |    is written, followed by the time index and the trailer which locates it.
+ -------------------------------------------------------------------------------*/
+uint8 CacheOutShutdown( void* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->cacheOutputCtxPtr);
+    CacheOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->cacheOutputCtxPtr;
+
+    if( ctxPtr->fp != NULL ) {
+        uint8 entry[CC_DATA_FILE_INDEX_ENTRY_SIZE];
+        uint8 trailer[CC_DATA_FILE_TRAILER_SIZE];
+
+        flushPaddingRun(ctxPtr);
+
+        uint32 indexPos = (uint32)ctxPtr->filePos;
+        for( uint32 loop = 0; loop < ctxPtr->timeCodeIndexPtr->numEntries; loop++ ) {
+            CC_DATA_FILE_PUT_32(&entry[0], ctxPtr->timeCodeIndexPtr->entriesPtr[loop].timeInMs);
+            CC_DATA_FILE_PUT_32(&entry[4], (uint32)ctxPtr->timeCodeIndexPtr->entriesPtr[loop].fileOffset);
+            fwrite(entry, 1, CC_DATA_FILE_INDEX_ENTRY_SIZE, ctxPtr->fp);
+        }
+
+        CC_DATA_FILE_PUT_32(&trailer[0], indexPos);
+        CC_DATA_FILE_PUT_32(&trailer[4], ctxPtr->timeCodeIndexPtr->numEntries);
+        CC_DATA_FILE_PUT_32(&trailer[8], ctxPtr->numFramesWritten);
+        memcpy(&trailer[12], CC_DATA_FILE_MAGIC, CC_DATA_FILE_MAGIC_SIZE);
+        fwrite(trailer, 1, CC_DATA_FILE_TRAILER_SIZE, ctxPtr->fp);
+
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "Cached %d Frames of CC Data in %ld Bytes with %d Index Entries: %s", ctxPtr->numFramesWritten,
+            (ctxPtr->filePos + (ctxPtr->timeCodeIndexPtr->numEntries * CC_DATA_FILE_INDEX_ENTRY_SIZE) + CC_DATA_FILE_TRAILER_SIZE),
+            ctxPtr->timeCodeIndexPtr->numEntries, ctxPtr->cacheFileName);
+        closeFile(ctxPtr->fp);
+        TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+    }
+
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->cacheOutputCtxPtr = NULL;
+    return PIPELINE_SUCCESS;
+} // CacheOutShutdown()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    openCacheFile()
+ |
+ | DESCRIPTION:
+ |    This creates the CC Data File and writes its header, taking the frame rate,
+ |    drop frame and source of the time from the first buffer to arrive.
+ -------------------------------------------------------------------------------*/
+static boolean openCacheFile( CacheOutputCtx* ctxPtr, CaptionTime* captionTimePtr ) {
+    uint8 header[CC_DATA_FILE_HEADER_SIZE];
+
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "Creating new CC Data File for Output: %s", ctxPtr->cacheFileName);
+    ctxPtr->fp = fileOutputInit(ctxPtr->cacheFileName);
+    if( ctxPtr->fp == NULL ) {
+        return FALSE;
+    }
+
+    memset(header, 0, CC_DATA_FILE_HEADER_SIZE);
+    memcpy(header, CC_DATA_FILE_MAGIC, CC_DATA_FILE_MAGIC_SIZE);
+    header[4] = CC_DATA_FILE_VERSION;
+    header[5] = captionTimePtr->source;
+    header[6] = captionTimePtr->dropframe;
+    CC_DATA_FILE_PUT_32(&header[8], captionTimePtr->frameRatePerSecTimesOneHundred);
+    fwrite(header, 1, CC_DATA_FILE_HEADER_SIZE, ctxPtr->fp);
+
+    ctxPtr->filePos = CC_DATA_FILE_HEADER_SIZE;
+    ctxPtr->nextIndexPos = CC_DATA_FILE_HEADER_SIZE;
+    ctxPtr->timeCodeIndexPtr = TimeCodeIndexNew(CC_DATA_FILE_HEADER_SIZE);
+    return TRUE;
+}  // openCacheFile()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeFrame()
+ |
+ | DESCRIPTION:
+ |    This writes a frame of cc_data, unless it carries nothing but padding. A
+ |    padding frame either extends the Padding Run being gathered, when it has
+ |    the same cc_data at the next time of the run, or starts a new one. Only
+ |    frames that will be read back exactly as they came in are gathered.
+ -------------------------------------------------------------------------------*/
+static void writeFrame( CacheOutputCtx* ctxPtr, CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements ) {
+    uint8 record[CC_DATA_FILE_MAX_RECORD_SIZE];
+    CcDataTriage triage;
+
+    if( (numElements == 0) || ((numElements % 3) != 0) || ((numElements / 3) > CC_DATA_FILE_MAX_CC_COUNT) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_FILE_OUT, "Unable to Cache Frame of %d Bytes of CC Data at %02d:%02d:%02d:%02d", numElements,
+            captionTimePtr->hour, captionTimePtr->minute, captionTimePtr->second, captionTimePtr->frame);
+        return;
+    }
+
+    uint8 ccCount = (uint8)(numElements / 3);
+    triageCcData(dataPtr, numElements, &triage);
+    boolean isPadding = (((triage.field1Mask | triage.field2Mask | triage.dtvccStartMask | triage.dtvccDataMask) == 0) &&
+                         (captionTimePtr->frameRatePerSecTimesOneHundred != 0)) ? TRUE : FALSE;
+
+    if( ctxPtr->numPaddingFrames != 0 ) {
+        if( (isPadding == TRUE) && (ccCount == ctxPtr->paddingCcCount) && (memcmp(dataPtr, ctxPtr->paddingData, numElements) == 0) ) {
+            CaptionTime nextTime;
+            frameTimeInRun(&ctxPtr->paddingTime, ctxPtr->numPaddingFrames, &nextTime);
+            if( isSameTime(&nextTime, captionTimePtr) == TRUE ) {
+                ctxPtr->numPaddingFrames++;
+                return;
+            }
+        }
+        flushPaddingRun(ctxPtr);
+    }
+
+    if( isPadding == TRUE ) {
+        ctxPtr->paddingTime = *captionTimePtr;
+        ctxPtr->paddingCcCount = ccCount;
+        memcpy(ctxPtr->paddingData, dataPtr, numElements);
+        ctxPtr->numPaddingFrames = 1;
+        return;
+    }
+
+    uint16 size = 0;
+    record[size++] = CC_DATA_RECORD_FRAME;
+    size = size + putTime(&record[size], captionTimePtr);
+    record[size++] = ccCount;
+    memcpy(&record[size], dataPtr, numElements);
+    size = size + numElements;
+    writeRecord(ctxPtr, record, size, captionTimeToMs(captionTimePtr));
+    ctxPtr->numFramesWritten++;
+}  // writeFrame()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeFillRun()
+ |
+ | DESCRIPTION:
+ |    This writes a run of fill frames, as passed by the SCC Encode, which is
+ |    read back as the same run rather than as frames of padding.
+ -------------------------------------------------------------------------------*/
+static void writeFillRun( CacheOutputCtx* ctxPtr, CaptionTime* captionTimePtr, FillRun* fillRunPtr ) {
+    uint8 record[1 + 4 + 4];
+    CaptionTime firstTime = *captionTimePtr;
+
+    flushPaddingRun(ctxPtr);
+
+    frameToTimeCode(fillRunPtr->firstFrameNum, captionTimePtr->frameRatePerSecTimesOneHundred, &firstTime);
+    record[0] = CC_DATA_RECORD_FILL_RUN;
+    CC_DATA_FILE_PUT_32(&record[1], fillRunPtr->firstFrameNum);
+    CC_DATA_FILE_PUT_32(&record[5], fillRunPtr->numFrames);
+    writeRecord(ctxPtr, record, sizeof(record), captionTimeToMs(&firstTime));
+    ctxPtr->numFramesWritten = ctxPtr->numFramesWritten + fillRunPtr->numFrames;
+}  // writeFillRun()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    flushPaddingRun()
+ |
+ | DESCRIPTION:
+ |    This writes the Padding Run being gathered, as a plain frame if it never
+ |    grew past one.
+ -------------------------------------------------------------------------------*/
+static void flushPaddingRun( CacheOutputCtx* ctxPtr ) {
+    uint8 record[CC_DATA_FILE_MAX_RECORD_SIZE];
+    uint16 numElements = 3 * ctxPtr->paddingCcCount;
+    uint16 size = 0;
+
+    if( ctxPtr->numPaddingFrames == 0 ) return;
+
+    if( ctxPtr->numPaddingFrames == 1 ) {
+        record[size++] = CC_DATA_RECORD_FRAME;
+        size = size + putTime(&record[size], &ctxPtr->paddingTime);
+    } else {
+        record[size++] = CC_DATA_RECORD_PADDING_RUN;
+        size = size + putTime(&record[size], &ctxPtr->paddingTime);
+        CC_DATA_FILE_PUT_32(&record[size], ctxPtr->numPaddingFrames);
+        size = size + 4;
+    }
+    record[size++] = ctxPtr->paddingCcCount;
+    memcpy(&record[size], ctxPtr->paddingData, numElements);
+    size = size + numElements;
+
+    writeRecord(ctxPtr, record, size, captionTimeToMs(&ctxPtr->paddingTime));
+    ctxPtr->numFramesWritten = ctxPtr->numFramesWritten + ctxPtr->numPaddingFrames;
+    ctxPtr->numPaddingFrames = 0;
+}  // flushPaddingRun()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeRecord()
+ |
+ | DESCRIPTION:
+ |    This writes a record to the file, indexing it first when a run of bytes
+ |    has been written since the last record that was indexed.
+ -------------------------------------------------------------------------------*/
+static void writeRecord( CacheOutputCtx* ctxPtr, uint8* recordPtr, uint16 size, uint32 timeInMs ) {
+    if( ctxPtr->filePos >= ctxPtr->nextIndexPos ) {
+        TimeCodeIndexAdd(ctxPtr->timeCodeIndexPtr, timeInMs, ctxPtr->filePos);
+        ctxPtr->nextIndexPos = ctxPtr->filePos + CC_DATA_FILE_INDEX_SPACING_BYTES;
+    }
+
+    if( fwrite(recordPtr, 1, size, ctxPtr->fp) != size ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_OUT, "Unable to Write to CC Data File: %s", ctxPtr->cacheFileName);
+    }
+    ctxPtr->filePos = ctxPtr->filePos + size;
+}  // writeRecord()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    putTime()
+ |
+ | DESCRIPTION:
+ |    This packs the time of a frame into a record, returning the bytes used.
+ -------------------------------------------------------------------------------*/
+static uint16 putTime( uint8* recordPtr, CaptionTime* captionTimePtr ) {
+    recordPtr[0] = captionTimePtr->hour;
+    recordPtr[1] = captionTimePtr->minute;
+    recordPtr[2] = captionTimePtr->second;
+    recordPtr[3] = captionTimePtr->frame;
+    recordPtr[4] = (uint8)captionTimePtr->millisecond;
+    recordPtr[5] = (uint8)(captionTimePtr->millisecond >> 8);
+    return CC_DATA_FILE_TIME_SIZE;
+}  // putTime()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isSameTime()
+ |
+ | DESCRIPTION:
+ |    This compares the parts of two times that are stored for each frame.
+ -------------------------------------------------------------------------------*/
+static boolean isSameTime( CaptionTime* firstTimePtr, CaptionTime* secondTimePtr ) {
+    return ((firstTimePtr->hour == secondTimePtr->hour) && (firstTimePtr->minute == secondTimePtr->minute) &&
+            (firstTimePtr->second == secondTimePtr->second) && (firstTimePtr->frame == secondTimePtr->frame) &&
+            (firstTimePtr->millisecond == secondTimePtr->millisecond)) ? TRUE : FALSE;
+}  // isSameTime()
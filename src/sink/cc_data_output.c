@@ -45,13 +45,17 @@ static const char* ccTypeStr[4] = { "1", "2", "D", "S" };
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static void writeCcDataLine( CcDataOutputCtx*, CaptionTime*, uint8*, uint16, Line21Code*, DtvccByte* );
+static void formatHexStr( char*, char, uint8, uint8* );
+static void formatCharTag( char*, uint8, const char* );
 static uint16 add708Error( CcDataOutputCtx*, char* );
-static void decode608Pair( CcDataOutputCtx*, uint8, uint8, uint8, CcdElemOut*, TextString* );
-static void decodePacketStart( CcDataOutputCtx*, uint8, uint8, CcdElemOut* );
-static void decodePacketData( CcDataOutputCtx*, uint8, char*, char*, TextString*, char* );
-static void decodeC0CmdCode( CcDataOutputCtx*, uint8, char*, char*, char* );
-static void decodeC1CmdCode( CcDataOutputCtx*, uint8, char*, char*, char* );
-static void decodeExtCmdCode( CcDataOutputCtx*, uint8, char*, char*, TextString*, char* );
+static void format608Code( uint8, uint8, uint8, Line21Code*, CcdElemOut*, TextString* );
+static void formatPacketStart( uint8, uint8, CcdElemOut* );
+static void formatPacketData( CcDataOutputCtx*, DtvccByte*, uint8, char*, char*, TextString*, char* );
+static void formatC0CmdCode( DtvccByte*, uint8, char*, char* );
+static void formatC1CmdCode( DtvccByte*, uint8, char*, char* );
+static void formatCharCode( DtvccByte*, char*, char*, TextString* );
+static void formatIgnoredCode( CcDataOutputCtx*, DtvccByte*, uint8, char*, char*, char* );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -81,13 +85,7 @@ LinkInfo CcDataOutInitialize( Context* rootCtxPtr ) {
 
     ctxPtr->fp = NULL;
     ctxPtr->wasHeaderWritten = FALSE;
-    ctxPtr->currentChannel[0] = UNKOWN_CHANNEL;
-    ctxPtr->currentChannel[1] = UNKOWN_CHANNEL;
-    ctxPtr->currentService = UNKNOWN_SERVICE;
     ctxPtr->cea708ErrNum = 0;
-    ctxPtr->cea708State = CEA708_STATE_UNKNOWN;
-    ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-    ctxPtr->cea708BytesRemaining = 0;
     buildOutputPath(rootCtxPtr->config.inputFilename, rootCtxPtr->config.outputDirectory, "ccd", ctxPtr->ccdFileName);
 
     LinkInfo linkInfo;
@@ -120,7 +118,6 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->ccDataOutputCtxPtr);
     CcDataOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->ccDataOutputCtxPtr;
-    int len;
 
     if( ctxPtr->fp == NULL ) {
         LOG(DEBUG_LEVEL_INFO, DBG_CCD_OUT, "Creating new CCD File for Output: %s", ctxPtr->ccdFileName);
@@ -185,20 +182,104 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
         ctxPtr->wasHeaderWritten = TRUE;
     }
 
-    if( buffPtr->captionTime.source == CAPTION_TIME_PTS_NUMBERING ) {
-        writeToFile(ctxPtr->fp, "%02d:%02d:%02d,%03d  ", buffPtr->captionTime.hour, buffPtr->captionTime.minute,
-                    buffPtr->captionTime.second, buffPtr->captionTime.millisecond);
-    } else if( buffPtr->captionTime.source == CAPTION_TIME_FRAME_NUMBERING ) {
-        if( buffPtr->captionTime.dropframe == FALSE ) {
-            writeToFile(ctxPtr->fp, "%02d:%02d:%02d:%02d   ", buffPtr->captionTime.hour, buffPtr->captionTime.minute,
-                        buffPtr->captionTime.second, buffPtr->captionTime.frame);
+    if( buffPtr->bufferType == BUFFER_TYPE_FILL ) {
+        FillRun* fillRunPtr = (FillRun*)buffPtr->dataPtr;
+        uint32 frameRate = buffPtr->captionTime.frameRatePerSecTimesOneHundred;
+        uint8 ccCount = numCcConstructsFromFramerate(frameRate);
+        uint8 fillData[3 * CC_COUNT_MASK];
+        CaptionTime captionTime = buffPtr->captionTime;
+
+        fillCcData(fillData, ccCount);
+        for( uint32 loop = 0; loop < fillRunPtr->numFrames; loop++ ) {
+            frameToTimeCode( (fillRunPtr->firstFrameNum + loop), frameRate, &captionTime );
+            writeCcDataLine( ctxPtr, &captionTime, fillData, (3 * ccCount), NULL, NULL );
+        }
+    } else {
+        Line21Code* line21CodePtr = NULL;
+        if( buffPtr->annotationPtr != NULL ) {
+            ASSERT(buffPtr->annotationPtr->bufferType == BUFFER_TYPE_BYTES);
+            ASSERT(((buffPtr->annotationPtr->numElements / sizeof(Line21Code)) * 3) >= buffPtr->numElements);
+            line21CodePtr = (Line21Code*)buffPtr->annotationPtr->dataPtr;
+        }
+        DtvccByte* dtvccBytePtr = NULL;
+        if( buffPtr->dtvccAnnotationPtr != NULL ) {
+            ASSERT(buffPtr->dtvccAnnotationPtr->bufferType == BUFFER_TYPE_BYTES);
+            ASSERT(((buffPtr->dtvccAnnotationPtr->numElements / (DTVCC_BYTES_PER_CONSTRUCT * sizeof(DtvccByte))) * 3) >= buffPtr->numElements);
+            dtvccBytePtr = (DtvccByte*)buffPtr->dtvccAnnotationPtr->dataPtr;
+        }
+        BufferFrame frame;
+        StartBufferFrames(buffPtr, &frame);
+        while( NextBufferFrame(buffPtr, &frame) == TRUE ) {
+            writeCcDataLine( ctxPtr, &frame.captionTime, &buffPtr->dataPtr[frame.firstElement], frame.numElements,
+                             (line21CodePtr != NULL) ? &line21CodePtr[frame.firstElement/3] : NULL,
+                             (dtvccBytePtr != NULL) ? &dtvccBytePtr[(frame.firstElement/3) * DTVCC_BYTES_PER_CONSTRUCT] : NULL );
+        }
+    }
+
+    FreeBuffer(buffPtr);
+    return PIPELINE_SUCCESS;
+} // CcDataOutProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataOutShutdown()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Context Pointer.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is called when the previous element in the pipeline determines
+ |    that there is no more data coming down the pipline. This element will
+ |    perform any necessary actions as a result and pass this call down the
+ |    pipeline.
+ -------------------------------------------------------------------------------*/
+uint8 CcDataOutShutdown( void* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->ccDataOutputCtxPtr);
+
+    closeFile(((Context*)rootCtxPtr)->ccDataOutputCtxPtr->fp);
+
+    free(((Context*)rootCtxPtr)->ccDataOutputCtxPtr);
+    ((Context*)rootCtxPtr)->ccDataOutputCtxPtr = NULL;
+    return PIPELINE_SUCCESS;
+} // CcDataOutShutdown()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeCcDataLine()
+ |
+ | DESCRIPTION:
+ |    This function writes the timestamp, hex data and inline decode for a single
+ |    frame of CC Data. The decode comes from the annotations which the Line 21
+ |    and DTVCC Decodes left on the buffer, and is left blank without them.
+ -------------------------------------------------------------------------------*/
+static void writeCcDataLine( CcDataOutputCtx* ctxPtr, CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements,
+                             Line21Code* line21CodePtr, DtvccByte* dtvccBytePtr ) {
+    DtvccByte unknownByte = { DTVCC_UNKNOWN, 0, 0, 0 };
+    int len;
+
+    if( captionTimePtr->source == CAPTION_TIME_PTS_NUMBERING ) {
+        writeToFile(ctxPtr->fp, "%02d:%02d:%02d,%03d  ", captionTimePtr->hour, captionTimePtr->minute,
+                    captionTimePtr->second, captionTimePtr->millisecond);
+    } else if( captionTimePtr->source == CAPTION_TIME_FRAME_NUMBERING ) {
+        if( captionTimePtr->dropframe == FALSE ) {
+            writeToFile(ctxPtr->fp, "%02d:%02d:%02d:%02d   ", captionTimePtr->hour, captionTimePtr->minute,
+                        captionTimePtr->second, captionTimePtr->frame);
         } else {
-            writeToFile(ctxPtr->fp, "%02d:%02d:%02d;%02d   ", buffPtr->captionTime.hour, buffPtr->captionTime.minute,
-                        buffPtr->captionTime.second, buffPtr->captionTime.frame);
+            writeToFile(ctxPtr->fp, "%02d:%02d:%02d;%02d   ", captionTimePtr->hour, captionTimePtr->minute,
+                        captionTimePtr->second, captionTimePtr->frame);
         }
     }
 
-    ASSERT((buffPtr->numElements % 3) == 0);
+    ASSERT((numElements % 3) == 0);
     CcdLineOut lineOut;
     lineOut.numElements = 0;
     boolean printNewline = FALSE;
@@ -211,11 +292,13 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     char errorStr[CEA708_ERROR_STR_SIZE];
     errorStr[0] = '\0';
 
-    for( int loop = 0; loop < buffPtr->numElements; loop = loop + 3 ) {
-        boolean ccValid = ((buffPtr->dataPtr[loop] & 0x04) >> 2);
-        uint8 ccType = (buffPtr->dataPtr[loop] & 0x03);
-        uint8 ccData1 = buffPtr->dataPtr[loop+1];
-        uint8 ccData2 = buffPtr->dataPtr[loop+2];
+    for( int loop = 0; loop < numElements; loop = loop + 3 ) {
+        boolean ccValid = ((dataPtr[loop] & 0x04) >> 2);
+        uint8 ccType = (dataPtr[loop] & 0x03);
+        uint8 ccData1 = dataPtr[loop+1];
+        uint8 ccData2 = dataPtr[loop+2];
+        DtvccByte* byte1Ptr = (dtvccBytePtr != NULL) ? &dtvccBytePtr[(loop/3) * DTVCC_BYTES_PER_CONSTRUCT] : &unknownByte;
+        DtvccByte* byte2Ptr = (dtvccBytePtr != NULL) ? &dtvccBytePtr[((loop/3) * DTVCC_BYTES_PER_CONSTRUCT) + 1] : &unknownByte;
         len = snprintf(lineOut.element[lineOut.numElements].tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "_________" );
         ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
         len = snprintf(lineOut.element[lineOut.numElements].decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_________________" );
@@ -223,25 +306,26 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
         if( ccValid == TRUE ) {
             ASSERT(ccType < 4 );
             if( (ccType == CC_DATA_TYPE__FIELD_1) || (ccType == CC_DATA_TYPE__FIELD_2) ) {
-                sprintf(lineOut.element[lineOut.numElements].hexStr, "F%s:%02X%02X", ccTypeStr[ccType], ccData1, ccData2);
+                formatHexStr(lineOut.element[lineOut.numElements].hexStr, 'F', ccType, &dataPtr[loop+1]);
             } else {
-                sprintf(lineOut.element[lineOut.numElements].hexStr, "P%s:%02X%02X", ccTypeStr[ccType], ccData1, ccData2);
+                formatHexStr(lineOut.element[lineOut.numElements].hexStr, 'P', ccType, &dataPtr[loop+1]);
             }
             switch( ccType ) {
                 case CC_DATA_TYPE__FIELD_1:
                 case CC_DATA_TYPE__FIELD_2:
-                    decode608Pair( ctxPtr, ccType, ccData1, ccData2, &lineOut.element[lineOut.numElements], &lineOut.txtStr );
+                    format608Code( ccType, ccData1, ccData2, (line21CodePtr != NULL) ? &line21CodePtr[loop/3] : NULL,
+                                   &lineOut.element[lineOut.numElements], &lineOut.txtStr );
                     lineOut.numElements = lineOut.numElements + 1;
                     break;
                 case CC_DATA_TYPE__PACKET_START:
-                    decodePacketStart( ctxPtr, ccData1, ccData2, &lineOut.element[lineOut.numElements] );
+                    formatPacketStart( ccData1, ccData2, &lineOut.element[lineOut.numElements] );
                     lineOut.numElements = lineOut.numElements + 1;
                     break;
                 case CC_DATA_TYPE__PACKET_DATA:
-                    decodePacketData( ctxPtr, ccData1, lineOut.element[lineOut.numElements].tagStr, lineOut.element[lineOut.numElements].decStr, &lineOut.txtStr, errorStr );
+                    formatPacketData( ctxPtr, byte1Ptr, ccData1, lineOut.element[lineOut.numElements].tagStr, lineOut.element[lineOut.numElements].decStr, &lineOut.txtStr, errorStr );
                     lineOut.element[lineOut.numElements].tagStr[(CC_DATA_ELEMENT_TAG_STR_SIZE/2)-1] = '|';
                     lineOut.element[lineOut.numElements].decStr[(CC_DATA_ELEMENT_DEC_STR_SIZE/2)-1] = '|';
-                    decodePacketData( ctxPtr, ccData2, &lineOut.element[lineOut.numElements].tagStr[CC_DATA_ELEMENT_TAG_STR_SIZE/2],
+                    formatPacketData( ctxPtr, byte2Ptr, ccData2, &lineOut.element[lineOut.numElements].tagStr[CC_DATA_ELEMENT_TAG_STR_SIZE/2],
                                       &lineOut.element[lineOut.numElements].decStr[CC_DATA_ELEMENT_DEC_STR_SIZE/2], &lineOut.txtStr, errorStr );
                     lineOut.numElements = lineOut.numElements + 1;
                     break;
@@ -250,7 +334,7 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
             }
         } else {
             ASSERT(ccType < 4 );
-            sprintf(lineOut.element[lineOut.numElements].hexStr, "X%s:%02X%02X", ccTypeStr[ccType], ccData1, ccData2);
+            formatHexStr(lineOut.element[lineOut.numElements].hexStr, 'X', ccType, &dataPtr[loop+1]);
             lineOut.numElements = lineOut.numElements + 1;
         }
 
@@ -305,58 +389,62 @@ uint8 CcDataOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(lineOut.numElements == 0 );
     writeToFile(ctxPtr->fp, "\n\n");
 
-    FreeBuffer(buffPtr);
-    return PIPELINE_SUCCESS;
-} // CcDataOutProcNextBuffer()
+}  // writeCcDataLine()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    CcDataOutShutdown()
- |
- | INPUT PARAMETERS:
- |    rootCtxPtr - Context Pointer.
- |
- | RETURN VALUES:
- |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
- |            All other codes specified in header.
+ |    formatHexStr()
  |
  | DESCRIPTION:
- |    This method is called when the previous element in the pipeline determines
- |    that there is no more data coming down the pipline. This element will
- |    perform any necessary actions as a result and pass this call down the
- |    pipeline.
+ |    This function writes the hex column for a construct, i.e. "F1:9420", as
+ |    the prefix, the cc_type and the two data bytes in hex.
  -------------------------------------------------------------------------------*/
-uint8 CcDataOutShutdown( void* rootCtxPtr ) {
-    ASSERT(rootCtxPtr);
-    ASSERT(((Context*)rootCtxPtr)->ccDataOutputCtxPtr);
-
-    closeFile(((Context*)rootCtxPtr)->ccDataOutputCtxPtr->fp);
+static void formatHexStr( char* hexStr, char prefix, uint8 ccType, uint8* ccDataPtr ) {
+    hexStr[0] = prefix;
+    hexStr[1] = ccTypeStr[ccType][0];
+    hexStr[2] = ':';
+    bytesToHex(ccDataPtr, 2, &hexStr[3]);
+    hexStr[7] = '\0';
+}  // formatHexStr()
 
-    free(((Context*)rootCtxPtr)->ccDataOutputCtxPtr);
-    ((Context*)rootCtxPtr)->ccDataOutputCtxPtr = NULL;
-    return PIPELINE_SUCCESS;
-} // CcDataOutShutdown()
-
-/*----------------------------------------------------------------------------*/
-/*--                       Private Member Functions                         --*/
-/*----------------------------------------------------------------------------*/
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    formatCharTag()
+ |
+ | DESCRIPTION:
+ |    This function writes the tag column for a single Special or Extended
+ |    character, i.e. 'Ch1  "a" '. The characters are UTF-8, so the spacing is
+ |    trimmed for the longer ones to keep the tag in its column.
+ -------------------------------------------------------------------------------*/
+static void formatCharTag( char* tagStr, uint8 channelNum, const char* charStr ) {
+    if( strlen(charStr) > 2 ) {
+        snprintf(tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d \"%s\"", channelNum, charStr);
+    } else {
+        snprintf(tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d  \"%s\"", channelNum, charStr);
+    }
+    while( strlen(tagStr) < (CC_DATA_ELEMENT_TAG_STR_SIZE-1) ) {
+        strcat(tagStr, " ");
+    }
+}  // formatCharTag()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decode608Pair()
+ |    format608Code()
  |
  | DESCRIPTION:
- |    This function decodes a CEA-608 Closed Captioning Construct.
+ |    This function writes the inline decode of a CEA-608 Closed Captioning
+ |    Construct, from the code that the Line 21 Decode left on the buffer. Pairs
+ |    that the decoder could not make sense of have already been reported by it,
+ |    so they are left blank here.
  -------------------------------------------------------------------------------*/
-static void decode608Pair( CcDataOutputCtx* ctxPtr, uint8 ccType, uint8 ccData1, uint8 ccData2, CcdElemOut* outputPtr, TextString* txtStr ){
-    ccData1 = ccData1 & LINE_21_PARITY_MASK;
-    ccData2 = ccData2 & LINE_21_PARITY_MASK;
-    uint8 channelNum = 0;
-    int len;
+static void format608Code( uint8 ccType, uint8 ccData1, uint8 ccData2, Line21Code* codePtr, CcdElemOut* outputPtr, TextString* txtStr ) {
     ASSERT(txtStr);
     ASSERT(outputPtr);
+    const char* decStr = NULL;
+    const char* altDecStr = NULL;
+    int len;
 
-    if( (ccData1 == 0) && (ccData2 == 0) ) {
+    if( ((ccData1 & LINE_21_PARITY_MASK) == 0) && ((ccData2 & LINE_21_PARITY_MASK) == 0) ) {
         if( ccType == CC_DATA_TYPE__FIELD_1 ) {
             len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "F1 - NULL" );
             ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
@@ -368,542 +456,231 @@ static void decode608Pair( CcDataOutputCtx* ctxPtr, uint8 ccType, uint8 ccData1,
             len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "608: Field 2 NULL" );
             ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
         }
-    } else if( ((ccData1 == GLOBAL_CTRL_CODE_CC1) || (ccData1 == GLOBAL_CTRL_CODE_CC2) ||
-                (ccData1 == GLOBAL_CTRL_CODE_CC3) || (ccData1 == GLOBAL_CTRL_CODE_CC4)) &&
-               ((ccData2 & GLOBAL_CTRL_CMD_MASK) == ccData2) ) {
-        switch( ccData1 ) {
-            case GLOBAL_CTRL_CODE_CC1:
-                channelNum = 1;
-                break;
-            case GLOBAL_CTRL_CODE_CC2:
-                channelNum = 2;
-                break;
-            case GLOBAL_CTRL_CODE_CC3:
-                channelNum = 3;
-                break;
-            case GLOBAL_CTRL_CODE_CC4:
-                channelNum = 4;
-                break;
-            default:
-                ASSERT(0);
-                break;
-        }
+        return;
+    }
 
-        if( ((channelNum == 1) && (ccType == CC_DATA_TYPE__FIELD_2)) ||
-            ((channelNum == 2) && (ccType == CC_DATA_TYPE__FIELD_2)) ||
-            ((channelNum == 3) && (ccType == CC_DATA_TYPE__FIELD_1)) ||
-            ((channelNum == 4) && (ccType == CC_DATA_TYPE__FIELD_1)) ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "Channel/Field Mismatch: Chan - %d Field - %s Code - %s", channelNum, ccTypeStr[ccType], Line21GlobalCtrlCodeToString(ccData2));
-        }
+    if( (codePtr == NULL) || (codePtr->codeType == LINE21_CODE_TYPE_UNKNOWN) ) {
+        return;
+    }
 
-        ctxPtr->currentChannel[ccType] = channelNum;
-        if( strlen(Line21GlobalCtrlCodeToString(ccData2)) == 3 ) {
-            len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d {%s}", channelNum, Line21GlobalCtrlCodeToString(ccData2));
-            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-        } else {
-            len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d {%s} ", channelNum, Line21GlobalCtrlCodeToString(ccData2));
-            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-        }
+    uint8 channelNum = codePtr->channelNum;
+    ASSERT((channelNum >= LINE21_CHANNEL_1) && (channelNum <= LINE21_CHANNEL_4));
 
-        switch( ccData2 ) {
-            case GLOBAL_CTRL_CODE__RCL:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "ResumeCaptLoading" );
-                break;
-            case GLOBAL_CTRL_CODE__BS:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____Backspace____" );
-                break;
-            case GLOBAL_CTRL_CODE__AOF:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____Alarm Off____" );
-                break;
-            case GLOBAL_CTRL_CODE__AON:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____Alarm On____" );
-                break;
-            case GLOBAL_CTRL_CODE__DER:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Delete Entire Row" );
-                break;
-            case GLOBAL_CTRL_CODE__RU2:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Roll Up -  2 Rows" );
-                break;
-            case GLOBAL_CTRL_CODE__RU3:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Roll Up -  3 Rows" );
-                break;
-            case GLOBAL_CTRL_CODE__RU4:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Roll Up -  4 Rows" );
-                break;
-            case GLOBAL_CTRL_CODE__FON:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____Flash On____" );
-                break;
-            case GLOBAL_CTRL_CODE__RDC:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "ResumeDirectCaptn" );
-                break;
-            case GLOBAL_CTRL_CODE__TR:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "___Text Restart__" );
-                break;
-            case GLOBAL_CTRL_CODE__RTD:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "ResumeTextDisplay" );
-                break;
-            case GLOBAL_CTRL_CODE__EDM:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "EraseDisplayedMem" );
-                break;
-            case GLOBAL_CTRL_CODE__CR:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Carriage Return_" );
-                break;
-            case GLOBAL_CTRL_CODE__ENM:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Erase NonDisp Mem" );
-                break;
-            case GLOBAL_CTRL_CODE__EOC:
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__End of Caption_" );
-                break;
-            default:
-                ASSERT(0);
-                break;
-        }
-        ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-    } else if( ((ccData1 == CMD_MIDROW_BG_CHAN_1_3) || (ccData1 == CMD_MIDROW_FG_CHAN_1_3) ||
-                (ccData1 == CMD_MIDROW_BG_CHAN_2_4) || (ccData1 == CMD_MIDROW_FG_CHAN_2_4)) &&
-               ((ccData2 & MIDROW_CODE_MASK) == ccData2) ) {
-        if( (ccData1 == CMD_MIDROW_BG_CHAN_1_3) || (ccData1 == CMD_MIDROW_FG_CHAN_1_3) ) {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 1;
-            } else {
-                channelNum = 3;
+    switch( codePtr->codeType ) {
+        case LINE21_GLOBAL_CONTROL_CODE:
+            if( ((channelNum == 1) && (ccType == CC_DATA_TYPE__FIELD_2)) ||
+                ((channelNum == 2) && (ccType == CC_DATA_TYPE__FIELD_2)) ||
+                ((channelNum == 3) && (ccType == CC_DATA_TYPE__FIELD_1)) ||
+                ((channelNum == 4) && (ccType == CC_DATA_TYPE__FIELD_1)) ) {
+                LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "Channel/Field Mismatch: Chan - %d Field - %s Code - %s", channelNum, ccTypeStr[ccType],
+                    Line21GlobalCtrlCodeToString(codePtr->code.globalControl.cmd));
             }
-        } else {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 2;
+
+            if( strlen(Line21GlobalCtrlCodeToString(codePtr->code.globalControl.cmd)) == 3 ) {
+                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d {%s}", channelNum, Line21GlobalCtrlCodeToString(codePtr->code.globalControl.cmd));
             } else {
-                channelNum = 4;
+                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d {%s} ", channelNum, Line21GlobalCtrlCodeToString(codePtr->code.globalControl.cmd));
             }
-        }
-        ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
-
-        len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - MDR", channelNum );
-        ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
+            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
 
-        if( (ccData1 & MIDROW_BG_FG_MASK) == MIDROW_FOREGROUND_STYLE ) {
-            switch( ccData2 & MIDROW_FG_STYLE_MASK ) {
-                case MIDROW_FG_STYLE_WHITE:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:White - Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____FG:White____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_GREEN:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Green - Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____FG:Green____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_BLUE:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Blue -  Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____FG:Blue_____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_CYAN:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Cyan -  Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____FG:Cyan_____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_RED:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Red  -  Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "______FG:Red_____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_YELLOW:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Yellw - Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____FG:Yellow____");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_MAGENTA:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Mgnta - Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____FG:Magenta___");
-                    }
-                    break;
-                case MIDROW_FG_STYLE_ITALIC_WHITE:
-                    if ((ccData2 & MIDROW_TRANSPARENCY_MASK) == MIDROW_PARTIALLY_TRANSPARENT) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:ItWht - Transp");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "FG:Italics  White");
-                    }
-                    break;
+            switch( codePtr->code.globalControl.cmd ) {
+                case GLOBAL_CTRL_CODE__RCL: decStr = "ResumeCaptLoading"; break;
+                case GLOBAL_CTRL_CODE__BS:  decStr = "____Backspace____"; break;
+                case GLOBAL_CTRL_CODE__AOF: decStr = "____Alarm Off____"; break;
+                case GLOBAL_CTRL_CODE__AON: decStr = "_____Alarm On____"; break;
+                case GLOBAL_CTRL_CODE__DER: decStr = "Delete Entire Row"; break;
+                case GLOBAL_CTRL_CODE__RU2: decStr = "Roll Up -  2 Rows"; break;
+                case GLOBAL_CTRL_CODE__RU3: decStr = "Roll Up -  3 Rows"; break;
+                case GLOBAL_CTRL_CODE__RU4: decStr = "Roll Up -  4 Rows"; break;
+                case GLOBAL_CTRL_CODE__FON: decStr = "_____Flash On____"; break;
+                case GLOBAL_CTRL_CODE__RDC: decStr = "ResumeDirectCaptn"; break;
+                case GLOBAL_CTRL_CODE__TR:  decStr = "___Text Restart__"; break;
+                case GLOBAL_CTRL_CODE__RTD: decStr = "ResumeTextDisplay"; break;
+                case GLOBAL_CTRL_CODE__EDM: decStr = "EraseDisplayedMem"; break;
+                case GLOBAL_CTRL_CODE__CR:  decStr = "_Carriage Return_"; break;
+                case GLOBAL_CTRL_CODE__ENM: decStr = "Erase NonDisp Mem"; break;
+                case GLOBAL_CTRL_CODE__EOC: decStr = "__End of Caption_"; break;
                 default:
                     ASSERT(0);
                     break;
             }
-            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-        } else {
-            switch(ccData2 & MIDROW_BG_COLOR_MASK) {
-                case MIDROW_BG_COLOR_WHITE:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:White - Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____BG:White____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_GREEN:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Green - Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____BG:Green____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_BLUE:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Blue -  Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____BG:Blue_____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_CYAN:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Cyan -  Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____BG:Cyan_____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_RED:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Red  -  Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "______BG:Red_____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_YELLOW:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Yellw - Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____BG:Yellow____");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_MAGENTA:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Mgnta - Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "____BG:Magenta___");
-                    }
-                    break;
-                case MIDROW_BG_COLOR_BLACK:
-                    if( (ccData2 & MIDROW_UNDERLINE_MASK) == MIDROW_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "BG:Black - Undrln");
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_____BG:Black____");
-                    }
-                    break;
-                default:
-                    ASSERT(0);
-                    break;
-            }
-            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-        }
-    } else if( ((ccData1 == CMD_TAB_HI_CC_1_3) || (ccData1 == CMD_TAB_HI_CC_2_4)) && ((ccData2 & TAB_CMD_MASK) == ccData2) ) {
-        if( ccData1 == CMD_TAB_HI_CC_1_3 ) {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 1;
-            } else {
-                channelNum = 3;
-            }
-        } else {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 2;
-            } else {
-                channelNum = 4;
-            }
-        }
-        ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
+            break;
+        case LINE21_MID_ROW_CONTROL_CODE:
+            len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - MDR", channelNum );
+            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
 
-        len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - TAB", channelNum );
-        ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
-        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__Tab-Offset: %d__", (ccData2 & 0x0F) );
-        ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-    } else if( (ccData1 & PAC_CC1_MASK) == ccData1 ) {
-        if( (ccData1 & PAC_CHANNEL_MASK) == PAC_CHANNEL_1_3 ) {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 1;
-            } else {
-                channelNum = 3;
-            }
-        } else {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 2;
+            if( codePtr->code.midRow.backgroundOrForeground == MIDROW_FOREGROUND_STYLE ) {
+                switch( codePtr->code.midRow.backgroundForgroundData.style ) {
+                    case MIDROW_FG_STYLE_WHITE:        decStr = "_____FG:White____"; altDecStr = "FG:White - Transp"; break;
+                    case MIDROW_FG_STYLE_GREEN:        decStr = "_____FG:Green____"; altDecStr = "FG:Green - Transp"; break;
+                    case MIDROW_FG_STYLE_BLUE:         decStr = "_____FG:Blue_____"; altDecStr = "FG:Blue -  Transp"; break;
+                    case MIDROW_FG_STYLE_CYAN:         decStr = "_____FG:Cyan_____"; altDecStr = "FG:Cyan -  Transp"; break;
+                    case MIDROW_FG_STYLE_RED:          decStr = "______FG:Red_____"; altDecStr = "FG:Red  -  Transp"; break;
+                    case MIDROW_FG_STYLE_YELLOW:       decStr = "____FG:Yellow____"; altDecStr = "FG:Yellw - Transp"; break;
+                    case MIDROW_FG_STYLE_MAGENTA:      decStr = "____FG:Magenta___"; altDecStr = "FG:Mgnta - Transp"; break;
+                    case MIDROW_FG_STYLE_ITALIC_WHITE: decStr = "FG:Italics  White"; altDecStr = "FG:ItWht - Transp"; break;
+                    default:
+                        ASSERT(0);
+                        break;
+                }
+                if( codePtr->code.midRow.isPartiallyTransparent ) {
+                    decStr = altDecStr;
+                }
             } else {
-                channelNum = 4;
+                switch( codePtr->code.midRow.backgroundForgroundData.color ) {
+                    case MIDROW_BG_COLOR_WHITE:   decStr = "_____BG:White____"; altDecStr = "BG:White - Undrln"; break;
+                    case MIDROW_BG_COLOR_GREEN:   decStr = "_____BG:Green____"; altDecStr = "BG:Green - Undrln"; break;
+                    case MIDROW_BG_COLOR_BLUE:    decStr = "_____BG:Blue_____"; altDecStr = "BG:Blue -  Undrln"; break;
+                    case MIDROW_BG_COLOR_CYAN:    decStr = "_____BG:Cyan_____"; altDecStr = "BG:Cyan -  Undrln"; break;
+                    case MIDROW_BG_COLOR_RED:     decStr = "______BG:Red_____"; altDecStr = "BG:Red  -  Undrln"; break;
+                    case MIDROW_BG_COLOR_YELLOW:  decStr = "____BG:Yellow____"; altDecStr = "BG:Yellw - Undrln"; break;
+                    case MIDROW_BG_COLOR_MAGENTA: decStr = "____BG:Magenta___"; altDecStr = "BG:Mgnta - Undrln"; break;
+                    case MIDROW_BG_COLOR_BLACK:   decStr = "_____BG:Black____"; altDecStr = "BG:Black - Undrln"; break;
+                    default:
+                        ASSERT(0);
+                        break;
+                }
+                if( codePtr->code.midRow.isUnderlined ) {
+                    decStr = altDecStr;
+                }
             }
-        }
-// TODO - HACK - This needs to be throttled on crappy captions.
-//        ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
+            break;
+        case LINE21_TAB_CONTROL_CODE:
+            len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - TAB", channelNum );
+            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
+            len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__Tab-Offset: %d__", (codePtr->code.tabControl.tabOffset & 0x0F) );
+            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+            break;
+        case LINE21_PREAMBLE_ACCESS_CODE: {
+            uint8 rowNumber = codePtr->code.pac.rowNumber;
+            len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - PAC", channelNum );
+            ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
 
-        len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - PAC", channelNum );
-        ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
-        uint8 rowNumber = Line21PacDecodeRow(ccData1,ccData2);
-        if( (ccData2 & PAC_STYLE_ADDR_MASK) == PAC_ADDRESS_SET ) {
-            switch(ccData2 & PAC_CURSOR_ADDRESS_MASK) {
-                case PAC_CURSOR_COLUMN_0:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:00-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:00", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_4:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:04-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:04", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_8:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:08-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:08", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_12:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:12-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:12", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_16:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:60-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:16", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_20:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:20-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:20", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_24:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:24-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:24", rowNumber);
-                    }
-                    break;
-                case PAC_CURSOR_COLUMN_28:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:28-UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:28", rowNumber);
-                    }
-                    break;
-                default:
-                    ASSERT(0);
-                    break;
+            if( codePtr->code.pac.styleAddr == PAC_ADDRESS_CODE ) {
+                if( codePtr->code.pac.isUnderlined ) {
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Col:%02d-UL", rowNumber, codePtr->code.pac.styleAddrData.cursor);
+                } else {
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Column:%02d", rowNumber, codePtr->code.pac.styleAddrData.cursor);
+                }
+                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                break;
             }
-            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-        } else {
-            switch(ccData2 & PAC_COLOR_STYLE_MASK) {
+
+            boolean isUnderlined = codePtr->code.pac.isUnderlined;
+            switch( codePtr->code.pac.styleAddrData.color ) {
                 case FG_COLOR_WHITE:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d White - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Row:%02d -  White_", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Row:%02d White - UL" : "_Row:%02d -  White_", rowNumber);
                     break;
                 case FG_COLOR_GREEN:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d Green - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Row:%02d -  Green_", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Row:%02d Green - UL" : "_Row:%02d -  Green_", rowNumber);
                     break;
                 case FG_COLOR_BLUE:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Blue - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__Row:%02d - Blue__", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Row:%02d  Blue - UL" : "__Row:%02d - Blue__", rowNumber);
                     break;
                 case FG_COLOR_CYAN:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d  Cyan - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__Row:%02d - Cyan__", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Row:%02d  Cyan - UL" : "__Row:%02d - Cyan__", rowNumber);
                     break;
                 case FG_COLOR_RED:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Row:%02d Red - UL_", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "__Row:%02d - Red___", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "_Row:%02d Red - UL_" : "__Row:%02d - Red___", rowNumber);
                     break;
                 case FG_COLOR_YELLOW:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Rw:%02d Yellow - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Row:%02d - Yellow_", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Rw:%02d Yellow - UL" : "_Row:%02d - Yellow_", rowNumber);
                     break;
                 case FG_COLOR_MAGENTA:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Rw:%02d Magnta - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d -  Magenta", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Rw:%02d Magnta - UL" : "Row:%02d -  Magenta", rowNumber);
                     break;
                 case FG_COLOR_ITALIC_WHITE:
-                    if( (ccData2 & PAC_UNDERLINE_MASK) == PAC_UNDERLINE ) {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Rw:%02d ItlWht - UL", rowNumber);
-                    } else {
-                        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Row:%02d - ItlacWht", rowNumber);
-                    }
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, isUnderlined ? "Rw:%02d ItlWht - UL" : "Row:%02d - ItlacWht", rowNumber);
                     break;
                 default:
                     ASSERT(0);
                     break;
             }
             ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+            break;
         }
-    } else if( ((ccData1 == SPCL_NA_CHAR_SET_CH_1_3) || (ccData1 == SPCL_NA_CHAR_SET_CH_2_4)) &&
-               ((ccData2 & SPCL_NA_CHAR_SET_MASK) == ccData2) ) {
-        if( ccData1 == SPCL_NA_CHAR_SET_CH_1_3 ) {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 1;
-            } else {
-                channelNum = 3;
-            }
-        } else {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 2;
-            } else {
-                channelNum = 4;
-            }
+        case LINE21_SPECIAL_CHAR: {
+            const char* charStr = Line21DecodeSpecialCharacter(codePtr->code.specialChar.spChar);
+            formatCharTag(outputPtr->tagStr, channelNum, charStr);
+            strcat(txtStr->txtStr608[channelNum-1], charStr);
+            break;
         }
-        ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
+        case LINE21_EXTENDED_CHAR: {
+            uint8 charSet = codePtr->code.extendedChar.charSet;
+            uint8 exChar = codePtr->code.extendedChar.exChar;
+            const char* charStr = Line21DecodeExtendedCharacter(charSet, exChar);
 
-        snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d  \"%s\"", channelNum, Line21DecodeSpecialCharacter(ccData2 & SPCL_NA_CHAR_MASK) );
-        if( strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-2) ) {
-            strcat(outputPtr->tagStr, " ");
-        }
-        ASSERT(strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
-        strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeSpecialCharacter(ccData2 & SPCL_NA_CHAR_MASK));
-    } else if( ((ccData1 == EXT_W_EURO_CHAR_SET_CH_1_3_SF) || (ccData1 == EXT_W_EURO_CHAR_SET_CH_1_3_FG) ||
-                (ccData1 == EXT_W_EURO_CHAR_SET_CH_2_4_SF) || (ccData1 == EXT_W_EURO_CHAR_SET_CH_2_4_FG)) &&
-               ((ccData2 & EXT_W_EURO_CHAR_SET_MASK) == ccData2) ) {
-
-        if( (ccData1 == EXT_W_EURO_CHAR_SET_CH_1_3_SF) || (ccData1 == EXT_W_EURO_CHAR_SET_CH_2_4_SF) ) {
-            if( (ccData2 & EXT_W_EURO_CHAR_SET_TOGGLE_MASK) == EXT_W_EURO_CHAR_SET_TOGGLE_MASK ) {
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_French Language_");
+            if( charSet == EXT_W_EURO_CHAR_SET_SPANISH_FRENCH ) {
+                decStr = ((exChar & EXT_W_EURO_CHAR_SET_TOGGLE_MASK) == EXT_W_EURO_CHAR_SET_TOGGLE_MASK) ? "_French Language_" : "_Spanish or Misc_";
             } else {
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Spanish or Misc_");
+                decStr = ((exChar & EXT_W_EURO_CHAR_SET_TOGGLE_MASK) == EXT_W_EURO_CHAR_SET_TOGGLE_MASK) ? "_German / Danish_" : "_Portuguese Lang_";
             }
-            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-        } else {
-            if( (ccData2 & EXT_W_EURO_CHAR_SET_TOGGLE_MASK) == EXT_W_EURO_CHAR_SET_TOGGLE_MASK ) {
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_German / Danish_");
-            } else {
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "_Portuguese Lang_");
-            }
-            ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-        }
 
-        if( (ccData1 == EXT_W_EURO_CHAR_SET_CH_1_3_SF) || (ccData1 == EXT_W_EURO_CHAR_SET_CH_1_3_FG) ) {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 1;
-            } else {
-                channelNum = 3;
-            }
-            ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
-            snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d  \"%s\"", channelNum, Line21DecodeExtendedCharacter(EXT_W_EURO_CHAR_SET_SPANISH_FRENCH, ccData2));
-            if( strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-2) ) {
-                strcat(outputPtr->tagStr, " ");
-            }
-            ASSERT(strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
-            strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeExtendedCharacter(EXT_W_EURO_CHAR_SET_SPANISH_FRENCH, ccData2));
-        } else {
-            if( ccType == CC_DATA_TYPE__FIELD_1 ) {
-                channelNum = 2;
-            } else {
-                channelNum = 4;
-            }
-            ASSERT(channelNum == ctxPtr->currentChannel[ccType]);
-            snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d  \"%s\"", channelNum, Line21DecodeExtendedCharacter(EXT_W_EURO_CHAR_SET_DUTCH_GERMAN, ccData2));
-            if( strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-2) ) {
-                strcat(outputPtr->tagStr, " ");
-            }
-            ASSERT(strlen(outputPtr->tagStr) == (CC_DATA_ELEMENT_TAG_STR_SIZE-1));
-            strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeExtendedCharacter(EXT_W_EURO_CHAR_SET_DUTCH_GERMAN, ccData2));
+            formatCharTag(outputPtr->tagStr, channelNum, charStr);
+            strcat(txtStr->txtStr608[channelNum-1], charStr);
+            break;
         }
-    } else if( (((ccData1 >= FIRST_BASIC_CHAR) && (ccData1 <= LAST_BASIC_CHAR)) || (ccData1 == NULL_BASIC_CHAR)) &&
-               (((ccData2 >= FIRST_BASIC_CHAR) && (ccData2 <= LAST_BASIC_CHAR)) || (ccData2 == NULL_BASIC_CHAR)) ) {
-// TODO - HACK - This needs to be throttled. It is to verbose on cruddy captions...
-//        ASSERT(ctxPtr->currentChannel[ccType]);
-        if( (ccData1 != 0) && (ccData2 != 0) ) {
-            if( (strlen(Line21DecodeBasicNACharacter(ccData1)) == 1) && (strlen(Line21DecodeBasicNACharacter(ccData2)) == 1) ) {
-                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d: \"%s%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d:  \"%s\"  \"%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-            } else if( (strlen(Line21DecodeBasicNACharacter(ccData1)) == 2) && (strlen(Line21DecodeBasicNACharacter(ccData2)) == 2) ) {
-                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d\"%s%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d: \"%s\" \"%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-            } else {
-                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d \"%s%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d:  \"%s\" \"%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1), Line21DecodeBasicNACharacter(ccData2));
-                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
-            }
-            strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeBasicNACharacter(ccData1));
-            strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeBasicNACharacter(ccData2));
-        } else if( (ccData1 != 0) && (ccData2 == 0) ) {
-            if( strlen(Line21DecodeBasicNACharacter(ccData1)) == 1 ) {
-                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - \"%s\"", ctxPtr->currentChannel[ccType], Line21DecodeBasicNACharacter(ccData1));
-                ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Channel - %d:  \"%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1));
-                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+        case LINE21_BASIC_CHARS: {
+            if( (codePtr->code.basicChars.charOne != 0) && (codePtr->code.basicChars.charTwo != 0) ) {
+                const char* charOneStr = Line21DecodeBasicNACharacter(codePtr->code.basicChars.charOne);
+                const char* charTwoStr = Line21DecodeBasicNACharacter(codePtr->code.basicChars.charTwo);
+                if( (strlen(charOneStr) == 1) && (strlen(charTwoStr) == 1) ) {
+                    len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d: \"%s%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d:  \"%s\"  \"%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                } else if( (strlen(charOneStr) == 2) && (strlen(charTwoStr) == 2) ) {
+                    len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d\"%s%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d: \"%s\" \"%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                } else {
+                    len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d \"%s%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Chan-%d:  \"%s\" \"%s\"", channelNum, charOneStr, charTwoStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                }
+                strcat(txtStr->txtStr608[channelNum-1], charOneStr);
+                strcat(txtStr->txtStr608[channelNum-1], charTwoStr);
             } else {
-                len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d: \"%s\"", ctxPtr->currentChannel[ccType], Line21DecodeBasicNACharacter(ccData1));
-                ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
-                len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Channel - %d: \"%s\"", ctxPtr->currentChannel[ccType],
-                               Line21DecodeBasicNACharacter(ccData1));
-                ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                // Only one of the pair carries a character, the other is padding
+                const char* charStr = Line21DecodeBasicNACharacter((codePtr->code.basicChars.charOne != 0) ?
+                                                                   codePtr->code.basicChars.charOne : codePtr->code.basicChars.charTwo);
+                if( strlen(charStr) == 1 ) {
+                    len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d - \"%s\"", channelNum, charStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Channel - %d:  \"%s\"", channelNum, charStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                } else {
+                    len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "Ch%d: \"%s\"", channelNum, charStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
+                    len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "Channel - %d: \"%s\"", channelNum, charStr);
+                    ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+                }
+                strcat(txtStr->txtStr608[channelNum-1], charStr);
             }
-            strcat(txtStr->txtStr608[ctxPtr->currentChannel[ccType]-1], Line21DecodeBasicNACharacter(ccData1));
-        } else {
-            ASSERT(0);
+            break;
         }
-    } else {
-        LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "Unable to decode CC Construct: 0x%02X 0x%02X", ccData1, ccData2);
+        default:
+            LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "Unexpected Line 21 Code Type %d: 0x%02X 0x%02X", codePtr->codeType, ccData1, ccData2);
+            break;
     }
-} // decode608Pair()
+
+    if( decStr != NULL ) {
+        len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "%s", decStr);
+        ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
+    }
+} // format608Code()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodePacketStart()
+ |    formatPacketStart()
  |
  | DESCRIPTION:
- |    This function decodes a CEA-708 Packet Start
+ |    This function formats a CEA-708 Packet Start, straight from the bytes of the
+ |    packet header and the first service block header.
  -------------------------------------------------------------------------------*/
-static void decodePacketStart( CcDataOutputCtx* ctxPtr, uint8 ccData1, uint8 ccData2, CcdElemOut* outputPtr ) {
+static void formatPacketStart( uint8 ccData1, uint8 ccData2, CcdElemOut* outputPtr ) {
     ASSERT(outputPtr);
     int len;
 
@@ -951,729 +728,401 @@ static void decodePacketStart( CcDataOutputCtx* ctxPtr, uint8 ccData1, uint8 ccD
     uint8 blkSize = (ccData2 & SERVICE_BLOCK_SIZE_MASK);                         // 5 less significant bits
 
     if( srvcNum == EXTENDED_SRV_NUM_PATTERN ) {
-        ctxPtr->cea708State = CEA708_STATE_EXTENDED_SEQ_NUM;
         len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "<-Srvc:Ex");
         ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
     } else {
-        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-        ctxPtr->currentService = srvcNum;
         len = snprintf(outputPtr->tagStr, CC_DATA_ELEMENT_TAG_STR_SIZE, "<-Srvc:%02d", srvcNum);
         ASSERT(len == (CC_DATA_ELEMENT_TAG_STR_SIZE - 1));
     }
     len = snprintf(outputPtr->decStr, CC_DATA_ELEMENT_DEC_STR_SIZE, "<--Seq:%d P%03d-B%02d", seqNum, pktSize, blkSize);
     ASSERT(len == (CC_DATA_ELEMENT_DEC_STR_SIZE - 1));
 
-} // decodePacketStart()
+} // formatPacketStart()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodePacketData()
+ |    formatPacketData()
  |
  | DESCRIPTION:
- |    This function decodes a CEA-708 Packet Data
+ |    This function formats a single byte of CEA-708 Packet Data, from what the
+ |    DTVCC Decode found the byte to be. Bytes that it did not annotate, e.g.
+ |    those before the first Packet Start, are left blank.
  -------------------------------------------------------------------------------*/
-static void decodePacketData( CcDataOutputCtx* ctxPtr, uint8 ccData, char* tagStr, char* decStr, TextString* txtStr, char* errStr ) {
+static void formatPacketData( CcDataOutputCtx* ctxPtr, DtvccByte* bytePtr, uint8 ccData, char* tagStr, char* decStr, TextString* txtStr, char* errStr ) {
     int len;
 
-    if( ctxPtr->cea708State  == CEA708_STATE_EXTENDED_SEQ_NUM ) {
-        ctxPtr->currentService = ccData & 0x3F;
-        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "S:%02d", ctxPtr->currentService);
-        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "ExSvc:%02d", ctxPtr->currentService);
-        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-    } else if( ctxPtr->cea708State  == CEA708_STATE_DATA_WAIT ) {
-        if( ccData == 0 ) {
-// HACK - TODO - What happens in the other decode for this?
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "?00?");
+    switch( bytePtr->dtvccType ) {
+        case DTVCC_UNKNOWN:
+        case DTVCC_PACKET_HEADER:
+            break;
+        case DTVCC_BLOCK_HEADER:
+            if( bytePtr->serviceNumber == EXTENDED_SRV_NUM_PATTERN ) {
+                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "S:Ex");
+                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "ExSv-B%02d", (ccData & SERVICE_BLOCK_SIZE_MASK));
+                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+            } else {
+                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "S:%02d", bytePtr->serviceNumber);
+                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "Sv%02d-B%02d", bytePtr->serviceNumber, (ccData & SERVICE_BLOCK_SIZE_MASK));
+                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+            }
+            break;
+        case DTVCC_EXT_SERVICE_NUM:
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "S:%02d", bytePtr->serviceNumber);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "?\?\?-0x00");
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "ExSvc:%02d", bytePtr->serviceNumber);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-// HACK - Error, or no? There are lots in the bad asset...
-//            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Ignoring Spurious NULL on Srvc: %d", add708Error(ctxPtr, errStr), ctxPtr->currentService);
-        } else if( ccData != DTVCC_C0_EXT1 ) {
-            if ((ccData >= DTVCC_MIN_C0_CODE) && (ccData <= DTVCC_MAX_C0_CODE)) {
-                decodeC0CmdCode(ctxPtr, ccData, tagStr, decStr, errStr);
-            } else if ((ccData >= DTVCC_MIN_G0_CODE) && (ccData <= DTVCC_MAX_G0_CODE)) {
-                if( strlen(DtvccDecodeG0CharSet(ccData)) == 1 ) {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G0:%s", DtvccDecodeG0CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G0Svc:%02d", ctxPtr->currentService);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G%s", DtvccDecodeG0CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "S:%02d %s", ctxPtr->currentService, DtvccDecodeG0CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                }
-                strcat(txtStr->txtStr708[ctxPtr->currentService-1], DtvccDecodeG0CharSet(ccData));
-            } else if ((ccData >= DTVCC_MIN_C1_CODE) && (ccData <= DTVCC_MAX_C1_CODE)) {
-                decodeC1CmdCode(ctxPtr, ccData, tagStr, decStr, errStr);
-            } else {
-                if( strlen(DtvccDecodeG1CharSet(ccData)) == 1 ) {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G1:%s", DtvccDecodeG1CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G1 - \"%s\"", DtvccDecodeG1CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G:%s", DtvccDecodeG1CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G1 -\"%s\"", DtvccDecodeG1CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                }
-                strcat(txtStr->txtStr708[ctxPtr->currentService-1], DtvccDecodeG1CharSet(ccData));
+            break;
+        case DTVCC_C0_CMD:
+            if( bytePtr->code != DTVCC_C0_NUL ) {
+                formatC0CmdCode(bytePtr, ccData, tagStr, decStr);
+                break;
             }
-        } else {  // Use Extended Set
-            ctxPtr->cea708State = CEA708_STATE_EXTENDED_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_EXTENDED_CODE_UNKNOWN;
-            ctxPtr->cea708BytesRemaining = 0;
+            // A NULL in the Block is shown the same as the Padding after it
+        case DTVCC_PADDING:
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "?%02X?", ccData);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "?\?\?-0x%02X", ccData);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+            break;
+        case DTVCC_EXT1_CODE:
             len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "EXT1");
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
             len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "Extended");
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-        }
-    } else {
-        switch( ctxPtr->cea708State ) {
-            case CEA708_STATE_UNKNOWN:
-                break;
-            case CEA708_STATE_C0_CODE:
-                decodeC0CmdCode(ctxPtr, ccData, tagStr, decStr, errStr);
-                break;
-            case CEA708_STATE_C1_CODE:
-                decodeC1CmdCode(ctxPtr, ccData, tagStr, decStr, errStr);
-                break;
-            case CEA708_STATE_EXTENDED_CODE:
-                decodeExtCmdCode(ctxPtr, ccData, tagStr, decStr, txtStr, errStr);
-                break;
-            default:
-                LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "{%X} - Unknown CEA-708 State: 0x%02X", add708Error(ctxPtr, errStr), ctxPtr->cea708State);
-                break;
-        }
+            break;
+        case DTVCC_C1_CMD:
+            formatC1CmdCode(bytePtr, ccData, tagStr, decStr);
+            break;
+        case DTVCC_C2_CMD:
+        case DTVCC_C3_CMD:
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C%d:%d", ((bytePtr->dtvccType == DTVCC_C2_CMD) ? 2 : 3), bytePtr->byteNum);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C%d:%d-%02X?", ((bytePtr->dtvccType == DTVCC_C2_CMD) ? 2 : 3), bytePtr->byteNum, ccData);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+            if( bytePtr->byteNum == 1 ) {
+                LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping C%d Code: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr),
+                    ((bytePtr->dtvccType == DTVCC_C2_CMD) ? 2 : 3), ccData, bytePtr->serviceNumber);
+            }
+            break;
+        case DTVCC_G0_CHAR:
+        case DTVCC_G1_CHAR:
+        case DTVCC_G2_CHAR:
+        case DTVCC_G3_CHAR:
+            formatCharCode(bytePtr, tagStr, decStr, txtStr);
+            break;
+        case DTVCC_IGNORE_CMD_OR_CHAR:
+            formatIgnoredCode(ctxPtr, bytePtr, ccData, tagStr, decStr, errStr);
+            break;
+        default:
+            LOG(DEBUG_LEVEL_ERROR, DBG_CCD_OUT, "{%X} - Unknown CEA-708 Type: 0x%02X", add708Error(ctxPtr, errStr), bytePtr->dtvccType);
+            break;
     }
-} // decodePacketData()
+} // formatPacketData()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodeC0CmdCode()
+ |    formatC0CmdCode()
  |
  | DESCRIPTION:
- |    This function decodes C0 Commands, per the spec.
+ |    This function formats a byte of a C0 Command, per the spec.
  -------------------------------------------------------------------------------*/
-static void decodeC0CmdCode( CcDataOutputCtx* ctxPtr, uint8 ccData, char* tagStr, char* decStr, char* errStr ) {
-    ASSERT(ctxPtr->currentService);
+static void formatC0CmdCode( DtvccByte* bytePtr, uint8 ccData, char* tagStr, char* decStr ) {
     int len;
 
-    if( ctxPtr->cea708State == CEA708_STATE_DATA_WAIT ) {
-        if (ccData <= 0x0F) {
-            if ((ccData == DTVCC_C0_NUL) || (ccData == DTVCC_C0_ETX) || (ccData == DTVCC_C0_BS) ||
-                (ccData == DTVCC_C0_FF) || (ccData == DTVCC_C0_CR) || (ccData == DTVCC_C0_HCR)) {
-                if( strlen(DtvccDecodeC0Cmd(ccData)) == 2 ) {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s  ", DtvccDecodeC0Cmd(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0: %s  ", DtvccDecodeC0Cmd(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC0Cmd(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0: %s ", DtvccDecodeC0Cmd(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                }
-            } else {
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X???", ccData);
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Ignoring Unknown Command: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-            }
-        } else if (ccData <= 0x17) {
-            // Note that 0x10 is actually EXT1 and is dealt with somewhere else. Rest is undefined as per CEA-708-D
-            ctxPtr->cea708State = CEA708_STATE_C0_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_UNKNOWN_C0_1;
-            ctxPtr->cea708BytesRemaining = 1;
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?E1", ccData);
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Ignoring Unknown Command: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-        } else if( ccData <= DTVCC_MAX_C0_CODE ) {
-            if( ccData == DTVCC_C0_P16 ) { // PE16
-                ctxPtr->cea708State = CEA708_STATE_C0_CODE;
-                ctxPtr->cea708Code = CEA708_CODE_P16_C0;
-                ctxPtr->cea708BytesRemaining = 2;
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "P16?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P16:UNH?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            } else {
-                ctxPtr->cea708State = CEA708_STATE_C0_CODE;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN_C0_2;
-                ctxPtr->cea708BytesRemaining = 2;
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?X1", ccData);
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Ignoring Unknown Command: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-            }
+    if( bytePtr->code == DTVCC_C0_P16 ) { // PE16
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "P16?");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( bytePtr->byteNum == 1 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P16:UNH?");
+        } else {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P16:%02X:%d", ccData, (bytePtr->byteNum - 1));
         }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    } else if( strlen(DtvccDecodeC0Cmd(bytePtr->code)) == 2 ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s  ", DtvccDecodeC0Cmd(bytePtr->code));
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0: %s  ", DtvccDecodeC0Cmd(bytePtr->code));
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
     } else {
-        switch( ctxPtr->cea708Code ) {
-            case CEA708_CODE_P16_C0:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "P16?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                if( ctxPtr->cea708BytesRemaining == 2 ) {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P16:%02X:1", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708BytesRemaining = 1;
-                } else {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P16:%02X:2", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                    ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                    ctxPtr->cea708BytesRemaining = 0;
-                }
-                break;
-            case CEA708_CODE_UNKNOWN_C0_1:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?E2", ccData);
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                ctxPtr->cea708BytesRemaining = 0;
-                break;
-            case CEA708_CODE_UNKNOWN_C0_2:
-                if( ctxPtr->cea708BytesRemaining == 2 ) {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?X2", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708BytesRemaining = 1;
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?X3", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                    ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                    ctxPtr->cea708BytesRemaining = 0;
-                }
-                break;
-            default:
-                break;
-        }
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC0Cmd(bytePtr->code));
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0: %s ", DtvccDecodeC0Cmd(bytePtr->code));
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
     }
-} // decodeC0CmdCode()
+} // formatC0CmdCode()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodeC1CmdCode()
+ |    formatC1CmdCode()
  |
  | DESCRIPTION:
- |    This function decodes C1 Commands, per the spec.
+ |    This function formats a byte of a C1 Command, per the spec.
  -------------------------------------------------------------------------------*/
-static void decodeC1CmdCode( CcDataOutputCtx* ctxPtr, uint8 ccData, char* tagStr, char* decStr, char* errStr ) {
-    ASSERT(ctxPtr->currentService);
+static void formatC1CmdCode( DtvccByte* bytePtr, uint8 ccData, char* tagStr, char* decStr ) {
+    uint8 c1CmdCode = bytePtr->code;
+    uint8 paramNum = bytePtr->byteNum - 1;
     int len;
 
-    if( ctxPtr->cea708State == CEA708_STATE_DATA_WAIT ) {
-        // --- Set Current Window {CWx} --- DelayCancel {DLC} --- Reset {RST} ---
-        if( (ccData == DTVCC_C1_CW0) || (ccData == DTVCC_C1_CW1) || (ccData == DTVCC_C1_CW2) ||
-            (ccData == DTVCC_C1_CW3) || (ccData == DTVCC_C1_CW4) || (ccData == DTVCC_C1_CW5) ||
-            (ccData == DTVCC_C1_CW6) || (ccData == DTVCC_C1_CW7) || (ccData == DTVCC_C1_DLC) ||
-            (ccData == DTVCC_C1_RST) ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC1Cmd(ccData));
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{%s}", DtvccDecodeC1Cmd(ccData));
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            // --- Clear Windows {CLW} --- Display Windows {DSW} --- HideWindows {HDW} ---
-            // --- ToggleWindows {TGW} --- Delete Windows {DLW} ---
-        } else if( (ccData == DTVCC_C1_CLW) || (ccData == DTVCC_C1_DSW) || (ccData == DTVCC_C1_HDW) ||
-                   (ccData == DTVCC_C1_TGW) || (ccData == DTVCC_C1_DLW) ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC1Cmd(ccData));
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{%s}", DtvccDecodeC1Cmd(ccData));
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_BITMAP;
-            ctxPtr->cea708BytesRemaining = 1;
-            // --- Delay {DLY} in 100ms ---
-        } else if( ccData == DTVCC_C1_DLY ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "DLY ");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{DLY}");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_DLY;
-            ctxPtr->cea708BytesRemaining = 1;
-            // --- Set Pen Attributes {SPA} ---
-        } else if( ccData == DTVCC_C1_SPA ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPA ");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{SPA}");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_SPA;
-            ctxPtr->cea708BytesRemaining = 2;
-            // --- Set Pen Color {SPC} ---
-        } else if( ccData == DTVCC_C1_SPC ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPC ");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{SPC}");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_SPC;
-            ctxPtr->cea708BytesRemaining = 3;
-            // --- Set Pen Location {SPL} ---
-        } else if( ccData == DTVCC_C1_SPL ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPL ");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{SPL}");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_SPL;
-            ctxPtr->cea708BytesRemaining = 2;
-            // --- Reserved {RSVxx} ---
-        } else if( (ccData == DTVCC_C1_RSV93) || (ccData == DTVCC_C1_RSV94) || (ccData == DTVCC_C1_RSV95) ||
-                   (ccData == DTVCC_C1_RSV96) ) {
+    if( bytePtr->byteNum == 1 ) {
+        // --- Reserved {RSVxx} ---
+        if( (c1CmdCode == DTVCC_C1_RSV93) || (c1CmdCode == DTVCC_C1_RSV94) || (c1CmdCode == DTVCC_C1_RSV95) ||
+            (c1CmdCode == DTVCC_C1_RSV96) ) {
             len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "RSV ");
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "{RSV-%X} ", ccData);
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            // --- Set Window Attributes {SWA} ---
-        } else if( ccData == DTVCC_C1_SWA ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SWA ");
-            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{SWA}");
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "{RSV-%X} ", c1CmdCode);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_SWA;
-            ctxPtr->cea708BytesRemaining = 4;
-            // --- Define Window {DFWx} ---
-        } else if( (ccData == DTVCC_C1_DF0) || (ccData == DTVCC_C1_DF1) || (ccData == DTVCC_C1_DF2) ||
-                   (ccData == DTVCC_C1_DF3) || (ccData == DTVCC_C1_DF4) || (ccData == DTVCC_C1_DF5) ||
-                   (ccData == DTVCC_C1_DF6) || (ccData == DTVCC_C1_DF7) ) {
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC1Cmd(ccData));
+        } else {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "%s ", DtvccDecodeC1Cmd(c1CmdCode));
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{%s}", DtvccDecodeC1Cmd(ccData));
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C1:{%s}", DtvccDecodeC1Cmd(c1CmdCode));
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            ctxPtr->cea708State = CEA708_STATE_C1_CODE;
-            ctxPtr->cea708Code = CEA708_CODE_C1_DFW;
-            ctxPtr->cea708BytesRemaining = 6;
+        }
+        return;
+    }
+
+    // --- Clear Windows {CLW} --- Display Windows {DSW} --- HideWindows {HDW} ---
+    // --- ToggleWindows {TGW} --- Delete Windows {DLW} ---
+    if( (c1CmdCode == DTVCC_C1_CLW) || (c1CmdCode == DTVCC_C1_DSW) || (c1CmdCode == DTVCC_C1_HDW) ||
+        (c1CmdCode == DTVCC_C1_TGW) || (c1CmdCode == DTVCC_C1_DLW) ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "BITM");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%s", uint8toBitArray(ccData));
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Delay {DLY} in 100ms ---
+    } else if( c1CmdCode == DTVCC_C1_DLY ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "DLY1");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( ccData < 10 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "_%d00 ms_", ccData);
+        } else if( ccData < 100 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d00  ms", ccData);
         } else {
-            ASSERT(0);
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d00 ms", ccData);
         }
-    } else {
-        switch (ctxPtr->cea708Code) {
-            case CEA708_CODE_C1_BITMAP:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "BITM");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%s", uint8toBitArray(ccData));
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                ctxPtr->cea708BytesRemaining = 0;
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Set Pen Attributes {SPA} ---
+    } else if( c1CmdCode == DTVCC_C1_SPA ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPA%d", paramNum);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( paramNum == 1 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " %d %d %02d ", (ccData & PEN_SIZE_MASK),
+                           ((ccData & PEN_OFFSET_MASK) >> PEN_OFFSET_NORM_SHIFT), ((ccData & TEXT_TAG_MASK) >> TEST_TAG_NORM_SHIFT));
+        } else {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " %d %d %c %c", (ccData & FONT_TAG_MASK),
+                           ((ccData & EDGE_TYPE_MASK) >> EDGE_TYPE_NORM_SHIFT),
+                           (((ccData & PA_UNDERLINE_TOGGLE_MASK) == PA_UNDERLINE_TOGGLE_SET)?'T':'F'),
+                           (((ccData & PA_ITALIC_TOGGLE_MASK) == PA_ITALIC_TOGGLE_SET)?'T':'F'));
+        }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Set Pen Color {SPC} ---
+    } else if( c1CmdCode == DTVCC_C1_SPC ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPC%d", paramNum);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( paramNum == 1 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d", ((ccData & FORGROUND_OPACITY_MASK) >> FORGROUND_OPACITY_NORM_SHIFT),
+                           ((ccData & FORGROUND_RED_COLOR_CMP_MASK) >> FORGROUND_RED_COLOR_CMP_NORM_SHIFT),
+                           ((ccData & FORGROUND_GREEN_COLOR_CMP_MASK) >> FORGROUND_GREEN_COLOR_CMP_NORM_SHIFT), (ccData & FORGROUND_BLUE_COLOR_CMP_MASK) );
+        } else if( paramNum == 2 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
+                           ((ccData & BACKGROUND_OPACITY_MASK) >> BACKGROUND_OPACITY_NORM_SHIFT),
+                           ((ccData & BACKGROUND_RED_COLOR_CMP_MASK) >> BACKGROUND_RED_COLOR_CMP_NORM_SHIFT),
+                           ((ccData & BACKGROUND_GREEN_COLOR_CMP_MASK) >> BACKGROUND_GREEN_COLOR_CMP_NORM_SHIFT),
+                           (ccData & BACKGROUND_BLUE_COLOR_CMP_MASK) );
+        } else {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "RGB%d:%d:%d",
+                           ((ccData & EDGE_RED_COLOR_CMP_MASK) >> EDGE_RED_COLOR_CMP_NORM_SHIFT),
+                           ((ccData & EDGE_GREEN_COLOR_CMP_MASK) >> EDGE_GREEN_COLOR_CMP_NORM_SHIFT),
+                           (ccData & EDGE_BLUE_COLOR_CMP_MASK));
+        }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Set Pen Location {SPL} ---
+    } else if( c1CmdCode == DTVCC_C1_SPL ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPL%d", paramNum);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( paramNum == 1 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " Row-%02d ", (ccData & PEN_LOC_ROW_MASK));
+        } else {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " Col-%02d ", (ccData & PEN_LOC_COLUMN_MASK));
+        }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Set Window Attributes {SWA} ---
+    } else if( c1CmdCode == DTVCC_C1_SWA ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SWA%d", paramNum);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        switch( paramNum ) {
+            case 1:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
+                               ((ccData & FILL_OPACITY_MASK) >> FILL_OPACITY_NORM_SHIFT),
+                               ((ccData & FILL_RED_COLOR_COMP_MASK) >> FILL_RED_COLOR_COMP_SHIFT),
+                               ((ccData & FILL_GREEN_COLOR_COMP_MASK) >> FILL_GREEN_COLOR_COMP_SHIFT),
+                               (ccData & FILL_BLUE_COLOR_COMP_MASK));
                 break;
-            case CEA708_CODE_C1_DLY:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "DLY1");
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                if( ccData < 10 ) {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "_%d00 ms_", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                } else if( ccData < 100 ) {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d00  ms", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                } else {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d00 ms", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                }
-                ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                ctxPtr->cea708BytesRemaining = 0;
+            case 2:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
+                               ((ccData & BORDER_TYPE_LOWER_BITS_MASK) >> BORDER_TYPE_LB_NORM_SHIFT),
+                               ((ccData & BORDER_RED_COLOR_COMP_MASK) >> BORDER_RED_COLOR_COMP_SHIFT),
+                               ((ccData & BORDER_GREEN_COLOR_COMP_MASK) >> BORDER_GREEN_COLOR_COMP_SHIFT),
+                               (ccData & BORDER_BLUE_COLOR_COMP_MASK));
                 break;
-            case CEA708_CODE_C1_SPA:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPA%d", (3 - ctxPtr->cea708BytesRemaining) );
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                if( ctxPtr->cea708BytesRemaining == 2 ) {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " %d %d %02d ", (ccData & PEN_SIZE_MASK),
-                                   ((ccData & PEN_OFFSET_MASK) >> PEN_OFFSET_NORM_SHIFT), ((ccData & TEXT_TAG_MASK) >> TEST_TAG_NORM_SHIFT));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708BytesRemaining = 1;
-                } else {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " %d %d %c %c", (ccData & FONT_TAG_MASK),
-                                   ((ccData & EDGE_TYPE_MASK) >> EDGE_TYPE_NORM_SHIFT),
-                                   (((ccData & PA_UNDERLINE_TOGGLE_MASK) == PA_UNDERLINE_TOGGLE_SET)?'T':'F'),
-                                   (((ccData & PA_ITALIC_TOGGLE_MASK) == PA_ITALIC_TOGGLE_SET)?'T':'F'));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                    ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                    ctxPtr->cea708BytesRemaining = 0;
-                }
+            case 3:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d %d %d %d%c",
+                               ((ccData & BORDER_TYPE_HIGH_BIT_MASK) >> BORDER_TYPE_HB_NORM_SHIFT),
+                               ((ccData & PRINT_DIRECTION_MASK) >> PRINT_DIRECTION_NORM_SHIFT),
+                               ((ccData & SCROLL_DIRECTION_MASK) >> SCROLL_DIRECTION_NORM_SHIFT),
+                               (ccData & JUSTIFY_DIRECTION_MASK),
+                               ((ccData & WORD_WRAP_TOGGLE_MASK) == WORD_WRAP_TOGGLE_SET)?'T':'F');
                 break;
-            case CEA708_CODE_C1_SPC:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPC%d", (4 - ctxPtr->cea708BytesRemaining) );
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                switch( ctxPtr->cea708BytesRemaining ) {
-                    case 3:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d", ((ccData & FORGROUND_OPACITY_MASK) >> FORGROUND_OPACITY_NORM_SHIFT),
-                                       ((ccData & FORGROUND_RED_COLOR_CMP_MASK) >> FORGROUND_RED_COLOR_CMP_NORM_SHIFT),
-                                       ((ccData & FORGROUND_GREEN_COLOR_CMP_MASK) >> FORGROUND_GREEN_COLOR_CMP_NORM_SHIFT), (ccData & FORGROUND_BLUE_COLOR_CMP_MASK) );
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    case 2:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
-                                       ((ccData & BACKGROUND_OPACITY_MASK) >> BACKGROUND_OPACITY_NORM_SHIFT),
-                                       ((ccData & BACKGROUND_RED_COLOR_CMP_MASK) >> BACKGROUND_RED_COLOR_CMP_NORM_SHIFT),
-                                       ((ccData & BACKGROUND_GREEN_COLOR_CMP_MASK) >> BACKGROUND_GREEN_COLOR_CMP_NORM_SHIFT),
-                                       (ccData & BACKGROUND_BLUE_COLOR_CMP_MASK) );
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 1;
-                        break;
-                    case 1:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "RGB%d:%d:%d",
-                                       ((ccData & EDGE_RED_COLOR_CMP_MASK) >> EDGE_RED_COLOR_CMP_NORM_SHIFT),
-                                       ((ccData & EDGE_GREEN_COLOR_CMP_MASK) >> EDGE_GREEN_COLOR_CMP_NORM_SHIFT),
-                                       (ccData & EDGE_BLUE_COLOR_CMP_MASK));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                        ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                        ctxPtr->cea708BytesRemaining = 0;
-                        break;
-                    default:
-                        ASSERT(0);
-                }
+            default:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d %ss %d",
+                               (ccData & DISPLAY_EFFECT_MASK),
+                               DECODE_EFFECT_SPEED(((ccData & EFFECT_SPEED_MASK) >> EFFECT_SPEED_NORM_SHIFT)),
+                               ((ccData & EFFECT_DIRECTION_MASK) >> EFFECT_DIRECTION_NORM_SHIFT));
                 break;
-            case CEA708_CODE_C1_SPL:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SPL%d", (3 - ctxPtr->cea708BytesRemaining) );
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                if( ctxPtr->cea708BytesRemaining == 2 ) {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " Row-%02d ", (ccData & PEN_LOC_ROW_MASK));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708BytesRemaining = 1;
-                } else {
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, " Col-%02d ", (ccData & PEN_LOC_COLUMN_MASK));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                    ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                    ctxPtr->cea708BytesRemaining = 0;
-                }
+        }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    // --- Define Window {DFWx} ---
+    } else if( (c1CmdCode >= DTVCC_C1_DF0) && (c1CmdCode <= DTVCC_C1_DF7) ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "DFW%d", paramNum);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        switch( paramNum ) {
+            case 1:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P%d %c %c %c",
+                               (ccData & PRIORITY_MASK),
+                               ((ccData & VISIBLE_TOGGLE_MASK) == VISIBLITY_SET)?'T':'F',
+                               ((ccData & ROW_LOCK_TOGGLE_MASK) == ROW_LOCK_TOGGLE_SET)?'T':'F',
+                               ((ccData & COLUMN_LOCK_TOGGLE_MASK) == COLUMN_LOCK_TOGGLE_SET)?'T':'F');
                 break;
-            case CEA708_CODE_C1_SWA:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "SWA%d", (5 - ctxPtr->cea708BytesRemaining) );
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                switch( ctxPtr->cea708BytesRemaining ) {
-                    case 4:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
-                                       ((ccData & FILL_OPACITY_MASK) >> FILL_OPACITY_NORM_SHIFT),
-                                       ((ccData & FILL_RED_COLOR_COMP_MASK) >> FILL_RED_COLOR_COMP_SHIFT),
-                                       ((ccData & FILL_GREEN_COLOR_COMP_MASK) >> FILL_GREEN_COLOR_COMP_SHIFT),
-                                       (ccData & FILL_BLUE_COLOR_COMP_MASK));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 3;
-                        break;
-                    case 3:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d  %d:%d:%d",
-                                       ((ccData & BORDER_TYPE_LOWER_BITS_MASK) >> BORDER_TYPE_LB_NORM_SHIFT),
-                                       ((ccData & BORDER_RED_COLOR_COMP_MASK) >> BORDER_RED_COLOR_COMP_SHIFT),
-                                       ((ccData & BORDER_GREEN_COLOR_COMP_MASK) >> BORDER_GREEN_COLOR_COMP_SHIFT),
-                                       (ccData & BORDER_BLUE_COLOR_COMP_MASK));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    case 2:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d %d %d %d%c",
-                                       ((ccData & BORDER_TYPE_HIGH_BIT_MASK) >> BORDER_TYPE_HB_NORM_SHIFT),
-                                       ((ccData & PRINT_DIRECTION_MASK) >> PRINT_DIRECTION_NORM_SHIFT),
-                                       ((ccData & SCROLL_DIRECTION_MASK) >> SCROLL_DIRECTION_NORM_SHIFT),
-                                       (ccData & JUSTIFY_DIRECTION_MASK),
-                                       ((ccData & WORD_WRAP_TOGGLE_MASK) == WORD_WRAP_TOGGLE_SET)?'T':'F');
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 1;
-                        break;
-                    case 1:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "%d %ss %d",
-                                       (ccData & DISPLAY_EFFECT_MASK),
-                                       DECODE_EFFECT_SPEED(((ccData & EFFECT_SPEED_MASK) >> EFFECT_SPEED_NORM_SHIFT)),
-                                       ((ccData & EFFECT_DIRECTION_MASK) >> EFFECT_DIRECTION_NORM_SHIFT));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                        ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    default:
-                        ASSERT(0);
-                }
+            case 2:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "VA-%03d %c", (ccData & VERTICAL_ANCHOR_MASK),
+                               ((ccData & RELATIVE_POSITIONING_MASK) == RELATIVE_POSITIONING_SET)?'T':'F');
                 break;
-            case CEA708_CODE_C1_DFW:
-                len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "DFW%d", (7 - ctxPtr->cea708BytesRemaining) );
-                ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                switch( ctxPtr->cea708BytesRemaining ) {
-                    case 6:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "P%d %c %c %c",
-                                       (ccData & PRIORITY_MASK),
-                                       ((ccData & VISIBLE_TOGGLE_MASK) == VISIBLITY_SET)?'T':'F',
-                                       ((ccData & ROW_LOCK_TOGGLE_MASK) == ROW_LOCK_TOGGLE_SET)?'T':'F',
-                                       ((ccData & COLUMN_LOCK_TOGGLE_MASK) == COLUMN_LOCK_TOGGLE_SET)?'T':'F');
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 5;
-                        break;
-                    case 5:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "VA-%03d %c", (ccData & VERTICAL_ANCHOR_MASK),
-                                       ((ccData & RELATIVE_POSITIONING_MASK) == RELATIVE_POSITIONING_SET)?'T':'F');
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 4;
-                        break;
-                    case 4:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "HrzA-%03d", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 3;
-                        break;
-                    case 3:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "RN-%02d %s", (ccData & ROW_COUNT_MASK),
-                                       DECODE_ANCOR_POSITION(((ccData & ANCHOR_ID_MASK) >> ANCHOR_ID_NORM_SHIFT)));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    case 2:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "ColN-%03d", (ccData & COLUMN_COUNT_MASK));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 1;
-                        break;
-                    case 1:
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "WS%d  PS%d", ((ccData & WINDOW_STYLE_MASK) >> WINDOW_STYLE_NORM_SHIFT), (ccData & PEN_STYLE_MASK));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                        ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                        ctxPtr->cea708BytesRemaining = 0;
-                        break;
-                    default:
-                        ASSERT(0);
-                }
+            case 3:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "HrzA-%03d", ccData);
+                break;
+            case 4:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "RN-%02d %s", (ccData & ROW_COUNT_MASK),
+                               DECODE_ANCOR_POSITION(((ccData & ANCHOR_ID_MASK) >> ANCHOR_ID_NORM_SHIFT)));
+                break;
+            case 5:
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "ColN-%03d", (ccData & COLUMN_COUNT_MASK));
                 break;
             default:
-                ASSERT(0);
+                len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "WS%d  PS%d", ((ccData & WINDOW_STYLE_MASK) >> WINDOW_STYLE_NORM_SHIFT), (ccData & PEN_STYLE_MASK));
                 break;
         }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    } else {
+        ASSERT(0);
     }
-}  // decodeC1CmdCode()
+}  // formatC1CmdCode()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodeExtCmdCode()
+ |    formatCharCode()
  |
  | DESCRIPTION:
- |    This function decodes C0 Commands, per the spec.
+ |    This function formats a G0, G1, G2 or G3 Character, adding it to the text
+ |    of its service.
  -------------------------------------------------------------------------------*/
-static void decodeExtCmdCode( CcDataOutputCtx* ctxPtr, uint8 ccData, char* tagStr, char* decStr, TextString* txtStr, char* errStr ) {
+static void formatCharCode( DtvccByte* bytePtr, char* tagStr, char* decStr, TextString* txtStr ) {
+    const char* charStr;
     int len;
 
-    if( ctxPtr->cea708Code == CEA708_CODE_EXTENDED_CODE_UNKNOWN ) {
-        if( (ccData >= DTVCC_MIN_C0_CODE) && (ccData <= DTVCC_MAX_C0_CODE) ) { // C2: Extended Misc. Control Codes
-            ctxPtr->cea708Code = CEA708_CODE_C2;
-            ctxPtr->cea708BytesRemaining = 4;
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C2:1");
+    if( bytePtr->dtvccType == DTVCC_G0_CHAR ) {
+        charStr = DtvccDecodeG0CharSet(bytePtr->code);
+        if( strlen(charStr) == 1 ) {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G0:%s", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C2:1-%02X?", ccData);
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G0Svc:%02d", bytePtr->serviceNumber);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping C2 Code: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-        } else if( (ccData >= DTVCC_MIN_G0_CODE) && (ccData <= DTVCC_MAX_G0_CODE)) {  // G2: Extended Misc. Characters
-            ctxPtr->cea708Code = CEA708_CODE_G2;
-            ctxPtr->cea708BytesRemaining = 1;
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2:1");
+        } else {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G%s", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2:1-%02X ", ccData);
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "S:%02d %s", bytePtr->serviceNumber, charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-        } else if( (ccData >= DTVCC_MIN_C1_CODE) && (ccData <= DTVCC_MAX_C1_CODE) ) {
-            ctxPtr->cea708Code = CEA708_CODE_C3;
-            ctxPtr->cea708BytesRemaining = 6;
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:1");
+        }
+    } else if( bytePtr->dtvccType == DTVCC_G1_CHAR ) {
+        charStr = DtvccDecodeG1CharSet(bytePtr->code);
+        if( strlen(charStr) == 1 ) {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G1:%s", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:1-%02X?", ccData);
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G1 - \"%s\"", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping C3 Code: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-        } else {  // G3 Character Set (Basically just the [CC] Symbol).
-            ctxPtr->cea708Code = CEA708_CODE_G3;
-            ctxPtr->cea708BytesRemaining = 1;
-            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G3:1");
+        } else {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G:%s", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G3:1-%02X ", ccData);
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G1 -\"%s\"", charStr);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+        }
+    } else if( bytePtr->dtvccType == DTVCC_G2_CHAR ) {
+        charStr = DtvccDecodeG2CharSet(bytePtr->code);
+        if( strlen(charStr) == 2 ) {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2%s", charStr);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2-'%s' ", charStr);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+        } else {
+            len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2:%s", charStr);
+            ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2 - '%s'", charStr);
             ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
         }
     } else {
-        switch (ctxPtr->cea708Code) {
-            case CEA708_CODE_C2:
-                switch (ctxPtr->cea708BytesRemaining) {
-                    case 4:
-                        /* This section is for future codes. While by definition we can't do any work on them, we must advance */
-                        /* however many bytes would be consumed if these codes were supported, as defined in the specs.        */
-                        // WARN: This code is completely untested due to lack of samples. Just following specs!
-                        if (ccData < 0x07) { // 00-07 : Single-byte control bytes (0 additional bytes)
-                            ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                            ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                            ctxPtr->cea708BytesRemaining = 0;
-                        } else if (ccData < 0x0F) { // 08-0F : Two-byte control codes (1 additional byte)
-                            ctxPtr->cea708BytesRemaining = 1;
-                        } else if (ccData < 0x0F) { // 10-17 : Three-byte control codes (2 additional bytes)
-                            ctxPtr->cea708BytesRemaining = 2;
-                        } else {  // 18-1F : Four-byte control codes (3 additional bytes)
-                            ctxPtr->cea708BytesRemaining = 3;
-                        }
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C2:2");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C2:2-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        break;
-                    case 3:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C2:3");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C2:3-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    case 2:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C2:4");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C2:4-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 1;
-                        break;
-                    case 1:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C2:5");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C2:5-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                        ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                        ctxPtr->cea708BytesRemaining = 0;
-                        break;
-                    default:
-                        ASSERT(0);
-                        break;
-                }
-                break;
-            case CEA708_CODE_G2:
-                ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                ctxPtr->cea708BytesRemaining = 0;
-                if ((ccData == 0x20) || (ccData == 0x21) || (ccData == 0x25) || (ccData == 0x2A) ||
-                    (ccData == 0x2C) || ((ccData >= 0x30) && (ccData <= 0x35)) || (ccData == 0x39) ||
-                    (ccData == 0x3A) || (ccData == 0x3C) || (ccData == 0x3D) || (ccData == 0x3F) ||
-                    ((ccData >= 0x76) && (ccData <= 0x7F))) {
-                    if( strlen(DtvccDecodeG2CharSet(ccData)) == 2 ) {
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2%s", DtvccDecodeG2CharSet(ccData));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2-'%s' ", DtvccDecodeG2CharSet(ccData));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    } else {
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2:%s", DtvccDecodeG2CharSet(ccData));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2 - '%s'", DtvccDecodeG2CharSet(ccData));
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    }
-                    strcat(txtStr->txtStr708[ctxPtr->currentService-1], DtvccDecodeG2CharSet(ccData));
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2:2");
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2:2-%02X?", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping Unknown G2 Char: 0x%02X Srvc: %d",
-                        add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-                }
-                break;
-            case CEA708_CODE_C3:
-                switch (ctxPtr->cea708BytesRemaining) {
-                    case 6:
-                        if ((ccData < 0x80) || (ccData > 0x9F)) {
-                            ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                            ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                            ctxPtr->cea708BytesRemaining = 0;
-                        } else if (ccData <= 0x87) { // 80-87 : Five-byte control bytes (4 additional bytes)
-                            ctxPtr->cea708BytesRemaining = 4;
-                        } else if (ccData <= 0x8F) { // 88-8F : Six-byte control codes (5 additional byte)
-                            ctxPtr->cea708BytesRemaining = 5;
-                        } else {
-                            // 90-9F : These are variable length commands, that can even span several segments.
-                            // They were envisioned for things like downloading fonts and graphics.
-                            // We are not supporting this set of data.
-                            ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                            ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                            ctxPtr->cea708BytesRemaining = 0;
-                            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT,
-                                "{%X} - SLikely Data Corruption. Unsupported C3 Data Range: 0x%02X %d",
-                                add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-                        }
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:2");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:2-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        break;
-                    case 5:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:3");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:3-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 4;
-                        break;
-                    case 4:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:4");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:4-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 3;
-                        break;
-                    case 3:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:5");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:5-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 2;
-                        break;
-                    case 2:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:6");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:6-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708BytesRemaining = 1;
-                        break;
-                    case 1:
-                        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C3:7");
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C3:7-%02X?", ccData);
-                        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                        ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                        ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                        ctxPtr->cea708BytesRemaining = 0;
-                        break;
-                    default:
-                        ASSERT(0);
-                        break;
-                }
-                break;
-            case CEA708_CODE_G3:
-                ctxPtr->cea708State = CEA708_STATE_DATA_WAIT;
-                ctxPtr->cea708Code = CEA708_CODE_UNKNOWN;
-                ctxPtr->cea708BytesRemaining = 0;
-                if( ccData != DTVCC_G3_CC_ICON ) {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G3%s", DtvccDecodeG3CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G3: '%s'", DtvccDecodeG3CharSet(ccData));
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    strcat(txtStr->txtStr708[ctxPtr->currentService-1], DtvccDecodeG3CharSet(ccData));
-                } else {
-                    len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G3:2");
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
-                    len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G3:2-%02X?", ccData);
-                    ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
-                    LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping Unknown G3 Char: 0x%02X Srvc: %d",
-                        add708Error(ctxPtr, errStr), ccData, ctxPtr->currentService);
-                }
-                break;
-            default:
-                ASSERT(0);
-                break;
+        charStr = DtvccDecodeG3CharSet(bytePtr->code);
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G3%s", charStr);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G3: '%s'", charStr);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+    }
+
+    // Only the standard services have room for their text on the line
+    if( (bytePtr->serviceNumber > 0) && (bytePtr->serviceNumber <= NUM_708_SERVICES) &&
+        ((strlen(txtStr->txtStr708[bytePtr->serviceNumber-1]) + strlen(charStr)) < MAX_CHARS_PER_LINE_PER_CHANNEL) ) {
+        strcat(txtStr->txtStr708[bytePtr->serviceNumber-1], charStr);
+    }
+}  // formatCharCode()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    formatIgnoredCode()
+ |
+ | DESCRIPTION:
+ |    This function formats a byte of a reserved C0 Command, or of an unknown G2
+ |    or G3 Character, which the DTVCC Decode skips over.
+ -------------------------------------------------------------------------------*/
+static void formatIgnoredCode( CcDataOutputCtx* ctxPtr, DtvccByte* bytePtr, uint8 ccData, char* tagStr, char* decStr, char* errStr ) {
+    int len;
+
+    if( bytePtr->code <= DTVCC_MAX_C0_CODE ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "C0:?");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        if( bytePtr->code <= 0x0F ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X???", ccData);
+        } else if( bytePtr->code <= 0x17 ) {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?E%d", ccData, bytePtr->byteNum);
+        } else {
+            len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "C0:%02X?X%d", ccData, bytePtr->byteNum);
         }
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+        if( bytePtr->byteNum == 1 ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Ignoring Unknown Command: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, bytePtr->serviceNumber);
+        }
+    } else if( bytePtr->code <= DTVCC_MAX_G0_CODE ) {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G2:?");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G2:?-%02X?", ccData);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+        LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping Unknown G2 Char: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, bytePtr->serviceNumber);
+    } else {
+        len = snprintf(tagStr, CC_DATA_ELEMENT_HALF_TAG_STR_SIZE, "G3:?");
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_TAG_STR_SIZE - 1));
+        len = snprintf(decStr, CC_DATA_ELEMENT_HALF_DEC_STR_SIZE, "G3:?-%02X?", ccData);
+        ASSERT(len == (CC_DATA_ELEMENT_HALF_DEC_STR_SIZE - 1));
+        LOG(DEBUG_LEVEL_WARN, DBG_CCD_OUT, "{%X} - Skipping Unknown G3 Char: 0x%02X Srvc: %d", add708Error(ctxPtr, errStr), ccData, bytePtr->serviceNumber);
     }
-}  // decodeExtCmdCode()
+}  // formatIgnoredCode()
 
 /*------------------------------------------------------------------------------
  | NAME:
@@ -0,0 +1,452 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "debug.h"
+
+#include "cue_output.h"
+#include "cc_utils.h"
+#include "output_utils.h"
+#include "dtvcc_window.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static FILE* openCueFile( CueOutputCtx*, char, uint8, char* );
+static void cueTimeToString( CaptionTime*, char, char* );
+static void writeLine21Cue( CueOutputCtx*, CaptionCue* );
+static void writeDtvccCue( CueOutputCtx*, CaptionCue* );
+static void writeSrtCue( CueOutputCtx*, CaptionCue* );
+static void writeVttCue( CueOutputCtx*, CaptionCue* );
+static void writeServiceVttCue( CueOutputCtx*, CaptionCue* );
+static void writeServiceJsonCue( CueOutputCtx*, CaptionCue* );
+static void writeVttText( FILE*, char* );
+static void writeJsonText( FILE*, char* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CueOutInitialize()
+ |
+ | INPUT PARAMETERS:
+ |    ctxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    LinkInfo -  Information about this element of the pipeline, such that it can
+ |                be chained to elements that can consume the specific type of data
+ |                that it produces.
+ |
+ | DESCRIPTION:
+ |    This initializes this element of the pipeline. Both the Line 21 and the
+ |    DTVCC cue producers write through the same instance, so initializing it
+ |    again just counts another producer, which will also shut it down.
+ -------------------------------------------------------------------------------*/
+LinkInfo CueOutInitialize( Context* ctxPtr ) {
+    ASSERT(ctxPtr);
+
+    if( ctxPtr->cueOutputCtxPtr == NULL ) {
+        ctxPtr->cueOutputCtxPtr = malloc(sizeof(CueOutputCtx));
+        for( int loop = 0; loop < LINE21_MAX_NUM_CHANNELS; loop++ ) {
+            ctxPtr->cueOutputCtxPtr->srtFp[loop] = NULL;
+            ctxPtr->cueOutputCtxPtr->vttFp[loop] = NULL;
+            ctxPtr->cueOutputCtxPtr->numCues[loop] = 0;
+        }
+        for( int loop = 0; loop < DTVCC_MAX_NUM_SERVICES; loop++ ) {
+            ctxPtr->cueOutputCtxPtr->serviceVttFp[loop] = NULL;
+            ctxPtr->cueOutputCtxPtr->serviceJsonFp[loop] = NULL;
+            ctxPtr->cueOutputCtxPtr->numServiceCues[loop] = 0;
+        }
+        ctxPtr->cueOutputCtxPtr->numProducers = 0;
+        buildOutputPath(ctxPtr->config.inputFilename, ctxPtr->config.outputDirectory, "srt",
+                        ctxPtr->cueOutputCtxPtr->outputFileName);
+    }
+    ctxPtr->cueOutputCtxPtr->numProducers++;
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = CAPTION_CUE___SUBTITLE_FILE;
+    linkInfo.sourceType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.sinkType = DATA_TYPE_SUBTITLE_FILE;
+    linkInfo.NextBufferFnPtr = &CueOutProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &CueOutShutdown;
+    return linkInfo;
+}  // CueOutInitialize()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CueOutProcNextBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Context Pointer.
+ |    inBuffer - Pointer to the buffer to process.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method writes each incoming Line 21 cue to both the SRT and the WebVTT
+ |    file of the channel that it was captioned on, and each DTVCC cue to both the
+ |    WebVTT and the JSON file of its service, creating the files on first use.
+ -------------------------------------------------------------------------------*/
+uint8 CueOutProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
+    ASSERT(inBuffer);
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->cueOutputCtxPtr);
+    CueOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->cueOutputCtxPtr;
+    CaptionCue* cuePtr = (CaptionCue*)inBuffer->dataPtr;
+
+    for( int loop = 0; loop < inBuffer->numElements; loop++ ) {
+        if( (cuePtr[loop].source == CAPTION_CUE_SOURCE_608) && (cuePtr[loop].channelNum >= 1) &&
+            (cuePtr[loop].channelNum <= LINE21_MAX_NUM_CHANNELS) ) {
+            writeLine21Cue(ctxPtr, &cuePtr[loop]);
+        } else if( (cuePtr[loop].source == CAPTION_CUE_SOURCE_708) && (cuePtr[loop].channelNum >= 1) &&
+                   (cuePtr[loop].channelNum <= DTVCC_MAX_NUM_SERVICES) ) {
+            writeDtvccCue(ctxPtr, &cuePtr[loop]);
+        } else {
+            LOG(DEBUG_LEVEL_WARN, DBG_FILE_OUT, "Ignoring Cue from unexpected Source/Channel: %d/%d", cuePtr[loop].source, cuePtr[loop].channelNum);
+        }
+    }
+
+    FreeBuffer(inBuffer);
+    return PIPELINE_SUCCESS;
+}  // CueOutProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CueOutShutdown()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Context Pointer.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is called when the previous element in the pipeline determines
+ |    that there is no more data coming down the pipline. The files are closed
+ |    once every producer of cues has shut down.
+ -------------------------------------------------------------------------------*/
+uint8 CueOutShutdown( void* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->cueOutputCtxPtr);
+    CueOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->cueOutputCtxPtr;
+    boolean anyFiles = FALSE;
+
+    ASSERT(ctxPtr->numProducers);
+    ctxPtr->numProducers--;
+    if( ctxPtr->numProducers != 0 ) {
+        return PIPELINE_SUCCESS;
+    }
+
+    for( int loop = 0; loop < LINE21_MAX_NUM_CHANNELS; loop++ ) {
+        if( ctxPtr->srtFp[loop] != NULL ) {
+            LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "Wrote %ld Cues for Channel %d", ctxPtr->numCues[loop], loop+1);
+            closeFile(ctxPtr->srtFp[loop]);
+            closeFile(ctxPtr->vttFp[loop]);
+            anyFiles = TRUE;
+        }
+    }
+
+    for( int loop = 0; loop < DTVCC_MAX_NUM_SERVICES; loop++ ) {
+        if( ctxPtr->serviceVttFp[loop] != NULL ) {
+            LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "Wrote %ld Cues for Service %d", ctxPtr->numServiceCues[loop], loop+1);
+            writeToFile(ctxPtr->serviceJsonFp[loop], "\n]\n");
+            closeFile(ctxPtr->serviceVttFp[loop]);
+            closeFile(ctxPtr->serviceJsonFp[loop]);
+            anyFiles = TRUE;
+        }
+    }
+
+    if( anyFiles == FALSE ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "No Caption Cues Outputted. No Subtitle Files Written.");
+    }
+
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->cueOutputCtxPtr = NULL;
+    return PIPELINE_SUCCESS;
+}  // CueOutShutdown()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    openCueFile()
+ |
+ | DESCRIPTION:
+ |    This function opens the subtitle file of a Line 21 channel ('C') or DTVCC
+ |    service ('S'), naming it after the asset in the same way as the decoded
+ |    caption files.
+ -------------------------------------------------------------------------------*/
+static FILE* openCueFile( CueOutputCtx* ctxPtr, char prefix, uint8 channelNum, char* extensionStr ) {
+    char uniqueFileName[MAX_FILE_NAME_LEN];
+    char suffix[10];
+
+    strncpy(uniqueFileName, ctxPtr->outputFileName, MAX_FILE_NAME_LEN);
+    char* tmpCharPtr = strrchr(uniqueFileName, '.');
+    ASSERT(tmpCharPtr);
+    *tmpCharPtr = '\0';
+    sprintf(suffix, "-%c%d.%s", prefix, channelNum, extensionStr);
+    strncat(uniqueFileName, suffix, (MAX_FILE_NAME_LEN - strlen(uniqueFileName) - 1));
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_OUT, "Creating new Subtitle File for Output: %s", uniqueFileName);
+    return fileOutputInit(uniqueFileName);
+}  // openCueFile()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    cueTimeToString()
+ |
+ | DESCRIPTION:
+ |    This function formats a cue time as HH:MM:SS?mmm, where the separator
+ |    before the milliseconds is ',' for SRT and '.' for WebVTT.
+ -------------------------------------------------------------------------------*/
+static void cueTimeToString( CaptionTime* captionTimePtr, char separator, char* timeStr ) {
+    uint32 timeInMs = captionTimeToMs(captionTimePtr);
+
+    snprintf(timeStr, CUE_OUTPUT_TIME_STR_SIZE, "%02ld:%02ld:%02ld%c%03ld", timeInMs / 3600000, (timeInMs / 60000) % 60,
+             (timeInMs / 1000) % 60, separator, timeInMs % 1000);
+}  // cueTimeToString()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeLine21Cue()
+ |
+ | DESCRIPTION:
+ |    This function writes a Line 21 cue to the SRT and WebVTT files of its
+ |    channel.
+ -------------------------------------------------------------------------------*/
+static void writeLine21Cue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    uint8 fileIdx = cuePtr->channelNum - 1;
+
+    if( ctxPtr->srtFp[fileIdx] == NULL ) {
+        ctxPtr->srtFp[fileIdx] = openCueFile(ctxPtr, 'C', cuePtr->channelNum, "srt");
+        ctxPtr->vttFp[fileIdx] = openCueFile(ctxPtr, 'C', cuePtr->channelNum, "vtt");
+        if( (ctxPtr->srtFp[fileIdx] == NULL) || (ctxPtr->vttFp[fileIdx] == NULL) ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_OUT, "Unable to Open Subtitle Files for Channel %d, Dropping Cue", cuePtr->channelNum);
+            closeFile(ctxPtr->srtFp[fileIdx]);
+            closeFile(ctxPtr->vttFp[fileIdx]);
+            ctxPtr->srtFp[fileIdx] = NULL;
+            ctxPtr->vttFp[fileIdx] = NULL;
+            return;
+        }
+        writeToFile(ctxPtr->vttFp[fileIdx], "WEBVTT\n");
+    }
+
+    writeSrtCue(ctxPtr, cuePtr);
+    writeVttCue(ctxPtr, cuePtr);
+}  // writeLine21Cue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeDtvccCue()
+ |
+ | DESCRIPTION:
+ |    This function writes a DTVCC cue to the WebVTT and JSON files of its
+ |    service. The JSON file holds an array of cues, which is closed on shutdown.
+ -------------------------------------------------------------------------------*/
+static void writeDtvccCue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    uint8 fileIdx = cuePtr->channelNum - 1;
+
+    if( ctxPtr->serviceVttFp[fileIdx] == NULL ) {
+        ctxPtr->serviceVttFp[fileIdx] = openCueFile(ctxPtr, 'S', cuePtr->channelNum, "vtt");
+        ctxPtr->serviceJsonFp[fileIdx] = openCueFile(ctxPtr, 'S', cuePtr->channelNum, "json");
+        if( (ctxPtr->serviceVttFp[fileIdx] == NULL) || (ctxPtr->serviceJsonFp[fileIdx] == NULL) ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_OUT, "Unable to Open Subtitle Files for Service %d, Dropping Cue", cuePtr->channelNum);
+            closeFile(ctxPtr->serviceVttFp[fileIdx]);
+            closeFile(ctxPtr->serviceJsonFp[fileIdx]);
+            ctxPtr->serviceVttFp[fileIdx] = NULL;
+            ctxPtr->serviceJsonFp[fileIdx] = NULL;
+            return;
+        }
+        writeToFile(ctxPtr->serviceVttFp[fileIdx], "WEBVTT\n");
+        writeToFile(ctxPtr->serviceJsonFp[fileIdx], "[");
+    }
+
+    writeServiceVttCue(ctxPtr, cuePtr);
+    writeServiceJsonCue(ctxPtr, cuePtr);
+    ctxPtr->numServiceCues[fileIdx]++;
+}  // writeDtvccCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeSrtCue()
+ |
+ | DESCRIPTION:
+ |    This function writes a numbered SRT cue, with a line per row of text.
+ -------------------------------------------------------------------------------*/
+static void writeSrtCue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    uint8 fileIdx = cuePtr->channelNum - 1;
+    char startTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+    char endTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+
+    ctxPtr->numCues[fileIdx]++;
+    cueTimeToString(&cuePtr->startTime, ',', startTimeStr);
+    cueTimeToString(&cuePtr->endTime, ',', endTimeStr);
+
+    writeToFile(ctxPtr->srtFp[fileIdx], "%ld\n%s --> %s\n", ctxPtr->numCues[fileIdx], startTimeStr, endTimeStr);
+    for( int loop = 0; loop < cuePtr->numRows; loop++ ) {
+        writeToFile(ctxPtr->srtFp[fileIdx], "%s\n", cuePtr->rows[loop].text);
+    }
+    writeToFile(ctxPtr->srtFp[fileIdx], "\n");
+}  // writeSrtCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeVttCue()
+ |
+ | DESCRIPTION:
+ |    This function writes a WebVTT cue, positioned at the top row and leftmost
+ |    column of its text, with a line per row of text.
+ -------------------------------------------------------------------------------*/
+static void writeVttCue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    uint8 fileIdx = cuePtr->channelNum - 1;
+    char startTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+    char endTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+    uint8 column = cuePtr->rows[0].column;
+
+    for( int loop = 1; loop < cuePtr->numRows; loop++ ) {
+        if( cuePtr->rows[loop].column < column ) column = cuePtr->rows[loop].column;
+    }
+
+    cueTimeToString(&cuePtr->startTime, '.', startTimeStr);
+    cueTimeToString(&cuePtr->endTime, '.', endTimeStr);
+
+    writeToFile(ctxPtr->vttFp[fileIdx], "\n%s --> %s line:%d%% position:%d%% align:start\n", startTimeStr, endTimeStr,
+                CUE_OUTPUT_SAFE_AREA_OFFSET_PERCENT + (((cuePtr->rows[0].rowNumber - 1) * CUE_OUTPUT_SAFE_AREA_SIZE_PERCENT) / LINE21_SCREEN_NUM_ROWS),
+                CUE_OUTPUT_SAFE_AREA_OFFSET_PERCENT + ((column * CUE_OUTPUT_SAFE_AREA_SIZE_PERCENT) / LINE21_SCREEN_NUM_COLUMNS));
+    for( int loop = 0; loop < cuePtr->numRows; loop++ ) {
+        writeVttText(ctxPtr->vttFp[fileIdx], cuePtr->rows[loop].text);
+    }
+}  // writeVttCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeServiceVttCue()
+ |
+ | DESCRIPTION:
+ |    This function writes a WebVTT cue for a DTVCC window. The anchor point of
+ |    the window picks how the cue lines up against its line and position.
+ -------------------------------------------------------------------------------*/
+static void writeServiceVttCue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    static const char* lineAlign[DTVCC_WINDOW_ANCHORS_PER_ROW] = { "start", "center", "end" };
+    static const char* positionAlign[DTVCC_WINDOW_ANCHORS_PER_ROW] = { "line-left", "center", "line-right" };
+    static const char* textAlign[DTVCC_WINDOW_ANCHORS_PER_ROW] = { "left", "center", "right" };
+    FILE* fp = ctxPtr->serviceVttFp[cuePtr->channelNum - 1];
+    char startTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+    char endTimeStr[CUE_OUTPUT_TIME_STR_SIZE];
+    uint8 vertIdx = (cuePtr->anchorId / DTVCC_WINDOW_ANCHORS_PER_ROW) % DTVCC_WINDOW_ANCHORS_PER_ROW;
+    uint8 horzIdx = cuePtr->anchorId % DTVCC_WINDOW_ANCHORS_PER_ROW;
+
+    cueTimeToString(&cuePtr->startTime, '.', startTimeStr);
+    cueTimeToString(&cuePtr->endTime, '.', endTimeStr);
+
+    writeToFile(fp, "\n%s --> %s line:%d%%,%s position:%d%%,%s align:%s\n", startTimeStr, endTimeStr,
+                cuePtr->anchorVertPercent, lineAlign[vertIdx], cuePtr->anchorHorzPercent, positionAlign[horzIdx], textAlign[horzIdx]);
+    for( int loop = 0; loop < cuePtr->numRows; loop++ ) {
+        writeVttText(fp, cuePtr->rows[loop].text);
+    }
+}  // writeServiceVttCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeServiceJsonCue()
+ |
+ | DESCRIPTION:
+ |    This function writes a DTVCC cue as a single line JSON object, with times
+ |    in milliseconds and the window anchor as a percentage of the screen.
+ -------------------------------------------------------------------------------*/
+static void writeServiceJsonCue( CueOutputCtx* ctxPtr, CaptionCue* cuePtr ) {
+    FILE* fp = ctxPtr->serviceJsonFp[cuePtr->channelNum - 1];
+
+    writeToFile(fp, "%s\n{\"start\":%ld,\"end\":%ld,\"window\":%d,\"anchor\":%d,\"line\":%d,\"position\":%d,\"rows\":[",
+                (ctxPtr->numServiceCues[cuePtr->channelNum - 1] == 0) ? "" : ",",
+                captionTimeToMs(&cuePtr->startTime), captionTimeToMs(&cuePtr->endTime), cuePtr->windowId,
+                cuePtr->anchorId, cuePtr->anchorVertPercent, cuePtr->anchorHorzPercent);
+    for( int loop = 0; loop < cuePtr->numRows; loop++ ) {
+        writeToFile(fp, "%s{\"row\":%d,\"column\":%d,\"text\":\"", (loop == 0) ? "" : ",",
+                    cuePtr->rows[loop].rowNumber, cuePtr->rows[loop].column);
+        writeJsonText(fp, cuePtr->rows[loop].text);
+        writeToFile(fp, "\"}");
+    }
+    writeToFile(fp, "]}");
+}  // writeServiceJsonCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeVttText()
+ |
+ | DESCRIPTION:
+ |    This function writes a row of cue text, escaping the characters which
+ |    WebVTT would otherwise read as markup.
+ -------------------------------------------------------------------------------*/
+static void writeVttText( FILE* fp, char* textStr ) {
+    for( char* charPtr = textStr; *charPtr != '\0'; charPtr++ ) {
+        switch( *charPtr ) {
+            case '&':
+                writeToFile(fp, "&amp;");
+                break;
+            case '<':
+                writeToFile(fp, "&lt;");
+                break;
+            case '>':
+                writeToFile(fp, "&gt;");
+                break;
+            default:
+                writeToFile(fp, "%c", *charPtr);
+                break;
+        }
+    }
+    writeToFile(fp, "\n");
+}  // writeVttText()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeJsonText()
+ |
+ | DESCRIPTION:
+ |    This function writes a row of cue text as the body of a JSON string,
+ |    escaping quotes, backslashes and control characters.
+ -------------------------------------------------------------------------------*/
+static void writeJsonText( FILE* fp, char* textStr ) {
+    for( char* charPtr = textStr; *charPtr != '\0'; charPtr++ ) {
+        if( (*charPtr == '"') || (*charPtr == '\\') ) {
+            writeToFile(fp, "\\%c", *charPtr);
+        } else if( (uint8)*charPtr < 0x20 ) {
+            writeToFile(fp, "\\u%04X", (uint8)*charPtr);
+        } else {
+            writeToFile(fp, "%c", *charPtr);
+        }
+    }
+}  // writeJsonText()
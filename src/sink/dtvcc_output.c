@@ -199,8 +199,16 @@ uint8 DtvccOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(buffPtr);
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->dtvccOutputCtxPtr);
-    DtvccData* dtvccDataPtr = (DtvccData*)buffPtr->dataPtr;
     DtvccOutputCtx* ctxPtr = ((Context*)rootCtxPtr)->dtvccOutputCtxPtr;
+    DtvccData dtvccData;
+    DtvccData* dtvccDataPtr = &dtvccData;
+    uint16 offset = 0;
+
+    // Every element of a buffer is from the same Service Block, so the first names the file
+    if( DtvccDecodeNextEvent(buffPtr, &offset, dtvccDataPtr) == FALSE ) {
+        FreeBuffer(buffPtr);
+        return PIPELINE_SUCCESS;
+    }
 
     if( ctxPtr->fp[dtvccDataPtr->serviceNumber-1] == NULL ) {
         char uniqueFileName[MAX_FILE_NAME_LEN];
@@ -216,9 +224,9 @@ uint8 DtvccOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
         LOG(DEBUG_LEVEL_INFO, DBG_708_OUT, "Creating new DTVCC File for Output: %s", uniqueFileName);
     }
 
-    for( int loop = 0; loop < buffPtr->numElements; loop++ ) {
-        writeDtvccData( ctxPtr, &buffPtr->captionTime, &dtvccDataPtr[loop] );
-    }
+    do {
+        writeDtvccData( ctxPtr, &buffPtr->captionTime, dtvccDataPtr );
+    } while( DtvccDecodeNextEvent(buffPtr, &offset, dtvccDataPtr) == TRUE );
     
     FreeBuffer(buffPtr);
     return PIPELINE_SUCCESS;
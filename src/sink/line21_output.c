@@ -155,29 +155,30 @@ uint8 Line21OutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->line21OutputCtxPtr);
     Line21OutputCtx* ctxPtr = ((Context*)rootCtxPtr)->line21OutputCtxPtr;
-    Line21Code* line21CodePtr = (Line21Code*)buffPtr->dataPtr;
+    Line21Code line21Code;
+    uint16 offset = 0;
 
-    for( int loop = 0; loop < buffPtr->numElements; loop++ ) {
-        ASSERT(line21CodePtr[loop].channelNum);
+    while( Line21DecodeNextEvent(buffPtr, &offset, &line21Code) == TRUE ) {
+        ASSERT(line21Code.channelNum);
 
-        if( ctxPtr->fp[line21CodePtr[loop].channelNum-1] == NULL ) {
+        if( ctxPtr->fp[line21Code.channelNum-1] == NULL ) {
             char uniqueFileName[MAX_FILE_NAME_LEN];
             strncpy(uniqueFileName, ctxPtr->outputFileName, MAX_FILE_NAME_LEN);
             char* tmpCharPtr = strrchr(uniqueFileName, '.');
             ASSERT(tmpCharPtr);
             *tmpCharPtr = '\0';
             char suffix[10];
-            sprintf(suffix, "-C%d.608", line21CodePtr[loop].channelNum);
+            sprintf(suffix, "-C%d.608", line21Code.channelNum);
             strncat(uniqueFileName, suffix, (MAX_FILE_NAME_LEN - strlen(uniqueFileName)));
-            ctxPtr->fp[line21CodePtr[loop].channelNum-1] = fileOutputInit(uniqueFileName);
+            ctxPtr->fp[line21Code.channelNum-1] = fileOutputInit(uniqueFileName);
             LOG(DEBUG_LEVEL_INFO, DBG_608_OUT, "Creating new Line-21 File for Output: %s", uniqueFileName);
             tmpCharPtr = strrchr(uniqueFileName, '.');
             ASSERT(tmpCharPtr);
             *tmpCharPtr = '\0';
-            writeToFile(ctxPtr->fp[line21CodePtr[loop].channelNum-1], "Decoded Line 21 / CEA-608 for Asset: %s - Channel: %d", uniqueFileName, line21CodePtr[loop].channelNum);
+            writeToFile(ctxPtr->fp[line21Code.channelNum-1], "Decoded Line 21 / CEA-608 for Asset: %s - Channel: %d", uniqueFileName, line21Code.channelNum);
         }
 
-        writeLine21codeToText(ctxPtr, line21CodePtr[loop], &buffPtr->captionTime);
+        writeLine21codeToText(ctxPtr, line21Code, &buffPtr->captionTime);
     }
     
     FreeBuffer(buffPtr);
@@ -250,7 +251,7 @@ char* Line21DecodeBasicNACharacter( uint8 basicCharCode ) {
  |    Line21DecodeSpecialCharacter()
  |
  | INPUT PARAMETERS:
- |    specialCharCode - Special Character Code to decode.
+ |    specialCharCode - Special Character Code to decode, with or without the 0x30.
  |
  | RETURN VALUES:
  |    char* - Decoded UTF-8 Special Character
@@ -261,6 +262,8 @@ char* Line21DecodeBasicNACharacter( uint8 basicCharCode ) {
 char* Line21DecodeSpecialCharacter( uint8 specialCharCode ) {
     if( (specialCharCode > 0x2F) && (specialCharCode < 0x40) ) {
         return normalizedSpecialNaCharSet[(specialCharCode - 0x30)];
+    } else if( specialCharCode <= SPCL_NA_CHAR_MASK ) {
+        return normalizedSpecialNaCharSet[specialCharCode];
     } else {
         LOG( DEBUG_LEVEL_ERROR, DBG_608_OUT, "Invalid Special Character Code: 0x%02X", specialCharCode );
         return BARF;
@@ -283,8 +286,8 @@ char* Line21DecodeSpecialCharacter( uint8 specialCharCode ) {
  -------------------------------------------------------------------------------*/
 char* Line21DecodeExtendedCharacter( uint8 charSet, uint8 extendedCharCode ) {
     if( ((charSet != EXT_W_EURO_CHAR_SET_SPANISH_FRENCH) && (charSet != EXT_W_EURO_CHAR_SET_DUTCH_GERMAN)) ||
-        !((charSet>0x1F) && (charSet<0x40)) ) {
-        LOG( DEBUG_LEVEL_ERROR, DBG_608_OUT, "Invalid Extended Character Code: 0x%02X 0x%02X", extendedCharCode );
+        !((extendedCharCode>0x1F) && (extendedCharCode<0x40)) ) {
+        LOG( DEBUG_LEVEL_ERROR, DBG_608_OUT, "Invalid Extended Character Code: 0x%02X 0x%02X", charSet, extendedCharCode );
         return BARF;
     }
 
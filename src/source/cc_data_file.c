@@ -0,0 +1,527 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "debug.h"
+
+#include "cc_data_file.h"
+#include "cc_utils.h"
+#include "pipeline_utils.h"
+#include "buffer_utils.h"
+#include "block_reader.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static boolean decodeHeader( uint8*, CcDataFileHeader* );
+static void readIndex( CcDataFileCtx* );
+static void getTime( CcDataFileCtx*, uint8*, CaptionTime* );
+static uint8 passFrames( Context*, CaptionTime*, uint32, uint8*, uint16, boolean* );
+static uint8 passFillRun( Context*, uint32, uint32, boolean* );
+static uint32 fillFrameToMs( CcDataFileCtx*, uint32 );
+static uint8 closeCcDataFile( Context*, boolean* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataFileInitialize()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    fileNameStr - The name of the source file.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This initializes the CC Data File Source part of the pipeline, reading the
+ |    header and the time index of a file written by the Cache Output.
+ -------------------------------------------------------------------------------*/
+boolean CcDataFileInitialize( Context* rootCtxPtr, char* fileNameStr ) {
+    uint8 header[CC_DATA_FILE_HEADER_SIZE];
+    CcDataFileHeader fileHeader;
+
+    ASSERT(rootCtxPtr);
+    ASSERT(!rootCtxPtr->ccDataFileCtxPtr);
+    ASSERT(fileNameStr);
+
+    rootCtxPtr->ccDataFileCtxPtr = malloc(sizeof(CcDataFileCtx));
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+
+    ctxPtr->numFramesRead = 0;
+    ctxPtr->firstRecordPos = CC_DATA_FILE_HEADER_SIZE;
+    ctxPtr->endOfRecordsPos = LONG_MAX;
+    ctxPtr->timeCodeIndexPtr = NULL;
+    ctxPtr->skipUntilMs = 0;
+    ctxPtr->framesBufferPtr = NULL;
+    ctxPtr->captionsFilePtr = BlockReaderOpenStream(fileNameStr);
+
+    if( ctxPtr->captionsFilePtr == NULL ) {
+        char filePath[PATH_MAX];
+        filePath[0] = '\0';
+        getcwd(filePath, sizeof(filePath));
+        LOG(DEBUG_LEVEL_FATAL, DBG_FILE_IN, "Unable to Open File: %s (looking here: %s) - [Errno %d] %s", fileNameStr, filePath, errno, strerror(errno));
+        free(ctxPtr);
+        rootCtxPtr->ccDataFileCtxPtr = NULL;
+        return FALSE;
+    }
+
+    strncpy(ctxPtr->captionFileName, fileNameStr, MAX_FILE_NAME_LEN);
+    ctxPtr->captionFileName[MAX_FILE_NAME_LEN-1] = '\0';
+
+    if( (fread(header, 1, CC_DATA_FILE_HEADER_SIZE, ctxPtr->captionsFilePtr) != CC_DATA_FILE_HEADER_SIZE) ||
+        (decodeHeader(header, &fileHeader) == FALSE) ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Not a CC Data File: %s", fileNameStr);
+        fclose(ctxPtr->captionsFilePtr);
+        free(ctxPtr);
+        rootCtxPtr->ccDataFileCtxPtr = NULL;
+        return FALSE;
+    }
+
+    ctxPtr->frameRateTimesOneHundred = fileHeader.frameRateTimesOneHundred;
+    ctxPtr->isDropFrame = fileHeader.isDropFrame;
+    ctxPtr->timeSource = fileHeader.timeSource;
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Frame Rate: %d.%d", (ctxPtr->frameRateTimesOneHundred / 100), (ctxPtr->frameRateTimesOneHundred % 100) );
+
+    InitSinks(&ctxPtr->sinks, CCD_FILE___CC_DATA);
+
+    readIndex(ctxPtr);
+    fseek(ctxPtr->captionsFilePtr, ctxPtr->firstRecordPos, SEEK_SET);
+
+    if( rootCtxPtr->config.startTimeMs != 0 ) {
+        if( CcDataFileSeekToTime(rootCtxPtr, rootCtxPtr->config.startTimeMs) == FALSE ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Seek to Start Time in CC Data File - [Errno %d] %s", errno, strerror(errno));
+            fclose(ctxPtr->captionsFilePtr);
+            TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+            free(ctxPtr);
+            rootCtxPtr->ccDataFileCtxPtr = NULL;
+            return FALSE;
+        }
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Starting at Byte %ld of CC Data File", ftell(ctxPtr->captionsFilePtr));
+    }
+
+    return TRUE;
+}  // CcDataFileInitialize()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataFileAddSink()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    linkInfo - Information of the next element in the pipeline.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This adds another sink in the pipeline after this element.
+ -------------------------------------------------------------------------------*/
+boolean CcDataFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->ccDataFileCtxPtr);
+
+    if( linkInfo.sourceType != DATA_TYPE_CC_DATA ) {
+        LOG(DEBUG_LEVEL_FATAL, DBG_FILE_IN, "Can't Add Incompatible Sink %d", linkInfo.sourceType);
+        return FALSE;
+    }
+
+    return AddSink(&rootCtxPtr->ccDataFileCtxPtr->sinks, &linkInfo);
+}  // CcDataFileAddSink()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataFileProcNextBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    isDonePtr - Whether or not the file has been completely read.
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method reads the next record of the file and passes the frames it
+ |    holds down the pipeline, the same way that they were passed to the Cache
+ |    Output when the file was written.
+ -------------------------------------------------------------------------------*/
+boolean CcDataFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
+    uint8 record[CC_DATA_FILE_MAX_RECORD_SIZE];
+    CaptionTime captionTime;
+
+    ASSERT(isDonePtr);
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->ccDataFileCtxPtr);
+
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+    FILE* filePtr = ctxPtr->captionsFilePtr;
+
+    if( ctxPtr->sinks.numSinks == 0 ) {
+        LOG(DEBUG_LEVEL_FATAL, DBG_FILE_IN, "Can't Process Buffers with no Sinks");
+        return FALSE;
+    }
+
+    if( filePtr == NULL ) {
+        LOG(DEBUG_LEVEL_FATAL, DBG_FILE_IN, "Unable to read from NULL file");
+        return FALSE;
+    }
+
+    long recordPos = ftell(filePtr);
+    if( (recordPos >= ctxPtr->endOfRecordsPos) || (fread(record, 1, 1, filePtr) != 1) ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End of CC Data File");
+        return closeCcDataFile(rootCtxPtr, isDonePtr);
+    }
+
+    switch( record[0] ) {
+        case CC_DATA_RECORD_FRAME:
+            if( fread(record, 1, (CC_DATA_FILE_TIME_SIZE + 1), filePtr) == (CC_DATA_FILE_TIME_SIZE + 1) ) {
+                uint16 numElements = 3 * record[CC_DATA_FILE_TIME_SIZE];
+                getTime(ctxPtr, record, &captionTime);
+                if( (numElements != 0) && (fread(record, 1, numElements, filePtr) == numElements) ) {
+                    return passFrames(rootCtxPtr, &captionTime, 1, record, numElements, isDonePtr);
+                }
+            }
+            break;
+        case CC_DATA_RECORD_PADDING_RUN:
+            if( fread(record, 1, (CC_DATA_FILE_TIME_SIZE + 4 + 1), filePtr) == (CC_DATA_FILE_TIME_SIZE + 4 + 1) ) {
+                uint32 numFrames = CC_DATA_FILE_GET_32(&record[CC_DATA_FILE_TIME_SIZE]);
+                uint16 numElements = 3 * record[CC_DATA_FILE_TIME_SIZE + 4];
+                getTime(ctxPtr, record, &captionTime);
+                if( (numElements != 0) && (fread(record, 1, numElements, filePtr) == numElements) ) {
+                    return passFrames(rootCtxPtr, &captionTime, numFrames, record, numElements, isDonePtr);
+                }
+            }
+            break;
+        case CC_DATA_RECORD_FILL_RUN:
+            if( fread(record, 1, (4 + 4), filePtr) == (4 + 4) ) {
+                return passFillRun(rootCtxPtr, CC_DATA_FILE_GET_32(&record[0]), CC_DATA_FILE_GET_32(&record[4]), isDonePtr);
+            }
+            break;
+        default:
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unknown Record Type %d at Byte %ld of CC Data File", record[0], recordPos);
+            return closeCcDataFile(rootCtxPtr, isDonePtr);
+    }
+
+    LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Truncated Record at Byte %ld of CC Data File", recordPos);
+    return closeCcDataFile(rootCtxPtr, isDonePtr);
+} // CcDataFileProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataFileSeekToTime()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    timeInMs - Time to seek to, in milliseconds from the start of the asset.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This positions the file at the indexed record ahead of the time, and
+ |    leaves the frames read before the time to be skipped, so that the next
+ |    frame passed is the first at or after it. Without an index the file is
+ |    read from the first record.
+ -------------------------------------------------------------------------------*/
+boolean CcDataFileSeekToTime( Context* rootCtxPtr, uint32 timeInMs ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->ccDataFileCtxPtr);
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+    long lowPos = ctxPtr->firstRecordPos;
+    long highPos = -1;
+
+    if( ctxPtr->timeCodeIndexPtr != NULL ) {
+        TimeCodeIndexLookup(ctxPtr->timeCodeIndexPtr, timeInMs, &lowPos, &highPos);
+    }
+
+    ctxPtr->skipUntilMs = timeInMs;
+    return (fseek(ctxPtr->captionsFilePtr, lowPos, SEEK_SET) == 0) ? TRUE : FALSE;
+}  // CcDataFileSeekToTime()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    CcDataFileReadHeader()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the CC Data File.
+ |
+ | RETURN VALUES:
+ |    headerPtr - The header of the file.
+ |    boolean - TRUE is Successful and FALSE if the file is not a CC Data File.
+ |
+ | DESCRIPTION:
+ |    This reads just the header of a CC Data File, for the pipeline to be
+ |    plumbed to suit the times the file holds before the file is opened.
+ -------------------------------------------------------------------------------*/
+boolean CcDataFileReadHeader( char* fileNameStr, CcDataFileHeader* headerPtr ) {
+    uint8 header[CC_DATA_FILE_HEADER_SIZE];
+    ASSERT(fileNameStr);
+    ASSERT(headerPtr);
+
+    FILE* filePtr = fopen(fileNameStr, "r");
+    if( filePtr == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Open File: %s - [Errno %d] %s", fileNameStr, errno, strerror(errno));
+        return FALSE;
+    }
+
+    size_t total = fread(header, 1, CC_DATA_FILE_HEADER_SIZE, filePtr);
+    fclose(filePtr);
+
+    return ((total == CC_DATA_FILE_HEADER_SIZE) && (decodeHeader(header, headerPtr) == TRUE)) ? TRUE : FALSE;
+}  // CcDataFileReadHeader()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeHeader()
+ |
+ | DESCRIPTION:
+ |    This unpacks the header of a CC Data File, checking the magic and version.
+ -------------------------------------------------------------------------------*/
+static boolean decodeHeader( uint8* header, CcDataFileHeader* headerPtr ) {
+    if( memcmp(header, CC_DATA_FILE_MAGIC, CC_DATA_FILE_MAGIC_SIZE) != 0 ) {
+        return FALSE;
+    }
+
+    headerPtr->version = header[4];
+    headerPtr->timeSource = header[5];
+    headerPtr->isDropFrame = (header[6] != 0) ? TRUE : FALSE;
+    headerPtr->frameRateTimesOneHundred = CC_DATA_FILE_GET_32(&header[8]);
+
+    if( headerPtr->version != CC_DATA_FILE_VERSION ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unsupported CC Data File Version: %d", headerPtr->version);
+        return FALSE;
+    }
+    return TRUE;
+}  // decodeHeader()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    readIndex()
+ |
+ | DESCRIPTION:
+ |    This reads the time index from the end of the file, as located by the
+ |    trailer. A file without a trailer, such as one whose writer never shut
+ |    down, is read through to its end without an index.
+ -------------------------------------------------------------------------------*/
+static void readIndex( CcDataFileCtx* ctxPtr ) {
+    uint8 trailer[CC_DATA_FILE_TRAILER_SIZE];
+    uint8 entry[CC_DATA_FILE_INDEX_ENTRY_SIZE];
+    FILE* filePtr = ctxPtr->captionsFilePtr;
+
+    fseek(filePtr, 0, SEEK_END);
+    long fileSize = ftell(filePtr);
+    ctxPtr->endOfRecordsPos = fileSize;
+
+    if( (fileSize < (CC_DATA_FILE_HEADER_SIZE + CC_DATA_FILE_TRAILER_SIZE)) ||
+        (fseek(filePtr, (fileSize - CC_DATA_FILE_TRAILER_SIZE), SEEK_SET) != 0) ||
+        (fread(trailer, 1, CC_DATA_FILE_TRAILER_SIZE, filePtr) != CC_DATA_FILE_TRAILER_SIZE) ||
+        (memcmp(&trailer[12], CC_DATA_FILE_MAGIC, CC_DATA_FILE_MAGIC_SIZE) != 0) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_FILE_IN, "CC Data File has no Index, reading all of it: %s", ctxPtr->captionFileName);
+        return;
+    }
+
+    long indexPos = CC_DATA_FILE_GET_32(&trailer[0]);
+    uint32 numEntries = CC_DATA_FILE_GET_32(&trailer[4]);
+    if( (indexPos < ctxPtr->firstRecordPos) ||
+        ((indexPos + ((long)numEntries * CC_DATA_FILE_INDEX_ENTRY_SIZE) + CC_DATA_FILE_TRAILER_SIZE) != fileSize) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_FILE_IN, "CC Data File has a Damaged Index, reading all of it: %s", ctxPtr->captionFileName);
+        return;
+    }
+
+    ctxPtr->endOfRecordsPos = indexPos;
+    ctxPtr->timeCodeIndexPtr = TimeCodeIndexNew(ctxPtr->firstRecordPos);
+    fseek(filePtr, indexPos, SEEK_SET);
+    for( uint32 loop = 0; loop < numEntries; loop++ ) {
+        if( fread(entry, 1, CC_DATA_FILE_INDEX_ENTRY_SIZE, filePtr) != CC_DATA_FILE_INDEX_ENTRY_SIZE ) break;
+        TimeCodeIndexAdd(ctxPtr->timeCodeIndexPtr, CC_DATA_FILE_GET_32(&entry[0]), (long)CC_DATA_FILE_GET_32(&entry[4]));
+    }
+
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Read %d Frames of CC Data with %d Index Entries from: %s", CC_DATA_FILE_GET_32(&trailer[8]),
+        ctxPtr->timeCodeIndexPtr->numEntries, ctxPtr->captionFileName);
+}  // readIndex()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    getTime()
+ |
+ | DESCRIPTION:
+ |    This unpacks the time of a frame from a record, adding the frame rate,
+ |    drop frame and source of the time from the header.
+ -------------------------------------------------------------------------------*/
+static void getTime( CcDataFileCtx* ctxPtr, uint8* recordPtr, CaptionTime* captionTimePtr ) {
+    captionTimePtr->hour = recordPtr[0];
+    captionTimePtr->minute = recordPtr[1];
+    captionTimePtr->second = recordPtr[2];
+    captionTimePtr->frame = recordPtr[3];
+    captionTimePtr->millisecond = (uint16)(recordPtr[4] | (recordPtr[5] << 8));
+    captionTimePtr->dropframe = ctxPtr->isDropFrame;
+    captionTimePtr->frameRatePerSecTimesOneHundred = ctxPtr->frameRateTimesOneHundred;
+    captionTimePtr->source = ctxPtr->timeSource;
+}  // getTime()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    passFrames()
+ |
+ | DESCRIPTION:
+ |    This passes a run of frames which all carry the same cc_data, skipping any
+ |    before the time sought and ending the file at the end time.
+ -------------------------------------------------------------------------------*/
+static uint8 passFrames( Context* rootCtxPtr, CaptionTime* firstTimePtr, uint32 numFrames, uint8* dataPtr, uint16 numElements, boolean* isDonePtr ) {
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+    uint8 retval = PIPELINE_SUCCESS;
+    CaptionTime captionTime = *firstTimePtr;
+
+    for( uint32 loop = 0; loop < numFrames; loop++ ) {
+        if( loop != 0 ) {
+            frameTimeInRun(firstTimePtr, loop, &captionTime);
+        }
+
+        uint32 timeInMs = captionTimeToMs(&captionTime);
+        if( timeInMs < ctxPtr->skipUntilMs ) {
+            continue;
+        }
+
+        if( (rootCtxPtr->config.endTimeMs != 0) && (timeInMs >= rootCtxPtr->config.endTimeMs) ) {
+            LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End Time in CC Data File");
+            return closeCcDataFile(rootCtxPtr, isDonePtr);
+        }
+
+        ctxPtr->numFramesRead++;
+        if( PassFrameToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &captionTime, dataPtr, numElements, &ctxPtr->sinks) == PIPELINE_FAILURE ) {
+            retval = PIPELINE_FAILURE;
+        }
+    }
+
+    return retval;
+}  // passFrames()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    passFillRun()
+ |
+ | DESCRIPTION:
+ |    This passes a run of fill frames as a single fill buffer, trimmed to the
+ |    frames from the time sought up to the end time.
+ -------------------------------------------------------------------------------*/
+static uint8 passFillRun( Context* rootCtxPtr, uint32 firstFrameNum, uint32 numFrames, boolean* isDonePtr ) {
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+    uint8 retval = PIPELINE_SUCCESS;
+    boolean isEndReached = FALSE;
+
+    while( (numFrames != 0) && (fillFrameToMs(ctxPtr, firstFrameNum) < ctxPtr->skipUntilMs) ) {
+        firstFrameNum++;
+        numFrames--;
+    }
+
+    if( rootCtxPtr->config.endTimeMs != 0 ) {
+        uint32 numBeforeEnd = 0;
+        while( (numBeforeEnd < numFrames) && (fillFrameToMs(ctxPtr, (firstFrameNum + numBeforeEnd)) < rootCtxPtr->config.endTimeMs) ) {
+            numBeforeEnd++;
+        }
+        isEndReached = (numBeforeEnd < numFrames) ? TRUE : FALSE;
+        numFrames = numBeforeEnd;
+    }
+
+    if( numFrames != 0 ) {
+        if( (ctxPtr->framesBufferPtr != NULL) &&
+            (FlushFramesToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &ctxPtr->sinks) == PIPELINE_FAILURE) ) {
+            retval = PIPELINE_FAILURE;
+        }
+
+        Buffer* newBufferPtr = NewBuffer(BUFFER_TYPE_FILL, 1);
+        frameToTimeCode(firstFrameNum, ctxPtr->frameRateTimesOneHundred, &newBufferPtr->captionTime);
+        newBufferPtr->captionTime.dropframe = ctxPtr->isDropFrame;
+        newBufferPtr->numElements = newBufferPtr->maxNumElements;
+
+        FillRun* fillRunPtr = (FillRun*)newBufferPtr->dataPtr;
+        fillRunPtr->firstFrameNum = firstFrameNum;
+        fillRunPtr->numFrames = numFrames;
+        ctxPtr->numFramesRead = ctxPtr->numFramesRead + numFrames;
+
+        if( PassToSinks(rootCtxPtr, newBufferPtr, &ctxPtr->sinks) == PIPELINE_FAILURE ) {
+            retval = PIPELINE_FAILURE;
+        }
+    }
+
+    if( isEndReached == TRUE ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End Time in CC Data File");
+        return closeCcDataFile(rootCtxPtr, isDonePtr);
+    }
+    return retval;
+}  // passFillRun()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    fillFrameToMs()
+ |
+ | DESCRIPTION:
+ |    This returns the time of a frame of a fill run, in milliseconds.
+ -------------------------------------------------------------------------------*/
+static uint32 fillFrameToMs( CcDataFileCtx* ctxPtr, uint32 frameNum ) {
+    CaptionTime captionTime;
+
+    frameToTimeCode(frameNum, ctxPtr->frameRateTimesOneHundred, &captionTime);
+    return captionTimeToMs(&captionTime);
+}  // fillFrameToMs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeCcDataFile()
+ |
+ | DESCRIPTION:
+ |    This passes on any frames still being gathered and closes the file once it
+ |    has been read as far as is wanted, either to the end or to the end of the
+ |    requested time range, and shuts down the rest of the pipeline.
+ -------------------------------------------------------------------------------*/
+static uint8 closeCcDataFile( Context* rootCtxPtr, boolean* isDonePtr ) {
+    CcDataFileCtx* ctxPtr = rootCtxPtr->ccDataFileCtxPtr;
+
+    LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "CC Data File: %s contained %d frames of caption data", ctxPtr->captionFileName, ctxPtr->numFramesRead);
+    Sinks sinks = ctxPtr->sinks;
+    FlushFramesToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &sinks);
+    fclose(ctxPtr->captionsFilePtr);
+    TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+    free(ctxPtr);
+    rootCtxPtr->ccDataFileCtxPtr = NULL;
+    *isDonePtr = TRUE;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // closeCcDataFile()
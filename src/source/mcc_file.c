@@ -30,6 +30,7 @@
 #include "cc_utils.h"
 #include "pipeline_utils.h"
 #include "buffer_utils.h"
+#include "block_reader.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Variables                          --*/
@@ -43,6 +44,8 @@
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static uint8 closeCaptionsFile( Context*, boolean* );
+
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
 /*----------------------------------------------------------------------------*/
@@ -78,13 +81,15 @@ boolean MccFileInitialize( Context* rootCtxPtr, char* fileNameStr ) {
 
     ctxPtr->numCaptionsLinesRead = 0;
     ctxPtr->captionsFilePtr = NULL;
+    ctxPtr->firstLinePos = 0;
+    ctxPtr->timeCodeIndexPtr = NULL;
     ctxPtr->frameRateTimesOneHundred = 2400;
     ctxPtr->isDropFrame = FALSE;
     ctxPtr->oneShotWarningFlag = FALSE;
 
     ctxPtr->numCaptionsLinesRead = 0;
     ASSERT(fileNameStr);
-    ctxPtr->captionsFilePtr = fopen(fileNameStr, "r");
+    ctxPtr->captionsFilePtr = BlockReaderOpenStream(fileNameStr);
     
     if( ctxPtr->captionsFilePtr == NULL ) {
         char filePath[PATH_MAX];
@@ -151,7 +156,24 @@ boolean MccFileInitialize( Context* rootCtxPtr, char* fileNameStr ) {
             fseek(ctxPtr->captionsFilePtr,pos,0);
         }
     }
-    
+    ctxPtr->firstLinePos = pos;
+
+    if( rootCtxPtr->config.startTimeMs != 0 ) {
+        // Without the index the seek still works, by bisecting the whole file
+        if( MccFileBuildIndex(rootCtxPtr) == FALSE ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_FILE_IN, "Seeking to Start Time without an Index");
+        }
+        if( MccFileSeekToTime(rootCtxPtr, rootCtxPtr->config.startTimeMs) == FALSE ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Seek to Start Time in Captions File - [Errno %d] %s", errno, strerror(errno));
+            fclose(ctxPtr->captionsFilePtr);
+            TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+            free(ctxPtr);
+            rootCtxPtr->mccFileCtxPtr = NULL;
+            return FALSE;
+        }
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Starting at Byte %ld of Captions File", ftell(ctxPtr->captionsFilePtr));
+    }
+
     return TRUE;
 }  // MccFileInitialize()
 
@@ -221,13 +243,7 @@ uint8 MccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
         read = getline(&line, &len, ctxPtr->captionsFilePtr);
         if( read == -1 ) {
             LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End of Captions File");
-            LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Captions File: %s contained %d lines of caption data", ctxPtr->captionFileName, (ctxPtr->numCaptionsLinesRead+1));
-            fclose(ctxPtr->captionsFilePtr);
-            Sinks sinks = ctxPtr->sinks;
-            free(ctxPtr);
-            rootCtxPtr->mccFileCtxPtr = NULL;
-            *isDonePtr = TRUE;
-            return ShutdownSinks(rootCtxPtr, &sinks);
+            return closeCaptionsFile(rootCtxPtr, isDonePtr);
         } else if( read < 5 ) {
             line = NULL;
         }
@@ -267,6 +283,12 @@ uint8 MccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
         newBufferPtr->captionTime.dropframe = TRUE;
     }
 
+    if( (rootCtxPtr->config.endTimeMs != 0) && (captionTimeToMs(&newBufferPtr->captionTime) >= rootCtxPtr->config.endTimeMs) ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End Time in Captions File");
+        FreeBuffer(newBufferPtr);
+        return closeCaptionsFile(rootCtxPtr, isDonePtr);
+    }
+
     LOG(DEBUG_LEVEL_VERBOSE, DBG_FILE_IN,"Raw MCC - %s", mccdata);
     ctxPtr->numCaptionsLinesRead = ctxPtr->numCaptionsLinesRead + 1;
 
@@ -277,7 +299,92 @@ uint8 MccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
     
 } // MccFileProcNextBuffer()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    MccFileBuildIndex()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This indexes the time codes of the open file, so that each later seek to a
+ |    time reads just a few lines of the file, rather than bisecting the whole
+ |    file. It is built before seeking to the start time.
+ -------------------------------------------------------------------------------*/
+boolean MccFileBuildIndex( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->mccFileCtxPtr);
+    MccFileCtx* ctxPtr = rootCtxPtr->mccFileCtxPtr;
+
+    if( ctxPtr->timeCodeIndexPtr != NULL ) {
+        return TRUE;
+    }
+
+    ctxPtr->timeCodeIndexPtr = TimeCodeIndexBuild(ctxPtr->captionFileName, ctxPtr->firstLinePos, ctxPtr->frameRateTimesOneHundred);
+    if( ctxPtr->timeCodeIndexPtr == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Index Captions File: %s - [Errno %d] %s", ctxPtr->captionFileName, errno, strerror(errno));
+        return FALSE;
+    }
+
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Indexed %d Time Codes of Captions File: %s", ctxPtr->timeCodeIndexPtr->numEntries, ctxPtr->captionFileName);
+    return TRUE;
+}  // MccFileBuildIndex()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    MccFileSeekToTime()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    timeInMs - Time to seek to, in milliseconds from the start of the asset.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This positions the file at the first line of captions at or after the
+ |    time, so that the next buffer is made from that line. The index narrows
+ |    the search when one has been built, otherwise the whole file is searched.
+ -------------------------------------------------------------------------------*/
+boolean MccFileSeekToTime( Context* rootCtxPtr, uint32 timeInMs ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->mccFileCtxPtr);
+    MccFileCtx* ctxPtr = rootCtxPtr->mccFileCtxPtr;
+    long lowPos = ctxPtr->firstLinePos;
+    long highPos = -1;
+
+    if( ctxPtr->timeCodeIndexPtr != NULL ) {
+        TimeCodeIndexLookup(ctxPtr->timeCodeIndexPtr, timeInMs, &lowPos, &highPos);
+    }
+
+    return seekToTimeCode(ctxPtr->captionsFilePtr, lowPos, highPos, ctxPtr->frameRateTimesOneHundred, timeInMs);
+}  // MccFileSeekToTime()
+
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeCaptionsFile()
+ |
+ | DESCRIPTION:
+ |    This closes the file once it has been read as far as is wanted, either to
+ |    the end or to the end of the requested time range, and shuts down the rest
+ |    of the pipeline.
+ -------------------------------------------------------------------------------*/
+static uint8 closeCaptionsFile( Context* rootCtxPtr, boolean* isDonePtr ) {
+    MccFileCtx* ctxPtr = rootCtxPtr->mccFileCtxPtr;
+
+    LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Captions File: %s contained %d lines of caption data", ctxPtr->captionFileName, (ctxPtr->numCaptionsLinesRead+1));
+    fclose(ctxPtr->captionsFilePtr);
+    TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+    Sinks sinks = ctxPtr->sinks;
+    free(ctxPtr);
+    rootCtxPtr->mccFileCtxPtr = NULL;
+    *isDonePtr = TRUE;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // closeCaptionsFile()
@@ -74,6 +74,7 @@ static char* GpacDebugSectionText[GF_LOG_TOOL_MAX] = {
 
 static uint8* ccdpFindData(uint8*, uint32, uint8*);
 static void closeMovFile( MovFileCtx* );
+static uint32 findSampleAtTime( MovFileCtx*, uint32 );
 static void loggingCallback( void*, GF_LOG_Level, GF_LOG_Tool, const char*, va_list );
 #endif
 
@@ -239,6 +240,11 @@ uint8 MovFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
 
             ctxPtr->processingStreamDescriptionIndex = 0;
             ctxPtr->timescale = gf_isom_get_media_timescale(ctxPtr->movFile, ctxPtr->currentTrack+1);
+
+            if( rootCtxPtr->config.startTimeMs != 0 ) {
+                ctxPtr->currentSample = findSampleAtTime(ctxPtr, rootCtxPtr->config.startTimeMs);
+                LOG(DEBUG_LEVEL_INFO, DBG_MOV_FILE, "Starting at Sample %d of %d", ctxPtr->currentSample + 1, ctxPtr->numSamples);
+            }
         }
 
         u32 streamDescriptionIndex;
@@ -261,6 +267,16 @@ uint8 MovFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
             ctxPtr->processingStreamDescriptionIndex = streamDescriptionIndex;
         }
 
+        if( (sample != NULL) && (rootCtxPtr->config.endTimeMs != 0) &&
+            (((sample->DTS + sample->CTS_Offset)*1000/ctxPtr->timescale) >= rootCtxPtr->config.endTimeMs) ) {
+            LOG(DEBUG_LEVEL_INFO, DBG_MOV_FILE, "Reached End Time");
+            free(sample->data);
+            free(sample);
+            sample = NULL;
+            // Skip the rest of the track
+            ctxPtr->currentSample = ctxPtr->numSamples - 1;
+        }
+
         if( sample != NULL ) {
             uint64 pts = (sample->DTS + sample->CTS_Offset)*1000/ctxPtr->timescale;
 
@@ -507,6 +523,34 @@ static void closeMovFile( MovFileCtx* ctxPtr ) {
         LOG(DEBUG_LEVEL_INFO, DBG_MOV_FILE, "Found no dedicated CC track(s).");
 } // closeMovFile()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    findSampleAtTime()
+ |
+ | DESCRIPTION:
+ |    This function looks up the first sample of the current track which is
+ |    decoded at or after the start time, bisecting the sample table on decode
+ |    times rather than reading the samples before it. It returns the zero based
+ |    index of the sample, which is the number of samples when every sample of
+ |    the track is before the start time.
+ -------------------------------------------------------------------------------*/
+static uint32 findSampleAtTime( MovFileCtx* ctxPtr, uint32 startTimeMs ) {
+    uint32 lowIndex = 0;
+    uint32 highIndex = ctxPtr->numSamples;
+
+    while( lowIndex < highIndex ) {
+        uint32 midIndex = lowIndex + ((highIndex - lowIndex) / 2);
+        uint64 dts = gf_isom_get_sample_dts(ctxPtr->movFile, ctxPtr->currentTrack+1, midIndex+1);
+        if( ((dts * 1000) / ctxPtr->timescale) < startTimeMs ) {
+            lowIndex = midIndex + 1;
+        } else {
+            highIndex = midIndex;
+        }
+    }
+
+    return lowIndex;
+}  // findSampleAtTime()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    LoggingCallback()
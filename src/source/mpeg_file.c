@@ -42,6 +42,13 @@
 
 #ifndef DONT_COMPILE_FFMPEG
 static void loggingCallback( void*, int, const char*, va_list );
+static void releaseSideData( void* );
+static void configureFastDecode( AVCodecContext*, AVCodec*, uint8 );
+static int readPacket( void*, uint8_t*, int );
+static int64_t seekPacket( void*, int64_t, int );
+static void closeInput( MpegFileCtx* );
+static boolean seekToStartTime( MpegFileCtx*, uint32 );
+static uint8 endOfInput( Context*, boolean* );
 #endif
 
 /*----------------------------------------------------------------------------*/
@@ -77,7 +84,13 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     MpegFileCtx* ctxPtr = rootCtxPtr->mpegFileCtxPtr;
 
     ctxPtr->firstPts = 0;
+    ctxPtr->isFirstPtsFound = FALSE;
     ctxPtr->ccCountMismatchErrors = 0;
+    ctxPtr->framesBufferPtr = NULL;
+    ctxPtr->formatContext = NULL;
+    ctxPtr->frame = NULL;
+    ctxPtr->readerPtr = NULL;
+    ctxPtr->ioContextPtr = NULL;
 
     ctxPtr->fileSize = 0;
     ctxPtr->isFileOpen = FALSE;
@@ -150,6 +163,34 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
 
     av_log_set_callback(loggingCallback);
 
+    /**
+     * Read the input in large blocks, read ahead of the demuxer, rather than through the small
+     * synchronous reads of the default file protocol.
+     */
+    ctxPtr->readerPtr = BlockReaderOpen(rootCtxPtr->config.inputFilename, MPEG_FILE_READ_BLOCK_SIZE);
+    if( ctxPtr->readerPtr == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MPEG_FILE, "Unable to Read %s", rootCtxPtr->config.inputFilename);
+        free(ctxPtr);
+        rootCtxPtr->mpegFileCtxPtr = NULL;
+        return FALSE;
+    }
+
+    uint8* ioBufferPtr = av_malloc(MPEG_FILE_IO_BUFFER_SIZE);
+    ctxPtr->ioContextPtr = avio_alloc_context(ioBufferPtr, MPEG_FILE_IO_BUFFER_SIZE, 0, ctxPtr->readerPtr, readPacket, NULL, seekPacket);
+    ctxPtr->formatContext = avformat_alloc_context();
+    if( (ioBufferPtr == NULL) || (ctxPtr->ioContextPtr == NULL) || (ctxPtr->formatContext == NULL) ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MPEG_FILE, "Unable to Allocate Input Context");
+        // Without an I/O Context there is nothing for closeInput() to free the I/O Buffer through
+        if( ctxPtr->ioContextPtr == NULL ) {
+            av_free(ioBufferPtr);
+        }
+        closeInput(ctxPtr);
+        free(ctxPtr);
+        rootCtxPtr->mpegFileCtxPtr = NULL;
+        return FALSE;
+    }
+    ctxPtr->formatContext->pb = ctxPtr->ioContextPtr;
+
     /**
      * Initialize decoder according to the name of input
      */
@@ -159,6 +200,7 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
         filePath[0] = '\0';
         getcwd(filePath, sizeof(filePath));
         av_log(NULL,AV_LOG_ERROR,"could not open input(%s) format. Looking Here: %s\n", rootCtxPtr->config.inputFilename, filePath);
+        closeInput(ctxPtr);
         free(ctxPtr);
         rootCtxPtr->mpegFileCtxPtr = NULL;
         return FALSE;
@@ -167,6 +209,7 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     ret = avformat_find_stream_info(ctxPtr->formatContext,NULL);
     if( ret < 0 ) {
         av_log(NULL,AV_LOG_ERROR,"could not find any stream\n");
+        closeInput(ctxPtr);
         free(ctxPtr);
         rootCtxPtr->mpegFileCtxPtr = NULL;
         return FALSE;
@@ -176,6 +219,7 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     ret = av_find_best_stream(ctxPtr->formatContext, AVMEDIA_TYPE_VIDEO, -1, -1, &dec, 0);
     if( ret < 0 ) {
         av_log(NULL, AV_LOG_ERROR, "no suitable subtitle or caption\n");
+        closeInput(ctxPtr);
         free(ctxPtr);
         rootCtxPtr->mpegFileCtxPtr = NULL;
         return FALSE;
@@ -184,9 +228,13 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     stream_index = ret;
     ctxPtr->decoderContext = ctxPtr->formatContext->streams[stream_index]->codec;
     ctxPtr->streamIndex = stream_index;
+    if( rootCtxPtr->config.fastDecode == TRUE ) {
+        configureFastDecode(ctxPtr->decoderContext, dec, rootCtxPtr->config.numThreads);
+    }
     ret = avcodec_open2(ctxPtr->decoderContext, dec, NULL);
     if( ret < 0 ) {
         av_log(NULL,AV_LOG_ERROR,"unable to open codec\n");
+        closeInput(ctxPtr);
         free(ctxPtr);
         rootCtxPtr->mpegFileCtxPtr = NULL;
         return FALSE;
@@ -218,6 +266,10 @@ boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
         }
     }
 
+    if( (rootCtxPtr->config.startTimeMs != 0) && (seekToStartTime(ctxPtr, rootCtxPtr->config.startTimeMs) == FALSE) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Unable to Seek to Start Time. Decoding up to it instead.");
+    }
+
     ctxPtr->isFileOpen = TRUE;
 
     InitSinks(&ctxPtr->sinks, MPG_FILE___CC_DATA);
@@ -294,37 +346,56 @@ uint8 MpegFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
     
     while( TRUE ) {
         int retval = 0;
-        int got_frame;
         AVPacket packet;
         int64 pts = 0;
+        AVFrameSideData* ccSideDataPtr = NULL;
+
+        // Frames may come out of the decoder some packets after they went in, so only read another
+        // packet once the decoder asks for one.
+        retval = avcodec_receive_frame( ctxPtr->decoderContext, ctxPtr->frame );
+        if( retval == AVERROR(EAGAIN) ) {
+            retval = av_read_frame(ctxPtr->formatContext, &packet);
+            if( retval == AVERROR_EOF ) {
+                // Drain the frames still held by the decoder before shutting down
+                avcodec_send_packet( ctxPtr->decoderContext, NULL );
+                continue;
+            } else if( retval < 0 ) {
+                av_log(NULL, AV_LOG_ERROR, "not able to read the packet\n");
+                return FALSE;
+            } else if( packet.stream_index != ctxPtr->streamIndex ) {
+                av_packet_unref(&packet);
+                continue;
+            }
 
-        ctxPtr->len = 0;
-        
-        retval = av_read_frame(ctxPtr->formatContext, &packet);
-        if( retval == AVERROR_EOF ) {
-            *isDonePtr = TRUE;
-            Sinks sinks = ctxPtr->sinks;
-            free(ctxPtr);
-            rootCtxPtr->mpegFileCtxPtr = NULL;
-            return ShutdownSinks(rootCtxPtr, &sinks);
-        } else if( retval < 0 ) {
-            av_log(NULL, AV_LOG_ERROR, "not able to read the packet\n");
-            return FALSE;
-        } else if( packet.stream_index != ctxPtr->streamIndex ) {
-            continue;
-        }
-        
-        retval = avcodec_decode_video2( ctxPtr->decoderContext, ctxPtr->frame, &got_frame, &packet );
-        if( ctxPtr->firstPts == 0 ) {
+            if( (ctxPtr->firstPts == 0) && (ctxPtr->isFirstPtsFound == FALSE) ) {
 // TODO - Need to account for rollover
-            ctxPtr->firstPts = packet.pts;
-        }
+                ctxPtr->firstPts = packet.pts;
+            }
 
-        if( retval < 0 ) {
+            retval = avcodec_send_packet( ctxPtr->decoderContext, &packet );
+            av_packet_unref(&packet);
+            if( retval < 0 ) {
+                av_log(NULL,AV_LOG_ERROR,"unable to decode packet\n");
+                return FALSE;
+            }
+            continue;
+        } else if( retval == AVERROR_EOF ) {
+            return endOfInput(rootCtxPtr, isDonePtr);
+        } else if( retval < 0 ) {
             av_log(NULL,AV_LOG_ERROR,"unable to decode packet\n");
             return FALSE;
-        } else if( !got_frame ) {
-            continue;
+        }
+
+        if( (rootCtxPtr->config.startTimeMs != 0) || (rootCtxPtr->config.endTimeMs != 0) ) {
+            AVRational timeBase = ctxPtr->formatContext->streams[ctxPtr->streamIndex]->time_base;
+            int64 frameTimeInMs = av_rescale_q(av_frame_get_best_effort_timestamp(ctxPtr->frame) - ctxPtr->firstPts, timeBase, (AVRational){1, 1000});
+            if( (rootCtxPtr->config.endTimeMs != 0) && (frameTimeInMs >= rootCtxPtr->config.endTimeMs) ) {
+                LOG(DEBUG_LEVEL_INFO, DBG_MPEG_FILE, "Reached End Time");
+                return endOfInput(rootCtxPtr, isDonePtr);
+            } else if( frameTimeInMs < rootCtxPtr->config.startTimeMs ) {
+                // Decoding starts at the key frame before the start, so skip the frames up to it
+                continue;
+            }
         }
         
         for( int i = 0; i < ctxPtr->frame->nb_side_data; i++ ) {
@@ -334,12 +405,10 @@ uint8 MpegFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
                 pts = (((ctxPtr->frame->pts - ctxPtr->firstPts) * ctxPtr->formatContext->streams[ctxPtr->streamIndex]->time_base.num)) /
                        (ctxPtr->formatContext->streams[ctxPtr->streamIndex]->time_base.den / 1000);
 
-                if(ctxPtr->frame->side_data[i]->size > BUFSIZE) {
-                    av_log(NULL,AV_LOG_ERROR,"Please consider increasing length of data\n");
+                if(ctxPtr->frame->side_data[i]->size > UINT16_MAX) {
+                    av_log(NULL,AV_LOG_ERROR,"Skipping A53 Side Data too long for a Buffer: %d\n", ctxPtr->frame->side_data[i]->size);
                 } else {
-                    memcpy(ctxPtr->buffer, ctxPtr->frame->side_data[i]->data,
-                           ctxPtr->frame->side_data[i]->size);
-                    ctxPtr->len = ctxPtr->frame->side_data[i]->size;
+                    ccSideDataPtr = ctxPtr->frame->side_data[i];
                 }
             }
         }
@@ -347,36 +416,47 @@ uint8 MpegFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
         if( ctxPtr->bailNoCaptions != 0 ) {
             CaptionTime captionTime;
             CaptionTimeFromPts(&captionTime, pts);
-            if (captionTime.minute >= ctxPtr->bailNoCaptions) {
+            // Frames still being gathered may hold the first Captions, so pass them on before giving up
+            if( (captionTime.minute >= ctxPtr->bailNoCaptions) &&
+                (FlushFramesToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &ctxPtr->sinks) == FIRST_TEXT_FOUND) ) {
+                ctxPtr->bailNoCaptions = 0;
+            } else if (captionTime.minute >= ctxPtr->bailNoCaptions) {
                 LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Unable to find Captions after %d mins. Abandoning.", captionTime.minute);
                 *isDonePtr = TRUE;
                 Sinks sinks = ctxPtr->sinks;
+                closeInput(ctxPtr);
                 free(ctxPtr);
                 rootCtxPtr->mpegFileCtxPtr = NULL;
                 return ShutdownSinks(rootCtxPtr, &sinks);
             }
         }
 
-        if( ctxPtr->len != 0 ) {
-            ASSERT(!(ctxPtr->len % 3));
+        if( (ccSideDataPtr != NULL) && (ccSideDataPtr->size != 0) ) {
+            uint16 len = (uint16)ccSideDataPtr->size;
+            ASSERT(!(len % 3));
             uint8 ccCount = numCcConstructsFromFramerate(ctxPtr->frameRatePerSecTimesOneHundred);
-            if( ccCount != (ctxPtr->len / 3) ) {
+            if( ccCount != (len / 3) ) {
                 ctxPtr->ccCountMismatchErrors++;
                 if( ctxPtr->ccCountMismatchErrors < 5) {
-                    LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Mismatch in CC Count Expected: %d vs Actual: %d", ccCount, (ctxPtr->len / 3));
+                    LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Mismatch in CC Count Expected: %d vs Actual: %d", ccCount, (len / 3));
                 } else if( ctxPtr->ccCountMismatchErrors == 5) {
-                    LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Mismatch in CC Count Expected: %d vs Actual: %d. Suppressing Subsequent Error Messages.", ccCount, (ctxPtr->len / 3));
+                    LOG(DEBUG_LEVEL_WARN, DBG_MPEG_FILE, "Mismatch in CC Count Expected: %d vs Actual: %d. Suppressing Subsequent Error Messages.", ccCount, (len / 3));
                 }
             }
 
-            Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, ctxPtr->len);
-            outputBuffer->captionTime.frameRatePerSecTimesOneHundred = ctxPtr->frameRatePerSecTimesOneHundred;
-            outputBuffer->captionTime.dropframe = ctxPtr->isDropframe;
-            CaptionTimeFromPts(&outputBuffer->captionTime, pts);
-            outputBuffer->numElements = outputBuffer->maxNumElements;
-            memcpy(outputBuffer->dataPtr, ctxPtr->buffer, ctxPtr->len);
+            CaptionTime captionTime;
+            captionTime.frame = 0;
+            captionTime.frameRatePerSecTimesOneHundred = ctxPtr->frameRatePerSecTimesOneHundred;
+            captionTime.dropframe = ctxPtr->isDropframe;
+            CaptionTimeFromPts(&captionTime, pts);
+
+            // The Buffer borrows the side data rather than copying it, holding a reference to it
+            // which outlives the frame, until the last sink frees the Buffer.
+            AVBufferRef* ccDataRefPtr = av_buffer_ref(ccSideDataPtr->buf);
+            if( ccDataRefPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_MPEG_FILE, "Unable to Reference A53 Side Data");
 
-            uint8 returnval = PassToSinks(rootCtxPtr, outputBuffer, &ctxPtr->sinks);
+            uint8 returnval = PassFrameRefToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &captionTime, ccSideDataPtr->data, len,
+                                                  ccDataRefPtr, releaseSideData, &ctxPtr->sinks);
             if( returnval == FIRST_TEXT_FOUND ) {
                 if( ctxPtr->bailNoCaptions != 0 ) {
                     ctxPtr->bailNoCaptions = 0;
@@ -435,4 +515,162 @@ static void loggingCallback( void* ptr, int level, const char* fmt, va_list vl )
 
     DebugLog( dbgLevel, DBG_FF_MPEG, "FFMPEG", 0, message );
 }  // loggingCallback()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    releaseSideData()
+ |
+ | DESCRIPTION:
+ |    This function drops the reference to the A53 Side Data of a frame, which
+ |    a Buffer held in place of a copy of the cc_data.
+ -------------------------------------------------------------------------------*/
+static void releaseSideData( void* dataRefPtr ) {
+    AVBufferRef* bufferRefPtr = (AVBufferRef*)dataRefPtr;
+    av_buffer_unref(&bufferRefPtr);
+}  // releaseSideData()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    configureFastDecode()
+ |
+ | DESCRIPTION:
+ |    This function asks the decoder to do as little work as it can, for
+ |    --fast-decode. Only the A53 Side Data of each frame is used, so the decoder
+ |    is told to thread across frames and slices, and to skip the loop filter,
+ |    the IDCT and as much of the picture resolution as it is able to. Frames
+ |    themselves are never skipped, since their Side Data would be lost with them.
+ -------------------------------------------------------------------------------*/
+static void configureFastDecode( AVCodecContext* decoderContextPtr, AVCodec* codecPtr, uint8 numThreads ) {
+    // Zero threads lets the decoder pick a count to suit the machine
+    decoderContextPtr->thread_count = (numThreads > 1) ? numThreads : 0;
+    decoderContextPtr->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+    decoderContextPtr->skip_loop_filter = AVDISCARD_ALL;
+    decoderContextPtr->skip_idct = AVDISCARD_ALL;
+    decoderContextPtr->lowres = codecPtr->max_lowres;
+    decoderContextPtr->flags2 |= AV_CODEC_FLAG2_FAST;
+
+    LOG(DEBUG_LEVEL_INFO, DBG_MPEG_FILE, "Fast Decode of %s with Lowres %d", codecPtr->name, codecPtr->max_lowres);
+}  // configureFastDecode()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    readPacket()
+ |
+ | DESCRIPTION:
+ |    This function is the read callback of the custom I/O Context, which serves
+ |    FFMPEG's reads from the Block Reader.
+ -------------------------------------------------------------------------------*/
+static int readPacket( void* opaque, uint8_t* buf, int buf_size ) {
+    int32 bytesRead = BlockReaderRead((BlockReader*)opaque, buf, buf_size);
+
+    if( bytesRead == 0 ) {
+        return AVERROR_EOF;
+    } else if( bytesRead < 0 ) {
+        return AVERROR(EIO);
+    }
+    return (int)bytesRead;
+}  // readPacket()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    seekPacket()
+ |
+ | DESCRIPTION:
+ |    This function is the seek callback of the custom I/O Context, which also
+ |    answers FFMPEG's requests for the size of the file.
+ -------------------------------------------------------------------------------*/
+static int64_t seekPacket( void* opaque, int64_t offset, int whence ) {
+    BlockReader* readerPtr = (BlockReader*)opaque;
+
+    if( whence & AVSEEK_SIZE ) {
+        return readerPtr->fileSize;
+    }
+
+    int64 position = BlockReaderSeek(readerPtr, offset, whence & ~AVSEEK_FORCE);
+    return (position < 0) ? AVERROR(EINVAL) : position;
+}  // seekPacket()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeInput()
+ |
+ | DESCRIPTION:
+ |    This function closes the demuxer and decoder, along with the custom I/O
+ |    Context and the Block Reader beneath them.
+ -------------------------------------------------------------------------------*/
+static void closeInput( MpegFileCtx* ctxPtr ) {
+    if( ctxPtr->frame != NULL ) {
+        av_frame_free(&ctxPtr->frame);
+    }
+    if( ctxPtr->formatContext != NULL ) {
+        avformat_close_input(&ctxPtr->formatContext);
+    }
+    if( ctxPtr->ioContextPtr != NULL ) {
+        av_freep(&ctxPtr->ioContextPtr->buffer);
+        av_freep(&ctxPtr->ioContextPtr);
+    }
+    if( ctxPtr->readerPtr != NULL ) {
+        BlockReaderClose(ctxPtr->readerPtr);
+        ctxPtr->readerPtr = NULL;
+    }
+}  // closeInput()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    seekToStartTime()
+ |
+ | DESCRIPTION:
+ |    This function moves the demuxer to the key frame at or before the start
+ |    time, leaving the decoder to work forward from there. Caption times are
+ |    relative to the first packet of the video, so that is read beforehand. The
+ |    demuxer uses the index of the container where there is one, otherwise it
+ |    bisects the file on timestamps (e.g. the PTS of a Transport Stream).
+ -------------------------------------------------------------------------------*/
+static boolean seekToStartTime( MpegFileCtx* ctxPtr, uint32 startTimeMs ) {
+    AVStream* streamPtr = ctxPtr->formatContext->streams[ctxPtr->streamIndex];
+    AVPacket packet;
+    boolean isPacketFound = FALSE;
+
+    while( isPacketFound == FALSE ) {
+        if( av_read_frame(ctxPtr->formatContext, &packet) < 0 ) {
+            return FALSE;
+        }
+        if( packet.stream_index == ctxPtr->streamIndex ) {
+            ctxPtr->firstPts = packet.pts;
+            ctxPtr->isFirstPtsFound = TRUE;
+            isPacketFound = TRUE;
+        }
+        av_packet_unref(&packet);
+    }
+
+    int64 startPts = ctxPtr->firstPts + av_rescale_q(startTimeMs, (AVRational){1, 1000}, streamPtr->time_base);
+    if( av_seek_frame(ctxPtr->formatContext, ctxPtr->streamIndex, startPts, AVSEEK_FLAG_BACKWARD) < 0 ) {
+        return FALSE;
+    }
+    avcodec_flush_buffers(ctxPtr->decoderContext);
+
+    LOG(DEBUG_LEVEL_INFO, DBG_MPEG_FILE, "Seeked to Start Time: %d ms", startTimeMs);
+    return TRUE;
+}  // seekToStartTime()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    endOfInput()
+ |
+ | DESCRIPTION:
+ |    This function passes on any frames still being gathered, closes the input
+ |    and shuts down the rest of the pipeline, once the file has been read to
+ |    the end or to the end time.
+ -------------------------------------------------------------------------------*/
+static uint8 endOfInput( Context* rootCtxPtr, boolean* isDonePtr ) {
+    MpegFileCtx* ctxPtr = rootCtxPtr->mpegFileCtxPtr;
+
+    *isDonePtr = TRUE;
+    Sinks sinks = ctxPtr->sinks;
+    FlushFramesToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &sinks);
+    closeInput(ctxPtr);
+    free(ctxPtr);
+    rootCtxPtr->mpegFileCtxPtr = NULL;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // endOfInput()
 #endif
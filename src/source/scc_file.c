@@ -30,6 +30,7 @@
 #include "cc_utils.h"
 #include "pipeline_utils.h"
 #include "buffer_utils.h"
+#include "block_reader.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Variables                          --*/
@@ -43,6 +44,9 @@
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static uint8 closeCaptionsFile( Context*, boolean* );
+static void decodeSccWords( char*, Buffer* );
+
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
 /*----------------------------------------------------------------------------*/
@@ -79,11 +83,13 @@ boolean SccFileInitialize( Context* rootCtxPtr, char* fileNameStr, uint32 frTime
 
     ctxPtr->numCaptionsLinesRead = 0;
     ctxPtr->captionsFilePtr = NULL;
+    ctxPtr->firstLinePos = 0;
+    ctxPtr->timeCodeIndexPtr = NULL;
     ctxPtr->frameRateTimesOneHundred = frTimesOneHundred;
 
     ctxPtr->numCaptionsLinesRead = 0;
     ASSERT(fileNameStr);
-    ctxPtr->captionsFilePtr = fopen(fileNameStr, "r");
+    ctxPtr->captionsFilePtr = BlockReaderOpenStream(fileNameStr);
     
     if( ctxPtr->captionsFilePtr == NULL ) {
         char filePath[PATH_MAX];
@@ -147,7 +153,24 @@ boolean SccFileInitialize( Context* rootCtxPtr, char* fileNameStr, uint32 frTime
             fseek(ctxPtr->captionsFilePtr,pos,0);
         }
     }
-    
+    ctxPtr->firstLinePos = pos;
+
+    if( rootCtxPtr->config.startTimeMs != 0 ) {
+        // Without the index the seek still works, by bisecting the whole file
+        if( SccFileBuildIndex(rootCtxPtr) == FALSE ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_FILE_IN, "Seeking to Start Time without an Index");
+        }
+        if( SccFileSeekToTime(rootCtxPtr, rootCtxPtr->config.startTimeMs) == FALSE ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Seek to Start Time in Captions File - [Errno %d] %s", errno, strerror(errno));
+            fclose(ctxPtr->captionsFilePtr);
+            TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+            free(ctxPtr);
+            rootCtxPtr->sccFileCtxPtr = NULL;
+            return FALSE;
+        }
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Starting at Byte %ld of Captions File", ftell(ctxPtr->captionsFilePtr));
+    }
+
     return TRUE;
 }  // SccFileInitialize()
 
@@ -216,13 +239,7 @@ uint8 SccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
         read = getline(&line, &len, ctxPtr->captionsFilePtr);
         if( read == -1 ) {
             LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End of Captions File");
-            LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Captions File: %s contained %d lines of caption data", ctxPtr->captionFileName, (ctxPtr->numCaptionsLinesRead+1));
-            fclose(ctxPtr->captionsFilePtr);
-            Sinks sinks = ctxPtr->sinks;
-            free(ctxPtr);
-            ctxPtr = NULL;
-            *isDonePtr = TRUE;
-            return ShutdownSinks(rootCtxPtr, &sinks);
+            return closeCaptionsFile(rootCtxPtr, isDonePtr);
         } else if( read < 5 ) {
             line = NULL;
         }
@@ -241,24 +258,14 @@ uint8 SccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
 
     decodeTimeCode( timecode, &newBufferPtr->captionTime );
 
-    char* wordPtr = strtok(sccdata, " ");
-    while( wordPtr != NULL ) {
-        if( isHexByteValid(wordPtr[0], wordPtr[1]) == TRUE ) {
-            newBufferPtr->dataPtr[newBufferPtr->numElements] = byteFromNibbles(wordPtr[0], wordPtr[1]);
-            newBufferPtr->numElements++;
-        } else {
-            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to parse SCC Values %c %c - %s", wordPtr[0], wordPtr[1], wordPtr );
-        }
-
-        if( isHexByteValid(wordPtr[2], wordPtr[3]) == TRUE ) {
-            newBufferPtr->dataPtr[newBufferPtr->numElements] = byteFromNibbles(wordPtr[2], wordPtr[3]);
-            newBufferPtr->numElements++;
-        } else {
-            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to parse SCC Values %c %c - %s", wordPtr[2], wordPtr[3], wordPtr );
-        }
-        wordPtr = strtok(NULL, " ");
+    if( (rootCtxPtr->config.endTimeMs != 0) && (captionTimeToMs(&newBufferPtr->captionTime) >= rootCtxPtr->config.endTimeMs) ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Reached End Time in Captions File");
+        FreeBuffer(newBufferPtr);
+        return closeCaptionsFile(rootCtxPtr, isDonePtr);
     }
 
+    decodeSccWords( sccdata, newBufferPtr );
+
     ctxPtr->numCaptionsLinesRead = ctxPtr->numCaptionsLinesRead + 1;
 
     LOG(DEBUG_LEVEL_VERBOSE, DBG_GENERAL, "Captions File: %s Line: %d - Processed %d bytes of scc caption data", ctxPtr->captionFileName, ctxPtr->numCaptionsLinesRead, newBufferPtr->numElements);
@@ -266,8 +273,147 @@ uint8 SccFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
     return PassToSinks(rootCtxPtr, newBufferPtr, &ctxPtr->sinks);
 } // SccFileProcNextBuffer()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    SccFileBuildIndex()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This indexes the time codes of the open file, so that each later seek to a
+ |    time reads just a few lines of the file, rather than bisecting the whole
+ |    file. It is built before seeking to the start time.
+ -------------------------------------------------------------------------------*/
+boolean SccFileBuildIndex( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->sccFileCtxPtr);
+    SccFileCtx* ctxPtr = rootCtxPtr->sccFileCtxPtr;
+
+    if( ctxPtr->timeCodeIndexPtr != NULL ) {
+        return TRUE;
+    }
+
+    ctxPtr->timeCodeIndexPtr = TimeCodeIndexBuild(ctxPtr->captionFileName, ctxPtr->firstLinePos, ctxPtr->frameRateTimesOneHundred);
+    if( ctxPtr->timeCodeIndexPtr == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to Index Captions File: %s - [Errno %d] %s", ctxPtr->captionFileName, errno, strerror(errno));
+        return FALSE;
+    }
+
+    LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Indexed %d Time Codes of Captions File: %s", ctxPtr->timeCodeIndexPtr->numEntries, ctxPtr->captionFileName);
+    return TRUE;
+}  // SccFileBuildIndex()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    SccFileSeekToTime()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    timeInMs - Time to seek to, in milliseconds from the start of the asset.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This positions the file at the first line of captions at or after the
+ |    time, so that the next buffer is made from that line. The index narrows
+ |    the search when one has been built, otherwise the whole file is searched.
+ -------------------------------------------------------------------------------*/
+boolean SccFileSeekToTime( Context* rootCtxPtr, uint32 timeInMs ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->sccFileCtxPtr);
+    SccFileCtx* ctxPtr = rootCtxPtr->sccFileCtxPtr;
+    long lowPos = ctxPtr->firstLinePos;
+    long highPos = -1;
+
+    if( ctxPtr->timeCodeIndexPtr != NULL ) {
+        TimeCodeIndexLookup(ctxPtr->timeCodeIndexPtr, timeInMs, &lowPos, &highPos);
+    }
+
+    return seekToTimeCode(ctxPtr->captionsFilePtr, lowPos, highPos, ctxPtr->frameRateTimesOneHundred, timeInMs);
+}  // SccFileSeekToTime()
+
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeSccWords()
+ |
+ | DESCRIPTION:
+ |    This function converts the space separated words of Hex on an SCC line into
+ |    bytes. The words are gathered a chunk at a time into a single run of Hex,
+ |    which is converted in bulk. Any chunk with a malformed word is converted
+ |    pair by pair instead, so the offending values can be reported.
+ -------------------------------------------------------------------------------*/
+static void decodeSccWords( char* sccdata, Buffer* bufferPtr ) {
+    char* wordPtrs[SCC_WORDS_PER_CHUNK];
+    char hexChars[SCC_WORDS_PER_CHUNK * 4];
+
+    char* wordPtr = strtok(sccdata, " ");
+    while( wordPtr != NULL ) {
+        boolean isChunkValid = TRUE;
+        uint8 numWords = 0;
+
+        while( (wordPtr != NULL) && (numWords < SCC_WORDS_PER_CHUNK) ) {
+            if( (wordPtr[0] == '\0') || (wordPtr[1] == '\0') || (wordPtr[2] == '\0') || (wordPtr[3] == '\0') ) {
+                isChunkValid = FALSE;
+            } else {
+                memcpy(&hexChars[numWords * 4], wordPtr, 4);
+            }
+            wordPtrs[numWords] = wordPtr;
+            numWords++;
+            wordPtr = strtok(NULL, " ");
+        }
+
+        uint8* dataPtr = &bufferPtr->dataPtr[bufferPtr->numElements];
+        if( (isChunkValid == TRUE) && (bytesFromHex(hexChars, (numWords * 2), dataPtr) == (numWords * 2)) ) {
+            bufferPtr->numElements = bufferPtr->numElements + (numWords * 2);
+            continue;
+        }
+
+        for( int loop = 0; loop < numWords; loop++ ) {
+            char* chunkWordPtr = wordPtrs[loop];
+            if( isHexByteValid(chunkWordPtr[0], chunkWordPtr[1]) == TRUE ) {
+                bufferPtr->dataPtr[bufferPtr->numElements] = byteFromNibbles(chunkWordPtr[0], chunkWordPtr[1]);
+                bufferPtr->numElements++;
+            } else {
+                LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to parse SCC Values %c %c - %s", chunkWordPtr[0], chunkWordPtr[1], chunkWordPtr );
+            }
+
+            if( isHexByteValid(chunkWordPtr[2], chunkWordPtr[3]) == TRUE ) {
+                bufferPtr->dataPtr[bufferPtr->numElements] = byteFromNibbles(chunkWordPtr[2], chunkWordPtr[3]);
+                bufferPtr->numElements++;
+            } else {
+                LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Unable to parse SCC Values %c %c - %s", chunkWordPtr[2], chunkWordPtr[3], chunkWordPtr );
+            }
+        }
+    }
+} // decodeSccWords()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeCaptionsFile()
+ |
+ | DESCRIPTION:
+ |    This closes the file once it has been read as far as is wanted, either to
+ |    the end or to the end of the requested time range, and shuts down the rest
+ |    of the pipeline.
+ -------------------------------------------------------------------------------*/
+static uint8 closeCaptionsFile( Context* rootCtxPtr, boolean* isDonePtr ) {
+    SccFileCtx* ctxPtr = rootCtxPtr->sccFileCtxPtr;
 
+    LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Captions File: %s contained %d lines of caption data", ctxPtr->captionFileName, (ctxPtr->numCaptionsLinesRead+1));
+    fclose(ctxPtr->captionsFilePtr);
+    TimeCodeIndexFree(ctxPtr->timeCodeIndexPtr);
+    Sinks sinks = ctxPtr->sinks;
+    free(ctxPtr);
+    rootCtxPtr->sccFileCtxPtr = NULL;
+    *isDonePtr = TRUE;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // closeCaptionsFile()
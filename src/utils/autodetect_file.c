@@ -31,6 +31,7 @@
 #include "gpac/isomedia.h"
 #endif
 #include "output_utils.h"
+#include "cc_data_file.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Variables                          --*/
@@ -43,6 +44,7 @@ const char* captionFileTypeStr[MAX_FILE_TYPE] = {
         "MCC Caption File",         // MCC_CAPTIONS_FILE
         "Binary MPEG File",         // MPEG_BINARY_FILE
         "Binary MOV File",          // MOV_BINARY_FILE
+        "Binary CC Data File",      // CC_DATA_BINARY_FILE
 };
 
 /*----------------------------------------------------------------------------*/
@@ -82,7 +84,8 @@ static void gpacLoggingSink( void*, GF_LOG_Level, GF_LOG_Tool, const char*, va_l
  |
  | DESCRIPTION:
  |    This determine whether this is likely a MPEG file or likely a Caption
- |    file. This is done by examining the first few bytes of the file.
+ |    file. This is done by examining the first few bytes of the file. A CC
+ |    Data File, written by the Cache Output, starts with its own magic.
  ------------------------------------------------------------------------------*/
 boolean DetermineDropFrame( char* fileNameStr, boolean saveMediaInfo, char* outputPath ) {
     FILE* filePtr;
@@ -183,7 +186,8 @@ boolean DetermineDropFrame( char* fileNameStr, boolean saveMediaInfo, char* outp
  |
  | DESCRIPTION:
  |    This determine whether this is likely a MPEG file or likely a Caption
- |    file. This is done by examining the first few bytes of the file.
+ |    file. This is done by examining the first few bytes of the file. A CC
+ |    Data File, written by the Cache Output, starts with its own magic.
  ------------------------------------------------------------------------------*/
 FileType DetermineFileType( char* fileNameStr ) {
     FILE* filePtr = fopen(fileNameStr, "r");
@@ -200,6 +204,12 @@ FileType DetermineFileType( char* fileNameStr ) {
 
     size_t total = fread(buffer, 1, 100, filePtr);
 
+    if( (total >= CC_DATA_FILE_MAGIC_SIZE) && (memcmp(buffer, CC_DATA_FILE_MAGIC, CC_DATA_FILE_MAGIC_SIZE) == 0) ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_FILE_IN, "Determined %s is a CC Data File", fileNameStr);
+        fclose(filePtr);
+        return CC_DATA_BINARY_FILE;
+    }
+
     if( total != 100 ) {
         LOG(DEBUG_LEVEL_FATAL, DBG_FILE_IN, "Unable to read a hundred bytes from File: %s - %d", fileNameStr, total);
         fclose(filePtr);
@@ -0,0 +1,754 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Needed for fopencookie()
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "debug.h"
+#include "block_reader.h"
+
+#ifdef BLOCK_READER_IO_URING
+#include <sys/mman.h>
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static void* readaheadThread( void* );
+static uint32 readBlock( BlockReader*, uint8*, int64, uint32 );
+static void requestBlock( BlockReader*, uint8, int64 );
+static void waitForBlock( BlockReader*, uint8 );
+static void readAhead( BlockReader*, int64 );
+static boolean nextBlock( BlockReader* );
+#ifdef BLOCK_READER_IO_URING
+static boolean ringSetup( BlockReader* );
+static void ringSubmit( BlockReader*, uint8 );
+static void ringComplete( BlockReader* );
+static void ringTeardown( BlockReader* );
+#endif
+#if defined(__GLIBC__)
+static ssize_t streamRead( void*, char*, size_t );
+static int streamSeek( void*, off64_t*, int );
+static int streamClose( void* );
+#elif defined(__APPLE__)
+static int streamRead( void*, char*, int );
+static fpos_t streamSeek( void*, fpos_t, int );
+static int streamClose( void* );
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BlockReaderOpen()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The file to read.
+ |    blockSize - The size of each read from the file, rounded up to the alignment.
+ |
+ | RETURN VALUES:
+ |    BlockReader* - The newly opened reader, or NULL if the file could not be
+ |                   read, or its blocks allocated, in which case errno is set
+ |                   to the reason.
+ |
+ | DESCRIPTION:
+ |    This method opens a file to be read front to back in large blocks. Small
+ |    reads are served from the block in memory, while the blocks which follow it
+ |    are read from the file in the background, so that the storage is waited on
+ |    as seldom as possible. The reads are queued with io_uring where the kernel
+ |    supports it, and otherwise made by a readahead thread.
+ -------------------------------------------------------------------------------*/
+BlockReader* BlockReaderOpen( char* fileNameStr, uint32 blockSize ) {
+    ASSERT(fileNameStr);
+    ASSERT(blockSize);
+
+    int fdesc = open(fileNameStr, O_RDONLY);
+    if( fdesc == -1 ) {
+        return NULL;
+    }
+
+    struct stat fileStat;
+    if( fstat(fdesc, &fileStat) != 0 ) {
+        int savedErrno = errno;
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to find the size of %s: %s", fileNameStr, strerror(savedErrno));
+        close(fdesc);
+        errno = savedErrno;
+        return NULL;
+    }
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    // Let the kernel read ahead further than it would by default
+    posix_fadvise(fdesc, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    BlockReader* readerPtr = malloc(sizeof(BlockReader));
+    readerPtr->fileDescriptor = fdesc;
+    readerPtr->fileSize = fileStat.st_size;
+    readerPtr->position = 0;
+    readerPtr->currentBlock = 0;
+    readerPtr->isRingEnabled = FALSE;
+    readerPtr->isShuttingDown = FALSE;
+
+    // Small files, such as Caption Files, need no more than a block which holds all of them
+    if( readerPtr->fileSize < blockSize ) {
+        blockSize = (readerPtr->fileSize != 0) ? (uint32)readerPtr->fileSize : 1;
+    }
+    readerPtr->blockSize = (blockSize + BLOCK_READER_ALIGNMENT - 1) & ~(BLOCK_READER_ALIGNMENT - 1);
+
+    for( int loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+        void* dataPtr = NULL;
+        int retval = posix_memalign(&dataPtr, BLOCK_READER_ALIGNMENT, readerPtr->blockSize);
+        if( retval != 0 ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to allocate a Block of %d Bytes", readerPtr->blockSize);
+            for( int freeLoop = 0; freeLoop < loop; freeLoop++ ) {
+                free(readerPtr->blocks[freeLoop].dataPtr);
+            }
+            close(fdesc);
+            free(readerPtr);
+            errno = retval;
+            return NULL;
+        }
+        readerPtr->blocks[loop].dataPtr = dataPtr;
+        readerPtr->blocks[loop].fileOffset = 0;
+        readerPtr->blocks[loop].numBytes = 0;
+        readerPtr->blocks[loop].state = BLOCK_READER_BLOCK_EMPTY;
+    }
+
+    pthread_mutex_init(&readerPtr->mutex, NULL);
+    pthread_cond_init(&readerPtr->blockRequested, NULL);
+    pthread_cond_init(&readerPtr->blockFilled, NULL);
+
+#ifdef BLOCK_READER_IO_URING
+    readerPtr->isRingEnabled = ringSetup(readerPtr);
+#endif
+
+    if( (readerPtr->isRingEnabled == FALSE) &&
+        (pthread_create(&readerPtr->readaheadThread, NULL, &readaheadThread, readerPtr) != 0) ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to start Readahead Thread for %s", fileNameStr);
+        pthread_cond_destroy(&readerPtr->blockFilled);
+        pthread_cond_destroy(&readerPtr->blockRequested);
+        pthread_mutex_destroy(&readerPtr->mutex);
+        for( int loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+            free(readerPtr->blocks[loop].dataPtr);
+        }
+        close(fdesc);
+        free(readerPtr);
+        return NULL;
+    }
+
+    // Start reading the front of the file straight away
+    pthread_mutex_lock(&readerPtr->mutex);
+    readAhead(readerPtr, 0);
+    pthread_mutex_unlock(&readerPtr->mutex);
+
+    LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Reading %s in Blocks of %d Bytes with %s", fileNameStr, readerPtr->blockSize,
+        (readerPtr->isRingEnabled == TRUE) ? "io_uring" : "a Readahead Thread");
+    return readerPtr;
+}  // BlockReaderOpen()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BlockReaderRead()
+ |
+ | INPUT PARAMETERS:
+ |    readerPtr - The reader to read from.
+ |    dataPtr - Where to copy the bytes which are read.
+ |    size - The largest number of bytes to read.
+ |
+ | RETURN VALUES:
+ |    int32 - The number of bytes read, which is only short of the size at the
+ |            end of the file, zero at the end of the file, or -1 on an error.
+ |
+ | DESCRIPTION:
+ |    This method reads from the current position of the file, waiting on the
+ |    background reads only if the block it needs has not been read yet.
+ -------------------------------------------------------------------------------*/
+int32 BlockReaderRead( BlockReader* readerPtr, uint8* dataPtr, uint32 size ) {
+    ASSERT(readerPtr);
+    ASSERT(dataPtr);
+
+    uint32 bytesRead = 0;
+
+    while( (bytesRead < size) && (readerPtr->position < readerPtr->fileSize) ) {
+        ReaderBlock* blockPtr = &readerPtr->blocks[readerPtr->currentBlock];
+        int64 blockEnd = blockPtr->fileOffset + blockPtr->numBytes;
+
+        if( (blockPtr->state != BLOCK_READER_BLOCK_FILLED) || (readerPtr->position < blockPtr->fileOffset) ||
+            (readerPtr->position >= blockEnd) ) {
+            if( nextBlock(readerPtr) == FALSE ) {
+                return (bytesRead != 0) ? (int32)bytesRead : -1;
+            }
+            continue;
+        }
+
+        uint32 numBytes = (uint32)(blockEnd - readerPtr->position);
+        if( numBytes > (size - bytesRead) ) {
+            numBytes = size - bytesRead;
+        }
+        memcpy(&dataPtr[bytesRead], &blockPtr->dataPtr[readerPtr->position - blockPtr->fileOffset], numBytes);
+        bytesRead = bytesRead + numBytes;
+        readerPtr->position = readerPtr->position + numBytes;
+    }
+
+    return (int32)bytesRead;
+}  // BlockReaderRead()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BlockReaderSeek()
+ |
+ | INPUT PARAMETERS:
+ |    readerPtr - The reader to move.
+ |    offset - The offset to move to.
+ |    whence - SEEK_SET, SEEK_CUR or SEEK_END, as for lseek().
+ |
+ | RETURN VALUES:
+ |    int64 - The new position in the file, or -1 if it would be invalid.
+ |
+ | DESCRIPTION:
+ |    This method moves the position which the next read starts from. Blocks
+ |    which have already been read are kept, in case the new position is in one.
+ -------------------------------------------------------------------------------*/
+int64 BlockReaderSeek( BlockReader* readerPtr, int64 offset, int whence ) {
+    ASSERT(readerPtr);
+
+    int64 position;
+
+    switch( whence ) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = readerPtr->position + offset;
+            break;
+        case SEEK_END:
+            position = readerPtr->fileSize + offset;
+            break;
+        default:
+            LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Invalid Seek Origin: %d", whence);
+            return -1;
+    }
+
+    if( position < 0 ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Invalid Seek Position: %lld", position);
+        return -1;
+    }
+
+    readerPtr->position = position;
+    return position;
+}  // BlockReaderSeek()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BlockReaderClose()
+ |
+ | INPUT PARAMETERS:
+ |    readerPtr - The reader to close.
+ |
+ | RETURN VALUES:
+ |    None.
+ |
+ | DESCRIPTION:
+ |    This method waits out the reads still in flight, stops the readahead
+ |    thread, closes the file and frees the reader.
+ -------------------------------------------------------------------------------*/
+void BlockReaderClose( BlockReader* readerPtr ) {
+    ASSERT(readerPtr);
+
+    pthread_mutex_lock(&readerPtr->mutex);
+    for( uint8 loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+        waitForBlock(readerPtr, loop);
+    }
+    readerPtr->isShuttingDown = TRUE;
+    pthread_cond_broadcast(&readerPtr->blockRequested);
+    pthread_mutex_unlock(&readerPtr->mutex);
+
+    if( readerPtr->isRingEnabled == TRUE ) {
+#ifdef BLOCK_READER_IO_URING
+        ringTeardown(readerPtr);
+#endif
+    } else {
+        pthread_join(readerPtr->readaheadThread, NULL);
+    }
+
+    pthread_cond_destroy(&readerPtr->blockFilled);
+    pthread_cond_destroy(&readerPtr->blockRequested);
+    pthread_mutex_destroy(&readerPtr->mutex);
+    for( int loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+        free(readerPtr->blocks[loop].dataPtr);
+    }
+    close(readerPtr->fileDescriptor);
+    free(readerPtr);
+}  // BlockReaderClose()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BlockReaderOpenStream()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The file to read.
+ |
+ | RETURN VALUES:
+ |    FILE* - A stream which reads the file through a Block Reader, or NULL if
+ |            the file could not be read.
+ |
+ | DESCRIPTION:
+ |    This method lets readers written against stdio, with getline() and the
+ |    like, read through a Block Reader. The stream is closed with fclose(),
+ |    which closes the Block Reader beneath it. Where custom streams are not
+ |    supported, the file is simply opened with fopen().
+ -------------------------------------------------------------------------------*/
+FILE* BlockReaderOpenStream( char* fileNameStr ) {
+    ASSERT(fileNameStr);
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+    BlockReader* readerPtr = BlockReaderOpen(fileNameStr, BLOCK_READER_DEFAULT_BLOCK_SIZE);
+    if( readerPtr == NULL ) {
+        return NULL;
+    }
+
+#if defined(__GLIBC__)
+    cookie_io_functions_t ioFunctions = { streamRead, NULL, streamSeek, streamClose };
+    FILE* filePtr = fopencookie(readerPtr, "r", ioFunctions);
+#else
+    FILE* filePtr = funopen(readerPtr, streamRead, NULL, streamSeek, streamClose);
+#endif
+
+    if( filePtr == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to Open a Stream on %s", fileNameStr);
+        BlockReaderClose(readerPtr);
+    }
+    return filePtr;
+#else
+    return fopen(fileNameStr, "r");
+#endif
+}  // BlockReaderOpenStream()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    readaheadThread()
+ |
+ | DESCRIPTION:
+ |    This is the body of the readahead thread, which is only started when
+ |    io_uring is not available. It fills each block that is requested with a
+ |    read of the file, earliest in the file first. It holds the mutex except
+ |    while reading.
+ -------------------------------------------------------------------------------*/
+static void* readaheadThread( void* readerVoidPtr ) {
+    BlockReader* readerPtr = (BlockReader*)readerVoidPtr;
+
+    pthread_mutex_lock(&readerPtr->mutex);
+    while( readerPtr->isShuttingDown == FALSE ) {
+        ReaderBlock* blockPtr = NULL;
+        for( int loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+            if( (readerPtr->blocks[loop].state == BLOCK_READER_BLOCK_REQUESTED) &&
+                ((blockPtr == NULL) || (readerPtr->blocks[loop].fileOffset < blockPtr->fileOffset)) ) {
+                blockPtr = &readerPtr->blocks[loop];
+            }
+        }
+
+        if( blockPtr == NULL ) {
+            pthread_cond_wait(&readerPtr->blockRequested, &readerPtr->mutex);
+            continue;
+        }
+
+        int64 fileOffset = blockPtr->fileOffset;
+        pthread_mutex_unlock(&readerPtr->mutex);
+
+        uint32 numBytes = readBlock(readerPtr, blockPtr->dataPtr, fileOffset, 0);
+
+        pthread_mutex_lock(&readerPtr->mutex);
+        blockPtr->numBytes = numBytes;
+        blockPtr->state = BLOCK_READER_BLOCK_FILLED;
+        pthread_cond_broadcast(&readerPtr->blockFilled);
+    }
+    pthread_mutex_unlock(&readerPtr->mutex);
+
+    return NULL;
+}  // readaheadThread()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    readBlock()
+ |
+ | DESCRIPTION:
+ |    This function reads the file into a block with pread(), carrying on from
+ |    the bytes already in it until the block is full or the file ends. It
+ |    returns the number of bytes in the block, which is short if a read failed.
+ -------------------------------------------------------------------------------*/
+static uint32 readBlock( BlockReader* readerPtr, uint8* dataPtr, int64 fileOffset, uint32 numBytes ) {
+    while( numBytes < readerPtr->blockSize ) {
+        ssize_t retval = pread(readerPtr->fileDescriptor, &dataPtr[numBytes], readerPtr->blockSize - numBytes, fileOffset + numBytes);
+        if( retval < 0 ) {
+            if( errno == EINTR ) continue;
+            LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to Read Block at %lld: %s", fileOffset, strerror(errno));
+            break;
+        } else if( retval == 0 ) {
+            break;
+        }
+        numBytes = numBytes + (uint32)retval;
+    }
+    return numBytes;
+}  // readBlock()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    requestBlock()
+ |
+ | DESCRIPTION:
+ |    This function starts a block being filled from the given offset, which is
+ |    rounded down to the alignment. It is called with the mutex held, and the
+ |    block must not be waiting to be filled already.
+ -------------------------------------------------------------------------------*/
+static void requestBlock( BlockReader* readerPtr, uint8 blockIndex, int64 fileOffset ) {
+    ReaderBlock* blockPtr = &readerPtr->blocks[blockIndex];
+    ASSERT(blockPtr->state != BLOCK_READER_BLOCK_REQUESTED);
+
+    blockPtr->fileOffset = fileOffset & ~((int64)BLOCK_READER_ALIGNMENT - 1);
+    blockPtr->numBytes = 0;
+    blockPtr->state = BLOCK_READER_BLOCK_REQUESTED;
+
+    if( readerPtr->isRingEnabled == TRUE ) {
+#ifdef BLOCK_READER_IO_URING
+        ringSubmit(readerPtr, blockIndex);
+#endif
+    } else {
+        pthread_cond_signal(&readerPtr->blockRequested);
+    }
+}  // requestBlock()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    waitForBlock()
+ |
+ | DESCRIPTION:
+ |    This function waits, with the mutex held, until a block is no longer
+ |    waiting to be filled.
+ -------------------------------------------------------------------------------*/
+static void waitForBlock( BlockReader* readerPtr, uint8 blockIndex ) {
+    while( readerPtr->blocks[blockIndex].state == BLOCK_READER_BLOCK_REQUESTED ) {
+        if( readerPtr->isRingEnabled == TRUE ) {
+#ifdef BLOCK_READER_IO_URING
+            ringComplete(readerPtr);
+#endif
+        } else {
+            pthread_cond_wait(&readerPtr->blockFilled, &readerPtr->mutex);
+        }
+    }
+}  // waitForBlock()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    readAhead()
+ |
+ | DESCRIPTION:
+ |    This function makes sure the blocks after the current one are being filled
+ |    with the file from the given offset onwards, leaving alone those which
+ |    already are. It is called with the mutex held.
+ -------------------------------------------------------------------------------*/
+static void readAhead( BlockReader* readerPtr, int64 fileOffset ) {
+    for( uint8 loop = 1; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+        uint8 blockIndex = (readerPtr->currentBlock + loop) % BLOCK_READER_NUM_BLOCKS;
+        ReaderBlock* blockPtr = &readerPtr->blocks[blockIndex];
+
+        if( fileOffset >= readerPtr->fileSize ) {
+            if( blockPtr->state == BLOCK_READER_BLOCK_FILLED ) {
+                blockPtr->state = BLOCK_READER_BLOCK_EMPTY;
+            }
+            continue;
+        }
+
+        if( (blockPtr->state == BLOCK_READER_BLOCK_EMPTY) || (blockPtr->fileOffset != fileOffset) ) {
+            waitForBlock(readerPtr, blockIndex);
+            requestBlock(readerPtr, blockIndex, fileOffset);
+        }
+        fileOffset = fileOffset + readerPtr->blockSize;
+    }
+}  // readAhead()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    nextBlock()
+ |
+ | DESCRIPTION:
+ |    This function makes the block holding the current position the current
+ |    block. Normally that is the next block read ahead, but after a seek the
+ |    block is read afresh. The blocks after it are then read ahead. It returns
+ |    FALSE if the position could not be read.
+ -------------------------------------------------------------------------------*/
+static boolean nextBlock( BlockReader* readerPtr ) {
+    uint8 nextIndex = (readerPtr->currentBlock + 1) % BLOCK_READER_NUM_BLOCKS;
+    ReaderBlock* nextBlockPtr = &readerPtr->blocks[nextIndex];
+
+    pthread_mutex_lock(&readerPtr->mutex);
+
+    waitForBlock(readerPtr, nextIndex);
+    if( (nextBlockPtr->state != BLOCK_READER_BLOCK_FILLED) || (readerPtr->position < nextBlockPtr->fileOffset) ||
+        (readerPtr->position >= (nextBlockPtr->fileOffset + nextBlockPtr->numBytes)) ) {
+        requestBlock(readerPtr, nextIndex, readerPtr->position);
+        waitForBlock(readerPtr, nextIndex);
+    }
+
+    readerPtr->currentBlock = nextIndex;
+    int64 blockEnd = nextBlockPtr->fileOffset + nextBlockPtr->numBytes;
+    // A short block is the end of the file, or a failed read, so there is nothing after it to read
+    readAhead(readerPtr, (nextBlockPtr->numBytes == readerPtr->blockSize) ? blockEnd : readerPtr->fileSize);
+
+    pthread_mutex_unlock(&readerPtr->mutex);
+
+    if( (readerPtr->position < nextBlockPtr->fileOffset) || (readerPtr->position >= blockEnd) ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to Read at %lld of %lld Bytes", readerPtr->position, readerPtr->fileSize);
+        return FALSE;
+    }
+    return TRUE;
+}  // nextBlock()
+
+#ifdef BLOCK_READER_IO_URING
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ringSetup()
+ |
+ | DESCRIPTION:
+ |    This function creates an io_uring with room for a read of every block, and
+ |    maps its queues. It returns FALSE if the kernel does not support io_uring,
+ |    or does not allow it, so that the readahead thread is used instead.
+ -------------------------------------------------------------------------------*/
+static boolean ringSetup( BlockReader* readerPtr ) {
+    BlockReaderRing* ringPtr = &readerPtr->ring;
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    ringPtr->ringFd = (int)syscall(__NR_io_uring_setup, BLOCK_READER_NUM_BLOCKS, &params);
+    if( ringPtr->ringFd < 0 ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "io_uring is Unavailable: %s", strerror(errno));
+        return FALSE;
+    }
+
+    ringPtr->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ringPtr->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ringPtr->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ringPtr->sqRingPtr = mmap(NULL, ringPtr->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_SQ_RING);
+    ringPtr->cqRingPtr = mmap(NULL, ringPtr->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_CQ_RING);
+    ringPtr->sqesPtr = mmap(NULL, ringPtr->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_SQES);
+
+    if( (ringPtr->sqRingPtr == MAP_FAILED) || (ringPtr->cqRingPtr == MAP_FAILED) || (ringPtr->sqesPtr == MAP_FAILED) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_GENERAL, "Unable to Map io_uring Queues: %s", strerror(errno));
+        if( ringPtr->sqRingPtr != MAP_FAILED ) munmap(ringPtr->sqRingPtr, ringPtr->sqRingSize);
+        if( ringPtr->cqRingPtr != MAP_FAILED ) munmap(ringPtr->cqRingPtr, ringPtr->cqRingSize);
+        if( ringPtr->sqesPtr != MAP_FAILED ) munmap(ringPtr->sqesPtr, ringPtr->sqesSize);
+        close(ringPtr->ringFd);
+        return FALSE;
+    }
+
+    ringPtr->sqTailPtr = (unsigned*)((char*)ringPtr->sqRingPtr + params.sq_off.tail);
+    ringPtr->sqMaskPtr = (unsigned*)((char*)ringPtr->sqRingPtr + params.sq_off.ring_mask);
+    ringPtr->sqArrayPtr = (unsigned*)((char*)ringPtr->sqRingPtr + params.sq_off.array);
+    ringPtr->cqHeadPtr = (unsigned*)((char*)ringPtr->cqRingPtr + params.cq_off.head);
+    ringPtr->cqTailPtr = (unsigned*)((char*)ringPtr->cqRingPtr + params.cq_off.tail);
+    ringPtr->cqMaskPtr = (unsigned*)((char*)ringPtr->cqRingPtr + params.cq_off.ring_mask);
+    ringPtr->cqesPtr = (struct io_uring_cqe*)((char*)ringPtr->cqRingPtr + params.cq_off.cqes);
+
+    return TRUE;
+}  // ringSetup()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ringSubmit()
+ |
+ | DESCRIPTION:
+ |    This function queues a read of the rest of a block, which has been filled
+ |    as far as its number of bytes, and submits it to the kernel. If the kernel
+ |    won't take the read, the block is read directly instead.
+ -------------------------------------------------------------------------------*/
+static void ringSubmit( BlockReader* readerPtr, uint8 blockIndex ) {
+    BlockReaderRing* ringPtr = &readerPtr->ring;
+    ReaderBlock* blockPtr = &readerPtr->blocks[blockIndex];
+
+    ringPtr->ioVectors[blockIndex].iov_base = &blockPtr->dataPtr[blockPtr->numBytes];
+    ringPtr->ioVectors[blockIndex].iov_len = readerPtr->blockSize - blockPtr->numBytes;
+
+    unsigned tail = *ringPtr->sqTailPtr;
+    unsigned slot = tail & *ringPtr->sqMaskPtr;
+    struct io_uring_sqe* sqePtr = &ringPtr->sqesPtr[slot];
+    memset(sqePtr, 0, sizeof(struct io_uring_sqe));
+    sqePtr->opcode = IORING_OP_READV;
+    sqePtr->fd = readerPtr->fileDescriptor;
+    sqePtr->addr = (uint64)(uintptr_t)&ringPtr->ioVectors[blockIndex];
+    sqePtr->len = 1;
+    sqePtr->off = blockPtr->fileOffset + blockPtr->numBytes;
+    sqePtr->user_data = blockIndex;
+    ringPtr->sqArrayPtr[slot] = slot;
+    __atomic_store_n(ringPtr->sqTailPtr, tail + 1, __ATOMIC_RELEASE);
+
+    while( syscall(__NR_io_uring_enter, ringPtr->ringFd, 1, 0, 0, NULL, 0) < 0 ) {
+        if( errno != EINTR ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_GENERAL, "Unable to Submit io_uring Read, Reading Directly: %s", strerror(errno));
+            // The queue entry was never consumed, so take it back rather than leave it for the next submit
+            __atomic_store_n(ringPtr->sqTailPtr, tail, __ATOMIC_RELEASE);
+            blockPtr->numBytes = readBlock(readerPtr, blockPtr->dataPtr, blockPtr->fileOffset, blockPtr->numBytes);
+            blockPtr->state = BLOCK_READER_BLOCK_FILLED;
+            return;
+        }
+    }
+}  // ringSubmit()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ringComplete()
+ |
+ | DESCRIPTION:
+ |    This function waits for the next read to complete, and marks its block as
+ |    filled. A read which comes up short of the block, before the end of the
+ |    file, is queued again for the rest of the block. If the kernel can't be
+ |    waited on, every block still waiting is read directly instead.
+ -------------------------------------------------------------------------------*/
+static void ringComplete( BlockReader* readerPtr ) {
+    BlockReaderRing* ringPtr = &readerPtr->ring;
+    unsigned head = *ringPtr->cqHeadPtr;
+
+    while( head == __atomic_load_n(ringPtr->cqTailPtr, __ATOMIC_ACQUIRE) ) {
+        if( (syscall(__NR_io_uring_enter, ringPtr->ringFd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0) && (errno != EINTR) ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_GENERAL, "Unable to Wait for io_uring Read, Reading Directly: %s", strerror(errno));
+            for( int loop = 0; loop < BLOCK_READER_NUM_BLOCKS; loop++ ) {
+                ReaderBlock* blockPtr = &readerPtr->blocks[loop];
+                if( blockPtr->state == BLOCK_READER_BLOCK_REQUESTED ) {
+                    blockPtr->numBytes = readBlock(readerPtr, blockPtr->dataPtr, blockPtr->fileOffset, blockPtr->numBytes);
+                    blockPtr->state = BLOCK_READER_BLOCK_FILLED;
+                }
+            }
+            return;
+        }
+    }
+
+    struct io_uring_cqe* cqePtr = &ringPtr->cqesPtr[head & *ringPtr->cqMaskPtr];
+    uint8 blockIndex = (uint8)cqePtr->user_data;
+    int result = cqePtr->res;
+    __atomic_store_n(ringPtr->cqHeadPtr, head + 1, __ATOMIC_RELEASE);
+
+    ReaderBlock* blockPtr = &readerPtr->blocks[blockIndex];
+    // A block which was read directly, while its read was still in flight, is already filled
+    if( blockPtr->state != BLOCK_READER_BLOCK_REQUESTED ) {
+        return;
+    }
+
+    if( (result == -EINTR) || (result == -EAGAIN) ) {
+        ringSubmit(readerPtr, blockIndex);
+        return;
+    } else if( result < 0 ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to Read Block at %lld: %s", blockPtr->fileOffset, strerror(-result));
+    } else {
+        blockPtr->numBytes = blockPtr->numBytes + (uint32)result;
+        if( (result != 0) && (blockPtr->numBytes < readerPtr->blockSize) &&
+            ((blockPtr->fileOffset + blockPtr->numBytes) < readerPtr->fileSize) ) {
+            ringSubmit(readerPtr, blockIndex);
+            return;
+        }
+    }
+    blockPtr->state = BLOCK_READER_BLOCK_FILLED;
+}  // ringComplete()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ringTeardown()
+ |
+ | DESCRIPTION:
+ |    This function unmaps the queues of the io_uring and closes it. Every read
+ |    must have completed first.
+ -------------------------------------------------------------------------------*/
+static void ringTeardown( BlockReader* readerPtr ) {
+    BlockReaderRing* ringPtr = &readerPtr->ring;
+
+    munmap(ringPtr->sqesPtr, ringPtr->sqesSize);
+    munmap(ringPtr->cqRingPtr, ringPtr->cqRingSize);
+    munmap(ringPtr->sqRingPtr, ringPtr->sqRingSize);
+    close(ringPtr->ringFd);
+}  // ringTeardown()
+#endif
+
+#if defined(__GLIBC__)
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    streamRead() / streamSeek() / streamClose()
+ |
+ | DESCRIPTION:
+ |    These functions connect a stdio stream to the Block Reader beneath it.
+ -------------------------------------------------------------------------------*/
+static ssize_t streamRead( void* cookie, char* buf, size_t size ) {
+    if( size > INT32_MAX ) size = INT32_MAX;
+    return BlockReaderRead((BlockReader*)cookie, (uint8*)buf, (uint32)size);
+}  // streamRead()
+
+static int streamSeek( void* cookie, off64_t* offsetPtr, int whence ) {
+    int64 position = BlockReaderSeek((BlockReader*)cookie, *offsetPtr, whence);
+    if( position < 0 ) {
+        return -1;
+    }
+    *offsetPtr = position;
+    return 0;
+}  // streamSeek()
+
+static int streamClose( void* cookie ) {
+    BlockReaderClose((BlockReader*)cookie);
+    return 0;
+}  // streamClose()
+#elif defined(__APPLE__)
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    streamRead() / streamSeek() / streamClose()
+ |
+ | DESCRIPTION:
+ |    These functions connect a stdio stream to the Block Reader beneath it.
+ -------------------------------------------------------------------------------*/
+static int streamRead( void* cookie, char* buf, int size ) {
+    return (int)BlockReaderRead((BlockReader*)cookie, (uint8*)buf, (uint32)size);
+}  // streamRead()
+
+static fpos_t streamSeek( void* cookie, fpos_t offset, int whence ) {
+    return BlockReaderSeek((BlockReader*)cookie, offset, whence);
+}  // streamSeek()
+
+static int streamClose( void* cookie ) {
+    BlockReaderClose((BlockReader*)cookie);
+    return 0;
+}  // streamClose()
+#endif
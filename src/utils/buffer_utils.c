@@ -18,6 +18,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 #include "debug.h"
 #include "buffer_utils.h"
@@ -33,18 +34,23 @@
 /*----------------------------------------------------------------------------*/
 
 static BufferElement* bufferArray[MAX_BUFFER_ARRAY_SIZE];
+static pthread_mutex_t bufferArrayMutex = PTHREAD_MUTEX_INITIALIZER;   // Sinks run in parallel share buffers
 
 static const char* BufferTypeText[MAX_BUFFER_TYPE] = {
     "BUFFER_TYPE_UNKNOWN",
     "BUFFER_TYPE_BYTES",
     "BUFFER_TYPE_LINE_21",
-    "BUFFER_TYPE_DTVCC"
+    "BUFFER_TYPE_DTVCC",
+    "BUFFER_TYPE_FILL",
+    "BUFFER_TYPE_CAPTION_CUE",
+    "BUFFER_TYPE_CC_DATA_FRAMES"
 };
 
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 void dbgdumpBufferPool( uint8 );
+static Buffer* allocBuffer( char*, int, uint8, uint16, uint8* );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -89,66 +95,193 @@ void BufferPoolInit( void ) {
  |    extract the metadata about the file.
  -------------------------------------------------------------------------------*/
 Buffer* _NewBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint16 size ) {
-    ASSERT(size);
-    ASSERT(bufferType);
-    ASSERT(bufferType < MAX_BUFFER_TYPE);
-    
-    char* basename = fileNameStr;
-    basename = strrchr(fileNameStr, '/');
-    basename = basename ? basename+1 : fileNameStr;
-    
-    Buffer* newBuffer = malloc(sizeof(Buffer));
-    if( newBuffer == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
-    LOG(DEBUG_LEVEL_VERBOSE, DBG_BUFFER, "Buffer [%p] Allocated by {%s:%d} %s - %d", newBuffer, basename, lineNum, BufferTypeText[bufferType], size);
+    return allocBuffer(fileNameStr, lineNum, bufferType, size, NULL);
+}  // _NewBuffer()
 
-    newBuffer->numElements = 0;
-    newBuffer->maxNumElements = size;
-    newBuffer->bufferType = bufferType;
-    
-    switch( bufferType ) {
-        case BUFFER_TYPE_BYTES:
-            newBuffer->dataPtr = malloc(newBuffer->maxNumElements);
-            break;
-        case BUFFER_TYPE_LINE_21:
-            newBuffer->dataPtr = malloc(newBuffer->maxNumElements * sizeof(Line21Code));
-            break;
-        case BUFFER_TYPE_DTVCC:
-            newBuffer->dataPtr = malloc(newBuffer->maxNumElements * sizeof(DtvccData));
-            break;
-        default:
-            LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Unreachable Branch %d", bufferType);
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    NewRefBuffer()/_NewRefBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the calling function.
+ |    lineNum - The line number of the calling function.
+ |    bufferType - The type of buffer requested.
+ |    dataPtr - The data the buffer carries, which is borrowed rather than copied.
+ |    numElements - The size of the data, as it would be given to NewBuffer().
+ |    dataRefPtr - The reference which keeps the data alive.
+ |    releaseFnPtr - Called with the reference once the buffer is freed.
+ |
+ | RETURN VALUES:
+ |    Buffer* - The full buffer.
+ |
+ | DESCRIPTION:
+ |    This method wraps data which is owned elsewhere (e.g. side data from a
+ |    decoder) in a buffer without copying it. The reference is handed over to
+ |    the buffer, and is released by FreeBuffer() rather than the data being
+ |    freed.
+ -------------------------------------------------------------------------------*/
+Buffer* _NewRefBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint8* dataPtr, uint16 numElements,
+                       void* dataRefPtr, BufferReleaseFnPtr releaseFnPtr ) {
+    ASSERT(dataPtr);
+    ASSERT(releaseFnPtr);
+
+    Buffer* buffPtr = allocBuffer(fileNameStr, lineNum, bufferType, numElements, dataPtr);
+    buffPtr->numElements = numElements;
+    buffPtr->dataRefPtr = dataRefPtr;
+    buffPtr->releaseFnPtr = releaseFnPtr;
+
+    return buffPtr;
+}  // _NewRefBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    NewFramesBuffer()/_NewFramesBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the calling function.
+ |    lineNum - The line number of the calling function.
+ |    maxFrames - The most frames of cc_data the buffer can carry.
+ |    size - The most bytes of cc_data the buffer can carry, across all frames.
+ |
+ | RETURN VALUES:
+ |    Buffer* - The empty buffer, which frames are added to with AddFrameToBuffer().
+ |
+ | DESCRIPTION:
+ |    This method allocates a buffer which carries the cc_data of several
+ |    consecutive frames, so that the pipeline passes and frees a buffer per
+ |    group of frames rather than per frame.
+ -------------------------------------------------------------------------------*/
+Buffer* _NewFramesBuffer( char* fileNameStr, int lineNum, uint16 maxFrames, uint16 size ) {
+    ASSERT(maxFrames);
+    ASSERT(maxFrames <= MAX_FRAMES_PER_BUFFER);
+
+    Buffer* newBuffer = _NewBuffer(fileNameStr, lineNum, BUFFER_TYPE_CC_DATA_FRAMES, size);
+    newBuffer->framePtr = malloc(maxFrames * sizeof(CcDataFrame));
+    if( newBuffer->framePtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
+    newBuffer->maxNumFrames = maxFrames;
+
+    return newBuffer;
+}  // _NewFramesBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    AddFrameToBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - The BUFFER_TYPE_CC_DATA_FRAMES buffer to add the frame to.
+ |    captionTimePtr - The time of the frame.
+ |    dataPtr - The cc_data of the frame.
+ |    numElements - The number of bytes of cc_data in the frame.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if the frame was added. FALSE if the buffer is full, or the
+ |              frame rate or kind of time of the frame differ from the buffer's,
+ |              in which case the buffer should be passed on and a new one started.
+ |
+ | DESCRIPTION:
+ |    This method appends the cc_data of a frame to a buffer of several frames.
+ |    The first frame added sets the frame rate and kind of time for the buffer.
+ -------------------------------------------------------------------------------*/
+boolean AddFrameToBuffer( Buffer* buffPtr, CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements ) {
+    ASSERT(buffPtr);
+    ASSERT(buffPtr->bufferType == BUFFER_TYPE_CC_DATA_FRAMES);
+    ASSERT(captionTimePtr);
+    ASSERT(numElements);
+
+    if( (buffPtr->numFrames == buffPtr->maxNumFrames) ||
+        ((buffPtr->numElements + numElements) > buffPtr->maxNumElements) ) {
+        return FALSE;
     }
-    if( newBuffer->dataPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
 
-    newBuffer->captionTime.hour = 0;
-    newBuffer->captionTime.minute = 0;
-    newBuffer->captionTime.second = 0;
-    newBuffer->captionTime.millisecond = 0;
-    newBuffer->captionTime.frame = 0;
-    newBuffer->captionTime.frameRatePerSecTimesOneHundred = 0;
-    newBuffer->captionTime.dropframe = FALSE;
+    if( buffPtr->numFrames == 0 ) {
+        buffPtr->captionTime = *captionTimePtr;
+    } else if( (buffPtr->captionTime.frameRatePerSecTimesOneHundred != captionTimePtr->frameRatePerSecTimesOneHundred) ||
+               (buffPtr->captionTime.dropframe != captionTimePtr->dropframe) ||
+               (buffPtr->captionTime.source != captionTimePtr->source) ) {
+        return FALSE;
+    }
 
-    BufferElement* listElementPtr = malloc(sizeof(BufferElement));
-    if( listElementPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
-    listElementPtr->bufferPtr = newBuffer;
-    listElementPtr->numReaders = 0;
+    CcDataFrame* framePtr = &buffPtr->framePtr[buffPtr->numFrames];
+    framePtr->hour = captionTimePtr->hour;
+    framePtr->minute = captionTimePtr->minute;
+    framePtr->second = captionTimePtr->second;
+    framePtr->frame = captionTimePtr->frame;
+    framePtr->millisecond = captionTimePtr->millisecond;
+    framePtr->numElements = numElements;
 
-    strncpy(listElementPtr->callerFileName, basename, MAX_CALLER_FILE_NAME_SIZE);
-    listElementPtr->callerFileName[MAX_CALLER_FILE_NAME_SIZE-1] = '\0';
-    listElementPtr->callerFileLine = lineNum;
-    
-    for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
-        if( bufferArray[loop] == NULL ) {
-            bufferArray[loop] = listElementPtr;
-            return newBuffer;
-        }
+    memcpy(&buffPtr->dataPtr[buffPtr->numElements], dataPtr, numElements);
+    buffPtr->numElements = buffPtr->numElements + numElements;
+    buffPtr->numFrames++;
+
+    return TRUE;
+}  // AddFrameToBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    StartBufferFrames()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - The buffer of cc_data to walk.
+ |
+ | RETURN VALUES:
+ |    framePtr - Set up so that NextBufferFrame() returns the first frame.
+ |
+ | DESCRIPTION:
+ |    This method starts a walk through the frames of cc_data in a buffer.
+ -------------------------------------------------------------------------------*/
+void StartBufferFrames( Buffer* buffPtr, BufferFrame* framePtr ) {
+    ASSERT(buffPtr);
+    ASSERT(framePtr);
+
+    framePtr->frameIndex = 0;
+    framePtr->firstElement = 0;
+    framePtr->numElements = 0;
+}  // StartBufferFrames()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    NextBufferFrame()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - The buffer of cc_data being walked.
+ |    framePtr - Where the walk is up to.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if there was another frame, FALSE at the end of the buffer.
+ |    framePtr - The time, and the place in the data of the buffer, of the frame.
+ |
+ | DESCRIPTION:
+ |    This method steps to the next frame of cc_data in a buffer. A buffer of
+ |    BUFFER_TYPE_BYTES is a single frame, at the time of the buffer, so the
+ |    same loop handles buffers of one frame and of several.
+ -------------------------------------------------------------------------------*/
+boolean NextBufferFrame( Buffer* buffPtr, BufferFrame* framePtr ) {
+    ASSERT(buffPtr);
+    ASSERT(framePtr);
+
+    framePtr->firstElement = framePtr->firstElement + framePtr->numElements;
+
+    if( buffPtr->bufferType != BUFFER_TYPE_CC_DATA_FRAMES ) {
+        if( framePtr->frameIndex != 0 ) return FALSE;
+        framePtr->numElements = buffPtr->numElements;
+        framePtr->captionTime = buffPtr->captionTime;
+        framePtr->frameIndex++;
+        return TRUE;
     }
 
-    dbgdumpBufferPool( DEBUG_LEVEL_ERROR );
-    LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Unable to add new buffer to array");
+    if( framePtr->frameIndex >= buffPtr->numFrames ) return FALSE;
 
-    return newBuffer;
-}  // _NewBuffer()
+    CcDataFrame* ccDataFramePtr = &buffPtr->framePtr[framePtr->frameIndex];
+    framePtr->numElements = ccDataFramePtr->numElements;
+    framePtr->captionTime = buffPtr->captionTime;
+    framePtr->captionTime.hour = ccDataFramePtr->hour;
+    framePtr->captionTime.minute = ccDataFramePtr->minute;
+    framePtr->captionTime.second = ccDataFramePtr->second;
+    framePtr->captionTime.frame = ccDataFramePtr->frame;
+    framePtr->captionTime.millisecond = ccDataFramePtr->millisecond;
+    framePtr->frameIndex++;
+    return TRUE;
+}  // NextBufferFrame()
 
 /*------------------------------------------------------------------------------
  | NAME:
@@ -163,11 +296,13 @@ Buffer* _NewBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint16 siz
  | DESCRIPTION:
  |    This method checks to see if anyone else is reading the buffer. If there
  |    are no other readers the buffer is freed. If there are other readers, this
- |    reader is removed.
+ |    reader is removed. The pool is locked while the readers are counted, as
+ |    the sinks which share a buffer may be run in parallel.
  -------------------------------------------------------------------------------*/
 void FreeBuffer( Buffer* bufferToFreePtr ) {
     ASSERT(bufferToFreePtr);
     
+    pthread_mutex_lock(&bufferArrayMutex);
     for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
         if( (bufferArray[loop] != NULL) && (bufferArray[loop]->bufferPtr == bufferToFreePtr) ) {
             LOG(DEBUG_LEVEL_VERBOSE, DBG_BUFFER, "Attempt to free Buffer [%p] with %d readers.", bufferToFreePtr, bufferArray[loop]->numReaders);
@@ -175,6 +310,7 @@ void FreeBuffer( Buffer* bufferToFreePtr ) {
             if( bufferArray[loop]->numReaders > 1 ) {
                 bufferArray[loop]->numReaders = bufferArray[loop]->numReaders - 1;
                 LOG(DEBUG_LEVEL_VERBOSE, DBG_BUFFER, "Decremented Readers for Buffer [%p] now %d", bufferToFreePtr, bufferArray[loop]->numReaders);
+                pthread_mutex_unlock(&bufferArrayMutex);
                 return;
             }
             
@@ -182,13 +318,31 @@ void FreeBuffer( Buffer* bufferToFreePtr ) {
             
             free(bufferArray[loop]);
             bufferArray[loop] = NULL;
+            pthread_mutex_unlock(&bufferArrayMutex);
             
+            if( bufferToFreePtr->annotationPtr != NULL ) {
+                FreeBuffer(bufferToFreePtr->annotationPtr);
+            }
+            if( bufferToFreePtr->dtvccAnnotationPtr != NULL ) {
+                FreeBuffer(bufferToFreePtr->dtvccAnnotationPtr);
+            }
+            if( bufferToFreePtr->framePtr != NULL ) {
+                free(bufferToFreePtr->framePtr);
+            }
+            if( bufferToFreePtr->planesPtr != NULL ) {
+                free(bufferToFreePtr->planesPtr);
+            }
             ASSERT(bufferToFreePtr->dataPtr);
-            free(bufferToFreePtr->dataPtr);
+            if( bufferToFreePtr->releaseFnPtr != NULL ) {
+                bufferToFreePtr->releaseFnPtr(bufferToFreePtr->dataRefPtr);
+            } else {
+                free(bufferToFreePtr->dataPtr);
+            }
             free(bufferToFreePtr);
             return;
         }
     }
+    pthread_mutex_unlock(&bufferArrayMutex);
     LOG(DEBUG_LEVEL_ERROR, DBG_BUFFER, "Unable to find or free Buffer [%p]", bufferToFreePtr );
     
 }  // FreeBuffer()
@@ -210,13 +364,16 @@ void FreeBuffer( Buffer* bufferToFreePtr ) {
 void AddReader( Buffer* buffPtr ) {
     ASSERT(buffPtr);
     
+    pthread_mutex_lock(&bufferArrayMutex);
     for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
         if( (bufferArray[loop] != NULL) && (bufferArray[loop]->bufferPtr == buffPtr) ) {
             bufferArray[loop]->numReaders = bufferArray[loop]->numReaders + 1;
             LOG(DEBUG_LEVEL_VERBOSE, DBG_BUFFER, "Reader added to Buffer [%p] - Total %d", buffPtr, bufferArray[loop]->numReaders);
+            pthread_mutex_unlock(&bufferArrayMutex);
             return;
         }
     }
+    pthread_mutex_unlock(&bufferArrayMutex);
     
     LOG(DEBUG_LEVEL_ERROR, DBG_BUFFER, "Unable to find Buffer %p", buffPtr);
 } // AddReader()
@@ -274,6 +431,94 @@ void CaptionTimeFromPts( CaptionTime* captionTimePtr, int64 pts ) {
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    allocBuffer()
+ |
+ | DESCRIPTION:
+ |    This function allocates a buffer and adds it to the pool. The data of the
+ |    buffer is allocated to suit its type, unless it was handed in.
+ -------------------------------------------------------------------------------*/
+static Buffer* allocBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint16 size, uint8* dataPtr ) {
+    ASSERT(size);
+    ASSERT(bufferType);
+    ASSERT(bufferType < MAX_BUFFER_TYPE);
+    
+    char* basename = fileNameStr;
+    basename = strrchr(fileNameStr, '/');
+    basename = basename ? basename+1 : fileNameStr;
+    
+    Buffer* newBuffer = malloc(sizeof(Buffer));
+    if( newBuffer == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
+    LOG(DEBUG_LEVEL_VERBOSE, DBG_BUFFER, "Buffer [%p] Allocated by {%s:%d} %s - %d", newBuffer, basename, lineNum, BufferTypeText[bufferType], size);
+
+    newBuffer->numElements = 0;
+    newBuffer->maxNumElements = size;
+    newBuffer->bufferType = bufferType;
+    newBuffer->annotationPtr = NULL;
+    newBuffer->dtvccAnnotationPtr = NULL;
+    newBuffer->framePtr = NULL;
+    newBuffer->numFrames = 0;
+    newBuffer->maxNumFrames = 0;
+    newBuffer->planesPtr = NULL;
+    newBuffer->dataRefPtr = NULL;
+    newBuffer->releaseFnPtr = NULL;
+    
+    if( dataPtr != NULL ) {
+        newBuffer->dataPtr = dataPtr;
+    } else {
+        switch( bufferType ) {
+            case BUFFER_TYPE_BYTES:
+            case BUFFER_TYPE_CC_DATA_FRAMES:
+            case BUFFER_TYPE_LINE_21:             // Packed Line21Events
+            case BUFFER_TYPE_DTVCC:               // Packed DtvccEvents
+                newBuffer->dataPtr = malloc(newBuffer->maxNumElements);
+                break;
+            case BUFFER_TYPE_FILL:
+                newBuffer->dataPtr = malloc(newBuffer->maxNumElements * sizeof(FillRun));
+                break;
+            case BUFFER_TYPE_CAPTION_CUE:
+                newBuffer->dataPtr = malloc(newBuffer->maxNumElements * sizeof(CaptionCue));
+                break;
+            default:
+                LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Unreachable Branch %d", bufferType);
+        }
+        if( newBuffer->dataPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
+    }
+
+    newBuffer->captionTime.hour = 0;
+    newBuffer->captionTime.minute = 0;
+    newBuffer->captionTime.second = 0;
+    newBuffer->captionTime.millisecond = 0;
+    newBuffer->captionTime.frame = 0;
+    newBuffer->captionTime.frameRatePerSecTimesOneHundred = 0;
+    newBuffer->captionTime.dropframe = FALSE;
+
+    BufferElement* listElementPtr = malloc(sizeof(BufferElement));
+    if( listElementPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Malloc Failed");
+    listElementPtr->bufferPtr = newBuffer;
+    listElementPtr->numReaders = 0;
+
+    strncpy(listElementPtr->callerFileName, basename, MAX_CALLER_FILE_NAME_SIZE);
+    listElementPtr->callerFileName[MAX_CALLER_FILE_NAME_SIZE-1] = '\0';
+    listElementPtr->callerFileLine = lineNum;
+    
+    pthread_mutex_lock(&bufferArrayMutex);
+    for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
+        if( bufferArray[loop] == NULL ) {
+            bufferArray[loop] = listElementPtr;
+            pthread_mutex_unlock(&bufferArrayMutex);
+            return newBuffer;
+        }
+    }
+    pthread_mutex_unlock(&bufferArrayMutex);
+
+    dbgdumpBufferPool( DEBUG_LEVEL_ERROR );
+    LOG(DEBUG_LEVEL_FATAL, DBG_BUFFER, "Unable to add new buffer to array");
+
+    return newBuffer;
+}  // allocBuffer()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    dbgdumpBufferPool()
@@ -16,10 +16,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "cc_utils.h"
+#include "line21_decode.h"
 #include "debug.h"
 
 /*----------------------------------------------------------------------------*/
@@ -34,6 +39,10 @@
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static void triageConstruct( uint8*, uint8, CcDataTriage* );
+static void appendToPlane( CcDataPlane*, uint8*, uint16, uint32 );
+static uint8 nibbleFromHex( char );
+
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
 /*----------------------------------------------------------------------------*/
@@ -453,7 +462,521 @@ uint32 timeCodeToFrame( CaptionTime* captionTimePtr ) {
     return frame;
 }
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    captionTimeToMs()
+ |
+ | INPUT PARAMETERS:
+ |    captionsTimePtr - The time code or presentation time to convert.
+ |
+ | RETURN VALUES:
+ |    uint32 - Milliseconds from the start of the asset.
+ |
+ | DESCRIPTION:
+ |    This converts either flavor of Caption Time into milliseconds, which is
+ |    what subtitle formats express their cue times in. Frames are converted
+ |    using the nominal (integer) frame rate, as a time code counts frames.
+ -------------------------------------------------------------------------------*/
+uint32 captionTimeToMs( CaptionTime* captionTimePtr ) {
+    ASSERT(captionTimePtr);
+
+    uint32 timeInMs = ((captionTimePtr->hour * 60 * 60) + (captionTimePtr->minute * 60) + captionTimePtr->second) * 1000;
+
+    if( captionTimePtr->source == CAPTION_TIME_PTS_NUMBERING ) {
+        return timeInMs + captionTimePtr->millisecond;
+    }
+
+    uint32 nominalFrameRate = (captionTimePtr->frameRatePerSecTimesOneHundred + 99) / 100;
+    if( nominalFrameRate == 0 ) {
+        return timeInMs;
+    }
+    return timeInMs + ((captionTimePtr->frame * 1000) / nominalFrameRate);
+}  // captionTimeToMs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    frameTimeInRun()
+ |
+ | INPUT PARAMETERS:
+ |    firstTimePtr - The time of the first frame of a run of frames.
+ |    frameOffset - The number of frames into the run.
+ |
+ | RETURN VALUES:
+ |    captionTimePtr - The time of that frame of the run.
+ |
+ | DESCRIPTION:
+ |    This works out the time of a frame in a run of consecutive frames from the
+ |    time of the first, counting frames for a time code and stepping by the
+ |    frame rate for a presentation time. Everything else is copied from the
+ |    first frame, so a run can be stored as its first time and a length.
+ -------------------------------------------------------------------------------*/
+void frameTimeInRun( CaptionTime* firstTimePtr, uint32 frameOffset, CaptionTime* captionTimePtr ) {
+    ASSERT(firstTimePtr);
+    ASSERT(captionTimePtr);
+    ASSERT(firstTimePtr->frameRatePerSecTimesOneHundred);
+
+    *captionTimePtr = *firstTimePtr;
+
+    if( firstTimePtr->source == CAPTION_TIME_PTS_NUMBERING ) {
+        uint32 timeInMs = captionTimeToMs(firstTimePtr) +
+                          (uint32)(((uint64)frameOffset * 100000) / firstTimePtr->frameRatePerSecTimesOneHundred);
+        captionTimePtr->hour = (uint8)((timeInMs / (1000*60*60)) % 24);
+        captionTimePtr->minute = (uint8)((timeInMs / (1000*60)) % 60);
+        captionTimePtr->second = (uint8)((timeInMs / 1000) % 60);
+        captionTimePtr->millisecond = (uint16)(timeInMs % 1000);
+    } else {
+        frameToTimeCode((timeCodeToFrame(firstTimePtr) + frameOffset), firstTimePtr->frameRatePerSecTimesOneHundred, captionTimePtr);
+        captionTimePtr->source = firstTimePtr->source;
+    }
+}  // frameTimeInRun()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    triageCcData()
+ |
+ | INPUT PARAMETERS:
+ |    dataPtr - Pointer to the cc_data constructs of a single frame.
+ |    numBytes - Number of bytes of cc_data, three per construct.
+ |    triagePtr - Bitmasks, per kind of construct, of where data was found.
+ |
+ | RETURN VALUES:
+ |    None
+ |
+ | DESCRIPTION:
+ |    This classifies every construct in a frame of cc_data, so that consumers
+ |    can skip frames which carry nothing but padding without examining each
+ |    construct. Frames longer than the masks can describe are reported as
+ |    containing every kind of data, leaving the caller to examine them fully.
+ -------------------------------------------------------------------------------*/
+void triageCcData( uint8* dataPtr, uint16 numBytes, CcDataTriage* triagePtr ) {
+    ASSERT(dataPtr);
+    ASSERT(triagePtr);
+    uint8 numConstructs = 0;
+    uint16 index = 0;
+
+    triagePtr->field1Mask = 0;
+    triagePtr->field2Mask = 0;
+    triagePtr->dtvccStartMask = 0;
+    triagePtr->dtvccDataMask = 0;
+
+    if( (numBytes / 3) > CC_TRIAGE_MAX_CONSTRUCTS ) {
+        triagePtr->field1Mask = CC_TRIAGE_ALL_CONSTRUCTS;
+        triagePtr->field2Mask = CC_TRIAGE_ALL_CONSTRUCTS;
+        triagePtr->dtvccStartMask = CC_TRIAGE_ALL_CONSTRUCTS;
+        triagePtr->dtvccDataMask = CC_TRIAGE_ALL_CONSTRUCTS;
+        return;
+    }
+
+#if defined(__SSE2__)
+    // Each 16 byte load covers five whole constructs, with the headers in lanes
+    // 0, 3, 6, 9 and 12. Shifting the load by one and two bytes lines the two
+    // data bytes up under their header, so every construct is classified at once.
+    const __m128i validMask = _mm_set1_epi8(CC_CONSTR_CC_VALID_FLAG_MASK | CC_CONSTR_CC_TYPE_MASK);
+    const __m128i parityMask = _mm_set1_epi8(LINE_21_PARITY_MASK);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i field1 = _mm_set1_epi8(CC_CONSTR_CC_VALID_FLAG_SET | CEA608E_LINE21_FIELD_1_CC);
+    const __m128i field2 = _mm_set1_epi8(CC_CONSTR_CC_VALID_FLAG_SET | CEA608E_LINE21_FIELD_2_CC);
+    const __m128i dtvccData = _mm_set1_epi8(CC_CONSTR_CC_VALID_FLAG_SET | DTVCCC_CHANNEL_PACKET_DATA);
+    const __m128i typeMask = _mm_set1_epi8(CC_CONSTR_CC_TYPE_MASK);
+    const __m128i dtvccStart = _mm_set1_epi8(DTVCCC_CHANNEL_PACKET_START);
+
+    while( (index + 16) <= numBytes ) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&dataPtr[index]);
+        __m128i header = _mm_and_si128(bytes, validMask);
+        __m128i pair = _mm_or_si128(_mm_srli_si128(bytes, 1), _mm_srli_si128(bytes, 2));
+        __m128i isNotNull = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_and_si128(pair, parityMask), zero), _mm_set1_epi8(-1));
+
+        uint32 f1 = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(header, field1), isNotNull));
+        uint32 f2 = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(header, field2), isNotNull));
+        uint32 ps = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, typeMask), dtvccStart));
+        uint32 pd = _mm_movemask_epi8(_mm_cmpeq_epi8(header, dtvccData));
+
+        triagePtr->field1Mask |= CC_TRIAGE_HEADER_BITS(f1) << numConstructs;
+        triagePtr->field2Mask |= CC_TRIAGE_HEADER_BITS(f2) << numConstructs;
+        triagePtr->dtvccStartMask |= CC_TRIAGE_HEADER_BITS(ps) << numConstructs;
+        triagePtr->dtvccDataMask |= CC_TRIAGE_HEADER_BITS(pd) << numConstructs;
+
+        index = index + 15;
+        numConstructs = numConstructs + 5;
+    }
+#endif
+
+    while( (index + 2) < numBytes ) {
+        triageConstruct(&dataPtr[index], numConstructs, triagePtr);
+        index = index + 3;
+        numConstructs = numConstructs + 1;
+    }
+}  // triageCcData()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    splitCcData()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - Buffer of cc_data, of one frame or several.
+ |
+ | RETURN VALUES:
+ |    None
+ |
+ | DESCRIPTION:
+ |    This attaches the cc_data of a buffer to it a second time, split into a
+ |    plane per Line 21 Field and one for DTVCC, so that each decoder walks only
+ |    the constructs it consumes. A Line 21 plane holds the valid, non null byte
+ |    pairs of its field; the DTVCC plane holds every DTVCC Packet Start and the
+ |    valid DTVCC Packet Data. The constructs are classified by triageCcData(),
+ |    in runs of as many as its masks can describe.
+ -------------------------------------------------------------------------------*/
+void splitCcData( Buffer* buffPtr ) {
+    ASSERT(buffPtr);
+    ASSERT(buffPtr->planesPtr == NULL);
+    uint16 numConstructs = buffPtr->numElements / 3;
+    CcDataTriage triage;
+
+    // Any plane could hold every construct, so each is sized for the worst case, with
+    // the planes of indexes ahead of the planes of bytes to keep them aligned.
+    buffPtr->planesPtr = malloc(sizeof(CcDataPlanes) + (CC_DATA_NUM_PLANES * numConstructs * (sizeof(uint16) + 3)));
+    if( buffPtr->planesPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_GENERAL, "Malloc Failed");
+    uint16* indexPtr = (uint16*)&buffPtr->planesPtr[1];
+    uint8* bytePtr = (uint8*)&indexPtr[CC_DATA_NUM_PLANES * numConstructs];
+
+    for( int loop = 0; loop < CC_DATA_NUM_PLANES; loop++ ) {
+        CcDataPlane* planePtr = &buffPtr->planesPtr->plane[loop];
+        planePtr->numConstructs = 0;
+        planePtr->indexPtr = &indexPtr[loop * numConstructs];
+        planePtr->headerPtr = &bytePtr[(loop * 3) * numConstructs];
+        planePtr->data1Ptr = &bytePtr[((loop * 3) + 1) * numConstructs];
+        planePtr->data2Ptr = &bytePtr[((loop * 3) + 2) * numConstructs];
+    }
+
+    for( uint16 first = 0; first < numConstructs; first = first + CC_TRIAGE_MAX_CONSTRUCTS ) {
+        uint16 numRun = ((numConstructs - first) < CC_TRIAGE_MAX_CONSTRUCTS) ? (numConstructs - first) : CC_TRIAGE_MAX_CONSTRUCTS;
+        triageCcData(&buffPtr->dataPtr[first * 3], numRun * 3, &triage);
+        appendToPlane(&buffPtr->planesPtr->plane[CC_DATA_PLANE_FIELD_1], buffPtr->dataPtr, first, triage.field1Mask);
+        appendToPlane(&buffPtr->planesPtr->plane[CC_DATA_PLANE_FIELD_2], buffPtr->dataPtr, first, triage.field2Mask);
+        appendToPlane(&buffPtr->planesPtr->plane[CC_DATA_PLANE_DTVCC], buffPtr->dataPtr, first, (triage.dtvccStartMask | triage.dtvccDataMask));
+    }
+}  // splitCcData()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    fillCcData()
+ |
+ | INPUT PARAMETERS:
+ |    dataPtr - Pointer to where the cc_data constructs should be written.
+ |    ccCount - Number of constructs in the frame.
+ |
+ | RETURN VALUES:
+ |    None
+ |
+ | DESCRIPTION:
+ |    This writes a frame of cc_data that carries no captioning: null pairs on
+ |    both Line 21 fields, followed by invalid DTVCC constructs.
+ -------------------------------------------------------------------------------*/
+void fillCcData( uint8* dataPtr, uint8 ccCount ) {
+    ASSERT(dataPtr);
+    ASSERT(ccCount >= 2);
+
+    dataPtr[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    dataPtr[1] = CEA608_ZERO_WITH_ODD_PARITY;
+    dataPtr[2] = CEA608_ZERO_WITH_ODD_PARITY;
+    dataPtr[3] = VALID_CEA608E_LINE21_FIELD_2_CC;
+    dataPtr[4] = CEA608_ZERO_WITH_ODD_PARITY;
+    dataPtr[5] = CEA608_ZERO_WITH_ODD_PARITY;
+    uint8* tmpPtr = &dataPtr[6];
+    for( int loop = 2; loop < ccCount; loop++ ) {
+        tmpPtr[0] = INVALID_DTVCCC_CHANNEL_PACKET_DATA;
+        tmpPtr[1] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+        tmpPtr[2] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+        tmpPtr = &tmpPtr[3];
+    }
+}  // fillCcData()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    bytesFromHex()
+ |
+ | INPUT PARAMETERS:
+ |    hexPtr - Pointer to a run of ASCII Hex, holding at least two characters per byte.
+ |    numBytes - Number of bytes to convert.
+ |
+ | RETURN VALUES:
+ |    bytesPtr - The converted bytes.
+ |    uint16 - Number of bytes converted, before the first invalid pair (if any).
+ |
+ | DESCRIPTION:
+ |    This method converts a whole run of ASCII Hex to bytes, stopping at the first
+ |    pair of characters which is not valid Hex. Callers which need to report the
+ |    invalid pair can then do so with isHexByteValid() at the returned position.
+ -------------------------------------------------------------------------------*/
+uint16 bytesFromHex( char* hexPtr, uint16 numBytes, uint8* bytesPtr ) {
+    ASSERT(hexPtr);
+    ASSERT(bytesPtr);
+    uint16 index = 0;
+
+#if defined(__SSE2__)
+    // Each 16 byte load holds eight pairs. Letters are folded to lower case, so a
+    // single range check covers both cases, and the first character of each pair
+    // lands in the low byte of its 16 bit lane, ready to be shifted up a nibble.
+    const __m128i belowZero = _mm_set1_epi8('0' - 1);
+    const __m128i aboveNine = _mm_set1_epi8('9' + 1);
+    const __m128i belowA = _mm_set1_epi8('a' - 1);
+    const __m128i aboveF = _mm_set1_epi8('f' + 1);
+    const __m128i lowerCase = _mm_set1_epi8(0x20);
+    const __m128i lowByte = _mm_set1_epi16(0x00FF);
+
+    while( (index + 8) <= numBytes ) {
+        __m128i chars = _mm_loadu_si128((const __m128i*)&hexPtr[index * 2]);
+        __m128i folded = _mm_or_si128(chars, lowerCase);
+        __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, belowZero), _mm_cmplt_epi8(chars, aboveNine));
+        __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(folded, belowA), _mm_cmplt_epi8(folded, aboveF));
+
+        if( _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF ) {
+            break;
+        }
+
+        __m128i nibbles = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                                       _mm_and_si128(isLetter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+        __m128i bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, lowByte), 4), _mm_srli_epi16(nibbles, 8));
+        _mm_storel_epi64((__m128i*)&bytesPtr[index], _mm_packus_epi16(bytes, bytes));
+        index = index + 8;
+    }
+#endif
+
+    while( index < numBytes ) {
+        uint8 msn = nibbleFromHex(hexPtr[index * 2]);
+        uint8 lsn = nibbleFromHex(hexPtr[(index * 2) + 1]);
+        if( (msn == INVALID_HEX_NIBBLE) || (lsn == INVALID_HEX_NIBBLE) ) {
+            break;
+        }
+        bytesPtr[index] = (msn << 4) | lsn;
+        index = index + 1;
+    }
+
+    return index;
+}  // bytesFromHex()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    bytesToHex()
+ |
+ | INPUT PARAMETERS:
+ |    bytesPtr - Pointer to the bytes to convert.
+ |    numBytes - Number of bytes to convert.
+ |
+ | RETURN VALUES:
+ |    hexPtr - Two upper case ASCII Hex characters per byte, without a terminator.
+ |
+ | DESCRIPTION:
+ |    This method converts a whole run of bytes to ASCII Hex, matching the output
+ |    of byteToAscii() for each byte.
+ -------------------------------------------------------------------------------*/
+void bytesToHex( uint8* bytesPtr, uint16 numBytes, char* hexPtr ) {
+    ASSERT(bytesPtr);
+    ASSERT(hexPtr);
+    uint16 index = 0;
+
+#if defined(__SSE2__)
+    // Eight bytes at a time are split into nibbles and interleaved, most significant
+    // first, then every nibble above nine is moved up from the digits to the letters.
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i asciiZero = _mm_set1_epi8('0');
+    const __m128i letterOffset = _mm_set1_epi8('A' - '0' - 10);
+
+    while( (index + 8) <= numBytes ) {
+        __m128i bytes = _mm_loadl_epi64((const __m128i*)&bytesPtr[index]);
+        __m128i msn = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+        __m128i lsn = _mm_and_si128(bytes, nibbleMask);
+        __m128i nibbles = _mm_unpacklo_epi8(msn, lsn);
+        __m128i chars = _mm_add_epi8(nibbles, asciiZero);
+        chars = _mm_add_epi8(chars, _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letterOffset));
+        _mm_storeu_si128((__m128i*)&hexPtr[index * 2], chars);
+        index = index + 8;
+    }
+#endif
+
+    while( index < numBytes ) {
+        byteToAscii(bytesPtr[index], (uint8*)&hexPtr[index * 2], (uint8*)&hexPtr[(index * 2) + 1]);
+        index = index + 1;
+    }
+}  // bytesToHex()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    timeCodeLineToMs()
+ |
+ | INPUT PARAMETERS:
+ |    line - Line of an SCC or MCC File, which need not be terminated.
+ |    lineLen - Length of the line.
+ |    frameRatePerSecTimesOneHundred - Frame Rate of the time codes in the file.
+ |
+ | RETURN VALUES:
+ |    timeInMsPtr - Time of the line, in milliseconds from the start of the asset.
+ |    boolean - TRUE if the line starts with a time code; FALSE otherwise
+ |
+ | DESCRIPTION:
+ |    This finds the time of a line of captions which starts with a time code.
+ |    It returns FALSE for any other line (e.g. a blank line), without logging,
+ |    as these are expected while searching or indexing a file.
+ -------------------------------------------------------------------------------*/
+boolean timeCodeLineToMs( const char* line, long lineLen, uint32 frameRatePerSecTimesOneHundred, uint32* timeInMsPtr ) {
+    char timecode[12];
+    CaptionTime captionTime;
+
+    if( lineLen < 11 ) return FALSE;
+    if( (line[2] != ':') || (line[5] != ':') || ((line[8] != ':') && (line[8] != ';')) ) return FALSE;
+    for( int loop = 0; loop < 11; loop = loop + 3 ) {
+        if( (line[loop] < '0') || (line[loop] > '9') || (line[loop+1] < '0') || (line[loop+1] > '9') ) return FALSE;
+    }
+
+    memcpy(timecode, line, 11);
+    timecode[11] = '\0';
+    memset(&captionTime, 0, sizeof(CaptionTime));
+    if( decodeTimeCode(timecode, &captionTime) == FALSE ) return FALSE;
+    captionTime.frameRatePerSecTimesOneHundred = frameRatePerSecTimesOneHundred;
+
+    *timeInMsPtr = captionTimeToMs(&captionTime);
+    return TRUE;
+}  // timeCodeLineToMs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    seekToTimeCode()
+ |
+ | INPUT PARAMETERS:
+ |    filePtr - Open SCC or MCC File.
+ |    lowPos - Offset of a line before the line being sought (e.g. the first
+ |             line of captions, after any header).
+ |    highPos - Offset at or after the start of the line being sought, or -1 for
+ |              the end of the file.
+ |    frameRatePerSecTimesOneHundred - Frame Rate of the time codes in the file.
+ |    timeInMs - Time to seek to, in milliseconds from the start of the asset.
+ |
+ | RETURN VALUES:
+ |    boolean - Success = TRUE; Failure = FALSE
+ |
+ | DESCRIPTION:
+ |    This leaves the file positioned at the first line of captions whose time
+ |    code is at or after the requested time, or at the end of the file if there
+ |    is no such line. As the lines are in time code order, the file is bisected
+ |    on byte offsets, reading just the first whole line after each midpoint,
+ |    until the line is close enough to find by reading the lines in turn.
+ -------------------------------------------------------------------------------*/
+boolean seekToTimeCode( FILE* filePtr, long lowPos, long highPos, uint32 frameRatePerSecTimesOneHundred, uint32 timeInMs ) {
+    ASSERT(filePtr);
+    char* line = NULL;
+    size_t len = 0;
+    ssize_t read = 0;
+    uint32 lineTimeInMs = 0;
+
+    if( highPos < 0 ) {
+        if( fseek(filePtr, 0, SEEK_END) != 0 ) return FALSE;
+        highPos = ftell(filePtr);
+    }
+
+    while( (highPos - lowPos) > TIME_CODE_SEEK_SCAN_BYTES ) {
+        long midPos = lowPos + ((highPos - lowPos) / 2);
+        boolean isLineFound = FALSE;
+
+        if( fseek(filePtr, midPos, SEEK_SET) != 0 ) {
+            free(line);
+            return FALSE;
+        }
+        // The midpoint is most likely part way through a line, so start from the next one
+        getline(&line, &len, filePtr);
+        while( (isLineFound == FALSE) && ((read = getline(&line, &len, filePtr)) != -1) ) {
+            isLineFound = timeCodeLineToMs(line, read, frameRatePerSecTimesOneHundred, &lineTimeInMs);
+        }
+
+        if( (isLineFound == TRUE) && (lineTimeInMs < timeInMs) ) {
+            lowPos = ftell(filePtr);
+        } else {
+            highPos = midPos;
+        }
+    }
+
+    if( fseek(filePtr, lowPos, SEEK_SET) != 0 ) {
+        free(line);
+        return FALSE;
+    }
+
+    long linePos = lowPos;
+    while( (read = getline(&line, &len, filePtr)) != -1 ) {
+        if( (timeCodeLineToMs(line, read, frameRatePerSecTimesOneHundred, &lineTimeInMs) == TRUE) && (lineTimeInMs >= timeInMs) ) {
+            break;
+        }
+        linePos = ftell(filePtr);
+    }
+    free(line);
+
+    return (fseek(filePtr, linePos, SEEK_SET) == 0) ? TRUE : FALSE;
+}  // seekToTimeCode()
+
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    triageConstruct()
+ |
+ | DESCRIPTION:
+ |    This classifies a single cc_data construct, setting the bit for its
+ |    position in the matching triage mask.
+ -------------------------------------------------------------------------------*/
+static void triageConstruct( uint8* constructPtr, uint8 position, CcDataTriage* triagePtr ) {
+    boolean ccValid = ((constructPtr[0] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET);
+    uint8 ccType = constructPtr[0] & CC_CONSTR_CC_TYPE_MASK;
+    boolean isNotNull = (((constructPtr[1] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA) ||
+                         ((constructPtr[2] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA));
+    uint32 positionBit = ((uint32)1) << position;
+
+    if( ccType == DTVCCC_CHANNEL_PACKET_START ) {
+        triagePtr->dtvccStartMask |= positionBit;
+    } else if( ccValid == FALSE ) {
+        return;
+    } else if( ccType == DTVCCC_CHANNEL_PACKET_DATA ) {
+        triagePtr->dtvccDataMask |= positionBit;
+    } else if( isNotNull == TRUE ) {
+        if( ccType == CEA608E_LINE21_FIELD_1_CC ) {
+            triagePtr->field1Mask |= positionBit;
+        } else {
+            triagePtr->field2Mask |= positionBit;
+        }
+    }
+}  // triageConstruct()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    appendToPlane()
+ |
+ | DESCRIPTION:
+ |    This copies the constructs flagged in a triage mask, for a run of cc_data
+ |    starting at the given construct, onto the end of a plane.
+ -------------------------------------------------------------------------------*/
+static void appendToPlane( CcDataPlane* planePtr, uint8* dataPtr, uint16 firstConstruct, uint32 mask ) {
+    while( mask != 0 ) {
+        uint16 constructNum = firstConstruct + __builtin_ctz(mask);
+        planePtr->indexPtr[planePtr->numConstructs] = constructNum;
+        planePtr->headerPtr[planePtr->numConstructs] = dataPtr[constructNum * 3];
+        planePtr->data1Ptr[planePtr->numConstructs] = dataPtr[(constructNum * 3) + 1];
+        planePtr->data2Ptr[planePtr->numConstructs] = dataPtr[(constructNum * 3) + 2];
+        planePtr->numConstructs++;
+        mask = mask & (mask - 1);
+    }
+}  // appendToPlane()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    nibbleFromHex()
+ |
+ | DESCRIPTION:
+ |    This converts a single ASCII Hex character, of either case, to its value.
+ |    Any other character is returned as INVALID_HEX_NIBBLE.
+ -------------------------------------------------------------------------------*/
+static uint8 nibbleFromHex( char hexChar ) {
+    if( (hexChar >= '0') && (hexChar <= '9') ) return hexChar - '0';
+    if( (hexChar >= 'A') && (hexChar <= 'F') ) return hexChar - 'A' + 10;
+    if( (hexChar >= 'a') && (hexChar <= 'f') ) return hexChar - 'a' + 10;
+    return INVALID_HEX_NIBBLE;
+}  // nibbleFromHex()
@@ -265,12 +265,13 @@ void DebugLog( uint8 level, uint8 section, char* file, int line, ... ) {
     va_list args;
     char message[1024];
     
+    // Logging may happen from the decode threads, so keep the tallies atomic
     if( level == DEBUG_LEVEL_FATAL ) {
-        numFatalErrors++;
+        __atomic_fetch_add(&numFatalErrors, 1, __ATOMIC_RELAXED);
     } else if( (level == DEBUG_LEVEL_ERROR) || (level == DEBUG_LEVEL_ASSERT) ) {
-        numErrors++;
+        __atomic_fetch_add(&numErrors, 1, __ATOMIC_RELAXED);
     } else if( level == DEBUG_LEVEL_WARN ) {
-        numWarnings++;
+        __atomic_fetch_add(&numWarnings, 1, __ATOMIC_RELAXED);
     }
     
     if( (level < dbgFileWriteLevel[section]) && ((level < dbgStdoutWriteLevel[section]) && (DebugExternal == NULL)) ) {
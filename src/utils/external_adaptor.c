@@ -24,9 +24,6 @@
 #include "cc_utils.h"
 #include "buffer_utils.h"
 #include "autodetect_file.h"
-#include "mpeg_file.h"
-#include "mov_file.h"
-#include "scc_encode.h"
 #include "version.h"
 
 /*----------------------------------------------------------------------------*/
@@ -53,6 +50,40 @@ FileType fileType = UNK_CAPTIONS_FILE;
 
 boolean pipelineEstablished = FALSE;
 
+#ifndef DONT_COMPILE_FFMPEG
+static const PipelineNode mpegDecodeGraph[] = {
+    { PIPELINE_ELEMENT_MPEG_FILE,      PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,   PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,  &linkInfo608 },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,  &linkInfo708 }
+};
+#endif
+
+static const PipelineNode movDecodeGraph[] = {
+    { PIPELINE_ELEMENT_MOV_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,   PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,  &linkInfo608 },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,  &linkInfo708 }
+};
+
+static const PipelineNode sccDecodeGraph[] = {
+    { PIPELINE_ELEMENT_SCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_SCC_ENCODE,     PIPELINE_ELEMENT_SCC_FILE,      PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_SCC_ENCODE,    PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,  &linkInfo608 }
+};
+
+static const PipelineNode mccDecodeGraph[] = {
+    { PIPELINE_ELEMENT_MCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,   PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_NONE, NULL },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,  &linkInfo608 },
+    { PIPELINE_ELEMENT_EXTERNAL,       PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,  &linkInfo708 }
+};
+
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
@@ -161,15 +192,18 @@ boolean ExtrnlAdptrInitialize( EXTERNAL_608_FN_PTR cbFn608Data, EXTERNAL_708_FN_
  |
  | DESCRIPTION:
  |    This method processes an incoming buffer, passing it to the External App.
+ |    The codes are packed in the buffer, so each is unpacked into a whole
+ |    Line21Code before it is handed over.
  -------------------------------------------------------------------------------*/
 boolean ExtrnlAdptr608OutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(buffPtr);
     ASSERT(buffPtr->dataPtr);
-    Line21Code* line21CodePtr = (Line21Code*)buffPtr->dataPtr;
+    Line21Code line21Code;
+    uint16 offset = 0;
 
-    for( int loop = 0; loop < buffPtr->numElements; loop++ ) {
-        if( line21CodePtr[loop].codeType != LINE21_NULL_DATA ) {
-            (external608DataCallbackFn)(buffPtr->captionTime, line21CodePtr[loop]);
+    while( Line21DecodeNextEvent(buffPtr, &offset, &line21Code) == TRUE ) {
+        if( line21Code.codeType != LINE21_NULL_DATA ) {
+            (external608DataCallbackFn)(buffPtr->captionTime, line21Code);
         }
     }
 
@@ -192,14 +226,17 @@ boolean ExtrnlAdptr608OutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
  |
  | DESCRIPTION:
  |    This method processes an incoming buffer, passing it to the External App.
+ |    The elements are packed in the buffer, so each is unpacked into a whole
+ |    DtvccData before it is handed over.
  -------------------------------------------------------------------------------*/
 boolean ExtrnlAdptr708OutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
     ASSERT(buffPtr);
     ASSERT(buffPtr->dataPtr);
-    DtvccData* dtvccDataPtr = (DtvccData*)buffPtr->dataPtr;
+    DtvccData dtvccData;
+    uint16 offset = 0;
 
-    for( int loop = 0; loop < buffPtr->numElements; loop++ ) {
-        (external708DataCallbackFn)(buffPtr->captionTime, dtvccDataPtr[loop]);
+    while( DtvccDecodeNextEvent(buffPtr, &offset, &dtvccData) == TRUE ) {
+        (external708DataCallbackFn)(buffPtr->captionTime, dtvccData);
     }
 
     FreeBuffer(buffPtr);
@@ -312,121 +349,40 @@ boolean ExtrnlAdptrPlumbFileDecodePipeline( char* inputFilename, uint32 framerat
 
     memset(&rootContext, 0, sizeof(Context));
     rootContext.config.inputFilename = inputFilename;
+    rootContext.config.passedInFramerate = framerate;
 
-    if( (fileType == MPEG_BINARY_FILE) || (fileType == MOV_BINARY_FILE) ) {
-        if (fileType == MPEG_BINARY_FILE) {
+    switch( fileType ) {
+        case MPEG_BINARY_FILE:
 #ifdef DONT_COMPILE_FFMPEG
             LOG(DEBUG_LEVEL_FATAL, DBG_EXT_ADPT, "Executable was compiled without FFMPEG, unable to process Binary MPEG File");
+            return FALSE;
 #else
-            retval = MpegFileInitialize(&rootContext, FALSE);
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            retval = MpegFileAddSink(&rootContext, Line21DecodeInitialize(&rootContext, FALSE));
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            retval = MpegFileAddSink(&rootContext, DtvccDecodeInitialize(&rootContext, FALSE));
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
+            retval = BuildPipeline(&rootContext, mpegDecodeGraph, PIPELINE_GRAPH_SIZE(mpegDecodeGraph), PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708);
+            break;
 #endif
-        } else {
-            retval = MovFileInitialize(&rootContext, FALSE);
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
+        case MOV_BINARY_FILE:
+            retval = BuildPipeline(&rootContext, movDecodeGraph, PIPELINE_GRAPH_SIZE(movDecodeGraph), PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708);
+            break;
+        case SCC_CAPTIONS_FILE:
+            if( isFramerateValid(framerate) == FALSE ) {
+                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Attempt to plumb stack for SCC File with an invalid Framerate: %d", framerate);
                 return FALSE;
             }
+            retval = BuildPipeline(&rootContext, sccDecodeGraph, PIPELINE_GRAPH_SIZE(sccDecodeGraph), PIPELINE_OUTPUT_608);
+            break;
+        default:
+            retval = BuildPipeline(&rootContext, mccDecodeGraph, PIPELINE_GRAPH_SIZE(mccDecodeGraph), PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708);
+            break;
+    }
 
-            retval = MovFileAddSink(&rootContext, Line21DecodeInitialize(&rootContext, FALSE));
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            retval = MovFileAddSink(&rootContext, DtvccDecodeInitialize(&rootContext, FALSE));
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-        }
-        retval = Line21DecodeAddSink(&rootContext, linkInfo608);
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = DtvccDecodeAddSink(&rootContext, linkInfo708);
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-    } else if( fileType == SCC_CAPTIONS_FILE ) {
-        if( isFramerateValid(framerate) == TRUE ) {
-            retval = SccFileInitialize(&rootContext, inputFilename, framerate);
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            retval = SccEncodeAddSink(&rootContext, Line21DecodeInitialize(&rootContext, FALSE));
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            retval = Line21DecodeAddSink(&rootContext, linkInfo608);
-            if( retval == FALSE ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-                return FALSE;
-            }
-
-            numberOfShutdowns = 1;
-        } else {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Attempt to plumb stack for SCC File with an invalid Framerate: %d", framerate);
-            return FALSE;
-        }
-    } else {
-        retval = MccFileInitialize(&rootContext, inputFilename);
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MccFileAddSink(&rootContext, MccDecodeInitialize(&rootContext));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MccDecodeAddSink(&rootContext, Line21DecodeInitialize(&rootContext, FALSE));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MccDecodeAddSink(&rootContext, DtvccDecodeInitialize(&rootContext, FALSE));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = Line21DecodeAddSink(&rootContext, linkInfo608);
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
+    if( retval == FALSE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
+        return FALSE;
+    }
 
-        retval = DtvccDecodeAddSink(&rootContext, linkInfo708);
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_EXT_ADPT, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
+    // There is no DTVCC Decode to shut down the CEA-708 side of the adaptor for a SCC File.
+    if( fileType == SCC_CAPTIONS_FILE ) {
+        numberOfShutdowns = 1;
     }
 
     pipelineEstablished = TRUE;
@@ -457,6 +413,7 @@ boolean ExtrnlAdptrPlumbSccPipeline( char* inputFilename, char* outputFilename,
     memset(&rootContext, 0, sizeof(Context));
     rootContext.config.passedInFramerate = framerate;
     rootContext.config.artifacts = TRUE;
+    rootContext.config.outputs = PIPELINE_OUTPUT_ALL;
     rootContext.config.inputFilename = InputFilename;
     strncpy(InputFilename, inputFilename, MAX_FILE_NAME_LEN);
     InputFilename[(MAX_FILE_NAME_LEN-1)] = '\0';
@@ -488,6 +445,7 @@ boolean ExtrnlAdptrPlumbMccPipeline( char* inputFilename, char* outputFilename )
     static char InputFilename[MAX_FILE_NAME_LEN];
     memset(&rootContext, 0, sizeof(Context));
     rootContext.config.artifacts = TRUE;
+    rootContext.config.outputs = PIPELINE_OUTPUT_ALL;
     rootContext.config.inputFilename = InputFilename;
     strncpy(InputFilename, inputFilename, MAX_FILE_NAME_LEN);
     InputFilename[(MAX_FILE_NAME_LEN-1)] = '\0';
@@ -520,6 +478,7 @@ boolean ExtrnlAdptrPlumbMpegPipeline( char* inputFilename, char* outputFilename,
     static char InputFilename[MAX_FILE_NAME_LEN];
     memset(&rootContext, 0, sizeof(Context));
     rootContext.config.artifacts = artifacts;
+    rootContext.config.outputs = PIPELINE_OUTPUT_ALL;
     rootContext.config.inputFilename = InputFilename;
     strncpy(InputFilename, inputFilename, MAX_FILE_NAME_LEN);
     InputFilename[(MAX_FILE_NAME_LEN-1)] = '\0';
@@ -552,6 +511,7 @@ boolean ExtrnlAdptrPlumbMovPipeline( char* inputFilename, char* outputFilename,
     static char InputFilename[MAX_FILE_NAME_LEN];
     memset(&rootContext, 0, sizeof(Context));
     rootContext.config.artifacts = artifacts;
+    rootContext.config.outputs = PIPELINE_OUTPUT_ALL;
     rootContext.config.inputFilename = InputFilename;
     strncpy(InputFilename, inputFilename, MAX_FILE_NAME_LEN);
     InputFilename[(MAX_FILE_NAME_LEN-1)] = '\0';
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "debug.h"
 #include "output_utils.h"
@@ -38,6 +39,7 @@ const char* trueFalseStr[2] = { "False", "True" };
 
 static uint8 numFilePtrs = 0;
 static FILE* fpArray[MAX_NUM_OUTPUT_FILES];
+static pthread_mutex_t fpArrayMutex = PTHREAD_MUTEX_INITIALIZER;   // Sinks run in parallel open files lazily
 
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
@@ -68,6 +70,7 @@ FILE* fileOutputInit( char* outputFileNameStr ) {
         return NULL;
     }
     
+    pthread_mutex_lock(&fpArrayMutex);
     if( numFilePtrs == 0 ) {
         for( uint8 loop = 0; loop < MAX_NUM_OUTPUT_FILES; loop++ ) {
             fpArray[loop] = NULL;
@@ -76,13 +79,26 @@ FILE* fileOutputInit( char* outputFileNameStr ) {
     
     if( numFilePtrs == MAX_NUM_OUTPUT_FILES ) {
         LOG(DEBUG_LEVEL_FATAL, DBG_FILE_OUT, "Attempted to open too many files: %d", numFilePtrs );
+        pthread_mutex_unlock(&fpArrayMutex);
         return NULL;
     }
     
     fp = fopen( outputFileNameStr, "w" );
-    if( fp == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_FILE_OUT, "Unable to Open File: %s - [Errno %d] %s", outputFileNameStr, errno, strerror(errno));
-    fpArray[numFilePtrs] = fp;
+    if( fp == NULL ) {
+        LOG(DEBUG_LEVEL_FATAL, DBG_FILE_OUT, "Unable to Open File: %s - [Errno %d] %s", outputFileNameStr, errno, strerror(errno));
+        pthread_mutex_unlock(&fpArrayMutex);
+        return NULL;
+    }
+
+    // Files may have been closed out of order, so take the first free slot rather than the last
+    for( uint8 loop = 0; loop < MAX_NUM_OUTPUT_FILES; loop++ ) {
+        if( fpArray[loop] == NULL ) {
+            fpArray[loop] = fp;
+            break;
+        }
+    }
     numFilePtrs++;
+    pthread_mutex_unlock(&fpArrayMutex);
 
     return fp;
 }  // FileOutputInit()
@@ -127,14 +143,16 @@ void writeToFile( FILE* fout, char* fmt, ... ) {
 void closeFile( FILE* myFp ) {
     if( myFp == FALSE ) return;
     
+    pthread_mutex_lock(&fpArrayMutex);
     for( uint8 loop = 0; loop < MAX_NUM_OUTPUT_FILES; loop++ ) {
         if( fpArray[loop] == myFp ) {
             fclose(fpArray[loop]);
             fpArray[loop] = NULL;
             numFilePtrs = numFilePtrs - 1;
-            return;
+            break;
         }
     }
+    pthread_mutex_unlock(&fpArrayMutex);
 }  // closeFile()
 
 /*------------------------------------------------------------------------------
@@ -152,13 +170,15 @@ void closeFile( FILE* myFp ) {
  |
  -------------------------------------------------------------------------------*/
 void closeAllFiles( void ) {
-    for( uint8 loop = 0; loop < numFilePtrs; loop++ ) {
+    pthread_mutex_lock(&fpArrayMutex);
+    for( uint8 loop = 0; loop < MAX_NUM_OUTPUT_FILES; loop++ ) {
         if( fpArray[loop] != NULL ) {
             fclose(fpArray[loop]);
             fpArray[loop] = NULL;
         }
     }
     numFilePtrs = 0;
+    pthread_mutex_unlock(&fpArrayMutex);
 }  // closeAllFiles()
 
 /*------------------------------------------------------------------------------
@@ -26,13 +26,18 @@
 #include "mov_file.h"
 #include "dtvcc_decode.h"
 #include "line21_decode.h"
+#include "line21_screen.h"
 #include "mcc_decode.h"
 #include "mcc_encode.h"
 #include "scc_encode.h"
 #include "mcc_output.h"
 #include "dtvcc_output.h"
 #include "line21_output.h"
+#include "cue_output.h"
+#include "dtvcc_window.h"
 #include "cc_data_output.h"
+#include "cc_data_file.h"
+#include "cache_output.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Variables                          --*/
@@ -50,22 +55,173 @@ static const char* LinkTypeText[MAX_LINK_TYPE] = {
     "MPG_FILE___CC_DATA",
     "MCC_DATA___CC_DATA",
     "SCC_DATA___CC_DATA",
-    "SEI_DATA___CC_DATA",    
     "CC_DATA___MCC_DATA",
     "CC_DATA___LINE21_DATA",
     "CC_DATA___DTVCC_DATA",
+    "SEI_DATA___TEXT_FILE",
     "CC_DATA___TEXT_FILE",
     "MCC_DATA___TEXT_FILE",
     "LINE21_DATA___TEXT_FILE",
     "DTVCC_DATA___TEXT_FILE",
     "LINE21_DATA___EXTRNL_ADPTR",
-    "DTVCC_DATA___EXTRNL_ADPTR"
+    "DTVCC_DATA___EXTRNL_ADPTR",
+    "LINE21_DATA___CAPTION_CUE",
+    "CAPTION_CUE___SUBTITLE_FILE",
+    "DTVCC_DATA___CAPTION_CUE",
+    "CCD_FILE___CC_DATA",
+    "CC_DATA___CCD_FILE"
 };
 
+// Set while a thread runs one of the sinks of a parallel pass, whose own sinks are then run in turn
+static _Thread_local boolean isRunningParallelSink = FALSE;
+
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static uint8 passToSink( SinkPass*, uint8 );
+static void passToSinkTask( void*, uint32 );
+static uint8 selectedOutputs( Context* );
+static boolean initSccFile( Context* );
+static boolean initMccFile( Context* );
+static boolean initMpegFile( Context* );
+static boolean initMovFile( Context* );
+static boolean initCcDataFile( Context* );
+static LinkInfo initSccEncode( Context*, boolean );
+static LinkInfo initMccDecode( Context*, boolean );
+static LinkInfo initMccEncode( Context*, boolean );
+static LinkInfo initLine21Decode( Context*, boolean );
+static LinkInfo initDtvccDecode( Context*, boolean );
+static LinkInfo initLine21Screen( Context*, boolean );
+static LinkInfo initDtvccWindow( Context*, boolean );
+static LinkInfo initMccOut( Context*, boolean );
+static LinkInfo initLine21Out( Context*, boolean );
+static LinkInfo initDtvccOut( Context*, boolean );
+static LinkInfo initDtvccOutMs( Context*, boolean );
+static LinkInfo initCueOut( Context*, boolean );
+static LinkInfo initCcDataOut( Context*, boolean );
+static LinkInfo initCacheOut( Context*, boolean );
+
+// WARNING: This array needs to match the defines in pipeline_utils.h
+static const PipelineElement PipelineElements[MAX_PIPELINE_ELEMENT] = {
+    { "None",            DATA_TYPE_UNKNOWN,      DATA_TYPE_UNKNOWN,            NULL,          NULL,              NULL },
+    { "SCC File",        DATA_TYPE_UNKNOWN,      DATA_TYPE_SCC_DATA,           initSccFile,   NULL,              SccFileAddSink },
+    { "MCC File",        DATA_TYPE_UNKNOWN,      DATA_TYPE_MCC_DATA,           initMccFile,   NULL,              MccFileAddSink },
+    { "MPEG File",       DATA_TYPE_UNKNOWN,      DATA_TYPE_CC_DATA,            initMpegFile,  NULL,              MpegFileAddSink },
+    { "MOV File",        DATA_TYPE_UNKNOWN,      DATA_TYPE_CC_DATA,            initMovFile,   NULL,              MovFileAddSink },
+    { "CC Data File",    DATA_TYPE_UNKNOWN,      DATA_TYPE_CC_DATA,            initCcDataFile, NULL,             CcDataFileAddSink },
+    { "SCC Encode",      DATA_TYPE_SCC_DATA,     DATA_TYPE_CC_DATA,            NULL,          initSccEncode,     SccEncodeAddSink },
+    { "MCC Decode",      DATA_TYPE_MCC_DATA,     DATA_TYPE_CC_DATA,            NULL,          initMccDecode,     MccDecodeAddSink },
+    { "MCC Encode",      DATA_TYPE_CC_DATA,      DATA_TYPE_MCC_DATA,           NULL,          initMccEncode,     MccEncodeAddSink },
+    { "Line 21 Decode",  DATA_TYPE_CC_DATA,      DATA_TYPE_DECODED_608,        NULL,          initLine21Decode,  Line21DecodeAddSink },
+    { "DTVCC Decode",    DATA_TYPE_CC_DATA,      DATA_TYPE_DECODED_708,        NULL,          initDtvccDecode,   DtvccDecodeAddSink },
+    { "Line 21 Screen",  DATA_TYPE_DECODED_608,  DATA_TYPE_CAPTION_CUE,        NULL,          initLine21Screen,  Line21ScreenAddSink },
+    { "DTVCC Window",    DATA_TYPE_DECODED_708,  DATA_TYPE_CAPTION_CUE,        NULL,          initDtvccWindow,   DtvccWindowAddSink },
+    { "MCC Output",      DATA_TYPE_MCC_DATA,     DATA_TYPE_MCC_DATA_TXT_FILE,  NULL,          initMccOut,        NULL },
+    { "Line 21 Output",  DATA_TYPE_DECODED_608,  DATA_TYPE_608_TXT_FILE,       NULL,          initLine21Out,     NULL },
+    { "DTVCC Output",    DATA_TYPE_DECODED_708,  DATA_TYPE_708_TXT_FILE,       NULL,          initDtvccOut,      NULL },
+    { "DTVCC Output",    DATA_TYPE_DECODED_708,  DATA_TYPE_708_TXT_FILE,       NULL,          initDtvccOutMs,    NULL },
+    { "Cue Output",      DATA_TYPE_CAPTION_CUE,  DATA_TYPE_SUBTITLE_FILE,      NULL,          initCueOut,        NULL },
+    { "CC Data Output",  DATA_TYPE_CC_DATA,      DATA_TYPE_CC_DATA_TXT_FILE,   NULL,          initCcDataOut,     NULL },
+    { "Cache Output",    DATA_TYPE_CC_DATA,      DATA_TYPE_CC_DATA_FILE,       NULL,          initCacheOut,      NULL },
+    { "External Sink",   DATA_TYPE_UNKNOWN,      DATA_TYPE_UNKNOWN,            NULL,          NULL,              NULL }
+};
+
+// Every node of a graph follows the node that feeds it, and the sinks of an element
+// are added in the order that they are listed. CC Data Output formats what the decoders
+// annotated the buffer with, so it is listed as the last sink of its element.
+static const PipelineNode sccPipelineGraph[] = {
+    { PIPELINE_ELEMENT_SCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_SCC_ENCODE,     PIPELINE_ELEMENT_SCC_FILE,      PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_SCC_ENCODE,    PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,     PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_MCC_ENCODE,     PIPELINE_ELEMENT_SCC_ENCODE,    PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_OUTPUT,     PIPELINE_ELEMENT_MCC_ENCODE,    PIPELINE_OUTPUT_MCC,                          NULL },
+    { PIPELINE_ELEMENT_CACHE_OUTPUT,   PIPELINE_ELEMENT_SCC_ENCODE,    PIPELINE_OUTPUT_CACHE,                        NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_SCC_ENCODE,    PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
+static const PipelineNode mccPipelineGraph[] = {
+    { PIPELINE_ELEMENT_MCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,   PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_DTVCC_OUTPUT,   PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_WINDOW,   PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,     PIPELINE_ELEMENT_DTVCC_WINDOW,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,     PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_CACHE_OUTPUT,   PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_CACHE,                        NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
+static const PipelineNode mpegPipelineGraph[] = {
+    { PIPELINE_ELEMENT_MPEG_FILE,        PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_ENCODE,       PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_OUTPUT,       PIPELINE_ELEMENT_MCC_ENCODE,    PIPELINE_OUTPUT_MCC,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,     PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,    PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_DTVCC_OUTPUT_MS,  PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_WINDOW,     PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_DTVCC_WINDOW,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_CACHE_OUTPUT,     PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_CACHE,                        NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT,   PIPELINE_ELEMENT_MPEG_FILE,     PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
+static const PipelineNode movPipelineGraph[] = {
+    { PIPELINE_ELEMENT_MOV_FILE,         PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_ENCODE,       PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_OUTPUT,       PIPELINE_ELEMENT_MCC_ENCODE,    PIPELINE_OUTPUT_MCC,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,     PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,    PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_DTVCC_OUTPUT_MS,  PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_WINDOW,     PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_DTVCC_WINDOW,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_CACHE_OUTPUT,     PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_CACHE,                        NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT,   PIPELINE_ELEMENT_MOV_FILE,      PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
+// A CC Data File is never cached again, as the Cache Output would overwrite the file being read.
+// The times it holds are either Presentation Times or Time Codes, as cached from its source.
+static const PipelineNode ccDataPtsPipelineGraph[] = {
+    { PIPELINE_ELEMENT_CC_DATA_FILE,     PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_ENCODE,       PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_OUTPUT,       PIPELINE_ELEMENT_MCC_ENCODE,    PIPELINE_OUTPUT_MCC,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,     PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,    PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_DTVCC_OUTPUT_MS,  PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_WINDOW,     PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_DTVCC_WINDOW,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT,   PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
+static const PipelineNode ccDataTimeCodePipelineGraph[] = {
+    { PIPELINE_ELEMENT_CC_DATA_FILE,     PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_ENCODE,       PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_MCC_OUTPUT,       PIPELINE_ELEMENT_MCC_ENCODE,    PIPELINE_OUTPUT_MCC,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_DECODE,     PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_LINE21_DECODE,    PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+    { PIPELINE_ELEMENT_DTVCC_OUTPUT,     PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_DTVCC_WINDOW,     PIPELINE_ELEMENT_DTVCC_DECODE,  PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_DTVCC_WINDOW,  PIPELINE_OUTPUT_708,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_OUTPUT,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_LINE21_SCREEN,    PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_NONE,                         NULL },
+    { PIPELINE_ELEMENT_CUE_OUTPUT,       PIPELINE_ELEMENT_LINE21_SCREEN, PIPELINE_OUTPUT_608,                          NULL },
+    { PIPELINE_ELEMENT_CC_DATA_OUTPUT,   PIPELINE_ELEMENT_CC_DATA_FILE,  PIPELINE_OUTPUT_CCD,                          NULL }
+};
+
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
 /*----------------------------------------------------------------------------*/
@@ -89,6 +245,8 @@ void InitSinks( Sinks* sinksToInit, uint8 myLinkType ) {
     ASSERT(sinksToInit);
     sinksToInit->linkType = myLinkType;
     sinksToInit->numSinks = 0;
+    sinksToInit->maxSinks = 0;
+    sinksToInit->sink = NULL;
 }  // InitSinks()
 
 /*------------------------------------------------------------------------------
@@ -103,7 +261,8 @@ void InitSinks( Sinks* sinksToInit, uint8 myLinkType ) {
  |    boolean - Success is TRUE and Failure is FALSE
  |
  | DESCRIPTION:
- |    This method adds another sink to the caller.
+ |    This method adds another sink to the caller. The list of sinks starts out
+ |    empty and doubles in size whenever it runs out of room.
  -------------------------------------------------------------------------------*/
 boolean AddSink( Sinks* sinks, LinkInfo* linkInfoPtr ) {
     ASSERT(sinks);
@@ -113,15 +272,30 @@ boolean AddSink( Sinks* sinks, LinkInfo* linkInfoPtr ) {
     ASSERT(linkInfoPtr->sourceType < MAX_DATA_TYPE);
     ASSERT(linkInfoPtr->sinkType < MAX_DATA_TYPE);
 
-    if( (sinks->numSinks + 1) <= MAX_NUMBER_OF_SINKS ) {
-        sinks->sink[sinks->numSinks] = *linkInfoPtr;
-        sinks->numSinks = sinks->numSinks + 1;
-        LOG(DEBUG_LEVEL_VERBOSE, DBG_PIPELINE, "Added Sink: %s -> %s", LinkTypeText[sinks->linkType], LinkTypeText[linkInfoPtr->linkType]);
-        return TRUE;
-    } else {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Ignoring attempt to add too many sinks.");
-        return FALSE;
+    if( sinks->numSinks == sinks->maxSinks ) {
+        if( sinks->maxSinks == MAX_NUMBER_OF_SINKS ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Ignoring attempt to add too many sinks.");
+            return FALSE;
+        }
+
+        uint16 maxSinks = (sinks->maxSinks == 0) ? INITIAL_NUMBER_OF_SINKS : (sinks->maxSinks * 2);
+        if( maxSinks > MAX_NUMBER_OF_SINKS ) {
+            maxSinks = MAX_NUMBER_OF_SINKS;
+        }
+
+        LinkInfo* sinkList = realloc(sinks->sink, maxSinks * sizeof(LinkInfo));
+        if( sinkList == NULL ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Unable to grow the list of sinks to %d.", maxSinks);
+            return FALSE;
+        }
+        sinks->sink = sinkList;
+        sinks->maxSinks = (uint8)maxSinks;
     }
+
+    sinks->sink[sinks->numSinks] = *linkInfoPtr;
+    sinks->numSinks = sinks->numSinks + 1;
+    LOG(DEBUG_LEVEL_VERBOSE, DBG_PIPELINE, "Added Sink: %s -> %s", LinkTypeText[sinks->linkType], LinkTypeText[linkInfoPtr->linkType]);
+    return TRUE;
 } // AddSink()
 
 /*------------------------------------------------------------------------------
@@ -142,13 +316,19 @@ boolean AddSink( Sinks* sinks, LinkInfo* linkInfoPtr ) {
  | DESCRIPTION:
  |    This method moves a buffer from one element to its sinks. It also adds
  |    references to the buffer, so that it won't be freed until all of the
- |    sinks are done with it.
+ |    sinks are done with it. With --parallel-sinks, the sinks of the first
+ |    element to pass a buffer to more than two sinks are run on the sink thread
+ |    pool, apart from the last sink, which is run once the others have finished
+ |    so that it sees any annotation they attached to the buffer. Any sink which
+ |    reads an annotation (e.g. the CC Data Output) must therefore be the last
+ |    sink of its element. The sinks further down each branch are run in turn,
+ |    on the thread of their branch.
  -------------------------------------------------------------------------------*/
 uint8 _PassToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer* buffPtr, Sinks* sinks ) {
     ASSERT(ctxPtr);
     ASSERT(buffPtr);
     ASSERT(sinks);
-    ASSERT(sinks->numSinks <= MAX_NUMBER_OF_SINKS);
+    ASSERT(sinks->numSinks <= sinks->maxSinks);
     uint8 retval = TRUE;
 
     char* basename = fileNameStr;
@@ -162,13 +342,26 @@ uint8 _PassToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer* buf
     for( int loop = 0; loop < sinks->numSinks; loop++ ) {
         AddReader(buffPtr);
     }
+
+    SinkPass sinkPass;
+    sinkPass.ctxPtr = ctxPtr;
+    sinkPass.buffPtr = buffPtr;
+    sinkPass.sinks = sinks;
+    sinkPass.basename = basename;
+    sinkPass.lineNum = lineNum;
+
+    uint8 numParallelSinks = 0;
+    if( (ctxPtr->sinkPoolPtr != NULL) && (sinks->numSinks > 2) && (isRunningParallelSink == FALSE) ) {
+        // The last sink may read what the others annotated the buffer with, so it waits for them
+        numParallelSinks = sinks->numSinks - 1;
+        ThreadPoolRun(ctxPtr->sinkPoolPtr, &passToSinkTask, &sinkPass, numParallelSinks);
+    }
+    for( uint8 loop = numParallelSinks; loop < sinks->numSinks; loop++ ) {
+        sinkPass.results[loop] = passToSink(&sinkPass, loop);
+    }
     
     for( int loop = 0; loop < sinks->numSinks; loop++ ) {
-        ASSERT(sinks->linkType < MAX_LINK_TYPE);
-        ASSERT(sinks->sink[loop].linkType < MAX_LINK_TYPE);
-        ASSERT(sinks->sink[loop].NextBufferFnPtr);
-        LOG(DEBUG_LEVEL_VERBOSE, DBG_PIPELINE, "Passed Buffer [%p] to Sink: %s -> %s in {%s:%d}", buffPtr, LinkTypeText[sinks->linkType], LinkTypeText[sinks->sink[loop].linkType], basename, lineNum);
-        boolean tmp = sinks->sink[loop].NextBufferFnPtr(ctxPtr, buffPtr);
+        uint8 tmp = sinkPass.results[loop];
         if( tmp != TRUE ) {
             if( (retval != TRUE) && (retval != tmp) ) {
                 LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Eclipsed %d with %d for {%s:%d}.", retval, tmp, basename, lineNum);
@@ -179,6 +372,166 @@ uint8 _PassToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer* buf
     return retval;
 } // PassToSinks()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    PassFrameToSinks()/_PassFrameToSinks()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the calling function.
+ |    lineNum - The line number of the calling function.
+ |    ctxPtr - Pointer to the Context of the caller.
+ |    framesBufferPtrPtr - The caller's buffer of frames waiting to be passed on.
+ |    captionTimePtr - The time of the frame.
+ |    dataPtr - The cc_data of the frame.
+ |    numElements - The number of bytes of cc_data in the frame.
+ |    sinks - Pointer to the sink structure of the caller.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method sends a frame of cc_data from a source down the pipeline. By
+ |    default every frame is passed on in a buffer of its own. With
+ |    --frames-per-buffer, frames are gathered into the caller's buffer of
+ |    frames instead, which is passed on once it is full, or once a frame comes
+ |    along that does not fit. The caller passes on whatever is left with
+ |    FlushFramesToSinks() before shutting down its sinks. With --planar-cc-data,
+ |    each buffer is split into planes for the decoders on its way out.
+ -------------------------------------------------------------------------------*/
+uint8 _PassFrameToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer** framesBufferPtrPtr,
+                         CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements, Sinks* sinks ) {
+    ASSERT(ctxPtr);
+    ASSERT(framesBufferPtrPtr);
+    ASSERT(captionTimePtr);
+    ASSERT(dataPtr);
+    ASSERT(numElements);
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( (ctxPtr->config.framesPerBuffer <= 1) || (numElements > MCC_MAX_CC_DATA_BYTES) ) {
+        if( *framesBufferPtrPtr != NULL ) {
+            retval = _FlushFramesToSinks(fileNameStr, lineNum, ctxPtr, framesBufferPtrPtr, sinks);
+        }
+        Buffer* buffPtr = _NewBuffer(fileNameStr, lineNum, BUFFER_TYPE_BYTES, numElements);
+        buffPtr->captionTime = *captionTimePtr;
+        buffPtr->numElements = numElements;
+        memcpy(buffPtr->dataPtr, dataPtr, numElements);
+        if( ctxPtr->config.planarCcData == TRUE ) {
+            splitCcData(buffPtr);
+        }
+        uint8 tmp = _PassToSinks(fileNameStr, lineNum, ctxPtr, buffPtr, sinks);
+        return (tmp != PIPELINE_SUCCESS) ? tmp : retval;
+    }
+
+    if( (*framesBufferPtrPtr != NULL) && (AddFrameToBuffer(*framesBufferPtrPtr, captionTimePtr, dataPtr, numElements) == FALSE) ) {
+        retval = _FlushFramesToSinks(fileNameStr, lineNum, ctxPtr, framesBufferPtrPtr, sinks);
+    }
+
+    if( *framesBufferPtrPtr == NULL ) {
+        *framesBufferPtrPtr = _NewFramesBuffer(fileNameStr, lineNum, ctxPtr->config.framesPerBuffer,
+                                               (ctxPtr->config.framesPerBuffer * MCC_MAX_CC_DATA_BYTES));
+        boolean wasAdded = AddFrameToBuffer(*framesBufferPtrPtr, captionTimePtr, dataPtr, numElements);
+        ASSERT(wasAdded);
+    }
+
+    if( (*framesBufferPtrPtr)->numFrames == (*framesBufferPtrPtr)->maxNumFrames ) {
+        uint8 tmp = _FlushFramesToSinks(fileNameStr, lineNum, ctxPtr, framesBufferPtrPtr, sinks);
+        return (tmp != PIPELINE_SUCCESS) ? tmp : retval;
+    }
+    return retval;
+}  // PassFrameToSinks()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    FlushFramesToSinks()/_FlushFramesToSinks()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the calling function.
+ |    lineNum - The line number of the calling function.
+ |    ctxPtr - Pointer to the Context of the caller.
+ |    framesBufferPtrPtr - The caller's buffer of frames waiting to be passed on.
+ |    sinks - Pointer to the sink structure of the caller.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method passes on the frames gathered by PassFrameToSinks(), if there
+ |    are any, leaving the caller without a buffer of frames.
+ -------------------------------------------------------------------------------*/
+uint8 _FlushFramesToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer** framesBufferPtrPtr, Sinks* sinks ) {
+    ASSERT(ctxPtr);
+    ASSERT(framesBufferPtrPtr);
+
+    if( *framesBufferPtrPtr == NULL ) {
+        return PIPELINE_SUCCESS;
+    }
+
+    Buffer* buffPtr = *framesBufferPtrPtr;
+    *framesBufferPtrPtr = NULL;
+    if( ctxPtr->config.planarCcData == TRUE ) {
+        splitCcData(buffPtr);
+    }
+    return _PassToSinks(fileNameStr, lineNum, ctxPtr, buffPtr, sinks);
+}  // FlushFramesToSinks()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    PassFrameRefToSinks()/_PassFrameRefToSinks()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The name of the calling function.
+ |    lineNum - The line number of the calling function.
+ |    ctxPtr - Pointer to the Context of the caller.
+ |    framesBufferPtrPtr - The caller's buffer of frames waiting to be passed on.
+ |    captionTimePtr - The time of the frame.
+ |    dataPtr - The cc_data of the frame, which is owned elsewhere.
+ |    numElements - The number of bytes of cc_data in the frame.
+ |    dataRefPtr - A reference which keeps the cc_data alive, handed over by the caller.
+ |    releaseFnPtr - Releases the reference once the cc_data is no longer needed.
+ |    sinks - Pointer to the sink structure of the caller.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is PassFrameToSinks() for a source whose cc_data is held by
+ |    someone else, such as the side data of a decoded frame. When the frame is
+ |    passed on in a buffer of its own, the buffer borrows the cc_data rather
+ |    than copying it, and releases the reference when it is freed. Frames which
+ |    are gathered into a buffer of frames are copied there, and the reference is
+ |    released straight away.
+ -------------------------------------------------------------------------------*/
+uint8 _PassFrameRefToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer** framesBufferPtrPtr, CaptionTime* captionTimePtr,
+                            uint8* dataPtr, uint16 numElements, void* dataRefPtr, BufferReleaseFnPtr releaseFnPtr, Sinks* sinks ) {
+    ASSERT(ctxPtr);
+    ASSERT(framesBufferPtrPtr);
+    ASSERT(captionTimePtr);
+    ASSERT(dataPtr);
+    ASSERT(numElements);
+    ASSERT(releaseFnPtr);
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( (ctxPtr->config.framesPerBuffer > 1) && (numElements <= MCC_MAX_CC_DATA_BYTES) ) {
+        retval = _PassFrameToSinks(fileNameStr, lineNum, ctxPtr, framesBufferPtrPtr, captionTimePtr, dataPtr, numElements, sinks);
+        releaseFnPtr(dataRefPtr);
+        return retval;
+    }
+
+    if( *framesBufferPtrPtr != NULL ) {
+        retval = _FlushFramesToSinks(fileNameStr, lineNum, ctxPtr, framesBufferPtrPtr, sinks);
+    }
+    Buffer* buffPtr = _NewRefBuffer(fileNameStr, lineNum, BUFFER_TYPE_BYTES, dataPtr, numElements, dataRefPtr, releaseFnPtr);
+    buffPtr->captionTime = *captionTimePtr;
+    if( ctxPtr->config.planarCcData == TRUE ) {
+        splitCcData(buffPtr);
+    }
+    uint8 tmp = _PassToSinks(fileNameStr, lineNum, ctxPtr, buffPtr, sinks);
+    return (tmp != PIPELINE_SUCCESS) ? tmp : retval;
+}  // PassFrameRefToSinks()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    ShutdownSinks()/_ShutdownSinks()
@@ -194,12 +547,13 @@ uint8 _PassToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer* buf
  |            All other codes specified in header.
  |
  | DESCRIPTION:
- |    This method tells the sinks that there is no more data in the pipeline.
+ |    This method tells the sinks that there is no more data in the pipeline,
+ |    and then frees the list of sinks.
  -------------------------------------------------------------------------------*/
 uint8 _ShutdownSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Sinks* sinks ) {
     ASSERT(sinks);
     ASSERT(ctxPtr);
-    ASSERT(sinks->numSinks <= MAX_NUMBER_OF_SINKS);
+    ASSERT(sinks->numSinks <= sinks->maxSinks);
     
     boolean retval = TRUE;
 
@@ -220,9 +574,158 @@ uint8 _ShutdownSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Sinks* si
             retval = FALSE;
         }
     }
+
+    free(sinks->sink);
+    sinks->sink = NULL;
+    sinks->numSinks = 0;
+    sinks->maxSinks = 0;
+
     return retval;
 } // ShutdownSinks()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    BuildPipeline()
+ |
+ | INPUT PARAMETERS:
+ |    ctxPtr - Pointer to the Context.
+ |    graph - The nodes of the Pipeline, starting with the Source.
+ |    numNodes - Number of nodes in the graph.
+ |    outputs - The outputs (PIPELINE_OUTPUT_*) to plumb the Pipeline for.
+ |
+ | RETURN VALUES:
+ |    boolean - Success is TRUE and Failure is FALSE
+ |
+ | DESCRIPTION:
+ |    This method plumbs a Pipeline from a description of it. The whole graph is
+ |    checked before anything is initialized: every node needs to follow the node
+ |    that feeds it, and to consume the type of data that node produces. CC Data
+ |    Output also needs to be the last sink of its element, so that it runs after
+ |    the decoders which annotate the buffers it formats. Nodes which none of the
+ |    selected outputs need are left out, an element that feeds several outputs
+ |    is only plumbed once, and an element whose sinks are all left out is
+ |    initialized knowing that it has none.
+ -------------------------------------------------------------------------------*/
+boolean BuildPipeline( Context* ctxPtr, const PipelineNode* graph, uint8 numNodes, uint8 outputs ) {
+    ASSERT(ctxPtr);
+    ASSERT(graph);
+    ASSERT(numNodes);
+    ASSERT(numNodes <= PIPELINE_MAX_NODES);
+    ASSERT(graph[0].element < MAX_PIPELINE_ELEMENT);
+
+    uint8 parentNode[PIPELINE_MAX_NODES];
+    boolean isNeeded[PIPELINE_MAX_NODES];
+    boolean hasSinks[PIPELINE_MAX_NODES];
+    uint8 graphOutputs = PIPELINE_OUTPUT_NONE;
+
+    if( (graph[0].parent != PIPELINE_ELEMENT_NONE) || (PipelineElements[graph[0].element].SourceInitFnPtr == NULL) ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Pipeline starts with %s rather than a Source, unable to establish pipeline.", PipelineElements[graph[0].element].name);
+        return FALSE;
+    }
+
+    for( int loop = 1; loop < numNodes; loop++ ) {
+        ASSERT(graph[loop].element < MAX_PIPELINE_ELEMENT);
+        const PipelineElement* elementPtr = &PipelineElements[graph[loop].element];
+        uint8 consumedType = elementPtr->sourceType;
+
+        if( graph[loop].element == PIPELINE_ELEMENT_EXTERNAL ) {
+            ASSERT(graph[loop].linkInfoPtr);
+            consumedType = graph[loop].linkInfoPtr->sourceType;
+        } else if( elementPtr->InitFnPtr == NULL ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "%s can only start a Pipeline, unable to establish pipeline.", elementPtr->name);
+            return FALSE;
+        }
+
+        int parent = loop - 1;
+        while( (parent >= 0) && (graph[parent].element != graph[loop].parent) ) {
+            parent--;
+        }
+
+        if( parent < 0 ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Nothing ahead of %s feeds it, unable to establish pipeline.", elementPtr->name);
+            return FALSE;
+        }
+
+        const PipelineElement* parentPtr = &PipelineElements[graph[parent].element];
+        if( (parentPtr->AddSinkFnPtr == NULL) || (parentPtr->sinkType != consumedType) ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "%s can't feed %s: %d vs. %d, unable to establish pipeline.", parentPtr->name, elementPtr->name, parentPtr->sinkType, consumedType);
+            return FALSE;
+        }
+
+        parentNode[loop] = (uint8)parent;
+        graphOutputs = graphOutputs | graph[loop].neededFor;
+    }
+
+    // CC Data Output formats the annotations left by the other sinks of its element, and
+    // only the last sink of a parallel pass waits for the others to finish.
+    for( int loop = 1; loop < numNodes; loop++ ) {
+        if( graph[loop].element != PIPELINE_ELEMENT_CC_DATA_OUTPUT ) continue;
+        for( int sibling = loop + 1; sibling < numNodes; sibling++ ) {
+            if( parentNode[sibling] == parentNode[loop] ) {
+                LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "%s needs to be the last sink of %s, unable to establish pipeline.", PipelineElements[graph[loop].element].name, PipelineElements[graph[parentNode[loop]].element].name);
+                return FALSE;
+            }
+        }
+    }
+
+    if( (outputs & graphOutputs & (PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708 | PIPELINE_OUTPUT_CCD)) == 0 ) {
+        outputs = outputs | PIPELINE_OUTPUT_DETECT;
+    }
+
+    // Children follow their parents, so walking the graph backwards carries
+    // whether a node is needed all the way up to the Source.
+    for( int loop = 0; loop < numNodes; loop++ ) {
+        isNeeded[loop] = ((graph[loop].neededFor & outputs) != 0) ? TRUE : FALSE;
+        hasSinks[loop] = FALSE;
+    }
+
+    for( int loop = numNodes - 1; loop > 0; loop-- ) {
+        if( isNeeded[loop] == TRUE ) {
+            isNeeded[parentNode[loop]] = TRUE;
+            hasSinks[parentNode[loop]] = TRUE;
+        }
+    }
+
+    if( hasSinks[0] == FALSE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Nothing to plumb for Outputs: 0x%02X, unable to establish pipeline.", outputs);
+        return FALSE;
+    }
+
+    if( (ctxPtr->config.parallelSinks == TRUE) && (ctxPtr->sinkPoolPtr == NULL) ) {
+        uint8 numSinkThreads = PIPELINE_PARALLEL_SINK_THREADS;
+        if( (ctxPtr->config.numThreads > 1) && (ctxPtr->config.numThreads < PIPELINE_PARALLEL_SINK_THREADS) ) {
+            numSinkThreads = ctxPtr->config.numThreads;
+        }
+        ctxPtr->sinkPoolPtr = ThreadPoolCreate(numSinkThreads);
+    }
+
+    if( PipelineElements[graph[0].element].SourceInitFnPtr(ctxPtr) == FALSE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
+        return FALSE;
+    }
+
+    for( int loop = 1; loop < numNodes; loop++ ) {
+        if( isNeeded[loop] == FALSE ) {
+            LOG(DEBUG_LEVEL_VERBOSE, DBG_PIPELINE, "Leaving %s out of the Pipeline", PipelineElements[graph[loop].element].name);
+            continue;
+        }
+
+        LinkInfo linkInfo;
+        if( graph[loop].element == PIPELINE_ELEMENT_EXTERNAL ) {
+            linkInfo = *graph[loop].linkInfoPtr;
+        } else {
+            linkInfo = PipelineElements[graph[loop].element].InitFnPtr(ctxPtr, hasSinks[loop]);
+        }
+
+        if( PipelineElements[graph[parentNode[loop]].element].AddSinkFnPtr(ctxPtr, linkInfo) == FALSE ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+} // BuildPipeline()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    PlumbSccPipeline()
@@ -237,22 +740,32 @@ uint8 _ShutdownSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Sinks* si
  | DESCRIPTION:
  |    This method plumbs the pipeline to decode a SCC file and leave it's
  |    decoded text in a file that is <inputFilename>.608
+ |    Branches marked with a ? are only plumbed for the selected outputs, as
+ |    worked out by BuildPipeline() from sccPipelineGraph[].
  |
  | PIPELINE:                                      +----------------+      +----------------+
- |                                           +--> | Line 21 Decode | -?-> | Line 21 Output |
- |                                           |    +----------------+      +----------------+
+ |                                           +--> | Line 21 Decode | -+?> | Line 21 Output |
+ |                                           |    +----------------+  |   +----------------+
+ |                                           |                        |
+ |                                           |                        |   +----------------+      +------------+
+ |                                           |                        +?> | Line 21 Screen | ---> | Cue Output |
+ |                                           |                            +----------------+      +------------+
  |                                           |
  |    +--------------+      +------------+   |     +------------+         +------------+
  |    | Caption File | ---> | SCC Encode | --+-?-> | MCC Encode | ------> | MCC Output |
  |    +--------------+      +------------+   |     +------------+         +------------+
  |                                           |
+ |                                           |     +--------------+
+ |                                           |-?-> | Cache Output |
+ |                                           |     +--------------+
+ |                                           |
  |                                           |     +----------------+
  |                                           +-?-> | CC Data Output |
  |                                                 +----------------+
  -------------------------------------------------------------------------------*/
 boolean PlumbSccPipeline( Context* ctxPtr ) {
     ASSERT(ctxPtr);
-    boolean retval;
+    uint8 outputs = selectedOutputs(ctxPtr);
 
     if( ctxPtr->config.inputFilename == NULL ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Input Filename, unable to establish pipeline.");
@@ -269,51 +782,12 @@ boolean PlumbSccPipeline( Context* ctxPtr ) {
         return FALSE;
     }
 
-    retval = SccFileInitialize(ctxPtr, ctxPtr->config.inputFilename, ctxPtr->config.passedInFramerate);
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = SccFileAddSink(ctxPtr, SccEncodeInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = SccEncodeAddSink(ctxPtr, Line21DecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
+    // The MCC File of a SCC File is an artifact, unlike the MCC File of a binary asset.
+    if( ctxPtr->config.artifacts == FALSE ) {
+        outputs = outputs & PIPELINE_OUTPUT_CACHE;
     }
 
-    if( ctxPtr->config.artifacts == TRUE ) {
-        retval = Line21DecodeAddSink(ctxPtr, Line21OutInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = SccEncodeAddSink(ctxPtr, MccEncodeInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MccEncodeAddSink(ctxPtr, MccOutInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = SccEncodeAddSink(ctxPtr, CcDataOutInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-    }
-
-    return TRUE;
+    return BuildPipeline(ctxPtr, sccPipelineGraph, PIPELINE_GRAPH_SIZE(sccPipelineGraph), outputs);
 } // PlumbSccPipeline()
 
 /*------------------------------------------------------------------------------
@@ -330,14 +804,28 @@ boolean PlumbSccPipeline( Context* ctxPtr ) {
  | DESCRIPTION:
  |    This method plumbs the pipeline to decode a MCC file and leave it's
  |    decoded text in a file that is <inputFilename>.608 and <inputFilename>.708
+ |    Branches marked with a ? are only plumbed for the selected outputs, as
+ |    worked out by BuildPipeline() from mccPipelineGraph[].
  |
  | PIPELINE:                                      +----------------+      +----------------+
- |                                           +--> | Line 21 Decode | -?-> | Line 21 Output |
- |                                           |    +----------------+      +----------------+
+ |                                           +-?> | Line 21 Decode | -+?> | Line 21 Output |
+ |                                           |    +----------------+  |   +----------------+
+ |                                           |                        |
+ |                                           |                        |   +----------------+      +------------+
+ |                                           |                        +?> | Line 21 Screen | ---> | Cue Output |
+ |                                           |                            +----------------+      +------------+
  |                                           |
  |    +--------------+      +------------+   |     +--------------+        +--------------+
- |    | Caption File | ---> | MCC Decode | --+---> | DTVCC Decode | --?--> | DTVCC Output |
- |    +--------------+      +------------+   |     +--------------+        +--------------+
+ |    | Caption File | ---> | MCC Decode | --+-?-> | DTVCC Decode | -+?--> | DTVCC Output |
+ |    +--------------+      +------------+   |     +--------------+  |     +--------------+
+ |                                           |                       |
+ |                                           |                       |     +--------------+      +------------+
+ |                                           |                       +?--> | DTVCC Window | ---> | Cue Output |
+ |                                           |                             +--------------+      +------------+
+ |                                           |
+ |                                           |     +--------------+
+ |                                           |-?-> | Cache Output |
+ |                                           |     +--------------+
  |                                           |
  |                                           |     +----------------+
  |                                           +-?-> | CC Data Output |
@@ -345,7 +833,6 @@ boolean PlumbSccPipeline( Context* ctxPtr ) {
  -------------------------------------------------------------------------------*/
 boolean PlumbMccPipeline( Context* ctxPtr ) {
     ASSERT(ctxPtr);
-    boolean retval;
 
     if( ctxPtr->config.inputFilename == NULL ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Input Filename, unable to establish pipeline.");
@@ -357,51 +844,7 @@ boolean PlumbMccPipeline( Context* ctxPtr ) {
         return FALSE;
     }
 
-    retval = MccFileInitialize(ctxPtr, ctxPtr->config.inputFilename);
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MccFileAddSink(ctxPtr, MccDecodeInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MccDecodeAddSink(ctxPtr, DtvccDecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MccDecodeAddSink(ctxPtr, Line21DecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if (retval == FALSE) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    if( ctxPtr->config.artifacts == TRUE ) {
-        retval = DtvccDecodeAddSink(ctxPtr, DtvccOutInitialize(ctxPtr, TRUE, FALSE));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = Line21DecodeAddSink(ctxPtr, Line21OutInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MccDecodeAddSink(ctxPtr, CcDataOutInitialize(ctxPtr));
-        if (retval == FALSE) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-    }
-
-    return TRUE;
+    return BuildPipeline(ctxPtr, mccPipelineGraph, PIPELINE_GRAPH_SIZE(mccPipelineGraph), selectedOutputs(ctxPtr));
 } // PlumbMccPipeline()
 
 /*------------------------------------------------------------------------------
@@ -421,18 +864,32 @@ boolean PlumbMccPipeline( Context* ctxPtr ) {
  |    the CC Data that is found in the asset and leave the decoded text in
  |    files that are <inputFilename>.608, <inputFilename>.708, and
  |    <inputFilename>.ccd. The output goes into the file <inputFilename>.mcc.
+ |    Branches marked with a ? are only plumbed for the selected outputs, as
+ |    worked out by BuildPipeline() from mpegPipelineGraph[].
  |
  | PIPELINE:                 +------------+          +------------+
- |                     +---> | MCC Encode | -------> | MCC Output |
+ |                     +-?-> | MCC Encode | -------> | MCC Output |
  |                     |     +------------+          +------------+
  |                     |
  |                     |     +----------------+      +----------------+
- |                     |---> | Line 21 Decode | -?-> | Line 21 Output |
- |     +-----------+   |     +----------------+      +----------------+
+ |                     |-?-> | Line 21 Decode | -+?> | Line 21 Output |
+ |                     |     +----------------+  |   +----------------+
+ |                     |                         |
+ |                     |                         |   +----------------+      +------------+
+ |                     |                         +?> | Line 21 Screen | ---> | Cue Output |
+ |     +-----------+   |                             +----------------+      +------------+
  |     | MPEG File | --|
  |     +-----------+   |     +--------------+        +--------------+
- |                     |---> | DTVCC Decode | --?--> | DTVCC Output |
- |                     |     +--------------+        +--------------+
+ |                     |-?-> | DTVCC Decode | -+?--> | DTVCC Output |
+ |                     |     +--------------+  |     +--------------+
+ |                     |                       |
+ |                     |                       |     +--------------+      +------------+
+ |                     |                       +?--> | DTVCC Window | ---> | Cue Output |
+ |                     |                             +--------------+      +------------+
+ |                     |
+ |                     |     +--------------+
+ |                     |-?-> | Cache Output |
+ |                     |     +--------------+
  |                     |
  |                     |     +----------------+
  |                     +-?-> | CC Data Output |
@@ -440,7 +897,6 @@ boolean PlumbMccPipeline( Context* ctxPtr ) {
  -------------------------------------------------------------------------------*/
 boolean PlumbMpegPipeline( Context* ctxPtr ) {
     ASSERT(ctxPtr);
-    boolean retval;
 
     if( ctxPtr->config.inputFilename == NULL ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Input Filename, unable to establish pipeline.");
@@ -452,57 +908,7 @@ boolean PlumbMpegPipeline( Context* ctxPtr ) {
         return FALSE;
     }
 
-    retval = MpegFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MpegFileAddSink(ctxPtr, MccEncodeInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MpegFileAddSink(ctxPtr, DtvccDecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MpegFileAddSink(ctxPtr, Line21DecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    retval = MccEncodeAddSink(ctxPtr, MccOutInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
-
-    if( ctxPtr->config.artifacts == TRUE ) {
-        retval = DtvccDecodeAddSink(ctxPtr, DtvccOutInitialize(ctxPtr, TRUE, TRUE));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = Line21DecodeAddSink(ctxPtr, Line21OutInitialize(ctxPtr));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MpegFileAddSink(ctxPtr, CcDataOutInitialize(ctxPtr));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-    }
-
-    return TRUE;
+    return BuildPipeline(ctxPtr, mpegPipelineGraph, PIPELINE_GRAPH_SIZE(mpegPipelineGraph), selectedOutputs(ctxPtr));
 } // PlumbMpegPipeline()
 
 /*------------------------------------------------------------------------------
@@ -522,18 +928,32 @@ boolean PlumbMpegPipeline( Context* ctxPtr ) {
  |    the CC Data that is found in the asset and leave the decoded text in
  |    files that are <inputFilename>.608, <inputFilename>.708, and
  |    <inputFilename>.ccd. The output goes into the file <inputFilename>.mcc.
+ |    Branches marked with a ? are only plumbed for the selected outputs, as
+ |    worked out by BuildPipeline() from movPipelineGraph[].
  |
  | PIPELINE:                 +------------+          +------------+
- |                     +---> | MCC Encode | -------> | MCC Output |
+ |                     +-?-> | MCC Encode | -------> | MCC Output |
  |                     |     +------------+          +------------+
  |                     |
  |                     |     +----------------+      +----------------+
- |                     |---> | Line 21 Decode | -?-> | Line 21 Output |
- |     +-----------+   |     +----------------+      +----------------+
- |     | MPEG File | --|
- |     +-----------+   |     +--------------+        +--------------+
- |                     |---> | DTVCC Decode | --?--> | DTVCC Output |
- |                     |     +--------------+        +--------------+
+ |                     |-?-> | Line 21 Decode | -+?> | Line 21 Output |
+ |                     |     +----------------+  |   +----------------+
+ |                     |                         |
+ |                     |                         |   +----------------+      +------------+
+ |                     |                         +?> | Line 21 Screen | ---> | Cue Output |
+ |     +----------+    |                             +----------------+      +------------+
+ |     | MOV File | ---|
+ |     +----------+    |     +--------------+        +--------------+
+ |                     |-?-> | DTVCC Decode | -+?--> | DTVCC Output |
+ |                     |     +--------------+  |     +--------------+
+ |                     |                       |
+ |                     |                       |     +--------------+      +------------+
+ |                     |                       +?--> | DTVCC Window | ---> | Cue Output |
+ |                     |                             +--------------+      +------------+
+ |                     |
+ |                     |     +--------------+
+ |                     |-?-> | Cache Output |
+ |                     |     +--------------+
  |                     |
  |                     |     +----------------+
  |                     +-?-> | CC Data Output |
@@ -541,7 +961,6 @@ boolean PlumbMpegPipeline( Context* ctxPtr ) {
  -------------------------------------------------------------------------------*/
 boolean PlumbMovPipeline( Context* ctxPtr ) {
     ASSERT(ctxPtr);
-    boolean retval;
 
     if( ctxPtr->config.inputFilename == NULL ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Input Filename, unable to establish pipeline.");
@@ -553,58 +972,76 @@ boolean PlumbMovPipeline( Context* ctxPtr ) {
         return FALSE;
     }
 
-    retval = MovFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
+    return BuildPipeline(ctxPtr, movPipelineGraph, PIPELINE_GRAPH_SIZE(movPipelineGraph), selectedOutputs(ctxPtr));
+} // PlumbMovPipeline()
 
-    retval = MovFileAddSink(ctxPtr, MccEncodeInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-        return FALSE;
-    }
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    PlumbCcDataPipeline()
+ |
+ | INPUT PARAMETERS:
+ |    ctxPtr - Pointer to the Context.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE is Successful and FALSE is a Failure
+ |
+ | DESCRIPTION:
+ |    This method plumbs the pipeline to regenerate the outputs of an asset
+ |    from the CC Data File that was cached when it was first read, rather
+ |    than from the asset itself. The 708 Output is timed the same way as it
+ |    was from the asset, which is read from the header of the file.
+ |    Branches marked with a ? are only plumbed for the selected outputs, as
+ |    worked out by BuildPipeline() from ccDataPtsPipelineGraph[] or
+ |    ccDataTimeCodePipelineGraph[].
+ |
+ | PIPELINE:                 +------------+          +------------+
+ |                     +-?-> | MCC Encode | -------> | MCC Output |
+ |                     |     +------------+          +------------+
+ |                     |
+ |                     |     +----------------+      +----------------+
+ |                     |-?-> | Line 21 Decode | -+?> | Line 21 Output |
+ |                     |     +----------------+  |   +----------------+
+ |                     |                         |
+ |                     |                         |   +----------------+      +------------+
+ |                     |                         +?> | Line 21 Screen | ---> | Cue Output |
+ |   +--------------+  |                             +----------------+      +------------+
+ |   | CC Data File | -|
+ |   +--------------+  |     +--------------+        +--------------+
+ |                     |-?-> | DTVCC Decode | -+?--> | DTVCC Output |
+ |                     |     +--------------+  |     +--------------+
+ |                     |                       |
+ |                     |                       |     +--------------+      +------------+
+ |                     |                       +?--> | DTVCC Window | ---> | Cue Output |
+ |                     |                             +--------------+      +------------+
+ |                     |
+ |                     |     +----------------+
+ |                     +-?-> | CC Data Output |
+ |                           +----------------+
+ -------------------------------------------------------------------------------*/
+boolean PlumbCcDataPipeline( Context* ctxPtr ) {
+    CcDataFileHeader header;
+    ASSERT(ctxPtr);
 
-    retval = MovFileAddSink(ctxPtr, DtvccDecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
+    if( ctxPtr->config.inputFilename == NULL ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Input Filename, unable to establish pipeline.");
         return FALSE;
     }
 
-    retval = MovFileAddSink(ctxPtr, Line21DecodeInitialize(ctxPtr, (ctxPtr->config.artifacts == FALSE)));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
+    if( ctxPtr->config.outputDirectory[0] == '\0' ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "NULL Output Path and Filename, unable to establish pipeline.");
         return FALSE;
     }
 
-    retval = MccEncodeAddSink(ctxPtr, MccOutInitialize(ctxPtr));
-    if( retval == FALSE ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
+    if( CcDataFileReadHeader(ctxPtr->config.inputFilename, &header) == FALSE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Unreadable CC Data File, unable to establish pipeline.");
         return FALSE;
     }
 
-    if( ctxPtr->config.artifacts == TRUE ) {
-        retval = DtvccDecodeAddSink(ctxPtr, DtvccOutInitialize(ctxPtr, TRUE, TRUE));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = Line21DecodeAddSink(ctxPtr, Line21OutInitialize(ctxPtr));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
-
-        retval = MovFileAddSink(ctxPtr, CcDataOutInitialize(ctxPtr));
-        if( retval == FALSE ) {
-            LOG(DEBUG_LEVEL_ERROR, DBG_PIPELINE, "Problem Establishing Pipeline, bailing.");
-            return FALSE;
-        }
+    if( header.timeSource == CAPTION_TIME_PTS_NUMBERING ) {
+        return BuildPipeline(ctxPtr, ccDataPtsPipelineGraph, PIPELINE_GRAPH_SIZE(ccDataPtsPipelineGraph), selectedOutputs(ctxPtr));
     }
-
-    return TRUE;
-} // PlumbMovPipeline()
+    return BuildPipeline(ctxPtr, ccDataTimeCodePipelineGraph, PIPELINE_GRAPH_SIZE(ccDataTimeCodePipelineGraph), selectedOutputs(ctxPtr));
+} // PlumbCcDataPipeline()
 
 /*------------------------------------------------------------------------------
  | NAME:
@@ -640,6 +1077,9 @@ void DrivePipeline( FileType sourceType, Context* ctxPtr ) {
             case MPEG_BINARY_FILE:
                 wasSuccessful = MpegFileProcNextBuffer(ctxPtr, &areWeDone);
                 break;
+            case CC_DATA_BINARY_FILE:
+                wasSuccessful = CcDataFileProcNextBuffer(ctxPtr, &areWeDone);
+                break;
             default:
                 LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Impossible Branch - %d", sourceType);
                 return;
@@ -649,9 +1089,150 @@ void DrivePipeline( FileType sourceType, Context* ctxPtr ) {
             LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Error in Pipeline!");
         }
     }
+
+    if( ctxPtr->sinkPoolPtr != NULL ) {
+        ThreadPoolDestroy(ctxPtr->sinkPoolPtr);
+        ctxPtr->sinkPoolPtr = NULL;
+    }
 } // DrivePipeline()
 
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    passToSink()
+ |
+ | DESCRIPTION:
+ |    This function passes the buffer to one of the sinks in the list, and
+ |    returns what the sink returned.
+ -------------------------------------------------------------------------------*/
+static uint8 passToSink( SinkPass* sinkPassPtr, uint8 sinkIndex ) {
+    Sinks* sinks = sinkPassPtr->sinks;
+
+    ASSERT(sinks->linkType < MAX_LINK_TYPE);
+    ASSERT(sinks->sink[sinkIndex].linkType < MAX_LINK_TYPE);
+    ASSERT(sinks->sink[sinkIndex].NextBufferFnPtr);
+    LOG(DEBUG_LEVEL_VERBOSE, DBG_PIPELINE, "Passed Buffer [%p] to Sink: %s -> %s in {%s:%d}", sinkPassPtr->buffPtr, LinkTypeText[sinks->linkType],
+        LinkTypeText[sinks->sink[sinkIndex].linkType], sinkPassPtr->basename, sinkPassPtr->lineNum);
+    return sinks->sink[sinkIndex].NextBufferFnPtr(sinkPassPtr->ctxPtr, sinkPassPtr->buffPtr);
+}  // passToSink()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    passToSinkTask()
+ |
+ | DESCRIPTION:
+ |    This function runs one of the sinks of a parallel pass on the sink thread
+ |    pool, leaving what it returned for _PassToSinks() to combine.
+ -------------------------------------------------------------------------------*/
+static void passToSinkTask( void* sinkPassVoidPtr, uint32 taskIndex ) {
+    SinkPass* sinkPassPtr = (SinkPass*)sinkPassVoidPtr;
+
+    isRunningParallelSink = TRUE;
+    sinkPassPtr->results[taskIndex] = passToSink(sinkPassPtr, (uint8)taskIndex);
+    isRunningParallelSink = FALSE;
+}  // passToSinkTask()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    selectedOutputs()
+ |
+ | DESCRIPTION:
+ |    This function returns the outputs that the Pipeline should be plumbed to
+ |    write. Not creating artifacts leaves only the MCC File of a binary asset,
+ |    and the CC Data File when one was asked for.
+ -------------------------------------------------------------------------------*/
+static uint8 selectedOutputs( Context* ctxPtr ) {
+    if( ctxPtr->config.artifacts == FALSE ) {
+        return ctxPtr->config.outputs & (PIPELINE_OUTPUT_MCC | PIPELINE_OUTPUT_CACHE);
+    }
+    return ctxPtr->config.outputs;
+}  // selectedOutputs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    initSccFile() ... initCacheOut()
+ |
+ | DESCRIPTION:
+ |    These functions initialize each element the way BuildPipeline() needs,
+ |    taking whatever else the element needs from the configuration. Sources
+ |    return whether they were initialized, and the rest are told whether they
+ |    are going to have any sinks.
+ -------------------------------------------------------------------------------*/
+static boolean initSccFile( Context* ctxPtr ) {
+    return SccFileInitialize(ctxPtr, ctxPtr->config.inputFilename, ctxPtr->config.passedInFramerate);
+}  // initSccFile()
+
+static boolean initMccFile( Context* ctxPtr ) {
+    return MccFileInitialize(ctxPtr, ctxPtr->config.inputFilename);
+}  // initMccFile()
+
+static boolean initMpegFile( Context* ctxPtr ) {
+    return MpegFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
+}  // initMpegFile()
+
+static boolean initMovFile( Context* ctxPtr ) {
+    return MovFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
+}  // initMovFile()
+
+static boolean initCcDataFile( Context* ctxPtr ) {
+    return CcDataFileInitialize(ctxPtr, ctxPtr->config.inputFilename);
+}  // initCcDataFile()
+
+static LinkInfo initSccEncode( Context* ctxPtr, boolean hasSinks ) {
+    return SccEncodeInitialize(ctxPtr);
+}  // initSccEncode()
+
+static LinkInfo initMccDecode( Context* ctxPtr, boolean hasSinks ) {
+    return MccDecodeInitialize(ctxPtr);
+}  // initMccDecode()
+
+static LinkInfo initMccEncode( Context* ctxPtr, boolean hasSinks ) {
+    return MccEncodeInitialize(ctxPtr);
+}  // initMccEncode()
+
+static LinkInfo initLine21Decode( Context* ctxPtr, boolean hasSinks ) {
+    return Line21DecodeInitialize(ctxPtr, (hasSinks == FALSE), ctxPtr->config.decodeWhichChannels);
+}  // initLine21Decode()
+
+static LinkInfo initDtvccDecode( Context* ctxPtr, boolean hasSinks ) {
+    return DtvccDecodeInitialize(ctxPtr, (hasSinks == FALSE), ctxPtr->config.decodeWhichServices);
+}  // initDtvccDecode()
+
+static LinkInfo initLine21Screen( Context* ctxPtr, boolean hasSinks ) {
+    return Line21ScreenInitialize(ctxPtr);
+}  // initLine21Screen()
+
+static LinkInfo initDtvccWindow( Context* ctxPtr, boolean hasSinks ) {
+    return DtvccWindowInitialize(ctxPtr);
+}  // initDtvccWindow()
+
+static LinkInfo initMccOut( Context* ctxPtr, boolean hasSinks ) {
+    return MccOutInitialize(ctxPtr);
+}  // initMccOut()
+
+static LinkInfo initLine21Out( Context* ctxPtr, boolean hasSinks ) {
+    return Line21OutInitialize(ctxPtr);
+}  // initLine21Out()
+
+static LinkInfo initDtvccOut( Context* ctxPtr, boolean hasSinks ) {
+    return DtvccOutInitialize(ctxPtr, TRUE, FALSE);
+}  // initDtvccOut()
+
+static LinkInfo initDtvccOutMs( Context* ctxPtr, boolean hasSinks ) {
+    return DtvccOutInitialize(ctxPtr, TRUE, TRUE);
+}  // initDtvccOutMs()
+
+static LinkInfo initCueOut( Context* ctxPtr, boolean hasSinks ) {
+    return CueOutInitialize(ctxPtr);
+}  // initCueOut()
+
+static LinkInfo initCcDataOut( Context* ctxPtr, boolean hasSinks ) {
+    return CcDataOutInitialize(ctxPtr);
+}  // initCcDataOut()
+
+static LinkInfo initCacheOut( Context* ctxPtr, boolean hasSinks ) {
+    return CacheOutInitialize(ctxPtr);
+}  // initCacheOut()
@@ -0,0 +1,215 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include "debug.h"
+#include "thread_pool.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static void* workerThread( void* );
+static void runTasks( ThreadPool* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ThreadPoolCreate()
+ |
+ | INPUT PARAMETERS:
+ |    numThreads - The number of threads which should work on each batch of tasks,
+ |                 including the thread which calls ThreadPoolRun().
+ |
+ | RETURN VALUES:
+ |    ThreadPool* - The newly created pool, or NULL if it could not be started.
+ |
+ | DESCRIPTION:
+ |    This method starts a pool of worker threads, which sleep until a batch of
+ |    tasks is handed to them with ThreadPoolRun(). The thread calling
+ |    ThreadPoolRun() works on the batch as well, so one fewer worker than the
+ |    requested number of threads is started.
+ -------------------------------------------------------------------------------*/
+ThreadPool* ThreadPoolCreate( uint8 numThreads ) {
+    ASSERT(numThreads);
+
+    if( numThreads > THREAD_POOL_MAX_THREADS ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_GENERAL, "Limiting Thread Pool to %d Threads, rather than %d", THREAD_POOL_MAX_THREADS, numThreads);
+        numThreads = THREAD_POOL_MAX_THREADS;
+    }
+
+    ThreadPool* poolPtr = malloc(sizeof(ThreadPool));
+    poolPtr->numThreads = 0;
+    poolPtr->taskFnPtr = NULL;
+    poolPtr->taskArgPtr = NULL;
+    poolPtr->numTasks = 0;
+    poolPtr->nextTask = 0;
+    poolPtr->numTasksDone = 0;
+    poolPtr->isShuttingDown = FALSE;
+    pthread_mutex_init(&poolPtr->mutex, NULL);
+    pthread_cond_init(&poolPtr->workReady, NULL);
+    pthread_cond_init(&poolPtr->workDone, NULL);
+
+    for( int loop = 1; loop < numThreads; loop++ ) {
+        if( pthread_create(&poolPtr->threads[poolPtr->numThreads], NULL, &workerThread, poolPtr) != 0 ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_GENERAL, "Unable to start Thread Pool Worker %d", loop);
+            ThreadPoolDestroy(poolPtr);
+            return NULL;
+        }
+        poolPtr->numThreads++;
+    }
+
+    LOG(DEBUG_LEVEL_INFO, DBG_GENERAL, "Started Thread Pool with %d Worker Threads", poolPtr->numThreads);
+    return poolPtr;
+}  // ThreadPoolCreate()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ThreadPoolRun()
+ |
+ | INPUT PARAMETERS:
+ |    poolPtr - The pool to run the tasks on.
+ |    taskFnPtr - The function which runs a single task.
+ |    taskArgPtr - Argument which is passed to every task.
+ |    numTasks - Number of tasks in the batch, each of which is passed its index.
+ |
+ | RETURN VALUES:
+ |    None.
+ |
+ | DESCRIPTION:
+ |    This method hands a batch of independent tasks to the pool and works on
+ |    them alongside the workers. It returns once every task in the batch has
+ |    finished, so the caller is free to consume the results in order.
+ -------------------------------------------------------------------------------*/
+void ThreadPoolRun( ThreadPool* poolPtr, ThreadPoolTaskFnPtr taskFnPtr, void* taskArgPtr, uint32 numTasks ) {
+    ASSERT(poolPtr);
+    ASSERT(taskFnPtr);
+
+    if( numTasks == 0 ) return;
+
+    pthread_mutex_lock(&poolPtr->mutex);
+    poolPtr->taskFnPtr = taskFnPtr;
+    poolPtr->taskArgPtr = taskArgPtr;
+    poolPtr->numTasks = numTasks;
+    poolPtr->nextTask = 0;
+    poolPtr->numTasksDone = 0;
+    pthread_cond_broadcast(&poolPtr->workReady);
+
+    runTasks(poolPtr);
+
+    while( poolPtr->numTasksDone < poolPtr->numTasks ) {
+        pthread_cond_wait(&poolPtr->workDone, &poolPtr->mutex);
+    }
+    pthread_mutex_unlock(&poolPtr->mutex);
+}  // ThreadPoolRun()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    ThreadPoolDestroy()
+ |
+ | INPUT PARAMETERS:
+ |    poolPtr - The pool to stop.
+ |
+ | RETURN VALUES:
+ |    None.
+ |
+ | DESCRIPTION:
+ |    This method stops the worker threads and frees the pool.
+ -------------------------------------------------------------------------------*/
+void ThreadPoolDestroy( ThreadPool* poolPtr ) {
+    ASSERT(poolPtr);
+
+    pthread_mutex_lock(&poolPtr->mutex);
+    poolPtr->isShuttingDown = TRUE;
+    pthread_cond_broadcast(&poolPtr->workReady);
+    pthread_mutex_unlock(&poolPtr->mutex);
+
+    for( int loop = 0; loop < poolPtr->numThreads; loop++ ) {
+        pthread_join(poolPtr->threads[loop], NULL);
+    }
+
+    pthread_cond_destroy(&poolPtr->workDone);
+    pthread_cond_destroy(&poolPtr->workReady);
+    pthread_mutex_destroy(&poolPtr->mutex);
+    free(poolPtr);
+}  // ThreadPoolDestroy()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    workerThread()
+ |
+ | DESCRIPTION:
+ |    This is the body of each worker thread, which sleeps until there are tasks
+ |    to claim, or until the pool is destroyed.
+ -------------------------------------------------------------------------------*/
+static void* workerThread( void* poolVoidPtr ) {
+    ThreadPool* poolPtr = (ThreadPool*)poolVoidPtr;
+
+    pthread_mutex_lock(&poolPtr->mutex);
+    while( poolPtr->isShuttingDown == FALSE ) {
+        if( poolPtr->nextTask < poolPtr->numTasks ) {
+            runTasks(poolPtr);
+        } else {
+            pthread_cond_wait(&poolPtr->workReady, &poolPtr->mutex);
+        }
+    }
+    pthread_mutex_unlock(&poolPtr->mutex);
+
+    return NULL;
+}  // workerThread()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    runTasks()
+ |
+ | DESCRIPTION:
+ |    This function claims and runs tasks from the current batch until none are
+ |    left unclaimed. It is entered and left with the pool mutex held, but drops
+ |    the mutex while each task is running.
+ -------------------------------------------------------------------------------*/
+static void runTasks( ThreadPool* poolPtr ) {
+    while( poolPtr->nextTask < poolPtr->numTasks ) {
+        uint32 taskIndex = poolPtr->nextTask;
+        poolPtr->nextTask++;
+        pthread_mutex_unlock(&poolPtr->mutex);
+
+        poolPtr->taskFnPtr(poolPtr->taskArgPtr, taskIndex);
+
+        pthread_mutex_lock(&poolPtr->mutex);
+        poolPtr->numTasksDone++;
+        if( poolPtr->numTasksDone == poolPtr->numTasks ) {
+            pthread_cond_signal(&poolPtr->workDone);
+        }
+    }
+}  // runTasks()
@@ -0,0 +1,233 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "debug.h"
+#include "timecode_index.h"
+#include "cc_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    TimeCodeIndexBuild()
+ |
+ | INPUT PARAMETERS:
+ |    fileNameStr - The SCC or MCC File to index.
+ |    firstLinePos - Offset of the first line of captions, after any header.
+ |    frameRatePerSecTimesOneHundred - Frame Rate of the time codes in the file.
+ |
+ | RETURN VALUES:
+ |    TimeCodeIndex* - The index of the file, or NULL if the file could not be
+ |                     read, in which case errno is left as the failing call set it.
+ |
+ | DESCRIPTION:
+ |    This builds a sparse index of the time codes in a captions file, holding
+ |    the time and offset of the first line after each run of bytes. The file is
+ |    mapped into memory and scanned once, front to back, which is far cheaper
+ |    than reading it a line at a time. As the lines are in time code order, the
+ |    index can then narrow any lookup down to a short run of lines.
+ -------------------------------------------------------------------------------*/
+TimeCodeIndex* TimeCodeIndexBuild( char* fileNameStr, long firstLinePos, uint32 frameRatePerSecTimesOneHundred ) {
+    ASSERT(fileNameStr);
+    struct stat fileStat;
+
+    int fileDescriptor = open(fileNameStr, O_RDONLY);
+    if( fileDescriptor == -1 ) return NULL;
+
+    if( fstat(fileDescriptor, &fileStat) != 0 ) {
+        int savedErrno = errno;
+        close(fileDescriptor);
+        errno = savedErrno;
+        return NULL;
+    }
+
+    TimeCodeIndex* indexPtr = TimeCodeIndexNew(firstLinePos);
+
+    long fileSize = (long)fileStat.st_size;
+    if( fileSize <= firstLinePos ) {
+        close(fileDescriptor);
+        return indexPtr;
+    }
+
+    char* mapPtr = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    int savedErrno = errno;
+    close(fileDescriptor);
+    if( mapPtr == MAP_FAILED ) {
+        TimeCodeIndexFree(indexPtr);
+        errno = savedErrno;
+        return NULL;
+    }
+    madvise(mapPtr, fileSize, MADV_SEQUENTIAL);
+
+    long linePos = firstLinePos;
+    long nextEntryPos = firstLinePos;
+    while( linePos < fileSize ) {
+        char* endOfLinePtr = memchr(&mapPtr[linePos], '\n', fileSize - linePos);
+        long lineLen = (endOfLinePtr != NULL) ? (endOfLinePtr - &mapPtr[linePos]) : (fileSize - linePos);
+        uint32 timeInMs;
+
+        if( (linePos >= nextEntryPos) && (timeCodeLineToMs(&mapPtr[linePos], lineLen, frameRatePerSecTimesOneHundred, &timeInMs) == TRUE) ) {
+            TimeCodeIndexAdd(indexPtr, timeInMs, linePos);
+            nextEntryPos = linePos + TIME_CODE_INDEX_SPACING_BYTES;
+        }
+        linePos = linePos + lineLen + 1;
+    }
+
+    munmap(mapPtr, fileSize);
+    return indexPtr;
+}  // TimeCodeIndexBuild()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    TimeCodeIndexNew()
+ |
+ | INPUT PARAMETERS:
+ |    firstLinePos - Offset of the first line of captions, after any header.
+ |
+ | RETURN VALUES:
+ |    TimeCodeIndex* - An index with no entries.
+ |
+ | DESCRIPTION:
+ |    This allocates an empty index, for a file whose entries are added as they
+ |    are written or read rather than found by TimeCodeIndexBuild().
+ -------------------------------------------------------------------------------*/
+TimeCodeIndex* TimeCodeIndexNew( long firstLinePos ) {
+    TimeCodeIndex* indexPtr = malloc(sizeof(TimeCodeIndex));
+    if( indexPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_GENERAL, "Unable to Allocate Time Code Index");
+
+    indexPtr->firstLinePos = firstLinePos;
+    indexPtr->numEntries = 0;
+    indexPtr->maxEntries = TIME_CODE_INDEX_INITIAL_ENTRIES;
+    indexPtr->entriesPtr = malloc(sizeof(TimeCodeIndexEntry) * indexPtr->maxEntries);
+    return indexPtr;
+}  // TimeCodeIndexNew()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    TimeCodeIndexAdd()
+ |
+ | INPUT PARAMETERS:
+ |    indexPtr - The index to add to.
+ |    timeInMs - Time of the indexed line, in milliseconds from the start.
+ |    fileOffset - Offset of the indexed line in the file.
+ |
+ | RETURN VALUES:
+ |    None
+ |
+ | DESCRIPTION:
+ |    This appends an entry to the index, doubling the room for entries when it
+ |    is full. Entries need to be added in time order.
+ -------------------------------------------------------------------------------*/
+void TimeCodeIndexAdd( TimeCodeIndex* indexPtr, uint32 timeInMs, long fileOffset ) {
+    ASSERT(indexPtr);
+
+    if( indexPtr->numEntries == indexPtr->maxEntries ) {
+        indexPtr->maxEntries = indexPtr->maxEntries * 2;
+        indexPtr->entriesPtr = realloc(indexPtr->entriesPtr, sizeof(TimeCodeIndexEntry) * indexPtr->maxEntries);
+        if( indexPtr->entriesPtr == NULL ) LOG(DEBUG_LEVEL_FATAL, DBG_GENERAL, "Unable to Grow Time Code Index");
+    }
+
+    indexPtr->entriesPtr[indexPtr->numEntries].timeInMs = timeInMs;
+    indexPtr->entriesPtr[indexPtr->numEntries].fileOffset = fileOffset;
+    indexPtr->numEntries++;
+}  // TimeCodeIndexAdd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    TimeCodeIndexLookup()
+ |
+ | INPUT PARAMETERS:
+ |    indexPtr - The index of the file.
+ |    timeInMs - Time to look up, in milliseconds from the start of the asset.
+ |
+ | RETURN VALUES:
+ |    lowPosPtr - Offset of a line before the first line at or after the time.
+ |    highPosPtr - Offset of a line at or after the first line at or after the
+ |                 time, or -1 for the end of the file.
+ |
+ | DESCRIPTION:
+ |    This bisects the index for the indexed lines either side of the time,
+ |    bounding the run of lines which holds the first line at or after it.
+ -------------------------------------------------------------------------------*/
+void TimeCodeIndexLookup( TimeCodeIndex* indexPtr, uint32 timeInMs, long* lowPosPtr, long* highPosPtr ) {
+    ASSERT(indexPtr);
+    ASSERT(lowPosPtr);
+    ASSERT(highPosPtr);
+    uint32 lowIndex = 0;
+    uint32 highIndex = indexPtr->numEntries;
+
+    while( lowIndex < highIndex ) {
+        uint32 midIndex = lowIndex + ((highIndex - lowIndex) / 2);
+        if( indexPtr->entriesPtr[midIndex].timeInMs < timeInMs ) {
+            lowIndex = midIndex + 1;
+        } else {
+            highIndex = midIndex;
+        }
+    }
+
+    *lowPosPtr = (lowIndex == 0) ? indexPtr->firstLinePos : indexPtr->entriesPtr[lowIndex-1].fileOffset;
+    *highPosPtr = (lowIndex == indexPtr->numEntries) ? -1 : indexPtr->entriesPtr[lowIndex].fileOffset;
+}  // TimeCodeIndexLookup()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    TimeCodeIndexFree()
+ |
+ | INPUT PARAMETERS:
+ |    indexPtr - The index to free.
+ |
+ | RETURN VALUES:
+ |    None
+ |
+ | DESCRIPTION:
+ |    This frees an index, and the entries it holds.
+ -------------------------------------------------------------------------------*/
+void TimeCodeIndexFree( TimeCodeIndex* indexPtr ) {
+    if( indexPtr == NULL ) return;
+
+    free(indexPtr->entriesPtr);
+    free(indexPtr);
+}  // TimeCodeIndexFree()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
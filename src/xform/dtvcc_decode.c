@@ -40,11 +40,19 @@ static const char* ccTypeStr[4] = { "F1", "F2", "PD", "PS" };
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static void decodeFrame( Context*, Buffer*, BufferFrame*, uint16*, DtvccByte* );
+static void addConstruct( Context*, uint8, uint8, uint8, CaptionTime*, DtvccByte* );
+static void annotateConstruct( DtvccDecodeCtx*, uint8, uint8, uint8, DtvccByte* );
+static void annotateByte( DtvccDecodeCtx*, uint8, DtvccByte* );
+static uint8 elementType( uint8, uint8 );
+static uint8 elementLength( uint8, uint8 );
+static boolean isKnownC0Cmd( uint8 );
+static boolean isKnownG2Char( uint8 );
 static void processCurrentPacket( Context*, CaptionTime* );
-static uint16 countDataPackets( uint8*, uint8 );
 static void processServiceBlock( DtvccDecodeCtx*, uint8*, uint8, Buffer*, uint8, uint8 );
 static int8 parseC0CmdCode( DtvccDecodeCtx*, uint8*, uint8, DtvccData*, uint8 );
 static int8 parseC1CmdCode( DtvccDecodeCtx*, uint8*, uint8, DtvccData*, uint8, CaptionTime* );
+static uint8 eventPayloadSize( DtvccData* );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -57,6 +65,7 @@ static int8 parseC1CmdCode( DtvccDecodeCtx*, uint8*, uint8, DtvccData*, uint8, C
  | INPUT PARAMETERS:
  |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
  |    processOnly - Decode only (to get metrics) = TRUE; Decode and Output = FALSE
+ |    decodeWhichServices - Bit per Service to decode, or DECODE_ALL_SERVICES.
  |
  | RETURN VALUES:
  |    LinkInfo -  Information about this element of the pipeline, such that it can
@@ -66,7 +75,7 @@ static int8 parseC1CmdCode( DtvccDecodeCtx*, uint8*, uint8, DtvccData*, uint8, C
  | DESCRIPTION:
  |    This initializes this element of the pipeline.
  -------------------------------------------------------------------------------*/
-LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint64 decodeWhichServices ) {
     ASSERT(rootCtxPtr);
     ASSERT(!rootCtxPtr->dtvccDecodeCtxPtr);
 
@@ -82,6 +91,10 @@ LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
     ctxPtr->dtvccPacketLength = 0;
     ctxPtr->lastSequence = DTVCC_NO_LAST_SEQUENCE;
     ctxPtr->activeServices = 0;
+    ctxPtr->decodeWhichServices = decodeWhichServices;
+    ctxPtr->annotate = ((rootCtxPtr->config.artifacts == TRUE) && (rootCtxPtr->config.outputs & PIPELINE_OUTPUT_CCD)) ? TRUE : FALSE;
+    ctxPtr->annotateState.state = DTVCC_ANNOTATE_NO_PACKET;
+    ctxPtr->annotateState.dtvccType = DTVCC_UNKNOWN;
     for( int loop = 0; loop < DTVCC_MAX_NUM_SERVICES; loop++ ) {
         ctxPtr->isPopOnCaptioning[loop] = FALSE;
         ctxPtr->isRollUpCaptioning[loop] = FALSE;
@@ -144,7 +157,7 @@ boolean DtvccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
  |
  | DESCRIPTION:
  |    This method processes an incoming buffer, decoding the CC Data per the
- |    CEA-708D Specification.
+ |    CEA-708D Specification, a frame at a time.
  -------------------------------------------------------------------------------*/
 uint8 DtvccDecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(inBuffer);
@@ -153,38 +166,33 @@ uint8 DtvccDecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->dtvccDecodeCtxPtr);
     DtvccDecodeCtx* ctxPtr = ((Context*)rootCtxPtr)->dtvccDecodeCtxPtr;
-    char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
 
-    for( int loop = 0; loop < inBuffer->numElements; loop = loop + 3 ) {
-        ASSERT((loop+2) < inBuffer->numElements);
-        boolean ccValid = ((inBuffer->dataPtr[loop] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET);
-        uint8 ccType = inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK;
-        
-        LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "Construct %d : 0x%02X -> Type = %s Valid = %s : Data = %02X %02X",
-            ((loop/3)+1), inBuffer->dataPtr[loop], ccTypeStr[ccType], trueFalseStr[ccValid], inBuffer->dataPtr[loop+1], inBuffer->dataPtr[loop+2] );
-        
-        if( ccType == DTVCCC_CHANNEL_PACKET_START ) {
-            processCurrentPacket(rootCtxPtr, &inBuffer->captionTime);
-            ctxPtr->dtvccPacketLength = 0;
-            if( ccValid == TRUE ) {
-                if( (ctxPtr->dtvccPacketLength + 2) < DTVCC_MAX_PACKET_LENGTH ) {
-                    ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = inBuffer->dataPtr[loop+1];
-                    ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = inBuffer->dataPtr[loop+2];
-                } else {
-                    encodeTimeCode(&inBuffer->captionTime, captionTimeStr);
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "At %s Max Packet Length Exceeded, skipping new.", captionTimeStr);
-                }
-            }
-        } else if( (ccValid == TRUE) && (ccType == DTVCCC_CHANNEL_PACKET_DATA) ) {
-            if( (ctxPtr->dtvccPacketLength + 2) < DTVCC_MAX_PACKET_LENGTH ) {
-                ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = inBuffer->dataPtr[loop+1];
-                ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = inBuffer->dataPtr[loop+2];
-            } else {
-                encodeTimeCode(&inBuffer->captionTime, captionTimeStr);
-                LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "At %s Max Packet Length Exceeded, skipping new.", captionTimeStr);
-            }
+    if( inBuffer->bufferType == BUFFER_TYPE_FILL ) {
+        FreeBuffer(inBuffer);
+        return ctxPtr->processedFine;
+    }
+
+    // Packets are only decoded once the next one starts, which is long after the sinks after
+    // this one (e.g. the CC Data Output) are done with the buffer that carried them. So what
+    // each byte of the packet is gets left on the incoming buffer as it arrives instead.
+    DtvccByte* annotationPtr = NULL;
+    if( ctxPtr->annotate == TRUE ) {
+        ASSERT(inBuffer->dtvccAnnotationPtr == NULL);
+        uint16 numBytes = (inBuffer->numElements / 3) * DTVCC_BYTES_PER_CONSTRUCT;
+        inBuffer->dtvccAnnotationPtr = NewBuffer(BUFFER_TYPE_BYTES, numBytes * sizeof(DtvccByte));
+        inBuffer->dtvccAnnotationPtr->numElements = inBuffer->dtvccAnnotationPtr->maxNumElements;
+        annotationPtr = (DtvccByte*)inBuffer->dtvccAnnotationPtr->dataPtr;
+        for( int loop = 0; loop < numBytes; loop++ ) {
+            annotationPtr[loop].dtvccType = DTVCC_UNKNOWN;
         }
     }
+
+    uint16 planeIndex = 0;
+    BufferFrame frame;
+    StartBufferFrames(inBuffer, &frame);
+    while( NextBufferFrame(inBuffer, &frame) == TRUE ) {
+        decodeFrame(rootCtxPtr, inBuffer, &frame, &planeIndex, annotationPtr);
+    }
     
     FreeBuffer(inBuffer);
 
@@ -267,10 +275,302 @@ uint8 DtvccDecodeShutdown( void* rootCtxPtr ) {
     }
 }  // DtvccDecodeShutdown()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccDecodeAddEvent()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - BUFFER_TYPE_DTVCC buffer to add the element to.
+ |    dtvccDataPtr - The decoded element to add.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if the element was added, FALSE if the buffer is full.
+ |
+ | DESCRIPTION:
+ |    This method packs a decoded DTVCC element onto the end of a buffer, as a
+ |    DtvccEvent header followed by only the parameters which its command uses,
+ |    rather than reserving the whole of DtvccData for every character.
+ -------------------------------------------------------------------------------*/
+boolean DtvccDecodeAddEvent( Buffer* buffPtr, DtvccData* dtvccDataPtr ) {
+    ASSERT(buffPtr);
+    ASSERT(dtvccDataPtr);
+    ASSERT(buffPtr->bufferType == BUFFER_TYPE_DTVCC);
+    ASSERT(dtvccDataPtr->serviceNumber <= EXTENDED_SRV_NUM_MASK);
+    uint8 payloadSize = eventPayloadSize(dtvccDataPtr);
+
+    if( (buffPtr->numElements + sizeof(DtvccEvent) + payloadSize) > buffPtr->maxNumElements ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_708_DEC, "No room in Buffer for DTVCC Element: %d + %d > %d",
+            buffPtr->numElements, (int)(sizeof(DtvccEvent) + payloadSize), buffPtr->maxNumElements);
+        return FALSE;
+    }
+
+    uint8* unionPtr = (uint8*)&dtvccDataPtr->data;
+    DtvccEvent* eventPtr = (DtvccEvent*)&buffPtr->dataPtr[buffPtr->numElements];
+    eventPtr->dtvccType = dtvccDataPtr->dtvccType;
+    eventPtr->serviceSequence = (uint8)((dtvccDataPtr->sequenceNumber << 6) | dtvccDataPtr->serviceNumber);
+    eventPtr->code = unionPtr[0];
+    eventPtr->payloadSize = payloadSize;
+    memcpy(&buffPtr->dataPtr[buffPtr->numElements + sizeof(DtvccEvent)], &unionPtr[1], payloadSize);
+    buffPtr->numElements = buffPtr->numElements + sizeof(DtvccEvent) + payloadSize;
+    return TRUE;
+}  // DtvccDecodeAddEvent()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccDecodeNextEvent()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - BUFFER_TYPE_DTVCC buffer to read the element from.
+ |    offsetPtr - Where the next element starts in the buffer, which should be
+ |                zero for the first element, and is moved past the element.
+ |    dtvccDataPtr - Filled in with the element which was read.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if an element was read, FALSE at the end of the buffer.
+ |
+ | DESCRIPTION:
+ |    This method unpacks the next element of a buffer, back into the DtvccData
+ |    that the sinks and the External Adaptor work with.
+ -------------------------------------------------------------------------------*/
+boolean DtvccDecodeNextEvent( Buffer* buffPtr, uint16* offsetPtr, DtvccData* dtvccDataPtr ) {
+    ASSERT(buffPtr);
+    ASSERT(offsetPtr);
+    ASSERT(dtvccDataPtr);
+
+    if( (*offsetPtr + sizeof(DtvccEvent)) > buffPtr->numElements ) {
+        return FALSE;
+    }
+
+    DtvccEvent* eventPtr = (DtvccEvent*)&buffPtr->dataPtr[*offsetPtr];
+    ASSERT((*offsetPtr + sizeof(DtvccEvent) + eventPtr->payloadSize) <= buffPtr->numElements);
+    ASSERT(eventPtr->payloadSize < sizeof(dtvccDataPtr->data));
+
+    memset(dtvccDataPtr, 0, sizeof(DtvccData));
+    uint8* unionPtr = (uint8*)&dtvccDataPtr->data;
+    dtvccDataPtr->dtvccType = eventPtr->dtvccType;
+    dtvccDataPtr->sequenceNumber = eventPtr->serviceSequence >> 6;
+    dtvccDataPtr->serviceNumber = eventPtr->serviceSequence & EXTENDED_SRV_NUM_MASK;
+    unionPtr[0] = eventPtr->code;
+    memcpy(&unionPtr[1], &buffPtr->dataPtr[*offsetPtr + sizeof(DtvccEvent)], eventPtr->payloadSize);
+    *offsetPtr = *offsetPtr + sizeof(DtvccEvent) + eventPtr->payloadSize;
+    return TRUE;
+}  // DtvccDecodeNextEvent()
+
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeFrame()
+ |
+ | DESCRIPTION:
+ |    This function gathers the DTVCC packets from the cc_data of a single frame,
+ |    processing each packet once the start of the next one arrives. When the
+ |    source split the buffer into planes, the constructs are read from the DTVCC
+ |    plane, from where the previous frame left off, unless each construct of the
+ |    frame is being logged. The annotation, if any, is for the whole buffer.
+ -------------------------------------------------------------------------------*/
+static void decodeFrame( Context* rootCtxPtr, Buffer* inBuffer, BufferFrame* framePtr, uint16* planeIndexPtr, DtvccByte* annotationPtr ) {
+    uint8* dataPtr = &inBuffer->dataPtr[framePtr->firstElement];
+    uint16 numElements = framePtr->numElements;
+    CaptionTime* captionTimePtr = &framePtr->captionTime;
+    CcDataTriage triage;
+
+    if( inBuffer->planesPtr != NULL ) {
+        CcDataPlane* planePtr = &inBuffer->planesPtr->plane[CC_DATA_PLANE_DTVCC];
+        uint16 endConstruct = (framePtr->firstElement + numElements) / 3;
+        if( GetMinDebugLevel(DBG_708_DEC) >= DEBUG_LEVEL_INFO ) {
+            while( (*planeIndexPtr < planePtr->numConstructs) && (planePtr->indexPtr[*planeIndexPtr] < endConstruct) ) {
+                addConstruct(rootCtxPtr, planePtr->headerPtr[*planeIndexPtr], planePtr->data1Ptr[*planeIndexPtr],
+                             planePtr->data2Ptr[*planeIndexPtr], captionTimePtr,
+                             (annotationPtr != NULL) ? &annotationPtr[planePtr->indexPtr[*planeIndexPtr] * DTVCC_BYTES_PER_CONSTRUCT] : NULL);
+                *planeIndexPtr = *planeIndexPtr + 1;
+            }
+            return;
+        }
+        while( (*planeIndexPtr < planePtr->numConstructs) && (planePtr->indexPtr[*planeIndexPtr] < endConstruct) ) {
+            *planeIndexPtr = *planeIndexPtr + 1;
+        }
+    } else {
+        // Frames of nothing but padding leave the packet state untouched, so they are
+        // skipped in bulk unless each construct is being logged.
+        triageCcData(dataPtr, numElements, &triage);
+        if( ((triage.dtvccStartMask | triage.dtvccDataMask) == 0) && (GetMinDebugLevel(DBG_708_DEC) >= DEBUG_LEVEL_INFO) ) {
+            return;
+        }
+    }
+
+    for( int loop = 0; loop < numElements; loop = loop + 3 ) {
+        ASSERT((loop+2) < numElements);
+        LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "Construct %d : 0x%02X -> Type = %s Valid = %s : Data = %02X %02X",
+            ((loop/3)+1), dataPtr[loop], ccTypeStr[dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK],
+            trueFalseStr[(dataPtr[loop] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET], dataPtr[loop+1], dataPtr[loop+2] );
+        addConstruct(rootCtxPtr, dataPtr[loop], dataPtr[loop+1], dataPtr[loop+2], captionTimePtr,
+                     (annotationPtr != NULL) ? &annotationPtr[((framePtr->firstElement + loop) / 3) * DTVCC_BYTES_PER_CONSTRUCT] : NULL);
+    }
+}  // decodeFrame()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    addConstruct()
+ |
+ | DESCRIPTION:
+ |    This function adds a single cc_data construct to the DTVCC packet being
+ |    gathered, or starts a new packet, processing the one it ends. Constructs
+ |    which carry neither are ignored.
+ -------------------------------------------------------------------------------*/
+static void addConstruct( Context* rootCtxPtr, uint8 header, uint8 data1, uint8 data2, CaptionTime* captionTimePtr, DtvccByte* annotationPtr ) {
+    DtvccDecodeCtx* ctxPtr = rootCtxPtr->dtvccDecodeCtxPtr;
+    char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
+    boolean ccValid = ((header & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET);
+    uint8 ccType = header & CC_CONSTR_CC_TYPE_MASK;
+
+    if( annotationPtr != NULL ) {
+        annotateConstruct(ctxPtr, header, data1, data2, annotationPtr);
+    }
+
+    if( ccType == DTVCCC_CHANNEL_PACKET_START ) {
+        processCurrentPacket(rootCtxPtr, captionTimePtr);
+        ctxPtr->dtvccPacketLength = 0;
+        if( ccValid == FALSE ) return;
+    } else if( (ccValid == FALSE) || (ccType != DTVCCC_CHANNEL_PACKET_DATA) ) {
+        return;
+    }
+
+    if( (ctxPtr->dtvccPacketLength + 2) < DTVCC_MAX_PACKET_LENGTH ) {
+        ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = data1;
+        ctxPtr->dtvccPacket[ctxPtr->dtvccPacketLength++] = data2;
+    } else {
+        encodeTimeCode(captionTimePtr, captionTimeStr);
+        LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "At %s Max Packet Length Exceeded, skipping new.", captionTimeStr);
+    }
+}  // addConstruct()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    annotateConstruct()
+ |
+ | DESCRIPTION:
+ |    This function notes what each of the two bytes of a cc_data construct is
+ |    within the DTVCC packet being walked, as it arrives. The walk follows the
+ |    same packet, service block and element lengths as processCurrentPacket(),
+ |    but for every service, as the annotation is used to show the bytes.
+ -------------------------------------------------------------------------------*/
+static void annotateConstruct( DtvccDecodeCtx* ctxPtr, uint8 header, uint8 data1, uint8 data2, DtvccByte* annotationPtr ) {
+    DtvccAnnotateState* statePtr = &ctxPtr->annotateState;
+    boolean ccValid = ((header & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET);
+    uint8 ccType = header & CC_CONSTR_CC_TYPE_MASK;
+
+    if( ccType == DTVCCC_CHANNEL_PACKET_START ) {
+        statePtr->dtvccType = DTVCC_UNKNOWN;
+        if( ccValid == FALSE ) {
+            statePtr->state = DTVCC_ANNOTATE_NO_PACKET;
+            return;
+        }
+        uint8 packet_size_code = data1 & PACKET_LENGTH_MASK;
+        // The header is the first byte of the packet_size, so it leaves packet_size - 1
+        statePtr->packetBytesLeft = ((packet_size_code == 0) ? 128 : (2 * packet_size_code)) - 1;
+        statePtr->serviceNumber = 0;
+        statePtr->state = DTVCC_ANNOTATE_BLOCK_HEADER;
+        annotationPtr[0].dtvccType = DTVCC_PACKET_HEADER;
+        annotationPtr[0].code = data1;
+        annotationPtr[0].byteNum = 1;
+        annotationPtr[0].serviceNumber = 0;
+        annotateByte(ctxPtr, data2, &annotationPtr[1]);
+    } else if( (ccValid == TRUE) && (ccType == DTVCCC_CHANNEL_PACKET_DATA) ) {
+        annotateByte(ctxPtr, data1, &annotationPtr[0]);
+        annotateByte(ctxPtr, data2, &annotationPtr[1]);
+    }
+}  // annotateConstruct()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    annotateByte()
+ |
+ | DESCRIPTION:
+ |    This function notes what a single byte of the packet being walked is,
+ |    and moves the walk on past it. Anything past the last service block, or
+ |    past the advertised size of the packet, is padding. An element which is
+ |    cut short by the end of its service block ends with the block.
+ -------------------------------------------------------------------------------*/
+static void annotateByte( DtvccDecodeCtx* ctxPtr, uint8 byte, DtvccByte* bytePtr ) {
+    DtvccAnnotateState* statePtr = &ctxPtr->annotateState;
+
+    if( statePtr->state == DTVCC_ANNOTATE_NO_PACKET ) return;
+
+    if( statePtr->packetBytesLeft == 0 ) {
+        statePtr->state = DTVCC_ANNOTATE_PADDING;
+    } else {
+        statePtr->packetBytesLeft--;
+    }
+
+    bytePtr->code = byte;
+    bytePtr->byteNum = 1;
+
+    if( statePtr->state == DTVCC_ANNOTATE_BLOCK_HEADER ) {
+        uint8 service_number = (byte & SERVICE_NUMBER_MASK) >> SERVICE_NUMBER_SHIFT;
+        uint8 block_size = byte & SERVICE_BLOCK_SIZE_MASK;
+        // A Null Service Block ends the packet, and so does data for Service 0, which is skipped
+        if( (block_size == 0) || (service_number == 0) ) {
+            statePtr->state = DTVCC_ANNOTATE_PADDING;
+            bytePtr->dtvccType = DTVCC_PADDING;
+            bytePtr->serviceNumber = 0;
+            return;
+        }
+        statePtr->serviceNumber = service_number;
+        statePtr->blockBytesLeft = block_size;
+        statePtr->state = (service_number == EXTENDED_SRV_NUM_PATTERN) ? DTVCC_ANNOTATE_EXT_SERVICE_NUM : DTVCC_ANNOTATE_BLOCK_DATA;
+        bytePtr->dtvccType = DTVCC_BLOCK_HEADER;
+        bytePtr->serviceNumber = service_number;
+        return;
+    } else if( statePtr->state == DTVCC_ANNOTATE_EXT_SERVICE_NUM ) {
+        statePtr->serviceNumber = byte & EXTENDED_SRV_NUM_MASK;
+        statePtr->state = DTVCC_ANNOTATE_BLOCK_DATA;
+        bytePtr->dtvccType = DTVCC_EXT_SERVICE_NUM;
+        bytePtr->serviceNumber = statePtr->serviceNumber;
+        return;
+    } else if( statePtr->state != DTVCC_ANNOTATE_BLOCK_DATA ) {
+        bytePtr->dtvccType = DTVCC_PADDING;
+        bytePtr->serviceNumber = 0;
+        return;
+    }
+
+    if( statePtr->dtvccType == DTVCC_EXT1_CODE ) {
+        statePtr->dtvccType = elementType(DTVCC_C0_EXT1, byte);
+        statePtr->code = byte;
+        statePtr->byteNum = 1;
+        statePtr->numBytes = elementLength(DTVCC_C0_EXT1, byte);
+        // Variable length C3 Commands are not supported, so they take up the rest of the block
+        statePtr->numBytes = (statePtr->numBytes == 0) ? statePtr->blockBytesLeft : (statePtr->numBytes - 1);
+    } else if( statePtr->dtvccType != DTVCC_UNKNOWN ) {
+        statePtr->byteNum++;
+    } else if( byte == DTVCC_C0_EXT1 ) {
+        statePtr->dtvccType = DTVCC_EXT1_CODE;
+        statePtr->code = byte;
+        statePtr->byteNum = 1;
+        statePtr->numBytes = 0;
+    } else {
+        statePtr->dtvccType = elementType(byte, 0);
+        statePtr->code = byte;
+        statePtr->byteNum = 1;
+        statePtr->numBytes = elementLength(byte, 0);
+    }
+
+    bytePtr->dtvccType = statePtr->dtvccType;
+    bytePtr->code = statePtr->code;
+    bytePtr->byteNum = statePtr->byteNum;
+    bytePtr->serviceNumber = statePtr->serviceNumber;
+
+    statePtr->blockBytesLeft--;
+    if( statePtr->blockBytesLeft == 0 ) {
+        statePtr->state = DTVCC_ANNOTATE_BLOCK_HEADER;
+        statePtr->dtvccType = DTVCC_UNKNOWN;
+    } else if( (statePtr->dtvccType != DTVCC_EXT1_CODE) && (statePtr->byteNum >= statePtr->numBytes) ) {
+        statePtr->dtvccType = DTVCC_UNKNOWN;
+    }
+}  // annotateByte()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    processCurrentPacket()
@@ -413,8 +713,17 @@ static void processCurrentPacket( Context* rootCtxPtr, CaptionTime* captionTimeP
             packetDataIndex = packet_size; // Move to end
             break;
         }
-        uint16 numDataPackets = countDataPackets( &packet_data[packetDataIndex], block_size );
-        Buffer* outBuffer = NewBuffer(BUFFER_TYPE_DTVCC, numDataPackets);
+
+        // Service Blocks which were not selected are stepped over without being decoded.
+        if( (ctxPtr->decodeWhichServices != DECODE_ALL_SERVICES) &&
+            ((ctxPtr->decodeWhichServices & DTVCC_SERVICE_SELECT(service_number)) == 0) ) {
+            packetDataIndex = packetDataIndex + block_size;
+            continue;
+        }
+
+        // No packed element is larger than a header for each byte of the block that it
+        // consumed, so the block size bounds the buffer and it can be decoded in a single pass.
+        Buffer* outBuffer = NewBuffer(BUFFER_TYPE_DTVCC, DTVCC_MAX_EVENT_BYTES(block_size));
         outBuffer->captionTime = *captionTimePtr;
 
         uint64 onService = 1;
@@ -433,107 +742,6 @@ static void processCurrentPacket( Context* rootCtxPtr, CaptionTime* captionTimeP
     }
 }  // dtvccProcessCurrentPacket()
 
-/*------------------------------------------------------------------------------
- | NAME:
- |    countDataPackets()
- |
- | DESCRIPTION:
- |    This function counts the number of data packets in a given service block,
- |    which is done primarily for buffer size allocation.
- -------------------------------------------------------------------------------*/
-static uint16 countDataPackets( uint8* dataPtr, uint8 block_size ) {
-    uint8 index = 0;
-    uint16 numDataPackets = 0;
-    
-    while( index < block_size ) {
-        int8 used = LENGTH_UNKNOWN;
-        
-        if( dataPtr[index] != DTVCC_C0_EXT1 ) {
-            if( (dataPtr[index] >= DTVCC_MIN_C0_CODE) && (dataPtr[index] <= DTVCC_MAX_C0_CODE) ) {
-                numDataPackets = numDataPackets + 1;
-                if( dataPtr[index] <= 0x0F ) used = 1;
-                else if( dataPtr[index] <= 0x17 ) used = 2;
-                else if( dataPtr[index] <= DTVCC_MAX_C0_CODE ) used = 3;
-                else LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Impossible Branch %02X", dataPtr[index] );
-            } else if( (dataPtr[index] >= DTVCC_MIN_G0_CODE) && (dataPtr[index] <= DTVCC_MAX_G0_CODE) ) {
-                numDataPackets = numDataPackets + 1;
-                used = 1;
-            } else if( (dataPtr[index] >= DTVCC_MIN_C1_CODE) && (dataPtr[index] <= DTVCC_MAX_C1_CODE) ) {
-                numDataPackets = numDataPackets + 1;
-                if( (dataPtr[index] == DTVCC_C1_CW0) || (dataPtr[index] == DTVCC_C1_CW1) || (dataPtr[index] == DTVCC_C1_CW2) ||
-                    (dataPtr[index] == DTVCC_C1_CW3) || (dataPtr[index] == DTVCC_C1_CW4) || (dataPtr[index] == DTVCC_C1_CW5) ||
-                    (dataPtr[index] == DTVCC_C1_CW6) || (dataPtr[index] == DTVCC_C1_CW7) || (dataPtr[index] == DTVCC_C1_DLC) ||
-                    (dataPtr[index] == DTVCC_C1_RST) || (dataPtr[0] == DTVCC_C1_RSV93)   || (dataPtr[0] == DTVCC_C1_RSV94)   ||
-                    (dataPtr[0] == DTVCC_C1_RSV95)   || (dataPtr[0] == DTVCC_C1_RSV96)) {
-                    used = 1;
-                } else if( (dataPtr[index] == DTVCC_C1_CLW) || (dataPtr[index] == DTVCC_C1_DSW) || (dataPtr[index] == DTVCC_C1_HDW) ||
-                           (dataPtr[index] == DTVCC_C1_TGW) || (dataPtr[index] == DTVCC_C1_DLW) || (dataPtr[index] == DTVCC_C1_DLY) ) {
-                    used = 2;
-                } else if( (dataPtr[index] == DTVCC_C1_SPA) || (dataPtr[index] == DTVCC_C1_SPL) ) {
-                    used = 3;
-                } else if( dataPtr[index] == DTVCC_C1_SPC ) {
-                    used = 4;
-                } else if( dataPtr[index] == DTVCC_C1_SWA ) {
-                    used = 5;
-                } else if( (dataPtr[index] == DTVCC_C1_DF0) || (dataPtr[index] == DTVCC_C1_DF1) || (dataPtr[index] == DTVCC_C1_DF2) ||
-                           (dataPtr[index] == DTVCC_C1_DF3) || (dataPtr[index] == DTVCC_C1_DF4) || (dataPtr[index] == DTVCC_C1_DF5) ||
-                           (dataPtr[index] == DTVCC_C1_DF6) || (dataPtr[index] == DTVCC_C1_DF7) ) {
-                    used = 7;
-                } else {
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Impossible Branch: 0x%02X", dataPtr[0] );
-                    used = 1;
-                }
-            } else {
-                numDataPackets = numDataPackets + 1;
-                used = 1;
-            }
-            if( used == LENGTH_UNKNOWN ) {
-                LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "There was a problem handling the data. Reseting service decoder" );
-                return 25;
-            }
-        } else {  // Use Extended Set
-            if( (dataPtr[index+1] >= DTVCC_MIN_C0_CODE) && (dataPtr[index+1] <= DTVCC_MAX_C0_CODE) ) { // C2: Extended Misc. Control Codes
-                numDataPackets = numDataPackets + 1;
-                if( dataPtr[index+2] < 0x07 ) { // 00-07 : Single-byte control bytes (0 additional bytes)
-                    used = 2;
-                } else if( dataPtr[index+2] < 0x0F ) { // 08-0F : Two-byte control codes (1 additional byte)
-                    used = 3;
-                } else if( dataPtr[index+2] < 0x0F ) { // 10-17 : Three-byte control codes (2 additional bytes)
-                    used = 4;
-                } else {  // 18-1F : Four-byte control codes (3 additional bytes)
-                    used = 5;
-                }
-                LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping C2 Code: 0x%02X", dataPtr[1] );
-            } else if( (dataPtr[index+1] >= DTVCC_MIN_G0_CODE) && (dataPtr[index+1] <= DTVCC_MAX_G0_CODE) ) {  // G2: Extended Misc. Characters
-                numDataPackets = numDataPackets + 1;
-                used = 2;
-            } else if( (dataPtr[index+1] >= DTVCC_MIN_C1_CODE) && (dataPtr[index+1] <= DTVCC_MAX_C1_CODE) ) {
-                if( (dataPtr[index+2] < 0x80) || (dataPtr[index+2] > 0x9F) ) {
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Skipping Invalid C3 Cmd: 0x%02X", dataPtr[index+2] );
-                } else if( dataPtr[index+2] <= 0x87 ) { // 80-87 : Five-byte control bytes (4 additional bytes)
-                    numDataPackets = numDataPackets + 1;
-                    used = 6;
-                } else if( dataPtr[index+2] <= 0x8F ) { // 88-8F : Six-byte control codes (5 additional byte)
-                    numDataPackets = numDataPackets + 1;
-                    used = 7;
-                } else {
-                    // 90-9F : These are variable length commands, that can even span several segments.
-                    // They were envisioned for things like downloading fonts and graphics.
-                    // We are not supporting this set of data.
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Likely Data Corruption. Unsupported C3 Data Range: 0x%02X", dataPtr[index+2] );
-                    return 25;
-                }
-            } else {  // G3 Character Set (Basically just the [CC] Symbol).
-                numDataPackets = numDataPackets + 1;
-                used = 2;
-            }
-        }
-        index = index + used;
-    }
-    ASSERT(index == block_size);
-    return numDataPackets;
-}  // countDataPackets()
-
 /*------------------------------------------------------------------------------
  | NAME:
  |    processServiceBlock()
@@ -545,20 +753,17 @@ static uint16 countDataPackets( uint8* dataPtr, uint8 block_size ) {
 static void processServiceBlock( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 block_size,
                                  Buffer* outBuffer, uint8 seqNum, uint8 srvcNum ) {
     uint8 index = 0;
-    DtvccData* dtvccDataPtr = NULL;
-    DtvccData* dtvccBufferDataPtr = (DtvccData*)outBuffer->dataPtr;
+    DtvccData dtvccData;
+    DtvccData* dtvccDataPtr = &dtvccData;
     ASSERT(outBuffer->numElements == 0);
     
     while( index < block_size ) {
         int8 used = LENGTH_UNKNOWN;
         
-        ASSERT(outBuffer->numElements < outBuffer->maxNumElements);
-        
-        dtvccDataPtr = &(dtvccBufferDataPtr[outBuffer->numElements]);
+        memset(dtvccDataPtr, 0, sizeof(DtvccData));
         dtvccDataPtr->dtvccType = DTVCC_UNKNOWN;
         dtvccDataPtr->sequenceNumber = seqNum;
         dtvccDataPtr->serviceNumber = srvcNum;
-        outBuffer->numElements = outBuffer->numElements + 1;
         
         if( dataPtr[index] != DTVCC_C0_EXT1 ) {
             if( (dataPtr[index] >= DTVCC_MIN_C0_CODE) && (dataPtr[index] <= DTVCC_MAX_C0_CODE) ) {
@@ -592,31 +797,26 @@ static void processServiceBlock( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 b
             }
             if( used == LENGTH_UNKNOWN ) {
                 LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "There was a problem handling the data. Reseting service decoder" );
+                DtvccDecodeAddEvent(outBuffer, dtvccDataPtr);
                 return;
             }
         } else {  // Use Extended Set
-            if( (dataPtr[index+1] >= DTVCC_MIN_C0_CODE) && (dataPtr[index+1] <= DTVCC_MAX_C0_CODE) ) { // C2: Extended Misc. Control Codes
-                dtvccDataPtr->dtvccType = DTVCC_C2_CMD;
+            if( (index + 1) >= block_size ) {
+                LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Extended Code at the end of the Service Block Srvc: %d", srvcNum );
+                return;
+            }
+            uint8 extCode = dataPtr[index+1];
+            dtvccDataPtr->dtvccType = elementType(DTVCC_C0_EXT1, extCode);
+            used = elementLength(DTVCC_C0_EXT1, extCode);
+            if( (extCode >= DTVCC_MIN_C0_CODE) && (extCode <= DTVCC_MAX_C0_CODE) ) { // C2: Extended Misc. Control Codes
                 /* This section is for future codes. While by definition we can't do any work on them, we must advance */
                 /* however many bytes would be consumed if these codes were supported, as defined in the specs.        */
                 // WARN: This code is completely untested due to lack of samples. Just following specs!
-                if( dataPtr[index+2] < 0x07 ) { // 00-07 : Single-byte control bytes (0 additional bytes)
-                    used = 2;
-                } else if( dataPtr[index+2] <0x0F ) { // 08-0F : Two-byte control codes (1 additional byte)
-                    used = 3;
-                } else if( dataPtr[index+2] <0x0F ) { // 10-17 : Three-byte control codes (2 additional bytes)
-                    used = 4;
-                } else {  // 18-1F : Four-byte control codes (3 additional bytes)
-                    used = 5;
-                }
-                LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping C2 Code: 0x%02X", dataPtr[1] );
-            } else if( (dataPtr[index+1] >= DTVCC_MIN_G0_CODE) && (dataPtr[index+1] <= DTVCC_MAX_G0_CODE) ) {  // G2: Extended Misc. Characters
+                LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping C2 Code: 0x%02X", extCode );
+            } else if( (extCode >= DTVCC_MIN_G0_CODE) && (extCode <= DTVCC_MAX_G0_CODE) ) {  // G2: Extended Misc. Characters
                 dtvccDataPtr->dtvccType = DTVCC_G2_CHAR;
-                if( (dataPtr[index+2] == 0x20) || (dataPtr[index+2] == 0x21) || (dataPtr[index+2] == 0x25) || (dataPtr[index+2] == 0x2A) ||
-                    (dataPtr[index+2] == 0x2C) || ((dataPtr[index+2] >= 0x30) && (dataPtr[index+2] <= 0x35)) || (dataPtr[index+2] == 0x39) ||
-                    (dataPtr[index+2] == 0x3A) || (dataPtr[index+2] == 0x3C) || (dataPtr[index+2] == 0x3D) || (dataPtr[index+2] == 0x3F) ||
-                    ((dataPtr[index+2] >= 0x76) && (dataPtr[index+2] <= 0x7F)) ) {
-                    dtvccDataPtr->data.g2char = dataPtr[index+2];
+                if( isKnownG2Char(extCode) == TRUE ) {
+                    dtvccDataPtr->data.g2char = extCode;
                     LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "G2: '%s'", DtvccDecodeG2CharSet(dtvccDataPtr->data.g2char) );
                     if( ctxPtr->foundText == NO_TEXT_FOUND ) {
                         ctxPtr->foundText = TEXT_FOUND;
@@ -625,28 +825,21 @@ static void processServiceBlock( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 b
                         LOG(DEBUG_LEVEL_INFO, DBG_708_DEC, "DTVCC First Character of text found on Service %d at %s", srvcNum, captionTimeStr);
                     }
                 } else {
-                    LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping Unknown G2 Char: 0x%02X", dataPtr[index+2] );
+                    LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping Unknown G2 Char: 0x%02X", extCode );
                     dtvccDataPtr->data.g2char = DTVCC_UNKNOWN_G2_CHAR;
                 }
-                used = 2;
-            } else if( (dataPtr[index+1] >= DTVCC_MIN_C1_CODE) && (dataPtr[index+1] <= DTVCC_MAX_C1_CODE) ) {
-                dtvccDataPtr->dtvccType = DTVCC_C3_CMD;
-                if( (dataPtr[index+2] < 0x80) || (dataPtr[index+2] > 0x9F) ) {
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Skipping Invalid C3 Cmd: 0x%02X", dataPtr[index+2] );
-                } else if( dataPtr[index+2] <= 0x87 ) { // 80-87 : Five-byte control bytes (4 additional bytes)
-                    used = 6;
-                } else if( dataPtr[index+2] <= 0x8F ) { // 88-8F : Six-byte control codes (5 additional byte)
-                    used = 7;
-                } else {
+            } else if( (extCode >= DTVCC_MIN_C1_CODE) && (extCode <= DTVCC_MAX_C1_CODE) ) {
+                if( used == 0 ) {
                     // 90-9F : These are variable length commands, that can even span several segments.
                     // They were envisioned for things like downloading fonts and graphics.
-                    // We are not supporting this set of data.
-                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Likely Data Corruption. Unsupported C3 Data Range: 0x%02X", dataPtr[index+2] );
+                    // We are not supporting this set of data, so the rest of the block is skipped.
+                    LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Likely Data Corruption. Unsupported C3 Data Range: 0x%02X", extCode );
+                    used = block_size - index;
                 }
             } else {  // G3 Character Set (Basically just the [CC] Symbol).
                 dtvccDataPtr->dtvccType = DTVCC_G3_CHAR;
-                if( dataPtr[index+2] != DTVCC_G3_CC_ICON ) {
-                    dtvccDataPtr->data.g3char = dataPtr[index+2];
+                if( extCode != DTVCC_G3_CC_ICON ) {
+                    dtvccDataPtr->data.g3char = extCode;
                     LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "G3: '%s'", DtvccDecodeG2CharSet(dtvccDataPtr->data.g3char) );
                     if( ctxPtr->foundText == NO_TEXT_FOUND ) {
                         ctxPtr->foundText = TEXT_FOUND;
@@ -655,22 +848,25 @@ static void processServiceBlock( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 b
                         LOG(DEBUG_LEVEL_INFO, DBG_708_DEC, "DTVCC First Character of text found on Service %d at %s", srvcNum, captionTimeStr);
                     }
                 } else {
-                    LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping Unknown G3 Char: 0x%02X", dataPtr[index+2] );
+                    LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Skipping Unknown G3 Char: 0x%02X", extCode );
                     dtvccDataPtr->data.g3char = DTVCC_UNKNOWN_G3_CHAR;
                 }
-                used = 2;
+            }
+            if( used > (block_size - index) ) {
+                LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Command is %d bytes long but we only have %d Srvc: %d", used, (block_size - index), srvcNum );
+                return;
             }
         }
         
         if( dtvccDataPtr->dtvccType == DTVCC_UNKNOWN ) {
             LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Unexpectedly Skipping a buffer element" );
-            outBuffer->numElements = outBuffer->numElements - 1;
+        } else if( DtvccDecodeAddEvent(outBuffer, dtvccDataPtr) == FALSE ) {
+            return;
         }
         
         index = index + used;
     }
     ASSERT(index == block_size);
-    ASSERT(outBuffer->numElements == outBuffer->maxNumElements);
 }  // processServiceBlock()
 
 /*------------------------------------------------------------------------------
@@ -681,25 +877,22 @@ static void processServiceBlock( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 b
  |    This function decodes C0 Commands, per the spec.
  -------------------------------------------------------------------------------*/
 static int8 parseC0CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockSize, DtvccData* dtvccDataPtr, uint8 service ) {
-    int8 len = LENGTH_UNKNOWN;
+    // These commands have a known length even if they are reserved.
+    int8 len = elementLength(dataPtr[0], 0);
     C0Command* c0CmdPtr = &dtvccDataPtr->data.c0cmd;
     
-    // These commands have a known length even if they are reserved.
     if( dataPtr[0] <= 0x0F ) {
-        if( (dataPtr[0] == DTVCC_C0_NUL) || (dataPtr[0] == DTVCC_C0_ETX) || (dataPtr[0] == DTVCC_C0_BS) ||
-            (dataPtr[0] == DTVCC_C0_FF) || (dataPtr[0] == DTVCC_C0_CR) || (dataPtr[0] == DTVCC_C0_HCR) ) {
+        if( isKnownC0Cmd(dataPtr[0]) == TRUE ) {
             c0CmdPtr->c0CmdCode = dataPtr[0];
             LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C0: [%02X] {%s} Srvc: %d", dataPtr[0], DtvccDecodeC0Cmd(c0CmdPtr->c0CmdCode), service);
         } else {
             LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Ignoring Unknown Command: 0x%02X Srvc: %d", dataPtr[0], service );
             dtvccDataPtr->dtvccType = DTVCC_IGNORE_CMD_OR_CHAR;
         }
-        len = 1;
     } else if( dataPtr[0] <= 0x17 ) {
         // Note that 0x10 is actually EXT1 and is dealt with somewhere else. Rest is undefined as per CEA-708-D
         LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Ignoring Unknown Command: 0x%02X Srvc: %d", dataPtr[0], service );
         dtvccDataPtr->dtvccType = DTVCC_IGNORE_CMD_OR_CHAR;
-        len = 2;
     } else if( dataPtr[0] <= DTVCC_MAX_C0_CODE ) {
         if( dataPtr[0] == DTVCC_C0_P16 ) { // PE16
             c0CmdPtr->c0CmdCode = dataPtr[0];
@@ -720,12 +913,6 @@ static int8 parseC0CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
             LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Ignoring Unknown Command: 0x%02X Srvc: %d", dataPtr[0], service );
             dtvccDataPtr->dtvccType = DTVCC_IGNORE_CMD_OR_CHAR;
         }
-        len = 3;
-    }
-    
-    if( len == LENGTH_UNKNOWN ) {
-        LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Command is unknown: 0x%02X Srvc: %d", dataPtr[0], service );
-        return LENGTH_UNKNOWN;
     }
     
     if( len > blockSize ) {
@@ -745,7 +932,7 @@ static int8 parseC0CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
  -------------------------------------------------------------------------------*/
 static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockSize, DtvccData* dtvccDataPtr, uint8 service, CaptionTime* captionTimePtr ) {
     ASSERT(service < 64);
-    int8 len = LENGTH_UNKNOWN;
+    int8 len = elementLength(dataPtr[0], 0);
     C1Command* c1CmdPtr = &dtvccDataPtr->data.c1cmd;
     char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
     
@@ -756,7 +943,6 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
         (dataPtr[0] == DTVCC_C1_RST) ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
         LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C1: [%02X] {%s}", dataPtr[0], DtvccDecodeC1Cmd(c1CmdPtr->c1CmdCode));
-        len = 1;
     // --- Clear Windows {CLW} --- Display Windows {DSW} --- HideWindows {HDW} ---
     // --- ToggleWindows {TGW} --- Delete Windows {DLW} ---
     } else if( (dataPtr[0] == DTVCC_C1_CLW) || (dataPtr[0] == DTVCC_C1_DSW) || (dataPtr[0] == DTVCC_C1_HDW) ||
@@ -770,14 +956,12 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
         c1CmdPtr->cmdData.windowBitmap = dataPtr[1];
         LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C1: [%02X %02X] {%s:%s}", dataPtr[0], dataPtr[1],
              DtvccDecodeC1Cmd(c1CmdPtr->c1CmdCode), uint8toBitArray(c1CmdPtr->cmdData.windowBitmap));
-        len = 2;
     // --- Delay {DLY} in 100ms ---
     } else if( dataPtr[0] == DTVCC_C1_DLY ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
         c1CmdPtr->cmdData.tenthsOfaSec = dataPtr[1];
         LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C1: [%02X %02X] {%s:%d00ms}", dataPtr[0], dataPtr[1],
              DtvccDecodeC1Cmd(c1CmdPtr->c1CmdCode), c1CmdPtr->cmdData.tenthsOfaSec);
-        len = 2;
     // --- Set Pen Attributes {SPA} ---
     } else if( dataPtr[0] == DTVCC_C1_SPA ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
@@ -798,7 +982,6 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
             DECODE_EDGE_TYPE(c1CmdPtr->cmdData.penAttributes.edgeType),
             trueFalseStr[c1CmdPtr->cmdData.penAttributes.isUnderlined],
             trueFalseStr[c1CmdPtr->cmdData.penAttributes.isItalic]);
-        len = 3;
     // --- Set Pen Color {SPC} ---
     } else if( dataPtr[0] == DTVCC_C1_SPC ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
@@ -827,7 +1010,6 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
             c1CmdPtr->cmdData.penColor.edgeRed,
             c1CmdPtr->cmdData.penColor.edgeGreen,
             c1CmdPtr->cmdData.penColor.edgeBlue);
-        len = 4;
     // --- Set Pen Location {SPL} ---
     } else if( dataPtr[0] == DTVCC_C1_SPL ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
@@ -836,14 +1018,12 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
         LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C1: [%02X %02X %02X] {%s:R%d-C%d}",
             dataPtr[0], dataPtr[1], dataPtr[2], DtvccDecodeC1Cmd(c1CmdPtr->c1CmdCode),
             c1CmdPtr->cmdData.penLocation.row, c1CmdPtr->cmdData.penLocation.column);
-        len = 3;
     // --- Reserved {RSVxx} ---
     } else if( (dataPtr[0] == DTVCC_C1_RSV93) || (dataPtr[0] == DTVCC_C1_RSV94) || (dataPtr[0] == DTVCC_C1_RSV95) ||
                (dataPtr[0] == DTVCC_C1_RSV96) ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
         LOG( DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "C1: [%02X] {%s}", dataPtr[0], DtvccDecodeC1Cmd(c1CmdPtr->c1CmdCode) );
         LOG( DEBUG_LEVEL_WARN, DBG_708_DEC, "Found Reserved codes, ignored." );
-        len = 1;
     // --- Set Window Attributes {SWA} ---
     } else if( dataPtr[0] == DTVCC_C1_SWA ) {
         c1CmdPtr->c1CmdCode = dataPtr[0];
@@ -881,7 +1061,6 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
             DECODE_EFFECT_SPEED(c1CmdPtr->cmdData.winAttributes.effectSpeed),
             DECODE_DIRECTION(c1CmdPtr->cmdData.winAttributes.effectDirection),
             trueFalseStr[c1CmdPtr->cmdData.winAttributes.isWordWrapped]);
-        len = 5;
     // --- Define Window {DFWx} ---
     } else if( (dataPtr[0] == DTVCC_C1_DF0) || (dataPtr[0] == DTVCC_C1_DF1) || (dataPtr[0] == DTVCC_C1_DF2) ||
                (dataPtr[0] == DTVCC_C1_DF3) || (dataPtr[0] == DTVCC_C1_DF4) || (dataPtr[0] == DTVCC_C1_DF5) ||
@@ -914,7 +1093,6 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
             trueFalseStr[c1CmdPtr->cmdData.winDefinition.isRowLocked],
             trueFalseStr[c1CmdPtr->cmdData.winDefinition.isColumnLocked],
             trueFalseStr[c1CmdPtr->cmdData.winDefinition.isRelativePosition]);
-        len = 7;
 
         if( ctxPtr->captioningChange[service-1] == FALSE ) {
             if( (c1CmdPtr->cmdData.winDefinition.windowStyle == WINDOW_STYLE_608_POPUP) ||
@@ -958,7 +1136,156 @@ static int8 parseC1CmdCode( DtvccDecodeCtx* ctxPtr, uint8* dataPtr, uint8 blockS
     } else {
         LOG( DEBUG_LEVEL_ERROR, DBG_708_DEC, "Impossible Branch: 0x%02X", dataPtr[0] );
         dtvccDataPtr->dtvccType = DTVCC_IGNORE_CMD_OR_CHAR;
-        len = 1;
     }
     return len;
 }  // parseC1CmdCode()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    elementType()
+ |
+ | DESCRIPTION:
+ |    This function returns the type of the element which starts with the code,
+ |    or the extended code which follows EXT1. Codes which are ignored while
+ |    decoding are DTVCC_IGNORE_CMD_OR_CHAR.
+ -------------------------------------------------------------------------------*/
+static uint8 elementType( uint8 code, uint8 extendedCode ) {
+    if( code == DTVCC_C0_EXT1 ) {
+        if( extendedCode <= DTVCC_MAX_C0_CODE ) {
+            return DTVCC_C2_CMD;
+        } else if( extendedCode <= DTVCC_MAX_G0_CODE ) {
+            return (isKnownG2Char(extendedCode) == TRUE) ? DTVCC_G2_CHAR : DTVCC_IGNORE_CMD_OR_CHAR;
+        } else if( extendedCode <= DTVCC_MAX_C1_CODE ) {
+            return DTVCC_C3_CMD;
+        } else {
+            return (extendedCode != DTVCC_G3_CC_ICON) ? DTVCC_G3_CHAR : DTVCC_IGNORE_CMD_OR_CHAR;
+        }
+    }
+
+    if( code <= DTVCC_MAX_C0_CODE ) {
+        return ((isKnownC0Cmd(code) == TRUE) || (code == DTVCC_C0_P16)) ? DTVCC_C0_CMD : DTVCC_IGNORE_CMD_OR_CHAR;
+    } else if( code <= DTVCC_MAX_G0_CODE ) {
+        return DTVCC_G0_CHAR;
+    } else if( code <= DTVCC_MAX_C1_CODE ) {
+        return DTVCC_C1_CMD;
+    } else {
+        return DTVCC_G1_CHAR;
+    }
+}  // elementType()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    elementLength()
+ |
+ | DESCRIPTION:
+ |    This function returns how many bytes of a service block the element which
+ |    starts with the code takes up, per the spec. Codes which are reserved still
+ |    have a known length. For EXT1, the length is of the extended code which
+ |    follows, and includes the EXT1 itself. Variable length C3 Commands are 0.
+ -------------------------------------------------------------------------------*/
+static uint8 elementLength( uint8 code, uint8 extendedCode ) {
+    if( code == DTVCC_C0_EXT1 ) {
+        if( extendedCode <= DTVCC_MAX_C0_CODE ) {
+            return 2 + (extendedCode >> 3);     // 00-07 : None, 08-0F : One, 10-17 : Two, 18-1F : Three additional bytes
+        } else if( extendedCode <= DTVCC_MAX_G0_CODE ) {
+            return 2;
+        } else if( extendedCode <= 0x87 ) {
+            return 6;                           // 80-87 : Four additional bytes
+        } else if( extendedCode <= 0x8F ) {
+            return 7;                           // 88-8F : Five additional bytes
+        } else if( extendedCode <= DTVCC_MAX_C1_CODE ) {
+            return 0;                           // 90-9F : Variable length
+        } else {
+            return 2;
+        }
+    }
+
+    if( code <= 0x0F ) {
+        return 1;
+    } else if( code <= 0x17 ) {
+        return 2;
+    } else if( code <= DTVCC_MAX_C0_CODE ) {
+        return 3;
+    } else if( (code <= DTVCC_MAX_G0_CODE) || (code > DTVCC_MAX_C1_CODE) ) {
+        return 1;
+    }
+
+    switch( code ) {
+        case DTVCC_C1_CLW:
+        case DTVCC_C1_DSW:
+        case DTVCC_C1_HDW:
+        case DTVCC_C1_TGW:
+        case DTVCC_C1_DLW:
+        case DTVCC_C1_DLY:
+            return 2;
+        case DTVCC_C1_SPA:
+        case DTVCC_C1_SPL:
+            return 3;
+        case DTVCC_C1_SPC:
+            return 4;
+        case DTVCC_C1_SWA:
+            return 5;
+        default:
+            return ((code >= DTVCC_C1_DF0) && (code <= DTVCC_C1_DF7)) ? 7 : 1;
+    }
+}  // elementLength()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isKnownC0Cmd()
+ |
+ | DESCRIPTION:
+ |    This function returns whether the single byte C0 Command is one that is
+ |    defined by the spec, rather than reserved.
+ -------------------------------------------------------------------------------*/
+static boolean isKnownC0Cmd( uint8 code ) {
+    return ((code == DTVCC_C0_NUL) || (code == DTVCC_C0_ETX) || (code == DTVCC_C0_BS) ||
+            (code == DTVCC_C0_FF) || (code == DTVCC_C0_CR) || (code == DTVCC_C0_HCR)) ? TRUE : FALSE;
+}  // isKnownC0Cmd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isKnownG2Char()
+ |
+ | DESCRIPTION:
+ |    This function returns whether the G2 Character is one that is defined by
+ |    the spec, rather than reserved.
+ -------------------------------------------------------------------------------*/
+static boolean isKnownG2Char( uint8 code ) {
+    return ((code == 0x20) || (code == 0x21) || (code == 0x25) || (code == 0x2A) || (code == 0x2C) ||
+            ((code >= 0x30) && (code <= 0x35)) || (code == 0x39) || (code == 0x3A) || (code == 0x3C) ||
+            (code == 0x3D) || (code == 0x3F) || ((code >= 0x76) && (code <= 0x7F))) ? TRUE : FALSE;
+}  // isKnownG2Char()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    eventPayloadSize()
+ |
+ | DESCRIPTION:
+ |    This function returns how many bytes of the element, after the character
+ |    or command code, need to be carried for the sinks to see the whole of it.
+ -------------------------------------------------------------------------------*/
+static uint8 eventPayloadSize( DtvccData* dtvccDataPtr ) {
+    if( dtvccDataPtr->dtvccType == DTVCC_C0_CMD ) {
+        return (dtvccDataPtr->data.c0cmd.c0CmdCode == DTVCC_C0_P16) ? (sizeof(C0Command) - 1) : 0;
+    }
+    if( dtvccDataPtr->dtvccType != DTVCC_C1_CMD ) {
+        return 0;
+    }
+
+    uint8 c1CmdCode = dtvccDataPtr->data.c1cmd.c1CmdCode;
+    if( (c1CmdCode >= DTVCC_C1_CLW) && (c1CmdCode <= DTVCC_C1_DLY) ) {
+        return sizeof(uint8);  // Window Bitmap or Tenths of a Second
+    } else if( c1CmdCode == DTVCC_C1_SPA ) {
+        return sizeof(PenAttributes);
+    } else if( c1CmdCode == DTVCC_C1_SPC ) {
+        return sizeof(PenColor);
+    } else if( c1CmdCode == DTVCC_C1_SPL ) {
+        return sizeof(PenLocation);
+    } else if( c1CmdCode == DTVCC_C1_SWA ) {
+        return sizeof(WindowAttributes);
+    } else if( (c1CmdCode >= DTVCC_C1_DF0) && (c1CmdCode <= DTVCC_C1_DF7) ) {
+        return sizeof(WindowDefinition);
+    }
+    return 0;
+}  // eventPayloadSize()
@@ -0,0 +1,645 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "debug.h"
+
+#include "dtvcc_window.h"
+#include "dtvcc_decode.h"
+#include "dtvcc_output.h"
+#include "cc_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static uint8 processC0Cmd( Context*, DtvccWindowService*, uint8, C0Command*, CaptionTime* );
+static uint8 processC1Cmd( Context*, DtvccWindowService*, uint8, C1Command*, CaptionTime* );
+static uint8 defineWindow( Context*, DtvccWindowService*, uint8, uint8, WindowDefinition*, CaptionTime* );
+static uint8 deleteWindow( Context*, uint8, uint8, DtvccWindow*, CaptionTime* );
+static void writeChar( DtvccWindowService*, const char*, CaptionTime* );
+static uint8 carriageReturn( Context*, uint8, uint8, DtvccWindow*, CaptionTime* );
+static void clearWindow( DtvccWindow* );
+static void clearRow( const char* [DTVCC_WINDOW_MAX_COLUMNS] );
+static boolean isCellBlank( const char* );
+static boolean isRowBlank( DtvccWindow*, uint8 );
+static boolean isWindowBlank( DtvccWindow* );
+static void openCue( DtvccWindow*, CaptionTime* );
+static uint8 closeCue( Context*, uint8, uint8, DtvccWindow*, CaptionTime* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccWindowInitialize()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    LinkInfo -  Information about this element of the pipeline, such that it can
+ |                be chained to elements that can consume the specific type of data
+ |                that it produces.
+ |
+ | DESCRIPTION:
+ |    This initializes this element of the pipeline.
+ -------------------------------------------------------------------------------*/
+LinkInfo DtvccWindowInitialize( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(!rootCtxPtr->dtvccWindowCtxPtr);
+
+    rootCtxPtr->dtvccWindowCtxPtr = malloc(sizeof(DtvccWindowCtx));
+    DtvccWindowCtx* ctxPtr = rootCtxPtr->dtvccWindowCtxPtr;
+    memset(ctxPtr, 0, sizeof(DtvccWindowCtx));
+
+    InitSinks(&ctxPtr->sinks, DTVCC_DATA___CAPTION_CUE);
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = DTVCC_DATA___CAPTION_CUE;
+    linkInfo.sourceType = DATA_TYPE_DECODED_708;
+    linkInfo.sinkType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.NextBufferFnPtr = &DtvccWindowProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &DtvccWindowShutdown;
+    return linkInfo;
+}  // DtvccWindowInitialize()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccWindowAddSink()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    linkInfo - Describes the potential next element of the pipeline.
+ |
+ | RETURN VALUES:
+ |    boolean - Success is TRUE and Failure is FALSE
+ |
+ | DESCRIPTION:
+ |    This method binds the next element to this element, after validating that
+ |    the data it receives is compatible with the data tht this element sends.
+ -------------------------------------------------------------------------------*/
+boolean DtvccWindowAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->dtvccWindowCtxPtr);
+
+    if( linkInfo.sourceType != DATA_TYPE_CAPTION_CUE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_708_DEC, "Attempt to add Sink that cannot process Caption Cues");
+        return FALSE;
+    }
+
+    return AddSink(&rootCtxPtr->dtvccWindowCtxPtr->sinks, &linkInfo);
+}  // DtvccWindowAddSink()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccWindowProcNextBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    inBuffer - Pointer to the buffer to process.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method applies the decoded DTVCC commands and characters to the eight
+ |    windows of each service, as a caption decoder would. Each time a visible
+ |    window is hidden, deleted, moved or has text removed, the text that it
+ |    showed up until then is passed down the pipeline as a timed cue.
+ |
+ |    Delay {DLY} is not modelled, so text held back by it is timed from when it
+ |    arrived rather than from when the delay would have expired.
+ -------------------------------------------------------------------------------*/
+uint8 DtvccWindowProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
+    ASSERT(inBuffer);
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->dtvccWindowCtxPtr);
+    DtvccWindowCtx* ctxPtr = ((Context*)rootCtxPtr)->dtvccWindowCtxPtr;
+    DtvccData dtvccData;
+    uint16 offset = 0;
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( inBuffer->bufferType != BUFFER_TYPE_DTVCC ) {
+        FreeBuffer(inBuffer);
+        return PIPELINE_SUCCESS;
+    }
+
+    ctxPtr->lastCaptionTime = inBuffer->captionTime;
+
+    while( DtvccDecodeNextEvent(inBuffer, &offset, &dtvccData) == TRUE ) {
+        uint8 serviceNum = dtvccData.serviceNumber;
+        uint8 tmp = PIPELINE_SUCCESS;
+
+        if( (serviceNum < 1) || (serviceNum > DTVCC_MAX_NUM_SERVICES) ) {
+            continue;
+        }
+
+        if( ctxPtr->service[serviceNum-1] == NULL ) {
+            LOG(DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "Rendering Windows for Service %d", serviceNum);
+            ctxPtr->service[serviceNum-1] = malloc(sizeof(DtvccWindowService));
+            memset(ctxPtr->service[serviceNum-1], 0, sizeof(DtvccWindowService));
+        }
+        DtvccWindowService* servicePtr = ctxPtr->service[serviceNum-1];
+
+        switch( dtvccData.dtvccType ) {
+            case DTVCC_C0_CMD:
+                tmp = processC0Cmd(rootCtxPtr, servicePtr, serviceNum, &dtvccData.data.c0cmd, &inBuffer->captionTime);
+                break;
+            case DTVCC_C1_CMD:
+                tmp = processC1Cmd(rootCtxPtr, servicePtr, serviceNum, &dtvccData.data.c1cmd, &inBuffer->captionTime);
+                break;
+            case DTVCC_G0_CHAR:
+                writeChar(servicePtr, DtvccDecodeG0CharSet(dtvccData.data.g0char), &inBuffer->captionTime);
+                break;
+            case DTVCC_G1_CHAR:
+                writeChar(servicePtr, DtvccDecodeG1CharSet(dtvccData.data.g1char), &inBuffer->captionTime);
+                break;
+            case DTVCC_G2_CHAR:
+                if( dtvccData.data.g2char != DTVCC_UNKNOWN_G2_CHAR ) {
+                    writeChar(servicePtr, DtvccDecodeG2CharSet(dtvccData.data.g2char), &inBuffer->captionTime);
+                }
+                break;
+            case DTVCC_G3_CHAR:
+                if( dtvccData.data.g3char == DTVCC_G3_CC_ICON ) {
+                    writeChar(servicePtr, DtvccDecodeG3CharSet(dtvccData.data.g3char), &inBuffer->captionTime);
+                }
+                break;
+            default:
+                break;
+        }
+
+        if( tmp != PIPELINE_SUCCESS ) {
+            retval = tmp;
+        }
+    }
+
+    FreeBuffer(inBuffer);
+    return retval;
+}  // DtvccWindowProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    DtvccWindowShutdown()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is called when the previous element in the pipeline determines
+ |    that there is no more data coming down the pipeline. Any windows which are
+ |    still on screen are ended at the time of the last data received, before the
+ |    call is passed down the pipeline.
+ -------------------------------------------------------------------------------*/
+uint8 DtvccWindowShutdown( void* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->dtvccWindowCtxPtr);
+    DtvccWindowCtx* ctxPtr = ((Context*)rootCtxPtr)->dtvccWindowCtxPtr;
+
+    for( int loop = 0; loop < DTVCC_MAX_NUM_SERVICES; loop++ ) {
+        if( ctxPtr->service[loop] == NULL ) continue;
+        for( int winId = 0; winId < DTVCC_NUM_WINDOWS; winId++ ) {
+            closeCue(rootCtxPtr, loop+1, winId, &ctxPtr->service[loop]->window[winId], &ctxPtr->lastCaptionTime);
+        }
+        free(ctxPtr->service[loop]);
+    }
+
+    Sinks sinks = ctxPtr->sinks;
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->dtvccWindowCtxPtr = NULL;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // DtvccWindowShutdown()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    processC0Cmd()
+ |
+ | DESCRIPTION:
+ |    This function applies a C0 Command to the current window of a service.
+ -------------------------------------------------------------------------------*/
+static uint8 processC0Cmd( Context* rootCtxPtr, DtvccWindowService* servicePtr, uint8 serviceNum,
+                           C0Command* c0CmdPtr, CaptionTime* captionTimePtr ) {
+    uint8 winId = servicePtr->currentWindow;
+    DtvccWindow* winPtr = &servicePtr->window[winId];
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( winPtr->isDefined == FALSE ) {
+        return PIPELINE_SUCCESS;
+    }
+
+    switch( c0CmdPtr->c0CmdCode ) {
+        case DTVCC_C0_BS:
+            if( winPtr->penColumn > 0 ) {
+                winPtr->penColumn--;
+                winPtr->text[winPtr->penRow][winPtr->penColumn] = NULL;
+            }
+            break;
+        case DTVCC_C0_FF:
+            retval = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+            clearWindow(winPtr);
+            winPtr->penRow = 0;
+            winPtr->penColumn = 0;
+            break;
+        case DTVCC_C0_CR:
+            retval = carriageReturn(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+            break;
+        case DTVCC_C0_HCR:
+            if( isRowBlank(winPtr, winPtr->penRow) == FALSE ) {
+                retval = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+                clearRow(winPtr->text[winPtr->penRow]);
+                openCue(winPtr, captionTimePtr);
+            }
+            winPtr->penColumn = 0;
+            break;
+        default:
+            break;
+    }
+
+    return retval;
+}  // processC0Cmd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    processC1Cmd()
+ |
+ | DESCRIPTION:
+ |    This function applies a C1 Command to the windows of a service. The pen and
+ |    window styling commands do not change which text is shown, so are skipped.
+ -------------------------------------------------------------------------------*/
+static uint8 processC1Cmd( Context* rootCtxPtr, DtvccWindowService* servicePtr, uint8 serviceNum,
+                           C1Command* c1CmdPtr, CaptionTime* captionTimePtr ) {
+    uint8 cmd = c1CmdPtr->c1CmdCode;
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( (cmd >= DTVCC_C1_CW0) && (cmd <= DTVCC_C1_CW7) ) {
+        if( servicePtr->window[cmd - DTVCC_C1_CW0].isDefined == TRUE ) {
+            servicePtr->currentWindow = cmd - DTVCC_C1_CW0;
+        }
+        return PIPELINE_SUCCESS;
+    }
+
+    if( (cmd >= DTVCC_C1_DF0) && (cmd <= DTVCC_C1_DF7) ) {
+        return defineWindow(rootCtxPtr, servicePtr, serviceNum, cmd - DTVCC_C1_DF0, &c1CmdPtr->cmdData.winDefinition, captionTimePtr);
+    }
+
+    if( cmd == DTVCC_C1_SPL ) {
+        DtvccWindow* winPtr = &servicePtr->window[servicePtr->currentWindow];
+        if( winPtr->isDefined == TRUE ) {
+            winPtr->penRow = c1CmdPtr->cmdData.penLocation.row;
+            winPtr->penColumn = c1CmdPtr->cmdData.penLocation.column;
+            if( winPtr->penRow >= winPtr->numRows ) winPtr->penRow = winPtr->numRows - 1;
+            if( winPtr->penColumn >= DTVCC_WINDOW_MAX_COLUMNS ) winPtr->penColumn = DTVCC_WINDOW_MAX_COLUMNS - 1;
+        }
+        return PIPELINE_SUCCESS;
+    }
+
+    for( uint8 winId = 0; winId < DTVCC_NUM_WINDOWS; winId++ ) {
+        DtvccWindow* winPtr = &servicePtr->window[winId];
+        uint8 tmp = PIPELINE_SUCCESS;
+
+        if( (cmd != DTVCC_C1_RST) && ((c1CmdPtr->cmdData.windowBitmap & (1 << winId)) == 0) ) continue;
+        if( winPtr->isDefined == FALSE ) continue;
+
+        switch( cmd ) {
+            case DTVCC_C1_CLW:
+                tmp = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+                clearWindow(winPtr);
+                break;
+            case DTVCC_C1_DSW:
+                winPtr->isVisible = TRUE;
+                openCue(winPtr, captionTimePtr);
+                break;
+            case DTVCC_C1_HDW:
+                tmp = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+                winPtr->isVisible = FALSE;
+                break;
+            case DTVCC_C1_TGW:
+                if( winPtr->isVisible == TRUE ) {
+                    tmp = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+                    winPtr->isVisible = FALSE;
+                } else {
+                    winPtr->isVisible = TRUE;
+                    openCue(winPtr, captionTimePtr);
+                }
+                break;
+            case DTVCC_C1_DLW:
+            case DTVCC_C1_RST:
+                tmp = deleteWindow(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+                break;
+            default:
+                break;
+        }
+
+        if( tmp != PIPELINE_SUCCESS ) {
+            retval = tmp;
+        }
+    }
+
+    return retval;
+}  // processC1Cmd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    defineWindow()
+ |
+ | DESCRIPTION:
+ |    This function creates a window, or updates one that already exists while
+ |    keeping its text, and makes it the current window. Captioners often resend
+ |    an unchanged definition, which leaves the cue on screen undisturbed.
+ -------------------------------------------------------------------------------*/
+static uint8 defineWindow( Context* rootCtxPtr, DtvccWindowService* servicePtr, uint8 serviceNum, uint8 winId,
+                           WindowDefinition* winDefPtr, CaptionTime* captionTimePtr ) {
+    DtvccWindow* winPtr = &servicePtr->window[winId];
+    uint8 numRows = winDefPtr->rowCount + 1;
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( numRows > DTVCC_WINDOW_MAX_ROWS ) numRows = DTVCC_WINDOW_MAX_ROWS;
+
+    if( winPtr->isDefined == FALSE ) {
+        clearWindow(winPtr);
+        winPtr->penRow = 0;
+        winPtr->penColumn = 0;
+    } else if( (winPtr->isVisible != winDefPtr->isVisible) || (winPtr->isRelativePosition != winDefPtr->isRelativePosition) ||
+               (winPtr->verticalAnchor != winDefPtr->verticalAnchor) || (winPtr->horizontalAnchor != winDefPtr->horizontalAnchor) ||
+               (winPtr->anchorId != winDefPtr->anchorId) || (winPtr->numRows != numRows) ) {
+        retval = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+    }
+
+    for( int row = numRows; row < DTVCC_WINDOW_MAX_ROWS; row++ ) {
+        clearRow(winPtr->text[row]);
+    }
+    if( winPtr->penRow >= numRows ) winPtr->penRow = numRows - 1;
+
+    winPtr->isDefined = TRUE;
+    winPtr->isVisible = winDefPtr->isVisible;
+    winPtr->isRelativePosition = winDefPtr->isRelativePosition;
+    winPtr->verticalAnchor = winDefPtr->verticalAnchor;
+    winPtr->horizontalAnchor = winDefPtr->horizontalAnchor;
+    winPtr->anchorId = winDefPtr->anchorId;
+    winPtr->numRows = numRows;
+    servicePtr->currentWindow = winId;
+
+    if( winPtr->isVisible == TRUE ) {
+        openCue(winPtr, captionTimePtr);
+    }
+
+    return retval;
+}  // defineWindow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    deleteWindow()
+ |
+ | DESCRIPTION:
+ |    This function removes a window, along with its text, from the screen.
+ -------------------------------------------------------------------------------*/
+static uint8 deleteWindow( Context* rootCtxPtr, uint8 serviceNum, uint8 winId, DtvccWindow* winPtr, CaptionTime* captionTimePtr ) {
+    uint8 retval = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+
+    clearWindow(winPtr);
+    winPtr->isDefined = FALSE;
+    winPtr->isVisible = FALSE;
+    return retval;
+}  // deleteWindow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeChar()
+ |
+ | DESCRIPTION:
+ |    This function writes a character at the pen of the current window and
+ |    advances the pen, which stays put in the last column. Writing to a visible
+ |    window starts a cue if it was not showing anything.
+ -------------------------------------------------------------------------------*/
+static void writeChar( DtvccWindowService* servicePtr, const char* charStr, CaptionTime* captionTimePtr ) {
+    ASSERT(charStr);
+    DtvccWindow* winPtr = &servicePtr->window[servicePtr->currentWindow];
+
+    if( winPtr->isDefined == FALSE ) {
+        return;
+    }
+
+    winPtr->text[winPtr->penRow][winPtr->penColumn] = charStr;
+    if( winPtr->penColumn < (DTVCC_WINDOW_MAX_COLUMNS - 1) ) {
+        winPtr->penColumn++;
+    }
+
+    if( winPtr->isVisible == TRUE ) {
+        openCue(winPtr, captionTimePtr);
+    }
+}  // writeChar()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    carriageReturn()
+ |
+ | DESCRIPTION:
+ |    This function moves the pen to the start of the next row, scrolling the
+ |    window up a row when the pen is already on the last one.
+ -------------------------------------------------------------------------------*/
+static uint8 carriageReturn( Context* rootCtxPtr, uint8 serviceNum, uint8 winId, DtvccWindow* winPtr, CaptionTime* captionTimePtr ) {
+    uint8 retval = PIPELINE_SUCCESS;
+
+    winPtr->penColumn = 0;
+    if( (winPtr->penRow + 1) < winPtr->numRows ) {
+        winPtr->penRow++;
+        return PIPELINE_SUCCESS;
+    }
+
+    if( isRowBlank(winPtr, 0) == FALSE ) {
+        retval = closeCue(rootCtxPtr, serviceNum, winId, winPtr, captionTimePtr);
+    }
+    memmove(winPtr->text[0], winPtr->text[1], (winPtr->numRows - 1) * sizeof(winPtr->text[0]));
+    clearRow(winPtr->text[winPtr->numRows - 1]);
+
+    if( winPtr->isVisible == TRUE ) {
+        openCue(winPtr, captionTimePtr);
+    }
+    return retval;
+}  // carriageReturn()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    clearWindow()
+ |
+ | DESCRIPTION:
+ |    This function erases every cell of a window.
+ -------------------------------------------------------------------------------*/
+static void clearWindow( DtvccWindow* winPtr ) {
+    for( int row = 0; row < DTVCC_WINDOW_MAX_ROWS; row++ ) {
+        clearRow(winPtr->text[row]);
+    }
+}  // clearWindow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    clearRow()
+ |
+ | DESCRIPTION:
+ |    This function erases every cell of a row of a window.
+ -------------------------------------------------------------------------------*/
+static void clearRow( const char* row[DTVCC_WINDOW_MAX_COLUMNS] ) {
+    for( int col = 0; col < DTVCC_WINDOW_MAX_COLUMNS; col++ ) {
+        row[col] = NULL;
+    }
+}  // clearRow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isCellBlank()
+ |
+ | DESCRIPTION:
+ |    This function determines whether a cell shows nothing but background.
+ -------------------------------------------------------------------------------*/
+static boolean isCellBlank( const char* cellPtr ) {
+    return ((cellPtr == NULL) || (strcmp(cellPtr, " ") == 0));
+}  // isCellBlank()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isRowBlank()
+ |
+ | DESCRIPTION:
+ |    This function determines whether there is any text in a row of a window.
+ -------------------------------------------------------------------------------*/
+static boolean isRowBlank( DtvccWindow* winPtr, uint8 row ) {
+    for( int col = 0; col < DTVCC_WINDOW_MAX_COLUMNS; col++ ) {
+        if( isCellBlank(winPtr->text[row][col]) == FALSE ) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}  // isRowBlank()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isWindowBlank()
+ |
+ | DESCRIPTION:
+ |    This function determines whether there is any text in a window.
+ -------------------------------------------------------------------------------*/
+static boolean isWindowBlank( DtvccWindow* winPtr ) {
+    for( int row = 0; row < winPtr->numRows; row++ ) {
+        if( isRowBlank(winPtr, row) == FALSE ) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}  // isWindowBlank()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    openCue()
+ |
+ | DESCRIPTION:
+ |    This function starts a cue, if the window is showing text and there is not
+ |    already a cue in progress.
+ -------------------------------------------------------------------------------*/
+static void openCue( DtvccWindow* winPtr, CaptionTime* captionTimePtr ) {
+    if( (winPtr->isCueOpen == TRUE) || (winPtr->isVisible == FALSE) || (isWindowBlank(winPtr) == TRUE) ) {
+        return;
+    }
+
+    winPtr->isCueOpen = TRUE;
+    winPtr->cueStartTime = *captionTimePtr;
+}  // openCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeCue()
+ |
+ | DESCRIPTION:
+ |    This function ends the cue in progress, capturing the text of the window
+ |    along with where the window is anchored, and passing it down the pipeline.
+ -------------------------------------------------------------------------------*/
+static uint8 closeCue( Context* rootCtxPtr, uint8 serviceNum, uint8 winId, DtvccWindow* winPtr, CaptionTime* captionTimePtr ) {
+    if( winPtr->isCueOpen == FALSE ) {
+        return PIPELINE_SUCCESS;
+    }
+    winPtr->isCueOpen = FALSE;
+
+    if( captionTimeToMs(&winPtr->cueStartTime) >= captionTimeToMs(captionTimePtr) ) {
+        LOG(DEBUG_LEVEL_VERBOSE, DBG_708_DEC, "Dropping Zero Length Cue on Service %d Window %d", serviceNum, winId);
+        return PIPELINE_SUCCESS;
+    }
+
+    Buffer* outBuffer = NewBuffer(BUFFER_TYPE_CAPTION_CUE, 1);
+    CaptionCue* cuePtr = (CaptionCue*)outBuffer->dataPtr;
+    cuePtr->source = CAPTION_CUE_SOURCE_708;
+    cuePtr->channelNum = serviceNum;
+    cuePtr->startTime = winPtr->cueStartTime;
+    cuePtr->endTime = *captionTimePtr;
+    cuePtr->numRows = 0;
+    cuePtr->windowId = winId;
+    cuePtr->anchorId = winPtr->anchorId;
+
+    if( winPtr->isRelativePosition == TRUE ) {
+        cuePtr->anchorVertPercent = winPtr->verticalAnchor;
+        cuePtr->anchorHorzPercent = winPtr->horizontalAnchor;
+    } else {
+        cuePtr->anchorVertPercent = (winPtr->verticalAnchor * DTVCC_WINDOW_RELATIVE_MAX_ANCHOR) / DTVCC_WINDOW_ABSOLUTE_MAX_VERTICAL;
+        cuePtr->anchorHorzPercent = (winPtr->horizontalAnchor * DTVCC_WINDOW_RELATIVE_MAX_ANCHOR) / DTVCC_WINDOW_ABSOLUTE_MAX_HORIZONTAL;
+    }
+    if( cuePtr->anchorVertPercent > DTVCC_WINDOW_RELATIVE_MAX_ANCHOR ) cuePtr->anchorVertPercent = DTVCC_WINDOW_RELATIVE_MAX_ANCHOR;
+    if( cuePtr->anchorHorzPercent > DTVCC_WINDOW_RELATIVE_MAX_ANCHOR ) cuePtr->anchorHorzPercent = DTVCC_WINDOW_RELATIVE_MAX_ANCHOR;
+
+    for( int row = 0; row < winPtr->numRows; row++ ) {
+        int firstCol = 0;
+        int lastCol = DTVCC_WINDOW_MAX_COLUMNS - 1;
+        while( (firstCol <= lastCol) && (isCellBlank(winPtr->text[row][firstCol]) == TRUE) ) firstCol++;
+        while( (lastCol >= firstCol) && (isCellBlank(winPtr->text[row][lastCol]) == TRUE) ) lastCol--;
+        if( firstCol > lastCol ) continue;
+
+        CaptionCueRow* rowPtr = &cuePtr->rows[cuePtr->numRows];
+        rowPtr->rowNumber = row + 1;
+        rowPtr->column = firstCol;
+        rowPtr->text[0] = '\0';
+        for( int col = firstCol; col <= lastCol; col++ ) {
+            const char* cellPtr = winPtr->text[row][col];
+            strncat(rowPtr->text, (cellPtr == NULL) ? " " : cellPtr, CAPTION_CUE_MAX_ROW_TEXT - strlen(rowPtr->text) - 1);
+        }
+        cuePtr->numRows++;
+    }
+
+    if( cuePtr->numRows == 0 ) {
+        FreeBuffer(outBuffer);
+        return PIPELINE_SUCCESS;
+    }
+
+    outBuffer->numElements = 1;
+    outBuffer->captionTime = *captionTimePtr;
+    return PassToSinks(rootCtxPtr, outBuffer, &rootCtxPtr->dtvccWindowCtxPtr->sinks);
+}  // closeCue()
@@ -30,19 +30,53 @@
 /*--                      Private Member Variables                          --*/
 /*----------------------------------------------------------------------------*/
 
+static Line21Code line21CodeTable[LINE21_CODE_TABLE_SIZE];
+static boolean isCodeTableBuilt = FALSE;
+
+static const uint8 pacRowNumber[PAC_NUM_ROW_CODES] = {
+    [PAC_ROW_1] = 1,   [PAC_ROW_2] = 2,   [PAC_ROW_3] = 3,   [PAC_ROW_4] = 4,
+    [PAC_ROW_5] = 5,   [PAC_ROW_6] = 6,   [PAC_ROW_7] = 7,   [PAC_ROW_8] = 8,
+    [PAC_ROW_9] = 9,   [PAC_ROW_10] = 10, [PAC_ROW_11] = 11, [PAC_ROW_12] = 12,
+    [PAC_ROW_13] = 13, [PAC_ROW_14] = 14, [PAC_ROW_15] = 15, [PAC_ROW_UNKNOWN] = 0
+};
+
+// Bytes of the code union used by each type of code, of which the first are carried in the
+// header of a Line21Event and the rest follow it
+static const uint8 eventCodeSize[LINE21_MID_ROW_CONTROL_CODE + 1] = {
+    [LINE21_CODE_TYPE_UNKNOWN] = 0,
+    [LINE21_NULL_DATA] = 0,
+    [LINE21_BASIC_CHARS] = sizeof(BasicCharsCodeType),
+    [LINE21_SPECIAL_CHAR] = sizeof(SpecialCharCodeType),
+    [LINE21_EXTENDED_CHAR] = sizeof(ExtendedCharCodeType),
+    [LINE21_GLOBAL_CONTROL_CODE] = sizeof(GlobalControlCodeType),
+    [LINE21_PREAMBLE_ACCESS_CODE] = sizeof(PreambleAccessCodeType),
+    [LINE21_TAB_CONTROL_CODE] = sizeof(TabControlCodeType),
+    [LINE21_MID_ROW_CONTROL_CODE] = sizeof(MidRowControlCodeType)
+};
+
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static uint8 decodeFrame( Context*, Buffer*, BufferFrame*, uint16*, Line21Code* );
+static void decodePair( Line21DecodeCtx*, uint8, uint8, uint8, uint16, CaptionTime*, Buffer*, Line21Code* );
+static uint16 numPlaneConstructs( CcDataPlane*, uint16, uint16 );
+static void buildCodeTable( void );
 static boolean decodeCaptionData( Line21DecodeCtx*, uint8, uint8, Line21Code*, CaptionTime* );
-static boolean decodeGlobalCmd( Line21DecodeCtx*, uint8, uint8, Line21Code*, CaptionTime* );
-static boolean decodeMidRowCode( Line21DecodeCtx*, uint8, uint8, Line21Code* );
-static boolean decodeTabCtrl( Line21DecodeCtx*, uint8, uint8, Line21Code* );
-static boolean decodePAC( Line21DecodeCtx*, uint8, uint8, Line21Code* );
-static boolean decodeBasicChars( Line21DecodeCtx*, uint8, uint8, Line21Code*, CaptionTime* );
-static boolean decodeSpecialChar( Line21DecodeCtx*, uint8, uint8, Line21Code*, CaptionTime* );
-static boolean decodeExtendedChar( Line21DecodeCtx*, uint8, uint8, Line21Code*, CaptionTime* );
+static void resolveChannel( Line21DecodeCtx*, Line21Code* );
+static boolean isFieldSelected( Line21DecodeCtx*, uint8 );
+static boolean isChannelSelected( Line21DecodeCtx*, uint8 );
+static void trackFirstText( Line21DecodeCtx*, Line21Code*, CaptionTime* );
+static void trackGlobalCmd( Line21DecodeCtx*, Line21Code*, CaptionTime* );
+static boolean decodeGlobalCmd( uint8, uint8, Line21Code* );
+static boolean decodeMidRowCode( uint8, uint8, Line21Code* );
+static boolean decodeTabCtrl( uint8, uint8, Line21Code* );
+static boolean decodePAC( uint8, uint8, Line21Code* );
+static boolean decodeBasicChars( uint8, uint8, Line21Code* );
+static boolean decodeSpecialChar( uint8, uint8, Line21Code* );
+static boolean decodeExtendedChar( uint8, uint8, Line21Code* );
 static uint8 decodeColumn( uint8 );
+static uint8 eventPayloadSize( uint8 );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -55,6 +89,7 @@ static uint8 decodeColumn( uint8 );
  | INPUT PARAMETERS:
  |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
  |    processOnly - Decode only (to get metrics) = TRUE; Decode and Output = FALSE
+ |    decodeWhichChannels - Bit per Channel to decode, or DECODE_ALL_CHANNELS.
  |
  | RETURN VALUES:
  |    LinkInfo -  Information about this element of the pipeline, such that it can
@@ -64,14 +99,20 @@ static uint8 decodeColumn( uint8 );
  | DESCRIPTION:
  |    This initializes this element of the pipeline.
  -------------------------------------------------------------------------------*/
-LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint8 decodeWhichChannels ) {
     ASSERT(rootCtxPtr);
     ASSERT(!rootCtxPtr->line21DecodeCtxPtr);
 
+    if( isCodeTableBuilt == FALSE ) {
+        buildCodeTable();
+    }
+
     rootCtxPtr->line21DecodeCtxPtr = malloc(sizeof(Line21DecodeCtx));
     Line21DecodeCtx* ctxPtr = rootCtxPtr->line21DecodeCtxPtr;
 
     ctxPtr->processOnly = processOnly;
+    ctxPtr->annotate = ((rootCtxPtr->config.artifacts == TRUE) && (rootCtxPtr->config.outputs & PIPELINE_OUTPUT_CCD)) ? TRUE : FALSE;
+    ctxPtr->decodeWhichChannels = decodeWhichChannels;
     ctxPtr->foundText = NO_TEXT_FOUND;
     ctxPtr->currentChannel[CEA608E_LINE21_FIELD_1_CC] = LINE21_CHANNEL_UNKONWN;
     ctxPtr->currentChannel[CEA608E_LINE21_FIELD_2_CC] = LINE21_CHANNEL_UNKONWN;
@@ -140,7 +181,7 @@ boolean Line21DecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
  |
  | DESCRIPTION:
  |    This method processes an incoming buffer, decoding  the byte pair from
- |    field 1 or field 2 of the Line 21 Data for CEA-608.
+ |    field 1 or field 2 of the Line 21 Data for CEA-608, a frame at a time.
  -------------------------------------------------------------------------------*/
 uint8 Line21DecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(inBuffer);
@@ -149,79 +190,70 @@ uint8 Line21DecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->line21DecodeCtxPtr);
     Line21DecodeCtx* ctxPtr = ((Context*)rootCtxPtr)->line21DecodeCtxPtr;
-    char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
-    uint8 numOutputElements = 0;
-
-    for( int loop = 0; loop < inBuffer->numElements; loop = loop + 3 ) {
-        if( (((inBuffer->dataPtr[loop+1] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA) ||
-             ((inBuffer->dataPtr[loop+2] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA)) &&
-            (((inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_1_CC) ||
-             ((inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_2_CC)) &&
-            (inBuffer->dataPtr[loop] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET ) {
-            numOutputElements++;
-        }
-    }
+    CcDataTriage triage;
 
-    if( numOutputElements == 0) {
+    if( inBuffer->bufferType == BUFFER_TYPE_FILL ) {
         FreeBuffer(inBuffer);
         return PIPELINE_SUCCESS;
     }
 
-    Buffer* outBuffer = NewBuffer(BUFFER_TYPE_LINE_21, numOutputElements);
-    Line21Code* codePtr = (Line21Code*)outBuffer->dataPtr;
-    outBuffer->captionTime = inBuffer->captionTime;
-    outBuffer->numElements = 0;
-
-    for( int loop = 0; loop < inBuffer->numElements; loop = loop + 3 ) {
-        if( (((inBuffer->dataPtr[loop+1] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA) ||
-             ((inBuffer->dataPtr[loop+2] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA)) &&
-            (((inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_1_CC) ||
-             ((inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_2_CC)) &&
-            (inBuffer->dataPtr[loop] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET ) {
-
-            if( (inBuffer->dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->fieldNum = CEA608E_LINE21_FIELD_1_CC;
-            } else {
-                codePtr->fieldNum = CEA608E_LINE21_FIELD_2_CC;
-            }
-
-            codePtr->codeType = LINE21_CODE_TYPE_UNKNOWN;
+    // Constructs on a field which carries none of the selected channels are dropped
+    // here, without being decoded at all, unless the CC Data Output shows each of them.
+    boolean decodeField1 = (ctxPtr->annotate == TRUE) || isFieldSelected(ctxPtr, LINE21_FIELD_1_CHANNELS);
+    boolean decodeField2 = (ctxPtr->annotate == TRUE) || isFieldSelected(ctxPtr, LINE21_FIELD_2_CHANNELS);
+    if( inBuffer->planesPtr != NULL ) {
+        if( ((decodeField1 ? inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_1].numConstructs : 0) +
+             (decodeField2 ? inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_2].numConstructs : 0)) == 0 ) {
+            FreeBuffer(inBuffer);
+            return PIPELINE_SUCCESS;
+        }
+    } else {
+        triageCcData(inBuffer->dataPtr, inBuffer->numElements, &triage);
+        if( ((decodeField1 ? triage.field1Mask : 0) | (decodeField2 ? triage.field2Mask : 0)) == 0 ) {
+            FreeBuffer(inBuffer);
+            return PIPELINE_SUCCESS;
+        }
+    }
 
-            boolean wasDecoded = decodeCaptionData(ctxPtr, inBuffer->dataPtr[loop+1], inBuffer->dataPtr[loop+2], codePtr, &inBuffer->captionTime);
+    // Leave the decode of each construct on the incoming buffer as well, so that the
+    // sinks after this one (e.g. the CC Data Output) do not need to decode it again.
+    Line21Code* annotationPtr = NULL;
+    if( ctxPtr->annotate == TRUE ) {
+        ASSERT(inBuffer->annotationPtr == NULL);
+        // Unlike the buffers passed down the pipeline, this is looked up by construct, so
+        // it holds a whole Line21Code for every construct rather than packed codes.
+        uint16 numCodes = LINE21_MAX_CODES_PER_BUFFER(inBuffer->numElements);
+        inBuffer->annotationPtr = NewBuffer(BUFFER_TYPE_BYTES, numCodes * sizeof(Line21Code));
+        inBuffer->annotationPtr->numElements = inBuffer->annotationPtr->maxNumElements;
+        annotationPtr = (Line21Code*)inBuffer->annotationPtr->dataPtr;
+        for( int loop = 0; loop < numCodes; loop++ ) {
+            annotationPtr[loop].codeType = LINE21_CODE_TYPE_UNKNOWN;
+        }
+    }
 
-            if( wasDecoded == TRUE ) {
-                outBuffer->numElements = outBuffer->numElements + 1;
-                codePtr++;
-            } else {
-                encodeTimeCode(&inBuffer->captionTime, captionTimeStr);
-                LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Unable to decode Line 21 Data Pair at %s (%d): 0x%02X 0x%02X 0x%02X",
-                    captionTimeStr, loop/3, inBuffer->dataPtr[loop], inBuffer->dataPtr[loop+1], inBuffer->dataPtr[loop+2]);
-            }
+    uint8 retval = PIPELINE_SUCCESS;
+    boolean wasFirstTextFound = FALSE;
+    uint16 planeIndex[CC_DATA_PLANE_FIELD_2 + 1] = { 0, 0 };
+    BufferFrame frame;
+    StartBufferFrames(inBuffer, &frame);
+    while( NextBufferFrame(inBuffer, &frame) == TRUE ) {
+        uint8 frameRetval = decodeFrame(rootCtxPtr, inBuffer, &frame, planeIndex,
+                                        (annotationPtr != NULL) ? &annotationPtr[frame.firstElement/3] : NULL);
+        if( frameRetval == FIRST_TEXT_FOUND ) {
+            wasFirstTextFound = TRUE;
+        } else if( frameRetval != PIPELINE_SUCCESS ) {
+            retval = frameRetval;
         }
     }
 
     FreeBuffer(inBuffer);
-    if( ((Context*)rootCtxPtr)->line21DecodeCtxPtr->processOnly == TRUE ) {
-        FreeBuffer(outBuffer);
-        if( ctxPtr->foundText == TEXT_FOUND ) {
-            ctxPtr->foundText = TEXT_REPORTED;
-            ((Context*)rootCtxPtr)->stats.captionText608Found = TRUE;
-            return FIRST_TEXT_FOUND;
-        }
-        return PIPELINE_SUCCESS;
-    } else {
-        if( ctxPtr->foundText == TEXT_FOUND ) {
-            ctxPtr->foundText = TEXT_REPORTED;
-            ((Context*)rootCtxPtr)->stats.captionText608Found = TRUE;
-            uint8 retval = PassToSinks(rootCtxPtr, outBuffer, &ctxPtr->sinks);
-            if( retval != PIPELINE_SUCCESS ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "First Text Found eclipsed non Success Response: %d", retval);
-            }
-            return FIRST_TEXT_FOUND;
-        } else {
-            return PassToSinks(rootCtxPtr, outBuffer, &ctxPtr->sinks);
+    if( wasFirstTextFound == TRUE ) {
+        if( retval != PIPELINE_SUCCESS ) {
+            LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "First Text Found eclipsed non Success Response: %d", retval);
         }
+        return FIRST_TEXT_FOUND;
     }
+    return retval;
 }  // Line21DecodeProcNextBuffer()
 
 /*------------------------------------------------------------------------------
@@ -296,206 +328,537 @@ uint8 Line21DecodeShutdown( void* rootCtxPtr ) {
  |    terminated reference to the string in memory
  -------------------------------------------------------------------------------*/
 uint8 Line21PacDecodeRow( uint8 ccData1, uint8 ccData2 ) {
-    uint8 rowCode = ((ccData1 & PAC_ROW_POS_MASK) << 1) | ((ccData2 & PAC_WHICH_ROW_MASK) >> 5);
-    uint8 retval = 0;
+    uint8 rowCode = PAC_ROW_CODE(ccData1, ccData2);
+    uint8 retval = pacRowNumber[rowCode];
 
-    switch(rowCode) {
-        case PAC_ROW_1:
-            retval = 1;
-            break;
-        case PAC_ROW_2:
-            retval = 2;
-            break;
-        case PAC_ROW_3:
-            retval = 3;
-            break;
-        case PAC_ROW_4:
-            retval = 4;
-            break;
-        case PAC_ROW_5:
-            retval = 5;
-            break;
-        case PAC_ROW_6:
-            retval = 6;
-            break;
-        case PAC_ROW_7:
-            retval = 7;
-            break;
-        case PAC_ROW_8:
-            retval = 8;
-            break;
-        case PAC_ROW_9:
-            retval = 9;
-            break;
-        case PAC_ROW_10:
-            retval = 10;
-            break;
-        case PAC_ROW_11:
-            retval = 11;
-            break;
-        case PAC_ROW_12:
-            retval = 12;
-            break;
-        case PAC_ROW_13:
-            retval = 13;
-            break;
-        case PAC_ROW_14:
-            retval = 14;
-            break;
-        case PAC_ROW_15:
-            retval = 15;
-            break;
-        default:
-            LOG( DEBUG_LEVEL_ERROR, DBG_608_OUT, "Invalid PAC Row, Using 0: 0x%02X 0x%02X %d", ccData1, ccData2, rowCode );
-            break;
+    if( retval == 0 ) {
+        LOG( DEBUG_LEVEL_ERROR, DBG_608_OUT, "Invalid PAC Row, Using 0: 0x%02X 0x%02X %d", ccData1, ccData2, rowCode );
     }
 
     return retval;
 } // Line21PacDecodeRow()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21DecodeAddEvent()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - BUFFER_TYPE_LINE_21 buffer to add the code to.
+ |    codePtr - The decoded code to add.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if the code was added, FALSE if the buffer is full.
+ |
+ | DESCRIPTION:
+ |    This method packs a decoded Line 21 code onto the end of a buffer, as a
+ |    Line21Event header followed by whatever of the code did not fit in it.
+ -------------------------------------------------------------------------------*/
+boolean Line21DecodeAddEvent( Buffer* buffPtr, Line21Code* codePtr ) {
+    ASSERT(buffPtr);
+    ASSERT(codePtr);
+    ASSERT(buffPtr->bufferType == BUFFER_TYPE_LINE_21);
+    ASSERT((codePtr->fieldNum <= 0x0F) && (codePtr->channelNum <= 0x0F));
+    uint8 payloadSize = eventPayloadSize(codePtr->codeType);
+
+    if( (buffPtr->numElements + sizeof(Line21Event) + payloadSize) > buffPtr->maxNumElements ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "No room in Buffer for Line 21 Code: %d + %d > %d",
+            buffPtr->numElements, (int)(sizeof(Line21Event) + payloadSize), buffPtr->maxNumElements);
+        return FALSE;
+    }
+
+    uint8* unionPtr = (uint8*)&codePtr->code;
+    Line21Event* eventPtr = (Line21Event*)&buffPtr->dataPtr[buffPtr->numElements];
+    eventPtr->codeType = codePtr->codeType;
+    eventPtr->fieldChannel = (uint8)((codePtr->fieldNum << 4) | codePtr->channelNum);
+    memcpy(eventPtr->code, unionPtr, LINE21_EVENT_INLINE_CODE_SIZE);
+    memcpy(&buffPtr->dataPtr[buffPtr->numElements + sizeof(Line21Event)], &unionPtr[LINE21_EVENT_INLINE_CODE_SIZE], payloadSize);
+    buffPtr->numElements = buffPtr->numElements + sizeof(Line21Event) + payloadSize;
+    return TRUE;
+}  // Line21DecodeAddEvent()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21DecodeNextEvent()
+ |
+ | INPUT PARAMETERS:
+ |    buffPtr - BUFFER_TYPE_LINE_21 buffer to read the code from.
+ |    offsetPtr - Where the next code starts in the buffer, which should be zero
+ |                for the first code, and is moved past the code.
+ |    codePtr - Filled in with the code which was read.
+ |
+ | RETURN VALUES:
+ |    boolean - TRUE if a code was read, FALSE at the end of the buffer.
+ |
+ | DESCRIPTION:
+ |    This method unpacks the next code of a buffer, back into the Line21Code
+ |    that the sinks and the External Adaptor work with.
+ -------------------------------------------------------------------------------*/
+boolean Line21DecodeNextEvent( Buffer* buffPtr, uint16* offsetPtr, Line21Code* codePtr ) {
+    ASSERT(buffPtr);
+    ASSERT(offsetPtr);
+    ASSERT(codePtr);
+
+    if( (*offsetPtr + sizeof(Line21Event)) > buffPtr->numElements ) {
+        return FALSE;
+    }
+
+    Line21Event* eventPtr = (Line21Event*)&buffPtr->dataPtr[*offsetPtr];
+    uint8 payloadSize = eventPayloadSize(eventPtr->codeType);
+    ASSERT((*offsetPtr + sizeof(Line21Event) + payloadSize) <= buffPtr->numElements);
+
+    memset(codePtr, 0, sizeof(Line21Code));
+    uint8* unionPtr = (uint8*)&codePtr->code;
+    codePtr->codeType = eventPtr->codeType;
+    codePtr->fieldNum = eventPtr->fieldChannel >> 4;
+    codePtr->channelNum = eventPtr->fieldChannel & 0x0F;
+    memcpy(unionPtr, eventPtr->code, LINE21_EVENT_INLINE_CODE_SIZE);
+    memcpy(&unionPtr[LINE21_EVENT_INLINE_CODE_SIZE], &buffPtr->dataPtr[*offsetPtr + sizeof(Line21Event)], payloadSize);
+    *offsetPtr = *offsetPtr + sizeof(Line21Event) + payloadSize;
+    return TRUE;
+}  // Line21DecodeNextEvent()
+
 /*----------------------------------------------------------------------------*/
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodeCaptionData()
+ |    decodeFrame()
  |
  | DESCRIPTION:
- |    This function decodes the Line 21 Caption Data by calling lower funcitons.
+ |    This function decodes the Line 21 byte pairs in the cc_data of a single
+ |    frame, and passes the codes of the selected channels down the pipeline in a
+ |    buffer of their own. When the source split the buffer into planes, the pairs
+ |    are read from the planes of the selected fields, from where the previous
+ |    frame left off, rather than picked out of the cc_data of the frame.
  -------------------------------------------------------------------------------*/
-static boolean decodeCaptionData( Line21DecodeCtx* ctxPtr, uint8 firstByte, uint8 secondByte, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
-    boolean wasDecoded;
+static uint8 decodeFrame( Context* rootCtxPtr, Buffer* inBuffer, BufferFrame* framePtr, uint16* planeIndexPtr, Line21Code* annotationPtr ) {
+    Line21DecodeCtx* ctxPtr = rootCtxPtr->line21DecodeCtxPtr;
+    uint8* dataPtr = &inBuffer->dataPtr[framePtr->firstElement];
+    uint16 numElements = framePtr->numElements;
+    CaptionTime* captionTimePtr = &framePtr->captionTime;
+    uint16 numCaptionPairs = 0;
+    uint16 numField1 = 0;
+    uint16 numField2 = 0;
+    CcDataTriage triage;
 
-    firstByte = firstByte & LINE_21_PARITY_MASK;
-    secondByte = secondByte & LINE_21_PARITY_MASK;
+    // The frames of a buffer of several which carry nothing to decode are passed over
+    boolean decodeField1 = (ctxPtr->annotate == TRUE) || isFieldSelected(ctxPtr, LINE21_FIELD_1_CHANNELS);
+    boolean decodeField2 = (ctxPtr->annotate == TRUE) || isFieldSelected(ctxPtr, LINE21_FIELD_2_CHANNELS);
+    if( inBuffer->planesPtr != NULL ) {
+        uint16 endConstruct = (framePtr->firstElement + numElements) / 3;
+        numField1 = numPlaneConstructs(&inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_1], planeIndexPtr[CC_DATA_PLANE_FIELD_1], endConstruct);
+        numField2 = numPlaneConstructs(&inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_2], planeIndexPtr[CC_DATA_PLANE_FIELD_2], endConstruct);
+        if( decodeField1 == FALSE ) {
+            planeIndexPtr[CC_DATA_PLANE_FIELD_1] = planeIndexPtr[CC_DATA_PLANE_FIELD_1] + numField1;
+            numField1 = 0;
+        }
+        if( decodeField2 == FALSE ) {
+            planeIndexPtr[CC_DATA_PLANE_FIELD_2] = planeIndexPtr[CC_DATA_PLANE_FIELD_2] + numField2;
+            numField2 = 0;
+        }
+        if( (numField1 + numField2) == 0 ) {
+            return PIPELINE_SUCCESS;
+        }
+    } else {
+        triageCcData(dataPtr, numElements, &triage);
+        if( ((decodeField1 ? triage.field1Mask : 0) | (decodeField2 ? triage.field2Mask : 0)) == 0 ) {
+            return PIPELINE_SUCCESS;
+        }
+    }
 
-    wasDecoded = decodeGlobalCmd(ctxPtr, firstByte, secondByte, codePtr, captionTimePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodeMidRowCode(ctxPtr, firstByte, secondByte, codePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodeTabCtrl(ctxPtr, firstByte, secondByte, codePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodePAC(ctxPtr, firstByte, secondByte, codePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodeSpecialChar(ctxPtr, firstByte, secondByte, codePtr, captionTimePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodeExtendedChar(ctxPtr, firstByte, secondByte, codePtr, captionTimePtr);
-    if (wasDecoded == FALSE) wasDecoded = decodeBasicChars(ctxPtr, firstByte, secondByte, codePtr, captionTimePtr);
+    // Every cc_data triplet yields at most one Line 21 code, so size the output for
+    // the worst case and decode in a single pass rather than counting first.
+    Buffer* outBuffer = NewBuffer(BUFFER_TYPE_LINE_21, LINE21_MAX_EVENT_BYTES(numElements));
+    outBuffer->captionTime = *captionTimePtr;
+    outBuffer->numElements = 0;
 
-    return wasDecoded;
-}  // decodeCaptionData()
+    if( inBuffer->planesPtr != NULL ) {
+        // The pairs of the two fields are merged back into the order they were sent in
+        CcDataPlane* field1Ptr = &inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_1];
+        CcDataPlane* field2Ptr = &inBuffer->planesPtr->plane[CC_DATA_PLANE_FIELD_2];
+        uint16 endField1 = planeIndexPtr[CC_DATA_PLANE_FIELD_1] + numField1;
+        uint16 endField2 = planeIndexPtr[CC_DATA_PLANE_FIELD_2] + numField2;
+        uint16 firstConstruct = framePtr->firstElement / 3;
+
+        while( (planeIndexPtr[CC_DATA_PLANE_FIELD_1] < endField1) || (planeIndexPtr[CC_DATA_PLANE_FIELD_2] < endField2) ) {
+            uint8 planeNum = CC_DATA_PLANE_FIELD_1;
+            if( (planeIndexPtr[CC_DATA_PLANE_FIELD_1] == endField1) ||
+                ((planeIndexPtr[CC_DATA_PLANE_FIELD_2] < endField2) &&
+                 (field2Ptr->indexPtr[planeIndexPtr[CC_DATA_PLANE_FIELD_2]] < field1Ptr->indexPtr[planeIndexPtr[CC_DATA_PLANE_FIELD_1]])) ) {
+                planeNum = CC_DATA_PLANE_FIELD_2;
+            }
+            CcDataPlane* planePtr = &inBuffer->planesPtr->plane[planeNum];
+            uint16 index = planeIndexPtr[planeNum];
+            planeIndexPtr[planeNum]++;
+
+            numCaptionPairs++;
+            decodePair(ctxPtr, planePtr->headerPtr[index], planePtr->data1Ptr[index], planePtr->data2Ptr[index],
+                       planePtr->indexPtr[index] - firstConstruct, captionTimePtr, outBuffer, annotationPtr);
+        }
+    } else {
+        for( int loop = 0; loop < numElements; loop = loop + 3 ) {
+            if( (((dataPtr[loop+1] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA) ||
+                 ((dataPtr[loop+2] & LINE_21_PARITY_MASK) != NULL_CAPTION_DATA)) &&
+                (((dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_1_CC) ||
+                 ((dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_2_CC)) &&
+                (dataPtr[loop] & CC_CONSTR_CC_VALID_FLAG_MASK) == CC_CONSTR_CC_VALID_FLAG_SET ) {
+
+                if( (dataPtr[loop] & CC_CONSTR_CC_TYPE_MASK) == CEA608E_LINE21_FIELD_1_CC ) {
+                    if( decodeField1 == FALSE ) continue;
+                } else {
+                    if( decodeField2 == FALSE ) continue;
+                }
+
+                numCaptionPairs++;
+                decodePair(ctxPtr, dataPtr[loop], dataPtr[loop+1], dataPtr[loop+2], loop/3, captionTimePtr, outBuffer, annotationPtr);
+            }
+        }
+    }
+
+    if( numCaptionPairs == 0 ) {
+        FreeBuffer(outBuffer);
+        return PIPELINE_SUCCESS;
+    }
+
+    if( ctxPtr->processOnly == TRUE ) {
+        FreeBuffer(outBuffer);
+        if( ctxPtr->foundText == TEXT_FOUND ) {
+            ctxPtr->foundText = TEXT_REPORTED;
+            rootCtxPtr->stats.captionText608Found = TRUE;
+            return FIRST_TEXT_FOUND;
+        }
+        return PIPELINE_SUCCESS;
+    } else {
+        if( ctxPtr->foundText == TEXT_FOUND ) {
+            ctxPtr->foundText = TEXT_REPORTED;
+            rootCtxPtr->stats.captionText608Found = TRUE;
+            uint8 retval = PassToSinks(rootCtxPtr, outBuffer, &ctxPtr->sinks);
+            if( retval != PIPELINE_SUCCESS ) {
+                LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "First Text Found eclipsed non Success Response: %d", retval);
+            }
+            return FIRST_TEXT_FOUND;
+        } else {
+            return PassToSinks(rootCtxPtr, outBuffer, &ctxPtr->sinks);
+        }
+    }
+}  // decodeFrame()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    decodeGlobalCmd()
+ |    decodePair()
  |
  | DESCRIPTION:
- |    This function decodes the Line 21 Global Command per the CEA-608 Spec.
+ |    This function decodes a single Line 21 byte pair onto the end of the buffer
+ |    of codes for its frame, unless it belongs to a channel or field which was
+ |    not selected. The code is also left in the annotation, when there is one,
+ |    whichever channel it belongs to.
  -------------------------------------------------------------------------------*/
-static boolean decodeGlobalCmd( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
+static void decodePair( Line21DecodeCtx* ctxPtr, uint8 header, uint8 data1, uint8 data2, uint16 constructNum,
+                        CaptionTime* captionTimePtr, Buffer* outBuffer, Line21Code* annotationPtr ) {
     char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
-    
-    if( (ccData1 != GLOBAL_CTRL_CODE_CC1) && (ccData1 != GLOBAL_CTRL_CODE_CC2) &&
-       (ccData1 != GLOBAL_CTRL_CODE_CC3) && (ccData1 != GLOBAL_CTRL_CODE_CC4) ) {
-        return FALSE;
+    Line21Code code;
+    Line21Code* codePtr = &code;
+
+    codePtr->fieldNum = header & CC_CONSTR_CC_TYPE_MASK;
+    codePtr->codeType = LINE21_CODE_TYPE_UNKNOWN;
+
+    if( decodeCaptionData(ctxPtr, data1, data2, codePtr, captionTimePtr) == TRUE ) {
+        if( annotationPtr != NULL ) {
+            annotationPtr[constructNum] = *codePtr;
+        }
+        // The control codes of the other channel on a field are still decoded, to
+        // follow which channel the following characters belong to.
+        if( isChannelSelected(ctxPtr, codePtr->channelNum) == FALSE ) return;
+        if( isFieldSelected(ctxPtr, (codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC) ? LINE21_FIELD_1_CHANNELS : LINE21_FIELD_2_CHANNELS) == FALSE ) return;
+        Line21DecodeAddEvent(outBuffer, codePtr);
+    } else {
+        encodeTimeCode(captionTimePtr, captionTimeStr);
+        LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Unable to decode Line 21 Data Pair at %s (%d): 0x%02X 0x%02X 0x%02X",
+            captionTimeStr, constructNum, header, data1, data2);
     }
-    
-    if( (ccData2 & GLOBAL_CTRL_CMD_MASK) != ccData2 ) {
-        return FALSE;
+}  // decodePair()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    numPlaneConstructs()
+ |
+ | DESCRIPTION:
+ |    This function counts the constructs of a plane, from where the decode is up
+ |    to, which come before the given construct of the buffer.
+ -------------------------------------------------------------------------------*/
+static uint16 numPlaneConstructs( CcDataPlane* planePtr, uint16 planeIndex, uint16 endConstruct ) {
+    uint16 numConstructs = 0;
+    while( ((planeIndex + numConstructs) < planePtr->numConstructs) &&
+           (planePtr->indexPtr[planeIndex + numConstructs] < endConstruct) ) {
+        numConstructs++;
     }
-    
+    return numConstructs;
+}  // numPlaneConstructs()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    buildCodeTable()
+ |
+ | DESCRIPTION:
+ |    This function precomputes the stateless portion of the decode for every
+ |    possible parity stripped byte pair, so that each pair in the stream only
+ |    costs a single table lookup. The classifiers are applied in the same order
+ |    that the original range checks were, so the table reproduces them exactly.
+ -------------------------------------------------------------------------------*/
+static void buildCodeTable( void ) {
+    for( uint8 ccData1 = 0; ccData1 <= LINE_21_PARITY_MASK; ccData1++ ) {
+        for( uint8 ccData2 = 0; ccData2 <= LINE_21_PARITY_MASK; ccData2++ ) {
+            Line21Code* codePtr = &line21CodeTable[LINE21_CODE_TABLE_INDEX(ccData1, ccData2)];
+            memset(codePtr, 0, sizeof(Line21Code));
+            codePtr->codeType = LINE21_CODE_TYPE_UNKNOWN;
+
+            boolean wasDecoded = decodeGlobalCmd(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) wasDecoded = decodeMidRowCode(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) wasDecoded = decodeTabCtrl(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) wasDecoded = decodePAC(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) wasDecoded = decodeSpecialChar(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) wasDecoded = decodeExtendedChar(ccData1, ccData2, codePtr);
+            if (wasDecoded == FALSE) decodeBasicChars(ccData1, ccData2, codePtr);
+        }
+    }
+    isCodeTableBuilt = TRUE;
+}  // buildCodeTable()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeCaptionData()
+ |
+ | DESCRIPTION:
+ |    This function decodes the Line 21 Caption Data by looking up the byte pair
+ |    in the precomputed code table and then applying the stateful portion of
+ |    the decode (channel tracking, captioning style and first text found).
+ -------------------------------------------------------------------------------*/
+static boolean decodeCaptionData( Line21DecodeCtx* ctxPtr, uint8 firstByte, uint8 secondByte, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
     ASSERT(codePtr);
-    codePtr->codeType = LINE21_GLOBAL_CONTROL_CODE;
-    
-    switch( ccData1 ) {
-        case GLOBAL_CTRL_CODE_CC1:
-            codePtr->channelNum = LINE21_CHANNEL_1;
-            ctxPtr->dataFound[LINE21_CHANNEL_1] = TRUE;
-            codePtr->code.globalControl.chan = LINE21_CHANNEL_1;
-            ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            break;
-        case GLOBAL_CTRL_CODE_CC2:
-            codePtr->channelNum = LINE21_CHANNEL_2;
-            ctxPtr->dataFound[LINE21_CHANNEL_2] = TRUE;
-            codePtr->code.globalControl.chan = LINE21_CHANNEL_2;
-            ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            break;
-        case GLOBAL_CTRL_CODE_CC3:
-            codePtr->channelNum = LINE21_CHANNEL_3;
-            ctxPtr->dataFound[LINE21_CHANNEL_3] = TRUE;
-            codePtr->code.globalControl.chan = LINE21_CHANNEL_3;
-            ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            break;
-        case GLOBAL_CTRL_CODE_CC4:
-            codePtr->channelNum = LINE21_CHANNEL_4;
-            ctxPtr->dataFound[LINE21_CHANNEL_4] = TRUE;
-            codePtr->code.globalControl.chan = LINE21_CHANNEL_4;
-            ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            break;
+    uint8 fieldNum = codePtr->fieldNum;
+
+    *codePtr = line21CodeTable[LINE21_CODE_TABLE_INDEX(firstByte, secondByte)];
+    codePtr->fieldNum = fieldNum;
+
+    switch( codePtr->codeType ) {
+        case LINE21_GLOBAL_CONTROL_CODE:
+            trackGlobalCmd(ctxPtr, codePtr, captionTimePtr);
+            return TRUE;
+        case LINE21_PREAMBLE_ACCESS_CODE:
+            if( codePtr->code.pac.rowNumber == 0 ) {
+                Line21PacDecodeRow((firstByte & LINE_21_PARITY_MASK), (secondByte & LINE_21_PARITY_MASK));
+            }
+            resolveChannel(ctxPtr, codePtr);
+            return TRUE;
+        case LINE21_MID_ROW_CONTROL_CODE:
+        case LINE21_TAB_CONTROL_CODE:
+            resolveChannel(ctxPtr, codePtr);
+            return TRUE;
+        case LINE21_SPECIAL_CHAR:
+        case LINE21_EXTENDED_CHAR:
+            resolveChannel(ctxPtr, codePtr);
+            trackFirstText(ctxPtr, codePtr, captionTimePtr);
+            return TRUE;
         default:
-            codePtr->code.globalControl.chan = LINE21_CHANNEL_UNKONWN;
-            LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
             break;
     }
 
+    if( (ctxPtr->currentChannel[codePtr->fieldNum] < 1) || (ctxPtr->currentChannel[codePtr->fieldNum] > 4) ) {
+        LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Dropping Chars for unknown channel : %d - 0x%02X 0x%02X",
+            ctxPtr->currentChannel[codePtr->fieldNum], (firstByte & LINE_21_PARITY_MASK), (secondByte & LINE_21_PARITY_MASK));
+        return FALSE;
+    }
+
+    if( codePtr->codeType != LINE21_BASIC_CHARS ) {
+        return FALSE;
+    }
+
+    codePtr->channelNum = ctxPtr->currentChannel[codePtr->fieldNum];
+    trackFirstText(ctxPtr, codePtr, captionTimePtr);
+    return TRUE;
+}  // decodeCaptionData()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    resolveChannel()
+ |
+ | DESCRIPTION:
+ |    The code table holds the Field 1 channel for codes which are only tied to
+ |    a channel pair (e.g. CC1/CC3). This function moves the code to the correct
+ |    channel for the field it arrived on and makes it the current channel.
+ -------------------------------------------------------------------------------*/
+static void resolveChannel( Line21DecodeCtx* ctxPtr, Line21Code* codePtr ) {
+    if( codePtr->fieldNum == CEA608E_LINE21_FIELD_2_CC ) {
+        codePtr->channelNum = codePtr->channelNum + (LINE21_CHANNEL_3 - LINE21_CHANNEL_1);
+    }
+    ctxPtr->currentChannel[codePtr->fieldNum] = codePtr->channelNum;
+}  // resolveChannel()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isFieldSelected()
+ |
+ | DESCRIPTION:
+ |    This function returns whether any of the channels carried on a field (given
+ |    as the mask of those channels) were selected to be decoded.
+ -------------------------------------------------------------------------------*/
+static boolean isFieldSelected( Line21DecodeCtx* ctxPtr, uint8 fieldChannels ) {
+    if( ctxPtr->decodeWhichChannels == DECODE_ALL_CHANNELS ) return TRUE;
+    return (ctxPtr->decodeWhichChannels & fieldChannels) ? TRUE : FALSE;
+}  // isFieldSelected()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isChannelSelected()
+ |
+ | DESCRIPTION:
+ |    This function returns whether a decoded code belongs to a channel which was
+ |    selected to be decoded. Characters which arrive before any control code has
+ |    set the channel are kept, as the field they arrived on was selected.
+ -------------------------------------------------------------------------------*/
+static boolean isChannelSelected( Line21DecodeCtx* ctxPtr, uint8 channelNum ) {
+    if( ctxPtr->decodeWhichChannels == DECODE_ALL_CHANNELS ) return TRUE;
+    if( channelNum == LINE21_CHANNEL_UNKONWN ) return TRUE;
+    return (ctxPtr->decodeWhichChannels & LINE21_CHANNEL_SELECT(channelNum)) ? TRUE : FALSE;
+}  // isChannelSelected()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    trackFirstText()
+ |
+ | DESCRIPTION:
+ |    This function notes the first time that a character of text is decoded.
+ -------------------------------------------------------------------------------*/
+static void trackFirstText( Line21DecodeCtx* ctxPtr, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
+    if( ctxPtr->foundText == NO_TEXT_FOUND ) {
+        ctxPtr->foundText = TEXT_FOUND;
+        char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
+        encodeTimeCode(captionTimePtr, captionTimeStr);
+        LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 First Character of text found on Channel %d at %s", codePtr->channelNum, captionTimeStr);
+    }
+}  // trackFirstText()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    trackGlobalCmd()
+ |
+ | DESCRIPTION:
+ |    This function applies a decoded Global Command to the state of the channel,
+ |    tracking which style of captioning (PopOn, RollUp, PaintOn) is in use.
+ -------------------------------------------------------------------------------*/
+static void trackGlobalCmd( Line21DecodeCtx* ctxPtr, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
+    char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
+    uint8 chan = codePtr->code.globalControl.chan;
+    uint8 ccData2 = codePtr->code.globalControl.cmd;
+
+    ctxPtr->dataFound[chan] = TRUE;
+    ctxPtr->currentChannel[codePtr->fieldNum] = chan;
+
     if( ((codePtr->channelNum == LINE21_CHANNEL_1) && (codePtr->fieldNum == CEA608E_LINE21_FIELD_2_CC)) ||
         ((codePtr->channelNum == LINE21_CHANNEL_2) && (codePtr->fieldNum == CEA608E_LINE21_FIELD_2_CC)) ||
         ((codePtr->channelNum == LINE21_CHANNEL_3) && (codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC)) ||
         ((codePtr->channelNum == LINE21_CHANNEL_4) && (codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC)) ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Channel/Field Mismatch: Chan - %d Field - %d", codePtr->channelNum, codePtr->fieldNum);
     }
-    
-    codePtr->code.globalControl.cmd = ccData2;
 
     if( (ccData2 == GLOBAL_CTRL_CODE__RCL) || (ccData2 == GLOBAL_CTRL_CODE__EOC) ) {
-        if( (ccData2 != GLOBAL_CTRL_CODE__RCL) && (ctxPtr->captioningStart[codePtr->code.globalControl.chan] == FALSE) ) {
-            ctxPtr->captioningStart[codePtr->code.globalControl.chan] = TRUE;
+        if( (ccData2 != GLOBAL_CTRL_CODE__RCL) && (ctxPtr->captioningStart[chan] == FALSE) ) {
+            ctxPtr->captioningStart[chan] = TRUE;
             encodeTimeCode(captionTimePtr, captionTimeStr);
-            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 PopOn Captioning on Channel %d started at %s", codePtr->code.globalControl.chan, captionTimeStr);
+            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 PopOn Captioning on Channel %d started at %s", chan, captionTimeStr);
         }
-        if( ctxPtr->captioningChange[codePtr->code.globalControl.chan] == FALSE ) {
-            ctxPtr->isPopOnCaptioning[codePtr->code.globalControl.chan] = TRUE;
-            if (ctxPtr->isRollUpCaptioning[codePtr->code.globalControl.chan] == TRUE) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: RollUp -> PopUp", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+        if( ctxPtr->captioningChange[chan] == FALSE ) {
+            ctxPtr->isPopOnCaptioning[chan] = TRUE;
+            if (ctxPtr->isRollUpCaptioning[chan] == TRUE) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: RollUp -> PopUp", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
-            if (ctxPtr->isPaintOnCaptioning[codePtr->code.globalControl.chan] == TRUE) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PaintOn -> PopUp", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+            if (ctxPtr->isPaintOnCaptioning[chan] == TRUE) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PaintOn -> PopUp", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
         }
     } else if( (ccData2 == GLOBAL_CTRL_CODE__RDC) || (ccData2 == GLOBAL_CTRL_CODE__DER) ) {
-        if( (ccData2 != GLOBAL_CTRL_CODE__DER) && (ctxPtr->captioningStart[codePtr->code.globalControl.chan] == FALSE) ) {
-            ctxPtr->captioningStart[codePtr->code.globalControl.chan] = TRUE;
+        if( (ccData2 != GLOBAL_CTRL_CODE__DER) && (ctxPtr->captioningStart[chan] == FALSE) ) {
+            ctxPtr->captioningStart[chan] = TRUE;
             encodeTimeCode(captionTimePtr, captionTimeStr);
-            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 PaintOn Captioning on Channel %d started at %s", codePtr->code.globalControl.chan, captionTimeStr);
+            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 PaintOn Captioning on Channel %d started at %s", chan, captionTimeStr);
         }
-        if( ctxPtr->captioningChange[codePtr->code.globalControl.chan] == FALSE ) {
-            ctxPtr->isPaintOnCaptioning[codePtr->code.globalControl.chan] = TRUE;
-            if( ctxPtr->isPopOnCaptioning[codePtr->code.globalControl.chan] == TRUE ) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PopUp -> PaintOn", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+        if( ctxPtr->captioningChange[chan] == FALSE ) {
+            ctxPtr->isPaintOnCaptioning[chan] = TRUE;
+            if( ctxPtr->isPopOnCaptioning[chan] == TRUE ) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PopUp -> PaintOn", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
-            if( ctxPtr->isRollUpCaptioning[codePtr->code.globalControl.chan] == TRUE ) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: RollUp -> PaintOn", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+            if( ctxPtr->isRollUpCaptioning[chan] == TRUE ) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: RollUp -> PaintOn", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
         }
     } else if( (ccData2 == GLOBAL_CTRL_CODE__RU2) || (ccData2 == GLOBAL_CTRL_CODE__RU3) ||
                (ccData2 == GLOBAL_CTRL_CODE__RU4) || (ccData2 == GLOBAL_CTRL_CODE__CR) ) {
-        if( (ccData2 != GLOBAL_CTRL_CODE__CR) && (ctxPtr->captioningStart[codePtr->code.globalControl.chan] == FALSE) ) {
-            ctxPtr->captioningStart[codePtr->code.globalControl.chan] = TRUE;
+        if( (ccData2 != GLOBAL_CTRL_CODE__CR) && (ctxPtr->captioningStart[chan] == FALSE) ) {
+            ctxPtr->captioningStart[chan] = TRUE;
             encodeTimeCode(captionTimePtr, captionTimeStr);
-            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 RollUp Captioning on Channel %d started at %s", codePtr->code.globalControl.chan, captionTimeStr);
+            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 RollUp Captioning on Channel %d started at %s", chan, captionTimeStr);
         }
-        if( ctxPtr->captioningChange[codePtr->code.globalControl.chan] == FALSE ) {
-            ctxPtr->isRollUpCaptioning[codePtr->code.globalControl.chan] = TRUE;
-            if( ctxPtr->isPopOnCaptioning[codePtr->code.globalControl.chan] == TRUE ) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PopUp -> RollUp", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+        if( ctxPtr->captioningChange[chan] == FALSE ) {
+            ctxPtr->isRollUpCaptioning[chan] = TRUE;
+            if( ctxPtr->isPopOnCaptioning[chan] == TRUE ) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PopUp -> RollUp", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
-            if( ctxPtr->isPaintOnCaptioning[codePtr->code.globalControl.chan] == TRUE ) {
-                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PaintOn -> RollUp", codePtr->code.globalControl.chan);
-                ctxPtr->captioningChange[codePtr->code.globalControl.chan] = TRUE;
+            if( ctxPtr->isPaintOnCaptioning[chan] == TRUE ) {
+                LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Caption Format change on Channel %d: PaintOn -> RollUp", chan);
+                ctxPtr->captioningChange[chan] = TRUE;
             }
         }
     }
+}  // trackGlobalCmd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeGlobalCmd()
+ |
+ | DESCRIPTION:
+ |    This function decodes the Line 21 Global Command per the CEA-608 Spec.
+ -------------------------------------------------------------------------------*/
+static boolean decodeGlobalCmd( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+
+    if( (ccData1 != GLOBAL_CTRL_CODE_CC1) && (ccData1 != GLOBAL_CTRL_CODE_CC2) &&
+       (ccData1 != GLOBAL_CTRL_CODE_CC3) && (ccData1 != GLOBAL_CTRL_CODE_CC4) ) {
+        return FALSE;
+    }
+
+    if( (ccData2 & GLOBAL_CTRL_CMD_MASK) != ccData2 ) {
+        return FALSE;
+    }
+
+    ASSERT(codePtr);
+    codePtr->codeType = LINE21_GLOBAL_CONTROL_CODE;
+
+    switch( ccData1 ) {
+        case GLOBAL_CTRL_CODE_CC1:
+            codePtr->channelNum = LINE21_CHANNEL_1;
+            break;
+        case GLOBAL_CTRL_CODE_CC2:
+            codePtr->channelNum = LINE21_CHANNEL_2;
+            break;
+        case GLOBAL_CTRL_CODE_CC3:
+            codePtr->channelNum = LINE21_CHANNEL_3;
+            break;
+        case GLOBAL_CTRL_CODE_CC4:
+            codePtr->channelNum = LINE21_CHANNEL_4;
+            break;
+        default:
+            codePtr->channelNum = LINE21_CHANNEL_UNKONWN;
+            LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
+            break;
+    }
+
+    codePtr->code.globalControl.chan = codePtr->channelNum;
+    codePtr->code.globalControl.cmd = ccData2;
 
     return TRUE;
 }  // decodeGlobalCmd()
@@ -507,49 +870,37 @@ static boolean decodeGlobalCmd( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 cc
  | DESCRIPTION:
  |    This function decodes the Line 21 Mid-Row Code per the CEA-608 Spec.
  -------------------------------------------------------------------------------*/
-static boolean decodeMidRowCode( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+static boolean decodeMidRowCode( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
 
     if( (ccData1 != CMD_MIDROW_BG_CHAN_1_3) && (ccData1 != CMD_MIDROW_FG_CHAN_1_3) &&
        (ccData1 != CMD_MIDROW_BG_CHAN_2_4) && (ccData1 != CMD_MIDROW_FG_CHAN_2_4) ) {
         return FALSE;
     }
-    
+
     if( (ccData2 & MIDROW_CODE_MASK) != ccData2 ) {
         return FALSE;
     }
-    
+
     ASSERT(codePtr);
     codePtr->codeType = LINE21_MID_ROW_CONTROL_CODE;
-    
+
     switch( ccData1 ) {
         case CMD_MIDROW_BG_CHAN_1_3:
         case CMD_MIDROW_FG_CHAN_1_3:
             codePtr->code.midRow.chan = LINE21_CHANNEL_1_3;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_1;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_3;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_1;
             break;
         case CMD_MIDROW_BG_CHAN_2_4:
         case CMD_MIDROW_FG_CHAN_2_4:
             codePtr->code.midRow.chan = LINE21_CHANNEL_2_4;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_2;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_4;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_2;
             break;
         default:
             codePtr->code.midRow.chan = LINE21_CHANNEL_UNKONWN;
             LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
             break;
     }
-    
+
     if( (ccData1 & MIDROW_BG_FG_MASK) == MIDROW_FOREGROUND_STYLE ) {
         codePtr->code.midRow.backgroundOrForeground = MIDROW_FOREGROUND_STYLE;
         codePtr->code.midRow.isPartiallyTransparent = ccData2 & MIDROW_TRANSPARENCY_MASK;
@@ -559,7 +910,7 @@ static boolean decodeMidRowCode( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 c
         codePtr->code.midRow.isUnderlined = ccData2 & MIDROW_UNDERLINE_MASK;
         codePtr->code.midRow.backgroundForgroundData.color = ccData2 & MIDROW_BG_COLOR_MASK;
     }
-    
+
     return TRUE;
 }  // decodeMidRowCode()
 
@@ -570,48 +921,36 @@ static boolean decodeMidRowCode( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 c
  | DESCRIPTION:
  |    This function decodes a Tab Control Code in Line 21 Data per the CEA-608 Spec.
  -------------------------------------------------------------------------------*/
-static boolean decodeTabCtrl( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
-    
+static boolean decodeTabCtrl( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+
     if( (ccData1 != CMD_TAB_HI_CC_1_3) && (ccData1 != CMD_TAB_HI_CC_2_4) ) {
         return FALSE;
     }
-    
+
     if( (ccData2 & TAB_CMD_MASK) != ccData2 ) {
         return FALSE;
     }
-    
+
     ASSERT(codePtr);
     codePtr->codeType = LINE21_TAB_CONTROL_CODE;
-    
+
     switch( ccData1 ) {
         case CMD_TAB_HI_CC_1_3:
             codePtr->code.tabControl.chan = LINE21_CHANNEL_1_3;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_1;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_3;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_1;
             break;
         case CMD_TAB_HI_CC_2_4:
             codePtr->code.tabControl.chan = LINE21_CHANNEL_2_4;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_2;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_4;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_2;
             break;
         default:
             codePtr->code.tabControl.chan = LINE21_CHANNEL_UNKONWN;
             LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
             break;
     }
-    
+
     codePtr->code.tabControl.tabOffset = ccData2;
-    
+
     return TRUE;
 }  // decodeTabCtrl()
 
@@ -621,45 +960,40 @@ static boolean decodeTabCtrl( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccDa
  |
  | DESCRIPTION:
  |    This function decodes the Line 21 Preamble Access Code per the CEA-608 Spec.
+ |    An invalid row is left as zero in the table and is reported when the code
+ |    is actually decoded.
  -------------------------------------------------------------------------------*/
-static boolean decodePAC( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
-    
+static boolean decodePAC( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+
     if( (ccData1 & PAC_CC1_MASK) != ccData1 ) {
         return FALSE;
     }
-    
+
+    // The second byte of a PAC is always 0x40 - 0x7F, anything lower is a Special or Extended Character
+    if( (ccData2 & PAC_SECOND_BYTE_MASK) != PAC_SECOND_BYTE_MASK ) {
+        return FALSE;
+    }
+
     ASSERT(codePtr);
     codePtr->codeType = LINE21_PREAMBLE_ACCESS_CODE;
-    
+
     switch( ccData1 & PAC_CHANNEL_MASK ) {
         case PAC_CHANNEL_1_3:
             codePtr->code.pac.chan = LINE21_CHANNEL_1_3;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_1;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_3;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_1;
             break;
         case PAC_CHANNEL_2_4:
             codePtr->code.pac.chan = LINE21_CHANNEL_2_4;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_2;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_4;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_2;
             break;
         default:
             codePtr->code.pac.chan = LINE21_CHANNEL_UNKONWN;
             LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
             break;
     }
-    
-    codePtr->code.pac.rowNumber = Line21PacDecodeRow(ccData1,ccData2);
-    
+
+    codePtr->code.pac.rowNumber = pacRowNumber[PAC_ROW_CODE(ccData1,ccData2)];
+
     if( (ccData2 & PAC_STYLE_ADDR_MASK) == PAC_ADDRESS_SET ) {
         codePtr->code.pac.styleAddr = PAC_ADDRESS_CODE;
         codePtr->code.pac.styleAddrData.cursor = decodeColumn(ccData2);
@@ -667,9 +1001,9 @@ static boolean decodePAC( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2,
         codePtr->code.pac.styleAddr = PAC_STYLE_CODE;
         codePtr->code.pac.styleAddrData.color = ccData2 & PAC_COLOR_STYLE_MASK;
     }
-    
+
     codePtr->code.pac.isUnderlined = ccData2 & PAC_UNDERLINE_MASK;
-    
+
     return TRUE;
 }  // decodePAC()
 
@@ -679,32 +1013,18 @@ static boolean decodePAC( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2,
  |
  | DESCRIPTION:
  |    This function decodes Basic Characters in Line 21 Data per the CEA-608 Spec.
+ |    The channel is not known until the pair is decoded in the stream.
  -------------------------------------------------------------------------------*/
-static boolean decodeBasicChars( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
+static boolean decodeBasicChars( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
     ASSERT(codePtr);
 
-    if( (ctxPtr->currentChannel[codePtr->fieldNum] < 1) || (ctxPtr->currentChannel[codePtr->fieldNum] > 4) ) {
-        LOG(DEBUG_LEVEL_WARN, DBG_608_DEC, "Dropping Chars for unknown channel : %d - 0x%02X 0x%02X",
-            ctxPtr->currentChannel[codePtr->fieldNum], ccData1, ccData2);
-        return FALSE;
-    }
-    
     if( (((ccData1 >= FIRST_BASIC_CHAR) && (ccData1 <= LAST_BASIC_CHAR)) || (ccData1 == NULL_BASIC_CHAR)) &&
         (((ccData2 >= FIRST_BASIC_CHAR) && (ccData2 <= LAST_BASIC_CHAR)) || (ccData2 == NULL_BASIC_CHAR)) ) {
         codePtr->codeType = LINE21_BASIC_CHARS;
-        
+
         codePtr->code.basicChars.charOne = ccData1;
         codePtr->code.basicChars.charTwo = ccData2;
 
-        codePtr->channelNum = ctxPtr->currentChannel[codePtr->fieldNum];
-
-        if( ctxPtr->foundText == NO_TEXT_FOUND ) {
-            ctxPtr->foundText = TEXT_FOUND;
-            char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
-            encodeTimeCode(captionTimePtr, captionTimeStr);
-            LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 First Character of text found on Channel %d at %s", codePtr->channelNum, captionTimeStr);
-        }
-
         return TRUE;
     }
     return FALSE;
@@ -717,55 +1037,36 @@ static boolean decodeBasicChars( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 c
  | DESCRIPTION:
  |    This function decodes a Special Character in Line 21 Data per the CEA-608 Spec.
  -------------------------------------------------------------------------------*/
-static boolean decodeSpecialChar( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
-    
+static boolean decodeSpecialChar( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+
     if( (ccData1 != SPCL_NA_CHAR_SET_CH_1_3) && (ccData1 != SPCL_NA_CHAR_SET_CH_2_4) ) {
         return FALSE;
     }
-    
+
     if( (ccData2 & SPCL_NA_CHAR_SET_MASK) != ccData2 ) {
         return FALSE;
     }
-    
+
     ASSERT(codePtr);
     codePtr->codeType = LINE21_SPECIAL_CHAR;
-    
+
     switch( ccData1 ) {
         case SPCL_NA_CHAR_SET_CH_1_3:
             codePtr->code.specialChar.chan = LINE21_CHANNEL_1_3;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_1;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_3;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_1;
             break;
         case SPCL_NA_CHAR_SET_CH_2_4:
             codePtr->code.specialChar.chan = LINE21_CHANNEL_2_4;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_2;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_4;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_2;
             break;
         default:
             codePtr->code.specialChar.chan = LINE21_CHANNEL_UNKONWN;
             LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Impossible Code Branch: 0x%02X", ccData1);
             break;
     }
-    
+
     codePtr->code.specialChar.spChar = ccData2 & SPCL_NA_CHAR_MASK;
 
-    if( ctxPtr->foundText == NO_TEXT_FOUND ) {
-        ctxPtr->foundText = TEXT_FOUND;
-        char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
-        encodeTimeCode(captionTimePtr, captionTimeStr);
-        LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 First Character of text found on Channel %d at %s", codePtr->channelNum, captionTimeStr);
-    }
-    
     return TRUE;
 }  // decodeSpecialChar()
 
@@ -776,46 +1077,32 @@ static boolean decodeSpecialChar( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8
  | DESCRIPTION:
  |    This function decodes a Extended Character in Line 21 Data per the CEA-608 Spec.
  -------------------------------------------------------------------------------*/
-static boolean decodeExtendedChar( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8 ccData2, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
-    
+static boolean decodeExtendedChar( uint8 ccData1, uint8 ccData2, Line21Code* codePtr ) {
+
     if( (ccData1 != EXT_W_EURO_CHAR_SET_CH_1_3_SF) && (ccData1 != EXT_W_EURO_CHAR_SET_CH_1_3_FG) &&
        (ccData1 != EXT_W_EURO_CHAR_SET_CH_2_4_SF) && (ccData1 != EXT_W_EURO_CHAR_SET_CH_2_4_FG) ) {
         return FALSE;
     }
-    
+
     if( (ccData2 & EXT_W_EURO_CHAR_SET_MASK) != ccData2 ) {
         return FALSE;
     }
-    
+
     ASSERT(codePtr);
     codePtr->codeType = LINE21_EXTENDED_CHAR;
-    
+
     switch( ccData1 ) {
         case EXT_W_EURO_CHAR_SET_CH_1_3_SF:
         case EXT_W_EURO_CHAR_SET_CH_1_3_FG:
             codePtr->code.extendedChar.chan = LINE21_CHANNEL_1_3;
-            codePtr->code.extendedChar.charSet = EXT_W_EURO_CHAR_SET_SPANISH_FRENCH;
             codePtr->code.extendedChar.exChar = ccData2;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_1;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_1;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_3;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_3;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_1;
             break;
         case EXT_W_EURO_CHAR_SET_CH_2_4_SF:
         case EXT_W_EURO_CHAR_SET_CH_2_4_FG:
             codePtr->code.extendedChar.chan = LINE21_CHANNEL_2_4;
-            codePtr->code.extendedChar.charSet = EXT_W_EURO_CHAR_SET_DUTCH_GERMAN;
             codePtr->code.extendedChar.exChar = ccData2;
-            if( codePtr->fieldNum == CEA608E_LINE21_FIELD_1_CC ) {
-                codePtr->channelNum = LINE21_CHANNEL_2;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_2;
-            } else {
-                codePtr->channelNum = LINE21_CHANNEL_4;
-                ctxPtr->currentChannel[codePtr->fieldNum] = LINE21_CHANNEL_4;
-            }
+            codePtr->channelNum = LINE21_CHANNEL_2;
             break;
         default:
             codePtr->code.extendedChar.chan = LINE21_CHANNEL_UNKONWN;
@@ -823,13 +1110,13 @@ static boolean decodeExtendedChar( Line21DecodeCtx* ctxPtr, uint8 ccData1, uint8
             break;
     }
 
-    if( ctxPtr->foundText == NO_TEXT_FOUND ) {
-        ctxPtr->foundText = TEXT_FOUND;
-        char captionTimeStr[CAPTION_TIME_SCRATCH_BUFFER_SIZE];
-        encodeTimeCode(captionTimePtr, captionTimeStr);
-        LOG(DEBUG_LEVEL_INFO, DBG_608_DEC, "Line 21 First Character of text found on Channel %d at %s", codePtr->channelNum, captionTimeStr);
+    // The Character Set is selected by the low bit of the first byte, not by the Channel
+    if( (ccData1 & EXT_W_EURO_CHAR_SET_FG_BIT) == 0 ) {
+        codePtr->code.extendedChar.charSet = EXT_W_EURO_CHAR_SET_SPANISH_FRENCH;
+    } else {
+        codePtr->code.extendedChar.charSet = EXT_W_EURO_CHAR_SET_DUTCH_GERMAN;
     }
-    
+
     return TRUE;
 }  // decodeExtendedChar()
 
@@ -876,3 +1163,18 @@ static uint8 decodeColumn( uint8 ccData ) {
 
     return retval;
 }
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    eventPayloadSize()
+ |
+ | DESCRIPTION:
+ |    This function returns how many bytes of a code of the given type follow
+ |    the header of a Line21Event.
+ -------------------------------------------------------------------------------*/
+static uint8 eventPayloadSize( uint8 codeType ) {
+    if( (codeType > LINE21_MID_ROW_CONTROL_CODE) || (eventCodeSize[codeType] <= LINE21_EVENT_INLINE_CODE_SIZE) ) {
+        return 0;
+    }
+    return eventCodeSize[codeType] - LINE21_EVENT_INLINE_CODE_SIZE;
+}  // eventPayloadSize()
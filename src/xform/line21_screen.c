@@ -0,0 +1,666 @@
+/**
+ * Copyright 2019 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "debug.h"
+
+#include "line21_screen.h"
+#include "line21_decode.h"
+#include "line21_output.h"
+#include "cc_utils.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                      Private Member Variables                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*--                     Private Member Declarations                        --*/
+/*----------------------------------------------------------------------------*/
+
+static uint8 processCode( Context*, Line21Code*, CaptionTime* );
+static uint8 processGlobalCmd( Context*, Line21Screen*, uint8, uint8, CaptionTime* );
+static boolean isRepeatedControlCode( Line21Screen*, Line21Code* );
+static void processPac( Line21Screen*, Line21Code* );
+static void writeChar( Line21Screen*, char*, CaptionTime* );
+static void backspace( Line21Screen* );
+static void rollUp( Line21Screen* );
+static void moveRollUpWindow( Line21Screen*, uint8 );
+static void clearMemory( char* [LINE21_SCREEN_NUM_ROWS][LINE21_SCREEN_NUM_COLUMNS] );
+static void clearRow( char* [LINE21_SCREEN_NUM_COLUMNS] );
+static boolean isCellBlank( char* );
+static boolean isDisplayBlank( Line21Screen* );
+static void openCue( Line21Screen*, CaptionTime* );
+static uint8 closeCue( Context*, Line21Screen*, uint8, CaptionTime* );
+
+/*----------------------------------------------------------------------------*/
+/*--                       Public Member Functions                          --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21ScreenInitialize()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    LinkInfo -  Information about this element of the pipeline, such that it can
+ |                be chained to elements that can consume the specific type of data
+ |                that it produces.
+ |
+ | DESCRIPTION:
+ |    This initializes this element of the pipeline.
+ -------------------------------------------------------------------------------*/
+LinkInfo Line21ScreenInitialize( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(!rootCtxPtr->line21ScreenCtxPtr);
+
+    rootCtxPtr->line21ScreenCtxPtr = malloc(sizeof(Line21ScreenCtx));
+    Line21ScreenCtx* ctxPtr = rootCtxPtr->line21ScreenCtxPtr;
+    memset(ctxPtr, 0, sizeof(Line21ScreenCtx));
+
+    for( int loop = 0; loop < LINE21_MAX_NUM_CHANNELS; loop++ ) {
+        Line21Screen* screenPtr = &ctxPtr->screen[loop];
+        clearMemory(screenPtr->displayed);
+        clearMemory(screenPtr->nonDisplayed);
+        screenPtr->captionMode = LINE21_SCREEN_MODE_UNKNOWN;
+        screenPtr->baseRow = LINE21_SCREEN_DEFAULT_BASE_ROW;
+        screenPtr->cursorRow = LINE21_SCREEN_DEFAULT_BASE_ROW;
+        screenPtr->isCueOpen = FALSE;
+        screenPtr->lastControlCode = LINE21_SCREEN_NO_CONTROL_CODE;
+    }
+
+    InitSinks(&ctxPtr->sinks, LINE21_DATA___CAPTION_CUE);
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = LINE21_DATA___CAPTION_CUE;
+    linkInfo.sourceType = DATA_TYPE_DECODED_608;
+    linkInfo.sinkType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.NextBufferFnPtr = &Line21ScreenProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &Line21ScreenShutdown;
+    return linkInfo;
+}  // Line21ScreenInitialize()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21ScreenAddSink()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    linkInfo - Describes the potential next element of the pipeline.
+ |
+ | RETURN VALUES:
+ |    boolean - Success is TRUE and Failure is FALSE
+ |
+ | DESCRIPTION:
+ |    This method binds the next element to this element, after validating that
+ |    the data it receives is compatible with the data tht this element sends.
+ -------------------------------------------------------------------------------*/
+boolean Line21ScreenAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(rootCtxPtr->line21ScreenCtxPtr);
+
+    if( linkInfo.sourceType != DATA_TYPE_CAPTION_CUE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_608_DEC, "Attempt to add Sink that cannot process Caption Cues");
+        return FALSE;
+    }
+
+    return AddSink(&rootCtxPtr->line21ScreenCtxPtr->sinks, &linkInfo);
+}  // Line21ScreenAddSink()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21ScreenProcNextBuffer()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |    inBuffer - Pointer to the buffer to process.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method applies the decoded Line 21 codes to the displayed and
+ |    non-displayed memories of each channel, as a caption decoder would. Each
+ |    time the displayed memory of a channel changes what is on screen, the text
+ |    that was shown up until then is passed down the pipeline as a timed cue.
+ -------------------------------------------------------------------------------*/
+uint8 Line21ScreenProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
+    ASSERT(inBuffer);
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->line21ScreenCtxPtr);
+    Line21ScreenCtx* ctxPtr = ((Context*)rootCtxPtr)->line21ScreenCtxPtr;
+    Line21Code code;
+    uint16 offset = 0;
+    uint8 retval = PIPELINE_SUCCESS;
+
+    if( inBuffer->bufferType != BUFFER_TYPE_LINE_21 ) {
+        FreeBuffer(inBuffer);
+        return PIPELINE_SUCCESS;
+    }
+
+    ctxPtr->lastCaptionTime = inBuffer->captionTime;
+
+    while( Line21DecodeNextEvent(inBuffer, &offset, &code) == TRUE ) {
+        uint8 tmp = processCode(rootCtxPtr, &code, &inBuffer->captionTime);
+        if( tmp != PIPELINE_SUCCESS ) {
+            retval = tmp;
+        }
+    }
+
+    FreeBuffer(inBuffer);
+    return retval;
+}  // Line21ScreenProcNextBuffer()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    Line21ScreenShutdown()
+ |
+ | INPUT PARAMETERS:
+ |    rootCtxPtr - Pointer to all Pipeline Elements Contexts, including this one.
+ |
+ | RETURN VALUES:
+ |    uint8 - Success is TRUE / PIPELINE_SUCCESS, Failure is FALSE / PIPELINE_FAILURE
+ |            All other codes specified in header.
+ |
+ | DESCRIPTION:
+ |    This method is called when the previous element in the pipeline determines
+ |    that there is no more data coming down the pipeline. Any captions which are
+ |    still on screen are ended at the time of the last data received, before the
+ |    call is passed down the pipeline.
+ -------------------------------------------------------------------------------*/
+uint8 Line21ScreenShutdown( void* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(((Context*)rootCtxPtr)->line21ScreenCtxPtr);
+    Line21ScreenCtx* ctxPtr = ((Context*)rootCtxPtr)->line21ScreenCtxPtr;
+
+    for( int loop = 0; loop < LINE21_MAX_NUM_CHANNELS; loop++ ) {
+        closeCue(rootCtxPtr, &ctxPtr->screen[loop], loop+1, &ctxPtr->lastCaptionTime);
+    }
+
+    Sinks sinks = ctxPtr->sinks;
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->line21ScreenCtxPtr = NULL;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // Line21ScreenShutdown()
+
+/*----------------------------------------------------------------------------*/
+/*--                       Private Member Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    processCode()
+ |
+ | DESCRIPTION:
+ |    This function applies a single decoded Line 21 code to the screen of the
+ |    channel that it belongs to.
+ -------------------------------------------------------------------------------*/
+static uint8 processCode( Context* rootCtxPtr, Line21Code* codePtr, CaptionTime* captionTimePtr ) {
+    if( (codePtr->channelNum < LINE21_CHANNEL_1) || (codePtr->channelNum > LINE21_CHANNEL_4) ) {
+        return PIPELINE_SUCCESS;
+    }
+
+    Line21Screen* screenPtr = &rootCtxPtr->line21ScreenCtxPtr->screen[codePtr->channelNum-1];
+
+    if( isRepeatedControlCode(screenPtr, codePtr) == TRUE ) {
+        return PIPELINE_SUCCESS;
+    }
+
+    switch( codePtr->codeType ) {
+        case LINE21_BASIC_CHARS:
+            if( codePtr->code.basicChars.charOne != NULL_BASIC_CHAR ) {
+                writeChar(screenPtr, Line21DecodeBasicNACharacter(codePtr->code.basicChars.charOne), captionTimePtr);
+            }
+            if( codePtr->code.basicChars.charTwo != NULL_BASIC_CHAR ) {
+                writeChar(screenPtr, Line21DecodeBasicNACharacter(codePtr->code.basicChars.charTwo), captionTimePtr);
+            }
+            break;
+        case LINE21_SPECIAL_CHAR:
+            if( codePtr->code.specialChar.spChar == SPCL_NA_CHAR_TRANSPARENT_SPACE ) {
+                writeChar(screenPtr, " ", captionTimePtr);
+            } else {
+                writeChar(screenPtr, Line21DecodeSpecialCharacter(codePtr->code.specialChar.spChar), captionTimePtr);
+            }
+            break;
+        case LINE21_EXTENDED_CHAR:
+            // Extended Characters are preceded by a Basic Character fallback, which they replace
+            backspace(screenPtr);
+            writeChar(screenPtr, Line21DecodeExtendedCharacter(codePtr->code.extendedChar.charSet, codePtr->code.extendedChar.exChar), captionTimePtr);
+            break;
+        case LINE21_GLOBAL_CONTROL_CODE:
+            return processGlobalCmd(rootCtxPtr, screenPtr, codePtr->channelNum, codePtr->code.globalControl.cmd, captionTimePtr);
+        case LINE21_PREAMBLE_ACCESS_CODE:
+            processPac(screenPtr, codePtr);
+            break;
+        case LINE21_TAB_CONTROL_CODE:
+            screenPtr->cursorColumn = screenPtr->cursorColumn + (codePtr->code.tabControl.tabOffset & TOC_COLUMN_MASK);
+            if( screenPtr->cursorColumn >= LINE21_SCREEN_NUM_COLUMNS ) {
+                screenPtr->cursorColumn = LINE21_SCREEN_NUM_COLUMNS - 1;
+            }
+            break;
+        case LINE21_MID_ROW_CONTROL_CODE:
+            // Mid-Row Codes occupy a cell on screen, which is displayed as a space
+            writeChar(screenPtr, " ", captionTimePtr);
+            break;
+        default:
+            break;
+    }
+
+    return PIPELINE_SUCCESS;
+}  // processCode()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    processGlobalCmd()
+ |
+ | DESCRIPTION:
+ |    This function applies a Global Control Code to the screen of a channel,
+ |    ending the cue on screen whenever the command changes what is displayed.
+ -------------------------------------------------------------------------------*/
+static uint8 processGlobalCmd( Context* rootCtxPtr, Line21Screen* screenPtr, uint8 channelNum, uint8 cmd, CaptionTime* captionTimePtr ) {
+    uint8 retval = PIPELINE_SUCCESS;
+
+    switch( cmd ) {
+        case GLOBAL_CTRL_CODE__RCL:
+            screenPtr->captionMode = LINE21_SCREEN_MODE_POP_ON;
+            break;
+        case GLOBAL_CTRL_CODE__RDC:
+            screenPtr->captionMode = LINE21_SCREEN_MODE_PAINT_ON;
+            break;
+        case GLOBAL_CTRL_CODE__TR:
+        case GLOBAL_CTRL_CODE__RTD:
+            screenPtr->captionMode = LINE21_SCREEN_MODE_TEXT;
+            break;
+        case GLOBAL_CTRL_CODE__EOC:
+            retval = closeCue(rootCtxPtr, screenPtr, channelNum, captionTimePtr);
+            for( int row = 0; row < LINE21_SCREEN_NUM_ROWS; row++ ) {
+                for( int col = 0; col < LINE21_SCREEN_NUM_COLUMNS; col++ ) {
+                    char* tmpCharPtr = screenPtr->displayed[row][col];
+                    screenPtr->displayed[row][col] = screenPtr->nonDisplayed[row][col];
+                    screenPtr->nonDisplayed[row][col] = tmpCharPtr;
+                }
+            }
+            screenPtr->captionMode = LINE21_SCREEN_MODE_POP_ON;
+            openCue(screenPtr, captionTimePtr);
+            break;
+        case GLOBAL_CTRL_CODE__RU2:
+        case GLOBAL_CTRL_CODE__RU3:
+        case GLOBAL_CTRL_CODE__RU4:
+            if( screenPtr->captionMode != LINE21_SCREEN_MODE_ROLL_UP ) {
+                retval = closeCue(rootCtxPtr, screenPtr, channelNum, captionTimePtr);
+                clearMemory(screenPtr->displayed);
+                clearMemory(screenPtr->nonDisplayed);
+                screenPtr->baseRow = LINE21_SCREEN_DEFAULT_BASE_ROW;
+            }
+            screenPtr->captionMode = LINE21_SCREEN_MODE_ROLL_UP;
+            screenPtr->rollUpRows = cmd - GLOBAL_CTRL_CODE__RU2 + 2;
+            if( screenPtr->baseRow < screenPtr->rollUpRows ) {
+                moveRollUpWindow(screenPtr, screenPtr->rollUpRows);
+            }
+            screenPtr->cursorRow = screenPtr->baseRow;
+            screenPtr->cursorColumn = 0;
+            break;
+        case GLOBAL_CTRL_CODE__CR:
+            if( screenPtr->captionMode == LINE21_SCREEN_MODE_ROLL_UP ) {
+                retval = closeCue(rootCtxPtr, screenPtr, channelNum, captionTimePtr);
+                rollUp(screenPtr);
+                openCue(screenPtr, captionTimePtr);
+            }
+            screenPtr->cursorColumn = 0;
+            break;
+        case GLOBAL_CTRL_CODE__EDM:
+            retval = closeCue(rootCtxPtr, screenPtr, channelNum, captionTimePtr);
+            clearMemory(screenPtr->displayed);
+            break;
+        case GLOBAL_CTRL_CODE__ENM:
+            clearMemory(screenPtr->nonDisplayed);
+            break;
+        case GLOBAL_CTRL_CODE__BS:
+            backspace(screenPtr);
+            break;
+        case GLOBAL_CTRL_CODE__DER:
+            if( screenPtr->captionMode == LINE21_SCREEN_MODE_POP_ON ) {
+                for( int col = screenPtr->cursorColumn; col < LINE21_SCREEN_NUM_COLUMNS; col++ ) {
+                    screenPtr->nonDisplayed[screenPtr->cursorRow-1][col] = NULL;
+                }
+            } else if( (screenPtr->captionMode == LINE21_SCREEN_MODE_ROLL_UP) || (screenPtr->captionMode == LINE21_SCREEN_MODE_PAINT_ON) ) {
+                for( int col = screenPtr->cursorColumn; col < LINE21_SCREEN_NUM_COLUMNS; col++ ) {
+                    screenPtr->displayed[screenPtr->cursorRow-1][col] = NULL;
+                }
+            }
+            break;
+        case GLOBAL_CTRL_CODE__AOF:
+        case GLOBAL_CTRL_CODE__AON:
+        case GLOBAL_CTRL_CODE__FON:
+        default:
+            break;
+    }
+
+    return retval;
+}  // processGlobalCmd()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isRepeatedControlCode()
+ |
+ | DESCRIPTION:
+ |    Control Codes, Special and Extended Characters are sent twice in a row so
+ |    that a single corrupted pair does not lose them. This function spots the
+ |    second of the pair, so that it is not applied twice. A third identical code
+ |    in a row is treated as a new code.
+ -------------------------------------------------------------------------------*/
+static boolean isRepeatedControlCode( Line21Screen* screenPtr, Line21Code* codePtr ) {
+    uint32 signature;
+
+    switch( codePtr->codeType ) {
+        case LINE21_SPECIAL_CHAR:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.specialChar.spChar, 0, 0);
+            break;
+        case LINE21_EXTENDED_CHAR:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.extendedChar.charSet, codePtr->code.extendedChar.exChar, 0);
+            break;
+        case LINE21_GLOBAL_CONTROL_CODE:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.globalControl.cmd, 0, 0);
+            break;
+        case LINE21_PREAMBLE_ACCESS_CODE:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.pac.rowNumber,
+                                                 (codePtr->code.pac.styleAddr << 1) | codePtr->code.pac.isUnderlined,
+                                                 codePtr->code.pac.styleAddrData.cursor);
+            break;
+        case LINE21_TAB_CONTROL_CODE:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.tabControl.tabOffset, 0, 0);
+            break;
+        case LINE21_MID_ROW_CONTROL_CODE:
+            signature = LINE21_CONTROL_SIGNATURE(codePtr->codeType, codePtr->code.midRow.backgroundForgroundData.color,
+                                                 (codePtr->code.midRow.backgroundOrForeground << 1) | codePtr->code.midRow.isUnderlined,
+                                                 codePtr->code.midRow.isPartiallyTransparent);
+            break;
+        default:
+            screenPtr->lastControlCode = LINE21_SCREEN_NO_CONTROL_CODE;
+            return FALSE;
+    }
+
+    if( signature == screenPtr->lastControlCode ) {
+        screenPtr->lastControlCode = LINE21_SCREEN_NO_CONTROL_CODE;
+        return TRUE;
+    }
+
+    screenPtr->lastControlCode = signature;
+    return FALSE;
+}  // isRepeatedControlCode()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    processPac()
+ |
+ | DESCRIPTION:
+ |    This function moves the cursor to the row and column of a Preamble Address
+ |    Code. In Roll-Up mode the row sets the base row of the window, and any
+ |    text already in the window moves along with it.
+ -------------------------------------------------------------------------------*/
+static void processPac( Line21Screen* screenPtr, Line21Code* codePtr ) {
+    uint8 rowNumber = codePtr->code.pac.rowNumber;
+
+    if( (rowNumber < 1) || (rowNumber > LINE21_SCREEN_NUM_ROWS) ) {
+        return;
+    }
+
+    if( screenPtr->captionMode == LINE21_SCREEN_MODE_ROLL_UP ) {
+        if( rowNumber < screenPtr->rollUpRows ) {
+            rowNumber = screenPtr->rollUpRows;
+        }
+        if( rowNumber != screenPtr->baseRow ) {
+            moveRollUpWindow(screenPtr, rowNumber);
+        }
+    }
+
+    screenPtr->cursorRow = rowNumber;
+    if( codePtr->code.pac.styleAddr == PAC_ADDRESS_CODE ) {
+        screenPtr->cursorColumn = codePtr->code.pac.styleAddrData.cursor;
+    } else {
+        screenPtr->cursorColumn = 0;
+    }
+}  // processPac()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    writeChar()
+ |
+ | DESCRIPTION:
+ |    This function writes a character at the cursor and advances the cursor,
+ |    which stays put in the last column. Pop-On captions are built in the
+ |    non-displayed memory, everything else goes straight to the screen, which
+ |    starts a cue if nothing was being shown.
+ -------------------------------------------------------------------------------*/
+static void writeChar( Line21Screen* screenPtr, char* charStr, CaptionTime* captionTimePtr ) {
+    ASSERT(charStr);
+    uint8 row = screenPtr->cursorRow - 1;
+
+    if( screenPtr->captionMode == LINE21_SCREEN_MODE_POP_ON ) {
+        screenPtr->nonDisplayed[row][screenPtr->cursorColumn] = charStr;
+    } else if( (screenPtr->captionMode == LINE21_SCREEN_MODE_ROLL_UP) || (screenPtr->captionMode == LINE21_SCREEN_MODE_PAINT_ON) ) {
+        screenPtr->displayed[row][screenPtr->cursorColumn] = charStr;
+        openCue(screenPtr, captionTimePtr);
+    } else {
+        return;
+    }
+
+    if( screenPtr->cursorColumn < (LINE21_SCREEN_NUM_COLUMNS - 1) ) {
+        screenPtr->cursorColumn++;
+    }
+}  // writeChar()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    backspace()
+ |
+ | DESCRIPTION:
+ |    This function moves the cursor back a column and erases that cell.
+ -------------------------------------------------------------------------------*/
+static void backspace( Line21Screen* screenPtr ) {
+    if( screenPtr->cursorColumn == 0 ) {
+        return;
+    }
+
+    screenPtr->cursorColumn--;
+    if( screenPtr->captionMode == LINE21_SCREEN_MODE_POP_ON ) {
+        screenPtr->nonDisplayed[screenPtr->cursorRow-1][screenPtr->cursorColumn] = NULL;
+    } else if( (screenPtr->captionMode == LINE21_SCREEN_MODE_ROLL_UP) || (screenPtr->captionMode == LINE21_SCREEN_MODE_PAINT_ON) ) {
+        screenPtr->displayed[screenPtr->cursorRow-1][screenPtr->cursorColumn] = NULL;
+    }
+}  // backspace()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    rollUp()
+ |
+ | DESCRIPTION:
+ |    This function scrolls the Roll-Up window up a row, dropping its top row
+ |    and leaving an empty base row, and erases anything outside of the window.
+ -------------------------------------------------------------------------------*/
+static void rollUp( Line21Screen* screenPtr ) {
+    uint8 topRow = screenPtr->baseRow - screenPtr->rollUpRows + 1;
+
+    for( int row = 1; row <= LINE21_SCREEN_NUM_ROWS; row++ ) {
+        if( (row >= topRow) && (row < screenPtr->baseRow) ) {
+            memcpy(screenPtr->displayed[row-1], screenPtr->displayed[row], sizeof(screenPtr->displayed[row]));
+        } else {
+            clearRow(screenPtr->displayed[row-1]);
+        }
+    }
+}  // rollUp()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    moveRollUpWindow()
+ |
+ | DESCRIPTION:
+ |    This function moves the Roll-Up window, along with the text in it, so that
+ |    it sits on a new base row.
+ -------------------------------------------------------------------------------*/
+static void moveRollUpWindow( Line21Screen* screenPtr, uint8 newBaseRow ) {
+    char* window[LINE21_SCREEN_NUM_ROWS][LINE21_SCREEN_NUM_COLUMNS];
+    uint8 numRows = screenPtr->rollUpRows;
+
+    if( numRows > screenPtr->baseRow ) {
+        numRows = screenPtr->baseRow;
+    }
+
+    memcpy(window, &screenPtr->displayed[screenPtr->baseRow - numRows], numRows * sizeof(window[0]));
+    clearMemory(screenPtr->displayed);
+    memcpy(&screenPtr->displayed[newBaseRow - numRows], window, numRows * sizeof(window[0]));
+    screenPtr->baseRow = newBaseRow;
+}  // moveRollUpWindow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    clearMemory()
+ |
+ | DESCRIPTION:
+ |    This function erases every cell of a caption memory.
+ -------------------------------------------------------------------------------*/
+static void clearMemory( char* memory[LINE21_SCREEN_NUM_ROWS][LINE21_SCREEN_NUM_COLUMNS] ) {
+    for( int row = 0; row < LINE21_SCREEN_NUM_ROWS; row++ ) {
+        clearRow(memory[row]);
+    }
+}  // clearMemory()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    clearRow()
+ |
+ | DESCRIPTION:
+ |    This function erases every cell of a row of a caption memory.
+ -------------------------------------------------------------------------------*/
+static void clearRow( char* row[LINE21_SCREEN_NUM_COLUMNS] ) {
+    for( int col = 0; col < LINE21_SCREEN_NUM_COLUMNS; col++ ) {
+        row[col] = NULL;
+    }
+}  // clearRow()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isCellBlank()
+ |
+ | DESCRIPTION:
+ |    This function determines whether a cell shows nothing but background.
+ -------------------------------------------------------------------------------*/
+static boolean isCellBlank( char* cellPtr ) {
+    return ((cellPtr == NULL) || (strcmp(cellPtr, " ") == 0));
+}  // isCellBlank()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    isDisplayBlank()
+ |
+ | DESCRIPTION:
+ |    This function determines whether there is any text on screen.
+ -------------------------------------------------------------------------------*/
+static boolean isDisplayBlank( Line21Screen* screenPtr ) {
+    for( int row = 0; row < LINE21_SCREEN_NUM_ROWS; row++ ) {
+        for( int col = 0; col < LINE21_SCREEN_NUM_COLUMNS; col++ ) {
+            if( isCellBlank(screenPtr->displayed[row][col]) == FALSE ) {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}  // isDisplayBlank()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    openCue()
+ |
+ | DESCRIPTION:
+ |    This function starts a cue, if there is text on screen and there is not
+ |    already a cue in progress.
+ -------------------------------------------------------------------------------*/
+static void openCue( Line21Screen* screenPtr, CaptionTime* captionTimePtr ) {
+    if( (screenPtr->isCueOpen == TRUE) || (isDisplayBlank(screenPtr) == TRUE) ) {
+        return;
+    }
+
+    screenPtr->isCueOpen = TRUE;
+    screenPtr->cueStartTime = *captionTimePtr;
+}  // openCue()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    closeCue()
+ |
+ | DESCRIPTION:
+ |    This function ends the cue in progress, capturing the text that is on
+ |    screen and passing it down the pipeline. Each row keeps the column where
+ |    its text starts, and blank cells between text are rendered as spaces.
+ -------------------------------------------------------------------------------*/
+static uint8 closeCue( Context* rootCtxPtr, Line21Screen* screenPtr, uint8 channelNum, CaptionTime* captionTimePtr ) {
+    if( screenPtr->isCueOpen == FALSE ) {
+        return PIPELINE_SUCCESS;
+    }
+    screenPtr->isCueOpen = FALSE;
+
+    if( captionTimeToMs(&screenPtr->cueStartTime) >= captionTimeToMs(captionTimePtr) ) {
+        LOG(DEBUG_LEVEL_VERBOSE, DBG_608_DEC, "Dropping Zero Length Cue on Channel %d", channelNum);
+        return PIPELINE_SUCCESS;
+    }
+
+    Buffer* outBuffer = NewBuffer(BUFFER_TYPE_CAPTION_CUE, 1);
+    CaptionCue* cuePtr = (CaptionCue*)outBuffer->dataPtr;
+    cuePtr->source = CAPTION_CUE_SOURCE_608;
+    cuePtr->channelNum = channelNum;
+    cuePtr->startTime = screenPtr->cueStartTime;
+    cuePtr->endTime = *captionTimePtr;
+    cuePtr->numRows = 0;
+    cuePtr->windowId = 0;
+    cuePtr->anchorId = 0;
+    cuePtr->anchorVertPercent = 0;
+    cuePtr->anchorHorzPercent = 0;
+
+    for( int row = 0; row < LINE21_SCREEN_NUM_ROWS; row++ ) {
+        int firstCol = 0;
+        int lastCol = LINE21_SCREEN_NUM_COLUMNS - 1;
+        while( (firstCol <= lastCol) && (isCellBlank(screenPtr->displayed[row][firstCol]) == TRUE) ) firstCol++;
+        while( (lastCol >= firstCol) && (isCellBlank(screenPtr->displayed[row][lastCol]) == TRUE) ) lastCol--;
+        if( firstCol > lastCol ) continue;
+
+        CaptionCueRow* rowPtr = &cuePtr->rows[cuePtr->numRows];
+        rowPtr->rowNumber = row + 1;
+        rowPtr->column = firstCol;
+        rowPtr->text[0] = '\0';
+        for( int col = firstCol; col <= lastCol; col++ ) {
+            char* cellPtr = screenPtr->displayed[row][col];
+            strncat(rowPtr->text, (cellPtr == NULL) ? " " : cellPtr, CAPTION_CUE_MAX_ROW_TEXT - strlen(rowPtr->text) - 1);
+        }
+        cuePtr->numRows++;
+    }
+
+    if( cuePtr->numRows == 0 ) {
+        FreeBuffer(outBuffer);
+        return PIPELINE_SUCCESS;
+    }
+
+    outBuffer->numElements = 1;
+    outBuffer->captionTime = *captionTimePtr;
+    return PassToSinks(rootCtxPtr, outBuffer, &rootCtxPtr->line21ScreenCtxPtr->sinks);
+}  // closeCue()
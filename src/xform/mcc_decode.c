@@ -33,15 +33,58 @@
 /*--                      Private Member Variables                          --*/
 /*----------------------------------------------------------------------------*/
 
+/*
+ * Every character which can appear on an MCC line, indexed by its ASCII value.
+ * Telestream specified the following compressed codes, in either case:
+ *
+ *   G  FAh 00h 00h            P  FBh 80h 80h            U  E1h 00h 00h 00h
+ *   H  2 x (FAh 00h 00h)      Q  FCh 80h 80h            Z  00h
+ *   ...                       R  FDh 80h 80h
+ *   O  9 x (FAh 00h 00h)      S  96h 69h
+ *                             T  61h 01h
+ */
+static const MccCharCode mccCharTable[256] = {
+    ['\r'] = MCC_LINE_END,                   ['\n'] = MCC_LINE_END,
+    ['0'] = MCC_HEX_DIGIT(0x0),  ['1'] = MCC_HEX_DIGIT(0x1),  ['2'] = MCC_HEX_DIGIT(0x2),  ['3'] = MCC_HEX_DIGIT(0x3),
+    ['4'] = MCC_HEX_DIGIT(0x4),  ['5'] = MCC_HEX_DIGIT(0x5),  ['6'] = MCC_HEX_DIGIT(0x6),  ['7'] = MCC_HEX_DIGIT(0x7),
+    ['8'] = MCC_HEX_DIGIT(0x8),  ['9'] = MCC_HEX_DIGIT(0x9),
+    ['A'] = MCC_HEX_DIGIT(0xA),  ['B'] = MCC_HEX_DIGIT(0xB),  ['C'] = MCC_HEX_DIGIT(0xC),  ['D'] = MCC_HEX_DIGIT(0xD),
+    ['E'] = MCC_HEX_DIGIT(0xE),  ['F'] = MCC_HEX_DIGIT(0xF),
+    ['a'] = MCC_HEX_DIGIT(0xA),  ['b'] = MCC_HEX_DIGIT(0xB),  ['c'] = MCC_HEX_DIGIT(0xC),  ['d'] = MCC_HEX_DIGIT(0xD),
+    ['e'] = MCC_HEX_DIGIT(0xE),  ['f'] = MCC_HEX_DIGIT(0xF),
+    ['G'] = MCC_EXPANSION(1, 3, 0xFA, 0x00, 0x00),         ['g'] = MCC_EXPANSION(1, 3, 0xFA, 0x00, 0x00),
+    ['H'] = MCC_EXPANSION(2, 3, 0xFA, 0x00, 0x00),         ['h'] = MCC_EXPANSION(2, 3, 0xFA, 0x00, 0x00),
+    ['I'] = MCC_EXPANSION(3, 3, 0xFA, 0x00, 0x00),         ['i'] = MCC_EXPANSION(3, 3, 0xFA, 0x00, 0x00),
+    ['J'] = MCC_EXPANSION(4, 3, 0xFA, 0x00, 0x00),         ['j'] = MCC_EXPANSION(4, 3, 0xFA, 0x00, 0x00),
+    ['K'] = MCC_EXPANSION(5, 3, 0xFA, 0x00, 0x00),         ['k'] = MCC_EXPANSION(5, 3, 0xFA, 0x00, 0x00),
+    ['L'] = MCC_EXPANSION(6, 3, 0xFA, 0x00, 0x00),         ['l'] = MCC_EXPANSION(6, 3, 0xFA, 0x00, 0x00),
+    ['M'] = MCC_EXPANSION(7, 3, 0xFA, 0x00, 0x00),         ['m'] = MCC_EXPANSION(7, 3, 0xFA, 0x00, 0x00),
+    ['N'] = MCC_EXPANSION(8, 3, 0xFA, 0x00, 0x00),         ['n'] = MCC_EXPANSION(8, 3, 0xFA, 0x00, 0x00),
+    ['O'] = MCC_EXPANSION(9, 3, 0xFA, 0x00, 0x00),         ['o'] = MCC_EXPANSION(9, 3, 0xFA, 0x00, 0x00),
+    ['P'] = MCC_EXPANSION(1, 3, 0xFB, 0x80, 0x80),         ['p'] = MCC_EXPANSION(1, 3, 0xFB, 0x80, 0x80),
+    ['Q'] = MCC_EXPANSION(1, 3, 0xFC, 0x80, 0x80),         ['q'] = MCC_EXPANSION(1, 3, 0xFC, 0x80, 0x80),
+    ['R'] = MCC_EXPANSION(1, 3, 0xFD, 0x80, 0x80),         ['r'] = MCC_EXPANSION(1, 3, 0xFD, 0x80, 0x80),
+    ['S'] = MCC_EXPANSION(1, 2, 0x96, 0x69),               ['s'] = MCC_EXPANSION(1, 2, 0x96, 0x69),
+    ['T'] = MCC_EXPANSION(1, 2, 0x61, 0x01),               ['t'] = MCC_EXPANSION(1, 2, 0x61, 0x01),
+    ['U'] = MCC_EXPANSION(1, 4, 0xE1, 0x00, 0x00, 0x00),   ['u'] = MCC_EXPANSION(1, 4, 0xE1, 0x00, 0x00, 0x00),
+    ['V'] = MCC_UNDEFINED_CODE,                             ['v'] = MCC_UNDEFINED_CODE,
+    ['W'] = MCC_UNDEFINED_CODE,                             ['w'] = MCC_UNDEFINED_CODE,
+    ['X'] = MCC_UNDEFINED_CODE,                             ['x'] = MCC_UNDEFINED_CODE,
+    ['Y'] = MCC_UNDEFINED_CODE,                             ['y'] = MCC_UNDEFINED_CODE,
+    ['Z'] = MCC_EXPANSION(1, 1, 0x00),                     ['z'] = MCC_EXPANSION(1, 1, 0x00),
+};
+
 /*----------------------------------------------------------------------------*/
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
-static Buffer* expandMccLine( Buffer* );
-static Buffer* decodeMccLine( MccDecodeCtx*, Buffer* );
-static uint8 mccCharCount( char );
-static void addMultipleFaZeroZero( uint8, uint8*, uint16* );
-static void expandMccCode( uint8, uint8*, uint16* );
+static uint8 batchMccLine( Context*, Buffer* );
+static uint8 decodeBatch( Context* );
+static void decodeBatchTask( void*, uint32 );
+static uint8 passDecodedLine( Context*, MccDecodeLine* );
+static void decodeMccLine( MccDecodeCtx*, char*, MccDecodeLine* );
+static uint8 nextMccByte( MccLineReader* );
+static void readMccBytes( MccLineReader*, uint8*, uint16 );
 static void decodeFrameRate( cdp_header, CaptionTime* );
 
 /*----------------------------------------------------------------------------*/
@@ -70,6 +113,23 @@ LinkInfo MccDecodeInitialize( Context* rootCtxPtr ) {
     rootCtxPtr->mccDecodeCtxPtr = malloc(sizeof(MccDecodeCtx));
 
     rootCtxPtr->mccDecodeCtxPtr->numCcCountMismatches = 0;
+    rootCtxPtr->mccDecodeCtxPtr->threadPoolPtr = NULL;
+    rootCtxPtr->mccDecodeCtxPtr->batchLines = NULL;
+    rootCtxPtr->mccDecodeCtxPtr->numBatchLines = 0;
+    rootCtxPtr->mccDecodeCtxPtr->batchChars = NULL;
+    rootCtxPtr->mccDecodeCtxPtr->numBatchChars = 0;
+    rootCtxPtr->mccDecodeCtxPtr->maxBatchChars = 0;
+    rootCtxPtr->mccDecodeCtxPtr->framesBufferPtr = NULL;
+
+    if( rootCtxPtr->config.numThreads > 1 ) {
+        rootCtxPtr->mccDecodeCtxPtr->threadPoolPtr = ThreadPoolCreate(rootCtxPtr->config.numThreads);
+    }
+
+    if( rootCtxPtr->mccDecodeCtxPtr->threadPoolPtr != NULL ) {
+        rootCtxPtr->mccDecodeCtxPtr->batchLines = malloc(MCC_DECODE_BATCH_LINES * sizeof(MccDecodeLine));
+        rootCtxPtr->mccDecodeCtxPtr->maxBatchChars = MCC_DECODE_BATCH_LINES * MCC_MAX_LINE_LENGTH;
+        rootCtxPtr->mccDecodeCtxPtr->batchChars = malloc(rootCtxPtr->mccDecodeCtxPtr->maxBatchChars);
+    }
 
     InitSinks(&rootCtxPtr->mccDecodeCtxPtr->sinks, MCC_DATA___CC_DATA);
 
@@ -122,8 +182,9 @@ boolean MccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
  |            All other codes specified in header.
  |
  | DESCRIPTION:
- |    This method processes an incoming buffer, expanding and the decoding the
- |    mcc data inside of it.
+ |    This method processes an incoming buffer, decoding the mcc data inside of
+ |    it straight into cc_data. When decoding with multiple threads, the line is
+ |    batched up instead, and the whole batch is decoded once it fills up.
  -------------------------------------------------------------------------------*/
 uint8 MccDecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(inBuffer);
@@ -131,11 +192,19 @@ uint8 MccDecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(inBuffer->numElements);
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->mccDecodeCtxPtr);
-    
-    Buffer* expandedBuffer = expandMccLine( inBuffer );
-    Buffer* decodedBuffer = decodeMccLine( ((Context*)rootCtxPtr)->mccDecodeCtxPtr, expandedBuffer );
-    
-    return PassToSinks(rootCtxPtr, decodedBuffer, &((Context*)rootCtxPtr)->mccDecodeCtxPtr->sinks);
+    MccDecodeCtx* ctxPtr = ((Context*)rootCtxPtr)->mccDecodeCtxPtr;
+
+    if( ctxPtr->threadPoolPtr != NULL ) {
+        return batchMccLine(rootCtxPtr, inBuffer);
+    }
+
+    MccDecodeLine decodedLine;
+    decodedLine.captionTime = inBuffer->captionTime;
+    decodedLine.numChars = inBuffer->numElements;
+    decodeMccLine(ctxPtr, (char*)inBuffer->dataPtr, &decodedLine);
+    FreeBuffer(inBuffer);
+
+    return passDecodedLine(rootCtxPtr, &decodedLine);
 }  // MccDecodeProcNextBuffer()
 
 /*------------------------------------------------------------------------------
@@ -158,16 +227,32 @@ uint8 MccDecodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
 uint8 MccDecodeShutdown( void* rootCtxPtr ) {
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->mccDecodeCtxPtr);
-    Sinks sinks = ((Context*)rootCtxPtr)->mccDecodeCtxPtr->sinks;
+    MccDecodeCtx* ctxPtr = ((Context*)rootCtxPtr)->mccDecodeCtxPtr;
+    Sinks sinks = ctxPtr->sinks;
+    uint8 retval = TRUE;
+
+    if( ctxPtr->threadPoolPtr != NULL ) {
+        retval = decodeBatch(rootCtxPtr);
+        ThreadPoolDestroy(ctxPtr->threadPoolPtr);
+        free(ctxPtr->batchLines);
+        free(ctxPtr->batchChars);
+    }
 
-    if( ((Context*)rootCtxPtr)->mccDecodeCtxPtr->numCcCountMismatches > 6 ) {
-        LOG(DEBUG_LEVEL_INFO, DBG_MCC_DEC, "Suppressed %d additional occurrences of the warning for CC Count Mismatches", ((Context*)rootCtxPtr)->mccDecodeCtxPtr->numCcCountMismatches - 6);
+    if( FlushFramesToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &sinks) == PIPELINE_FAILURE ) {
+        retval = FALSE;
     }
 
-    free(((Context*)rootCtxPtr)->mccDecodeCtxPtr);
+    if( ctxPtr->numCcCountMismatches > 6 ) {
+        LOG(DEBUG_LEVEL_INFO, DBG_MCC_DEC, "Suppressed %d additional occurrences of the warning for CC Count Mismatches", ctxPtr->numCcCountMismatches - 6);
+    }
+
+    free(ctxPtr);
     ((Context*)rootCtxPtr)->mccDecodeCtxPtr = NULL;
 
-    return ShutdownSinks(rootCtxPtr, &sinks);
+    if( ShutdownSinks(rootCtxPtr, &sinks) == FALSE ) {
+        retval = FALSE;
+    }
+    return retval;
 }  // MccDecodeShutdown()
 
 /*----------------------------------------------------------------------------*/
@@ -176,94 +261,107 @@ uint8 MccDecodeShutdown( void* rootCtxPtr ) {
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    expandMccLine()
+ |    batchMccLine()
  |
  | DESCRIPTION:
- |    This method uses the Telestream specified character expansion.
- |
- |    ANC data bytes may be represented by one ASCII character according
- |    to the following schema:
- |      G  FAh 00h 00h
- |      H  2 x (FAh 00h 00h)
- |      I  3 x (FAh 00h 00h)
- |      J  4 x (FAh 00h 00h)
- |      K  5 x (FAh 00h 00h)
- |      L  6 x (FAh 00h 00h)
- |      M  7 x (FAh 00h 00h)
- |      N  8 x (FAh 00h 00h)
- |      O  9 x (FAh 00h 00h)
- |      P  FBh 80h 80h
- |      Q  FCh 80h 80h
- |      R  FDh 80h 80h
- |      S  96h 69h
- |      T  61h 01h
- |      U  E1h 00h 00h 00h
- |      Z  00h
+ |    This function copies an MCC line into the current batch and releases the
+ |    buffer that carried it, so that the buffer pool is not held up while the
+ |    batch fills. A full batch is decoded and passed down the pipeline.
  -------------------------------------------------------------------------------*/
-static Buffer* expandMccLine( Buffer* buffPtr ) {
-    ASSERT(buffPtr);
-    ASSERT(buffPtr->dataPtr);
-    ASSERT(buffPtr->numElements);
-    char* mccdata = (char*)buffPtr->dataPtr;
-    
-    // Detrmine how much data to allocate for the expanded line
-    size_t size = 0;
-    for( int loop = 0; loop < buffPtr->numElements; loop++ ) {
-        size = size + mccCharCount(mccdata[loop]);
+static uint8 batchMccLine( Context* rootCtxPtr, Buffer* inBuffer ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(inBuffer);
+    MccDecodeCtx* ctxPtr = rootCtxPtr->mccDecodeCtxPtr;
+    ASSERT(ctxPtr->numBatchLines < MCC_DECODE_BATCH_LINES);
+
+    if( (ctxPtr->numBatchChars + inBuffer->numElements) > ctxPtr->maxBatchChars ) {
+        ctxPtr->maxBatchChars = (ctxPtr->maxBatchChars * 2) + inBuffer->numElements;
+        ctxPtr->batchChars = realloc(ctxPtr->batchChars, ctxPtr->maxBatchChars);
     }
-    
-    ASSERT((size%2) == 0);
-    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, (size/2));
-    outputBuffer->captionTime = buffPtr->captionTime;
-    
-    for( int loop = 0; loop < buffPtr->numElements; ) {
-        if( ((mccdata[loop] >= 'G') && (mccdata[loop] <= 'Z')) || ((mccdata[loop] >= 'g') && (mccdata[loop] <= 'z')) ) {
-            expandMccCode( mccdata[loop], outputBuffer->dataPtr, &outputBuffer->numElements );
-            loop++;
-        } else if( ((mccdata[loop] >= 'A') && (mccdata[loop] <= 'F')) || ((mccdata[loop] >= 'a') && (mccdata[loop] <= 'f')) || ((mccdata[loop] >= '0') && (mccdata[loop] <= '9')) ) {
-            if( isHexByteValid(mccdata[loop], mccdata[(loop+1)]) == TRUE ) {
-                outputBuffer->dataPtr[outputBuffer->numElements] = byteFromNibbles(mccdata[loop], mccdata[(loop+1)]);
-                outputBuffer->numElements++;
-            } else  {
-                LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "At %02d:%02d:%02d:%02d Unable to parse MCC Values %c %c - %s",
-                    buffPtr->captionTime.hour, buffPtr->captionTime.minute, buffPtr->captionTime.second,
-                    buffPtr->captionTime.frame, mccdata[loop], mccdata[(loop+1)], &mccdata[loop] );
-            }
-            loop = loop + 2;
-        } else {
-            if( (mccdata[loop] != '\r') && (mccdata[loop] != '\n') ) {
-                LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "At %02d:%02d:%02d:%02d Ignoring Spurious Character: %c",
-                    buffPtr->captionTime.hour, buffPtr->captionTime.minute, buffPtr->captionTime.second,
-                    buffPtr->captionTime.frame, mccdata[loop] );
-            }
-            loop++;
-        }
+
+    MccDecodeLine* linePtr = &ctxPtr->batchLines[ctxPtr->numBatchLines];
+    linePtr->captionTime = inBuffer->captionTime;
+    linePtr->charOffset = ctxPtr->numBatchChars;
+    linePtr->numChars = inBuffer->numElements;
+    memcpy(&ctxPtr->batchChars[ctxPtr->numBatchChars], inBuffer->dataPtr, inBuffer->numElements);
+    ctxPtr->numBatchChars = ctxPtr->numBatchChars + inBuffer->numElements;
+    ctxPtr->numBatchLines++;
+    FreeBuffer(inBuffer);
+
+    if( ctxPtr->numBatchLines == MCC_DECODE_BATCH_LINES ) {
+        return decodeBatch(rootCtxPtr);
     }
-    ASSERT(outputBuffer->numElements <= outputBuffer->maxNumElements);
-
-#if 0
-    for( int loop = 0; loop < outputBuffer->numElements; loop++ ) {
-        if( loop == 0 ) {
-            printf("\n%02d:%02d:%02d;%02d - %02X ",
-                   outputBuffer->captionTime.hour, outputBuffer->captionTime.minute,
-                   outputBuffer->captionTime.second, outputBuffer->captionTime.frame,
-                   outputBuffer->dataPtr[loop]);
-        } else {
-            printf("%02X ", outputBuffer->dataPtr[loop]);
+    return TRUE;
+}  // batchMccLine()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeBatch()
+ |
+ | DESCRIPTION:
+ |    This function decodes every line in the current batch on the thread pool,
+ |    and then passes the resulting cc_data down the pipeline in the order that
+ |    the lines appeared in the file.
+ -------------------------------------------------------------------------------*/
+static uint8 decodeBatch( Context* rootCtxPtr ) {
+    ASSERT(rootCtxPtr);
+    MccDecodeCtx* ctxPtr = rootCtxPtr->mccDecodeCtxPtr;
+    uint8 retval = TRUE;
+
+    uint32 numTasks = (ctxPtr->numBatchLines + MCC_DECODE_LINES_PER_TASK - 1) / MCC_DECODE_LINES_PER_TASK;
+    ThreadPoolRun(ctxPtr->threadPoolPtr, &decodeBatchTask, ctxPtr, numTasks);
+
+    for( int loop = 0; loop < ctxPtr->numBatchLines; loop++ ) {
+        uint8 tmp = passDecodedLine(rootCtxPtr, &ctxPtr->batchLines[loop]);
+        if( tmp != TRUE ) {
+            retval = tmp;
         }
     }
-#endif
-    
-    FreeBuffer(buffPtr);
-    return outputBuffer;
-    
-#if 0
-    char tmpBuffer[512];
-    PrintCaptionsLine( tmpBuffer, 512, outputBuffer->dataPtr );
-    tmpBuffer[(strlen(tmpBuffer)-3)] = '\0';
-    printf("%s -- Size: %lu\n", tmpBuffer, (size/2));
-#endif
-}  // expandMccLine()
+
+    ctxPtr->numBatchLines = 0;
+    ctxPtr->numBatchChars = 0;
+    return retval;
+}  // decodeBatch()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    decodeBatchTask()
+ |
+ | DESCRIPTION:
+ |    This function is run on the thread pool, and decodes a single run of
+ |    MCC_DECODE_LINES_PER_TASK lines from the current batch.
+ -------------------------------------------------------------------------------*/
+static void decodeBatchTask( void* ctxVoidPtr, uint32 taskIndex ) {
+    MccDecodeCtx* ctxPtr = (MccDecodeCtx*)ctxVoidPtr;
+    uint32 firstLine = taskIndex * MCC_DECODE_LINES_PER_TASK;
+    uint32 lastLine = firstLine + MCC_DECODE_LINES_PER_TASK;
+
+    if( lastLine > ctxPtr->numBatchLines ) {
+        lastLine = ctxPtr->numBatchLines;
+    }
+
+    for( uint32 loop = firstLine; loop < lastLine; loop++ ) {
+        MccDecodeLine* linePtr = &ctxPtr->batchLines[loop];
+        decodeMccLine(ctxPtr, &ctxPtr->batchChars[linePtr->charOffset], linePtr);
+    }
+}  // decodeBatchTask()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    passDecodedLine()
+ |
+ | DESCRIPTION:
+ |    This function passes the cc_data decoded from an MCC line down the pipeline,
+ |    as a frame of its own or gathered with the frames around it.
+ -------------------------------------------------------------------------------*/
+static uint8 passDecodedLine( Context* rootCtxPtr, MccDecodeLine* linePtr ) {
+    ASSERT(rootCtxPtr);
+    ASSERT(linePtr);
+    MccDecodeCtx* ctxPtr = rootCtxPtr->mccDecodeCtxPtr;
+
+    return PassFrameToSinks(rootCtxPtr, &ctxPtr->framesBufferPtr, &linePtr->captionTime,
+                            linePtr->ccData, linePtr->numCcDataBytes, &ctxPtr->sinks);
+}  // passDecodedLine()
 
 /*------------------------------------------------------------------------------
  | NAME:
@@ -280,64 +378,77 @@ static Buffer* expandMccLine( Buffer* buffPtr ) {
  |    SMPTE ST 334-2 - Caption Distribution Packet (CDP) Definition
  |                     (Specifically: SMPTE ST 334-2:2015 - Revision of SMPTE 334-2-2007)
  |    CEA-708-D - CEA Standard - Digital Television (DTV) Closed Captioning - August 2008
+ |
+ |    The compressed MCC characters are expanded as the packet is parsed, so the
+ |    cc_data constructs are written straight into the decoded line. This may run
+ |    on several threads at once, so it must not touch the buffer pool.
  -------------------------------------------------------------------------------*/
-static Buffer* decodeMccLine( MccDecodeCtx* ctxPtr, Buffer* buffPtr ) {
-    ASSERT(buffPtr);
-    ASSERT(buffPtr->dataPtr);
-    ASSERT(buffPtr->numElements);
-    uint8 dataCount;
+static void decodeMccLine( MccDecodeCtx* ctxPtr, char* mccChars, MccDecodeLine* linePtr ) {
+    ASSERT(mccChars);
+    ASSERT(linePtr);
+    ASSERT(linePtr->numChars);
+    uint8 tmpBytes[7];
     boolean timeCodeSectionPresent = FALSE;
     boolean srvcInfoSectionPresent = FALSE;
-    
-    uint8* tmpPtr = buffPtr->dataPtr;
-    
-    ANC_packet* ancPacketPtr = (ANC_packet*)tmpPtr;
-    
-    if( ancPacketPtr->did != ANC_DID_CLOSED_CAPTIONING ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Unexepected DID: 0x%02X vs 0x%02X", ancPacketPtr->did, ANC_DID_CLOSED_CAPTIONING);
+
+    MccLineReader reader;
+    reader.mccChars = mccChars;
+    reader.numChars = linePtr->numChars;
+    reader.charIndex = 0;
+    reader.codePtr = NULL;
+    reader.codeByteIndex = 0;
+    reader.codeRepeatsLeft = 0;
+    reader.isExhausted = FALSE;
+    reader.captionTimePtr = &linePtr->captionTime;
+
+    ANC_packet ancPacket;
+    ancPacket.did = nextMccByte(&reader);
+    ancPacket.sdid = nextMccByte(&reader);
+    ancPacket.dc = nextMccByte(&reader);
+
+    if( ancPacket.did != ANC_DID_CLOSED_CAPTIONING ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Unexepected DID: 0x%02X vs 0x%02X", ancPacket.did, ANC_DID_CLOSED_CAPTIONING);
     }
-    
-    if( ancPacketPtr->sdid != ANC_SDID_CEA_708 ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Unexepected SDID: 0x%02X vs 0x%02X (0x%02X is unexpected CEA-608)", ancPacketPtr->sdid, ANC_SDID_CEA_708, ANC_SDID_CEA_608);
+
+    if( ancPacket.sdid != ANC_SDID_CEA_708 ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Unexepected SDID: 0x%02X vs 0x%02X (0x%02X is unexpected CEA-608)", ancPacket.sdid, ANC_SDID_CEA_708, ANC_SDID_CEA_608);
     }
-    
-    dataCount = ancPacketPtr->dc;
-    
-    tmpPtr = tmpPtr + 3;
+
+    readMccBytes(&reader, tmpBytes, 7);
     cdp_header captionDataPacketHeader;
-    captionDataPacketHeader.cdp_identifier = (tmpPtr[0] << 8) | tmpPtr[1];
-    captionDataPacketHeader.cdp_length = tmpPtr[2];
-    captionDataPacketHeader.cdp_frame_rate = (tmpPtr[3] & 0xF0) >> 4;
-    captionDataPacketHeader.reserved_1 = (tmpPtr[3] & 0x0F);
-    captionDataPacketHeader.time_code_present = (tmpPtr[4] & 0x80) >> 7;
-    captionDataPacketHeader.ccdata_present = (tmpPtr[4] & 0x40) >> 6;
-    captionDataPacketHeader.svcinfo_present = (tmpPtr[4] & 0x20) >> 5;
-    captionDataPacketHeader.svc_info_start = (tmpPtr[4] & 0x10) >> 4;
-    captionDataPacketHeader.svc_info_change = (tmpPtr[4] & 0x08) >> 3;
-    captionDataPacketHeader.svc_info_complete = (tmpPtr[4] & 0x04) >> 2;
-    captionDataPacketHeader.caption_service_active = (tmpPtr[4] & 0x02) >> 1;
-    captionDataPacketHeader.reserved_2 = (tmpPtr[4] & 0x01);
-    captionDataPacketHeader.cdp_hdr_sequence_cntr = (tmpPtr[5] << 8) | tmpPtr[6];
-    
+    captionDataPacketHeader.cdp_identifier = (tmpBytes[0] << 8) | tmpBytes[1];
+    captionDataPacketHeader.cdp_length = tmpBytes[2];
+    captionDataPacketHeader.cdp_frame_rate = (tmpBytes[3] & 0xF0) >> 4;
+    captionDataPacketHeader.reserved_1 = (tmpBytes[3] & 0x0F);
+    captionDataPacketHeader.time_code_present = (tmpBytes[4] & 0x80) >> 7;
+    captionDataPacketHeader.ccdata_present = (tmpBytes[4] & 0x40) >> 6;
+    captionDataPacketHeader.svcinfo_present = (tmpBytes[4] & 0x20) >> 5;
+    captionDataPacketHeader.svc_info_start = (tmpBytes[4] & 0x10) >> 4;
+    captionDataPacketHeader.svc_info_change = (tmpBytes[4] & 0x08) >> 3;
+    captionDataPacketHeader.svc_info_complete = (tmpBytes[4] & 0x04) >> 2;
+    captionDataPacketHeader.caption_service_active = (tmpBytes[4] & 0x02) >> 1;
+    captionDataPacketHeader.reserved_2 = (tmpBytes[4] & 0x01);
+    captionDataPacketHeader.cdp_hdr_sequence_cntr = (tmpBytes[5] << 8) | tmpBytes[6];
+
     if( captionDataPacketHeader.cdp_identifier != CDP_IDENTIFIER_VALUE ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Unexepected CDP Identifier: 0x%04X vs 0x%04X", captionDataPacketHeader.cdp_identifier, CDP_IDENTIFIER_VALUE);
     }
-    
-    if( captionDataPacketHeader.cdp_length != dataCount ) {
-        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Mismatch in length: 0x%02X vs 0x%02X", captionDataPacketHeader.cdp_length, dataCount);
+
+    if( captionDataPacketHeader.cdp_length != ancPacket.dc ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Mismatch in length: 0x%02X vs 0x%02X", captionDataPacketHeader.cdp_length, ancPacket.dc);
     }
-    
-    decodeFrameRate( captionDataPacketHeader, &buffPtr->captionTime );
-    
+
+    decodeFrameRate( captionDataPacketHeader, &linePtr->captionTime );
+
     if( captionDataPacketHeader.time_code_present == TRUE ) {
         timeCodeSectionPresent = TRUE;
         LOG(DEBUG_LEVEL_INFO, DBG_MCC_DEC, "Time Code Present");
     }
-    
+
     if( captionDataPacketHeader.ccdata_present != TRUE ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Missing CC Data");
     }
-    
+
     if( captionDataPacketHeader.svcinfo_present == TRUE ) {
         srvcInfoSectionPresent = TRUE;
     }
@@ -346,329 +457,175 @@ static Buffer* decodeMccLine( MccDecodeCtx* ctxPtr, Buffer* buffPtr ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Caption Service Active should be True");
     }
 
-    tmpPtr = tmpPtr + 7;
-    
     if( timeCodeSectionPresent == TRUE ) {
         time_code_section timeCodeSection;
-        timeCodeSection.time_code_section_id = tmpPtr[0];
-        
+        timeCodeSection.time_code_section_id = nextMccByte(&reader);
+
         if( timeCodeSection.time_code_section_id != TIME_CODE_ID ) {
             LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Invalid Time Code ID: 0x%02X vs 0x%02X", timeCodeSection.time_code_section_id, TIME_CODE_ID);
         }
-        
-        tmpPtr = tmpPtr + sizeof(time_code_section) - 1;
+
+        readMccBytes(&reader, NULL, sizeof(time_code_section) - 2);
     }
-    
+
     ccdata_section ccData;
-    ccData.ccdata_id = tmpPtr[0];
-    ccData.marker_bits = (tmpPtr[1] & 0xE0) >> 5;
-    ccData.cc_count = (tmpPtr[1] & 0x1F);
-    
-    tmpPtr = tmpPtr + 2;
-    
+    ccData.ccdata_id = nextMccByte(&reader);
+    tmpBytes[0] = nextMccByte(&reader);
+    ccData.marker_bits = (tmpBytes[0] & 0xE0) >> 5;
+    ccData.cc_count = (tmpBytes[0] & 0x1F);
+
     if( ccData.ccdata_id != CC_DATA_ID ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Invalid CCData ID: 0x%02X vs 0x%02X", ccData.ccdata_id, CC_DATA_ID);
     }
-    
-    uint8 computedNumCcConstructs = numCcConstructsFromFramerate(buffPtr->captionTime.frameRatePerSecTimesOneHundred);
+
+    uint8 computedNumCcConstructs = numCcConstructsFromFramerate(linePtr->captionTime.frameRatePerSecTimesOneHundred);
     if( ccData.cc_count != computedNumCcConstructs ) {
-        if( ctxPtr->numCcCountMismatches < 5 ) {
+        uint32 numCcCountMismatches = __atomic_fetch_add(&ctxPtr->numCcCountMismatches, 1, __ATOMIC_RELAXED);
+        if( numCcCountMismatches < 5 ) {
             LOG(DEBUG_LEVEL_WARN, DBG_MCC_DEC, "Unexpected Number of CC Constructs: %d vs %d", ccData.cc_count, computedNumCcConstructs);
-        } else if( ctxPtr->numCcCountMismatches == 5 ) {
+        } else if( numCcCountMismatches == 5 ) {
             LOG(DEBUG_LEVEL_WARN, DBG_MCC_DEC, "Unexpected Number of CC Constructs: %d vs %d --- Suppressing Subsequent Warnings.", ccData.cc_count, computedNumCcConstructs);
         } else {
             LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_DEC, "Unexpected Number of CC Constructs: %d vs %d", ccData.cc_count, computedNumCcConstructs);
         }
-        ctxPtr->numCcCountMismatches++;
     }
-    
-    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, (ccData.cc_count * sizeof(cc_construct)));
-    outputBuffer->captionTime = buffPtr->captionTime;
-    outputBuffer->numElements = (ccData.cc_count * sizeof(cc_construct));
-    
-    memcpy(outputBuffer->dataPtr, tmpPtr, (ccData.cc_count * sizeof(cc_construct)));
-    
-    tmpPtr = tmpPtr + (ccData.cc_count * (sizeof(cc_construct)));
+
+    linePtr->numCcDataBytes = ccData.cc_count * sizeof(cc_construct);
+    readMccBytes(&reader, linePtr->ccData, linePtr->numCcDataBytes);
 
     if( srvcInfoSectionPresent == TRUE ) {
         ccsvcinfo_section srvcInfo;
-        srvcInfo.ccsvcinfo_id = tmpPtr[0];
-        srvcInfo.svc_count = (tmpPtr[1] & 0x0F);
- 
+        srvcInfo.ccsvcinfo_id = nextMccByte(&reader);
+        srvcInfo.svc_count = (nextMccByte(&reader) & 0x0F);
+
         if( srvcInfo.ccsvcinfo_id != CCS_SVCINFO_ID ) {
             LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Invalid Srvc Info ID: 0x%02X vs 0x%02X", srvcInfo.ccsvcinfo_id, CCS_SVCINFO_ID);
         }
 
-        // 2 Byte Preamble + (Number of Services * 7 Bytes)
-        tmpPtr = tmpPtr + 2 + (7 * srvcInfo.svc_count);
+        // Number of Services * 7 Bytes, following the 2 Byte Preamble
+        readMccBytes(&reader, NULL, (7 * srvcInfo.svc_count));
     }
-    
+
     cdp_footer cdpFooter;
-    cdpFooter.cdp_footer_id = tmpPtr[0];
-    
-    if( cdpFooter.cdp_footer_id != CDP_FOOTER_ID ) {
+    cdpFooter.cdp_footer_id = nextMccByte(&reader);
+
+    if( reader.isExhausted == TRUE ) {
+        LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "At %02d:%02d:%02d:%02d MCC Line ended before the CDP Footer",
+            linePtr->captionTime.hour, linePtr->captionTime.minute, linePtr->captionTime.second, linePtr->captionTime.frame );
+    } else if( cdpFooter.cdp_footer_id != CDP_FOOTER_ID ) {
         LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "Invalid CDP Footer ID: 0x%02X vs 0x%02X", cdpFooter.cdp_footer_id, CDP_FOOTER_ID);
     }
-    
-    FreeBuffer(buffPtr);
 
-    ASSERT(outputBuffer->numElements <= outputBuffer->maxNumElements);
-    return outputBuffer;
-    
-#if 0
-    char tmpBuffer[512];
-    PrintCaptionsLine( tmpBuffer, 512, buffPtr->dataPtr );
-    tmpBuffer[(strlen(tmpBuffer)-3)] = '\0';
-    printf("%s -- %d CC Constructs\n", tmpBuffer, ccData.cc_count);
-#endif
+    // Run out the rest of the line, so that any malformed characters are still reported
+    while( reader.isExhausted == FALSE ) {
+        nextMccByte(&reader);
+    }
 }  // decodeMccLine()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    mccCharCount()
+ |    nextMccByte()
  |
  | DESCRIPTION:
- |    This function determines the resulting number of charcters from expansion
- |    of a specific character.
- |
- |    Per the description in the MCC File:
- |
- |    ANC data bytes may be represented by one ASCII character according
- |    to the following schema:
- |      G  FAh 00h 00h
- |      H  2 x (FAh 00h 00h)
- |      I  3 x (FAh 00h 00h)
- |      J  4 x (FAh 00h 00h)
- |      K  5 x (FAh 00h 00h)
- |      L  6 x (FAh 00h 00h)
- |      M  7 x (FAh 00h 00h)
- |      N  8 x (FAh 00h 00h)
- |      O  9 x (FAh 00h 00h)
- |      P  FBh 80h 80h
- |      Q  FCh 80h 80h
- |      R  FDh 80h 80h
- |      S  96h 69h
- |      T  61h 01h
- |      U  E1h 00h 00h 00h
- |      Z  00h
+ |    This function returns the next ANC data byte from an MCC line, expanding the
+ |    compressed codes as it goes using mccCharTable. Hex pairs which cannot be
+ |    parsed and spurious characters are reported and skipped. Once the line is
+ |    used up, the reader is flagged as exhausted and zero is returned.
  -------------------------------------------------------------------------------*/
-static uint8 mccCharCount( char character ) {
-    uint8 retval;
-    
-    switch( character ) {
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-        case 'A':
-        case 'B':
-        case 'C':
-        case 'D':
-        case 'E':
-        case 'F':
-            retval = 1;
-            break;
-        case 'G':  // G  FAh 00h 00h
-        case 'g':  // G  FAh 00h 00h
-            retval = 6;
-            break;
-        case 'H':  // H  2 x (FAh 00h 00h)
-        case 'h':  // H  2 x (FAh 00h 00h)
-            retval = 12;
-            break;
-        case 'I':  // I  3 x (FAh 00h 00h)
-        case 'i':  // I  3 x (FAh 00h 00h)
-            retval = 18;
-            break;
-        case 'J':  // J  4 x (FAh 00h 00h)
-        case 'j':  // J  4 x (FAh 00h 00h)
-            retval = 24;
-            break;
-        case 'K':  // K  5 x (FAh 00h 00h)
-        case 'k':  // K  5 x (FAh 00h 00h)
-            retval = 30;
-            break;
-        case 'L':  // L  6 x (FAh 00h 00h)
-        case 'l':  // L  6 x (FAh 00h 00h)
-            retval = 36;
-            break;
-        case 'M':  // M  7 x (FAh 00h 00h)
-        case 'm':  // M  7 x (FAh 00h 00h)
-            retval = 42;
-            break;
-        case 'N':  // N  8 x (FAh 00h 00h)
-        case 'n':  // N  8 x (FAh 00h 00h)
-            retval = 48;
-            break;
-        case 'O':  // O  9 x (FAh 00h 00h)
-        case 'o':  // O  9 x (FAh 00h 00h)
-            retval = 54;
-            break;
-        case 'P':  // P  FBh 80h 80h
-        case 'p':  // P  FBh 80h 80h
-        case 'Q':  // Q  FCh 80h 80h
-        case 'q':  // Q  FCh 80h 80h
-        case 'R':  // R  FDh 80h 80h
-        case 'r':  // R  FDh 80h 80h
-            retval = 6;
-            break;
-        case 'S':  // S  96h 69h
-        case 's':  // S  96h 69h
-        case 'T':  // T  61h 01h
-        case 't':  // T  61h 01h
-            retval = 4;
-            break;
-        case 'U':  // U  E1h 00h 00h 00h
-        case 'u':  // U  E1h 00h 00h 00h
-            retval = 8;
-            break;
-        case 'Z':  // Z  00h
-        case 'z':  // Z  00h
-            retval = 2;
-            break;
-        default:
-            retval = 0;
-            break;
-    }
-    return retval;
-}  // mccCharCount()
+static uint8 nextMccByte( MccLineReader* readerPtr ) {
+    ASSERT(readerPtr);
+
+    while( TRUE ) {
+        if( readerPtr->codePtr != NULL ) {
+            uint8 byte = readerPtr->codePtr->bytes[readerPtr->codeByteIndex];
+            readerPtr->codeByteIndex++;
+            if( readerPtr->codeByteIndex == readerPtr->codePtr->numBytes ) {
+                readerPtr->codeByteIndex = 0;
+                readerPtr->codeRepeatsLeft--;
+                if( readerPtr->codeRepeatsLeft == 0 ) {
+                    readerPtr->codePtr = NULL;
+                }
+            }
+            return byte;
+        }
 
-/*------------------------------------------------------------------------------
- | NAME:
- |    expandMccCode()
- |
- | DESCRIPTION:
- |    This is just a conveinece function to save from cut and paste.
- -------------------------------------------------------------------------------*/
-static void addMultipleFaZeroZero( uint8 number, uint8* lineBytesPtr, uint16* numLineBytesPtr ) {
-    
-    for( int loop = 0; loop < number; loop++ ) {
-        lineBytesPtr[(*numLineBytesPtr)++] = 0xFA;
-        lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-        lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
+        if( readerPtr->charIndex >= readerPtr->numChars ) {
+            readerPtr->isExhausted = TRUE;
+            return 0;
+        }
+
+        char* mccdata = &readerPtr->mccChars[readerPtr->charIndex];
+        const MccCharCode* codePtr = &mccCharTable[(uint8)mccdata[0]];
+
+        switch( codePtr->charType ) {
+            case MCC_CHAR_HEX_DIGIT:
+            {
+                uint16 numCharsLeft = readerPtr->numChars - readerPtr->charIndex;
+                char lsn = (numCharsLeft > 1) ? mccdata[1] : '\0';
+                readerPtr->charIndex = readerPtr->charIndex + 2;
+                if( mccCharTable[(uint8)lsn].charType == MCC_CHAR_HEX_DIGIT ) {
+                    return (codePtr->nibble << 4) | mccCharTable[(uint8)lsn].nibble;
+                }
+                LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "At %02d:%02d:%02d:%02d Unable to parse MCC Values %c %c - %.*s",
+                    readerPtr->captionTimePtr->hour, readerPtr->captionTimePtr->minute, readerPtr->captionTimePtr->second,
+                    readerPtr->captionTimePtr->frame, mccdata[0], lsn, numCharsLeft, mccdata );
+                break;
+            }
+            case MCC_CHAR_EXPANSION_CODE:
+                readerPtr->codePtr = codePtr;
+                readerPtr->codeByteIndex = 0;
+                readerPtr->codeRepeatsLeft = codePtr->numRepeats;
+                readerPtr->charIndex++;
+                break;
+            case MCC_CHAR_UNDEFINED_CODE:
+                LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Invalid Replacement Char: %c", mccdata[0]);
+                readerPtr->charIndex++;
+                break;
+            case MCC_CHAR_LINE_END:
+                readerPtr->charIndex++;
+                break;
+            default:
+                LOG(DEBUG_LEVEL_ERROR, DBG_MCC_DEC, "At %02d:%02d:%02d:%02d Ignoring Spurious Character: %c",
+                    readerPtr->captionTimePtr->hour, readerPtr->captionTimePtr->minute, readerPtr->captionTimePtr->second,
+                    readerPtr->captionTimePtr->frame, mccdata[0] );
+                readerPtr->charIndex++;
+                break;
+        }
     }
-}  // addMultipleFaZeroZero()
+}  // nextMccByte()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    expandMccCode()
+ |    readMccBytes()
  |
  | DESCRIPTION:
- |    This function determines the resulting number of charcters from expansion
- |    of a specific character.
- |
- |    Per the description in the MCC File:
- |
- |    ANC data bytes may be represented by one ASCII character according
- |    to the following schema:
- |      G  FAh 00h 00h
- |      H  2 x (FAh 00h 00h)
- |      I  3 x (FAh 00h 00h)
- |      J  4 x (FAh 00h 00h)
- |      K  5 x (FAh 00h 00h)
- |      L  6 x (FAh 00h 00h)
- |      M  7 x (FAh 00h 00h)
- |      N  8 x (FAh 00h 00h)
- |      O  9 x (FAh 00h 00h)
- |      P  FBh 80h 80h
- |      Q  FCh 80h 80h
- |      R  FDh 80h 80h
- |      S  96h 69h
- |      T  61h 01h
- |      U  E1h 00h 00h 00h
- |      Z  00h
+ |    This function reads the next run of ANC data bytes from an MCC line into
+ |    the destination, or simply skips over them if the destination is NULL.
+ |    Runs of uncompressed hex are converted in bulk.
  -------------------------------------------------------------------------------*/
-static void expandMccCode( uint8 code, uint8* lineBytesPtr, uint16* numLineBytesPtr ) {
-    
-    switch( code ) {
-        case 'G':  // G  FAh 00h 00h
-        case 'g':  // G  FAh 00h 00h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0xFA;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            break;
-        case 'H':  // H  2 x (FAh 00h 00h)
-        case 'h':  // H  2 x (FAh 00h 00h)
-            addMultipleFaZeroZero(2, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'I':  // I  3 x (FAh 00h 00h)
-        case 'i':  // I  3 x (FAh 00h 00h)
-            addMultipleFaZeroZero(3, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'J':  // J  4 x (FAh 00h 00h)
-        case 'j':  // J  4 x (FAh 00h 00h)
-            addMultipleFaZeroZero(4, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'K':  // K  5 x (FAh 00h 00h)
-        case 'k':  // K  5 x (FAh 00h 00h)
-            addMultipleFaZeroZero(5, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'L':  // L  6 x (FAh 00h 00h)
-        case 'l':  // L  6 x (FAh 00h 00h)
-            addMultipleFaZeroZero(6, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'M':  // M  7 x (FAh 00h 00h)
-        case 'm':  // M  7 x (FAh 00h 00h)
-            addMultipleFaZeroZero(7, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'N':  // N  8 x (FAh 00h 00h)
-        case 'n':  // N  8 x (FAh 00h 00h)
-            addMultipleFaZeroZero(8, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'O':  // O  9 x (FAh 00h 00h)
-        case 'o':  // O  9 x (FAh 00h 00h)
-            addMultipleFaZeroZero(9, lineBytesPtr, numLineBytesPtr);
-            break;
-        case 'P':  // P  FBh 80h 80h
-        case 'p':  // P  FBh 80h 80h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0xFB;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            break;
-        case 'Q':  // Q  FCh 80h 80h
-        case 'q':  // Q  FCh 80h 80h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0xFC;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            break;
-        case 'R':  // R  FDh 80h 80h
-        case 'r':  // R  FDh 80h 80h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0xFD;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x80;
-            break;
-        case 'S':  // S  96h 69h
-        case 's':  // S  96h 69h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x96;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x69;
-            break;
-        case 'T':  // T  61h 01h
-        case 't':  // T  61h 01h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x61;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x01;
-            break;
-        case 'U':  // U  E1h 00h 00h 00h
-        case 'u':  // U  E1h 00h 00h 00h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0xE1;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            break;
-        case 'Z':  // Z  00h
-        case 'z':  // Z  00h
-            lineBytesPtr[(*numLineBytesPtr)++] = 0x00;
-            break;
-        default:
-            LOG(DEBUG_LEVEL_ERROR, DBG_FILE_IN, "Invalid Replacement Char: %c", code);
-            break;
+static void readMccBytes( MccLineReader* readerPtr, uint8* destPtr, uint16 numBytes ) {
+    ASSERT(readerPtr);
+    uint16 loop = 0;
+
+    while( loop < numBytes ) {
+        if( (destPtr != NULL) && (readerPtr->codePtr == NULL) ) {
+            uint16 numPairsLeft = (readerPtr->numChars - readerPtr->charIndex) / 2;
+            uint16 numToConvert = ((numBytes - loop) < numPairsLeft) ? (numBytes - loop) : numPairsLeft;
+            uint16 numConverted = bytesFromHex(&readerPtr->mccChars[readerPtr->charIndex], numToConvert, &destPtr[loop]);
+            readerPtr->charIndex = readerPtr->charIndex + (numConverted * 2);
+            loop = loop + numConverted;
+            if( loop == numBytes ) {
+                break;
+            }
+        }
+
+        uint8 byte = nextMccByte(readerPtr);
+        if( destPtr != NULL ) {
+            destPtr[loop] = byte;
+        }
+        loop++;
     }
-}  // expandMccCode()
+}  // readMccBytes()
 
 /*------------------------------------------------------------------------------
  | NAME:
@@ -46,14 +46,17 @@ const char* DayOfWeekStr[7] = { "Sunday", "Monday", "Tuesday", "Wednesday",
 /*--                     Private Member Declarations                        --*/
 /*----------------------------------------------------------------------------*/
 
+static uint8 encodeFrame( Context*, uint8*, uint16, CaptionTime* );
+static uint8 encodeFillRun( Context*, Buffer* );
 static boolean generateMccHeader( Context*, CaptionTime* );
 static void addFillPacket( Context*, CaptionTime* );
 static uint8 handleSkew( Context*, CaptionTime* );
-static CaptionTime convertCaptionTime( Context*, Buffer* );
+static CaptionTime convertCaptionTime( Context*, CaptionTime*, uint8*, uint16 );
 static boolean sendMccText( Context*, char*, CaptionTime* );
-static Buffer* addBoilerplate( MccEncodeCtx*, Buffer* );
-static uint16 countChars( uint8*, uint16 );
-static void compressData( uint8*, uint16, Buffer* );
+static uint16 buildAncPacket( MccEncodeCtx*, uint8*, uint16, uint32, uint8* );
+static Buffer* generateMccLine( MccEncodeCtx*, uint8*, uint16, CaptionTime* );
+static uint16 compressData( uint8*, uint16, char* );
+static char mccCodeAt( uint8*, uint16, uint8* );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -158,60 +161,23 @@ uint8 MccEncodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
     ASSERT(inBuffer->numElements);
     ASSERT(rootCtxPtr);
     ASSERT(((Context*)rootCtxPtr)->mccEncodeCtxPtr);
-    MccEncodeCtx* ctxPtr = ((Context*)rootCtxPtr)->mccEncodeCtxPtr;
 
-    if( ctxPtr->headerPrinted == FALSE ) {
-        LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "Sending MCC Header.");
-        if( generateMccHeader(rootCtxPtr, &inBuffer->captionTime) == FALSE ) {
-            return FALSE;
-        }
-        ctxPtr->headerPrinted = TRUE;
-        ctxPtr->nextCaptionTime.hour = inBuffer->captionTime.hour;
-        ctxPtr->nextCaptionTime.minute = inBuffer->captionTime.minute;
-        ctxPtr->nextCaptionTime.second = inBuffer->captionTime.second;
-
-        ctxPtr->lastCaptionTime.hour = inBuffer->captionTime.hour;
-        ctxPtr->lastCaptionTime.minute = inBuffer->captionTime.minute;
-        ctxPtr->lastCaptionTime.second = inBuffer->captionTime.second;
+    if( inBuffer->bufferType == BUFFER_TYPE_FILL ) {
+        return encodeFillRun(rootCtxPtr, inBuffer);
+    }
 
-        uint64 frameNumber = inBuffer->captionTime.millisecond * inBuffer->captionTime.frameRatePerSecTimesOneHundred;
-        frameNumber = frameNumber / 100000;
-        if( frameNumber > (inBuffer->captionTime.frameRatePerSecTimesOneHundred / 100) ) {
-            LOG(DEBUG_LEVEL_WARN, DBG_MCC_ENC, "Normalized Frame Number %d to %d", frameNumber, (inBuffer->captionTime.frameRatePerSecTimesOneHundred / 100));
-            frameNumber = inBuffer->captionTime.frameRatePerSecTimesOneHundred / 100;
+    uint8 retval = PIPELINE_SUCCESS;
+    BufferFrame frame;
+    StartBufferFrames(inBuffer, &frame);
+    while( NextBufferFrame(inBuffer, &frame) == TRUE ) {
+        uint8 frameRetval = encodeFrame(rootCtxPtr, &inBuffer->dataPtr[frame.firstElement], frame.numElements, &frame.captionTime);
+        if( frameRetval != PIPELINE_SUCCESS ) {
+            retval = frameRetval;
         }
-        ctxPtr->nextCaptionTime.frame = frameNumber;
-        LOG(DEBUG_LEVEL_INFO, DBG_MCC_ENC, "Captions start at: %02d:%02d:%02d:%02d / %02d:%02d:%02d,%03d",
-            inBuffer->captionTime.hour, inBuffer->captionTime.minute, inBuffer->captionTime.second, frameNumber,
-            inBuffer->captionTime.hour, inBuffer->captionTime.minute, inBuffer->captionTime.second, inBuffer->captionTime.millisecond);
     }
 
-    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "MCC Encoding %d byte packet at time: %02d:%02d:%02d;%02d",
-        inBuffer->numElements, inBuffer->captionTime.hour, inBuffer->captionTime.minute,
-        inBuffer->captionTime.second, inBuffer->captionTime.frame);
-    Buffer* withBoilerPlateBuffer = addBoilerplate(ctxPtr, inBuffer);
-    if( inBuffer->captionTime.source == CAPTION_TIME_PTS_NUMBERING ) {
-        withBoilerPlateBuffer->captionTime = convertCaptionTime(rootCtxPtr, inBuffer);
-    } else {
-        withBoilerPlateBuffer->captionTime = inBuffer->captionTime;
-    }
-    uint16 numCharsNeeded = countChars( withBoilerPlateBuffer->dataPtr, withBoilerPlateBuffer->numElements );
-    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "With CDP Boiler Plate %d byte packet at time: %02d:%02d:%02d;%02d requires %d bytes compressed",
-        withBoilerPlateBuffer->numElements, withBoilerPlateBuffer->captionTime.hour, withBoilerPlateBuffer->captionTime.minute,
-        withBoilerPlateBuffer->captionTime.second, withBoilerPlateBuffer->captionTime.frame, numCharsNeeded);
-    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, (numCharsNeeded + 13));
-    outputBuffer->captionTime = withBoilerPlateBuffer->captionTime;
-    sprintf((char*)outputBuffer->dataPtr, "%02d:%02d:%02d:%02d\t", withBoilerPlateBuffer->captionTime.hour,
-            withBoilerPlateBuffer->captionTime.minute, withBoilerPlateBuffer->captionTime.second,
-            withBoilerPlateBuffer->captionTime.frame);
-    outputBuffer->numElements = 13;
-    compressData( withBoilerPlateBuffer->dataPtr, withBoilerPlateBuffer->numElements, outputBuffer );
-    FreeBuffer(withBoilerPlateBuffer);
-    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "Sending Compressed %d byte packet at time: %02d:%02d:%02d;%02d",
-        outputBuffer->numElements, outputBuffer->captionTime.hour, outputBuffer->captionTime.minute,
-        outputBuffer->captionTime.second, outputBuffer->captionTime.frame);
-    
-    return PassToSinks(rootCtxPtr, outputBuffer, &ctxPtr->sinks);
+    FreeBuffer(inBuffer);
+    return retval;
 }  // MccEncodeProcNextBuffer()
 
 /*------------------------------------------------------------------------------
@@ -277,6 +243,93 @@ uint8 MccEncodeShutdown( void* rootCtxPtr ) {
 /*--                       Private Member Functions                         --*/
 /*----------------------------------------------------------------------------*/
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    encodeFrame()
+ |
+ | DESCRIPTION:
+ |    This function encodes a single frame of CC Data into a line of the MCC
+ |    file, preceded by the MCC header if this is the first frame.
+ -------------------------------------------------------------------------------*/
+static uint8 encodeFrame( Context* rootCtxPtr, uint8* dataPtr, uint16 numElements, CaptionTime* captionTimePtr ) {
+    MccEncodeCtx* ctxPtr = rootCtxPtr->mccEncodeCtxPtr;
+
+    if( ctxPtr->headerPrinted == FALSE ) {
+        LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "Sending MCC Header.");
+        if( generateMccHeader(rootCtxPtr, captionTimePtr) == FALSE ) {
+            return FALSE;
+        }
+        ctxPtr->headerPrinted = TRUE;
+        ctxPtr->nextCaptionTime.hour = captionTimePtr->hour;
+        ctxPtr->nextCaptionTime.minute = captionTimePtr->minute;
+        ctxPtr->nextCaptionTime.second = captionTimePtr->second;
+
+        ctxPtr->lastCaptionTime.hour = captionTimePtr->hour;
+        ctxPtr->lastCaptionTime.minute = captionTimePtr->minute;
+        ctxPtr->lastCaptionTime.second = captionTimePtr->second;
+
+        uint64 frameNumber = captionTimePtr->millisecond * captionTimePtr->frameRatePerSecTimesOneHundred;
+        frameNumber = frameNumber / 100000;
+        if( frameNumber > (captionTimePtr->frameRatePerSecTimesOneHundred / 100) ) {
+            LOG(DEBUG_LEVEL_WARN, DBG_MCC_ENC, "Normalized Frame Number %d to %d", frameNumber, (captionTimePtr->frameRatePerSecTimesOneHundred / 100));
+            frameNumber = captionTimePtr->frameRatePerSecTimesOneHundred / 100;
+        }
+        ctxPtr->nextCaptionTime.frame = frameNumber;
+        LOG(DEBUG_LEVEL_INFO, DBG_MCC_ENC, "Captions start at: %02d:%02d:%02d:%02d / %02d:%02d:%02d,%03d",
+            captionTimePtr->hour, captionTimePtr->minute, captionTimePtr->second, frameNumber,
+            captionTimePtr->hour, captionTimePtr->minute, captionTimePtr->second, captionTimePtr->millisecond);
+    }
+
+    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "MCC Encoding %d byte packet at time: %02d:%02d:%02d;%02d",
+        numElements, captionTimePtr->hour, captionTimePtr->minute,
+        captionTimePtr->second, captionTimePtr->frame);
+    uint8 ancPacket[MCC_MAX_ANC_PACKET_SIZE];
+    uint16 packetLength = buildAncPacket(ctxPtr, dataPtr, numElements,
+                                         captionTimePtr->frameRatePerSecTimesOneHundred, ancPacket);
+    CaptionTime captionTime;
+    if( captionTimePtr->source == CAPTION_TIME_PTS_NUMBERING ) {
+        captionTime = convertCaptionTime(rootCtxPtr, captionTimePtr, dataPtr, numElements);
+    } else {
+        captionTime = *captionTimePtr;
+    }
+    Buffer* outputBuffer = generateMccLine(ctxPtr, ancPacket, packetLength, &captionTime);
+    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "Sending Compressed %d byte packet at time: %02d:%02d:%02d;%02d",
+        outputBuffer->numElements, outputBuffer->captionTime.hour, outputBuffer->captionTime.minute,
+        outputBuffer->captionTime.second, outputBuffer->captionTime.frame);
+    
+    return PassToSinks(rootCtxPtr, outputBuffer, &ctxPtr->sinks);
+}  // encodeFrame()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    encodeFillRun()
+ |
+ | DESCRIPTION:
+ |    This function expands a run of fill frames into a compressed line of fill
+ |    per frame, as the MCC format calls for a line for every frame.
+ -------------------------------------------------------------------------------*/
+static uint8 encodeFillRun( Context* rootCtxPtr, Buffer* inBuffer ) {
+    FillRun* fillRunPtr = (FillRun*)inBuffer->dataPtr;
+    uint32 frameRate = inBuffer->captionTime.frameRatePerSecTimesOneHundred;
+    uint8 ccCount = numCcConstructsFromFramerate(frameRate);
+    uint8 fillData[3 * CC_COUNT_MASK];
+    CaptionTime captionTime = inBuffer->captionTime;
+    uint8 retval = PIPELINE_SUCCESS;
+
+    fillCcData(fillData, ccCount);
+    for( uint32 loop = 0; loop < fillRunPtr->numFrames; loop++ ) {
+        frameToTimeCode( (fillRunPtr->firstFrameNum + loop), frameRate, &captionTime );
+
+        uint8 frameRetval = encodeFrame(rootCtxPtr, fillData, (3 * ccCount), &captionTime);
+        if( frameRetval != PIPELINE_SUCCESS ) {
+            retval = frameRetval;
+        }
+    }
+
+    FreeBuffer(inBuffer);
+    return retval;
+}  // encodeFillRun()
+
 /*------------------------------------------------------------------------------
  | NAME:
  |    generateMccHeader()
@@ -388,38 +441,13 @@ static void addFillPacket( Context* rootCtxPtr, CaptionTime* captionTimePtr ) {
     MccEncodeCtx* ctxPtr = rootCtxPtr->mccEncodeCtxPtr;
     uint8 ccCount = numCcConstructsFromFramerate(captionTimePtr->frameRatePerSecTimesOneHundred);
 
-    Buffer* fillBuffer = NewBuffer(BUFFER_TYPE_BYTES, (ccCount * 3));
-    fillBuffer->numElements = fillBuffer->maxNumElements;
-    fillBuffer->captionTime = *captionTimePtr;
-
-    fillBuffer->dataPtr[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
-    fillBuffer->dataPtr[1] = CEA608_ZERO_WITH_ODD_PARITY;
-    fillBuffer->dataPtr[2] = CEA608_ZERO_WITH_ODD_PARITY;
-    fillBuffer->dataPtr[3] = VALID_CEA608E_LINE21_FIELD_2_CC;
-    fillBuffer->dataPtr[4] = CEA608_ZERO_WITH_ODD_PARITY;
-    fillBuffer->dataPtr[5] = CEA608_ZERO_WITH_ODD_PARITY;
-    uint8* tmpPtr = &fillBuffer->dataPtr[6];
-    for( int loop = 2; loop < ccCount; loop++ ) {
-        tmpPtr[0] = INVALID_DTVCCC_CHANNEL_PACKET_DATA;
-        tmpPtr[1] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
-        tmpPtr[2] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
-        tmpPtr = &tmpPtr[3];
-    }
+    uint8 fillData[3 * CC_COUNT_MASK];
+    uint8 ancPacket[MCC_MAX_ANC_PACKET_SIZE];
 
-    Buffer* withBoilerPlateBuffer = addBoilerplate(ctxPtr, fillBuffer);
-    withBoilerPlateBuffer->captionTime = *captionTimePtr;
-    uint16 numCharsNeeded = countChars( withBoilerPlateBuffer->dataPtr, withBoilerPlateBuffer->numElements );
-    LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "FILL: With CDP Boiler Plate %d byte packet at time: %02d:%02d:%02d;%02d requires %d bytes compressed",
-        withBoilerPlateBuffer->numElements, withBoilerPlateBuffer->captionTime.hour, withBoilerPlateBuffer->captionTime.minute,
-        withBoilerPlateBuffer->captionTime.second, withBoilerPlateBuffer->captionTime.frame, numCharsNeeded);
-    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, (numCharsNeeded + 13));
-    outputBuffer->captionTime = withBoilerPlateBuffer->captionTime;
-    sprintf((char*)outputBuffer->dataPtr, "%02d:%02d:%02d:%02d\t", withBoilerPlateBuffer->captionTime.hour,
-            withBoilerPlateBuffer->captionTime.minute, withBoilerPlateBuffer->captionTime.second,
-            withBoilerPlateBuffer->captionTime.frame);
-    outputBuffer->numElements = 13;
-    compressData( withBoilerPlateBuffer->dataPtr, withBoilerPlateBuffer->numElements, outputBuffer );
-    FreeBuffer(withBoilerPlateBuffer);
+    fillCcData(fillData, ccCount);
+    uint16 packetLength = buildAncPacket(ctxPtr, fillData, (ccCount * 3),
+                                         captionTimePtr->frameRatePerSecTimesOneHundred, ancPacket);
+    Buffer* outputBuffer = generateMccLine(ctxPtr, ancPacket, packetLength, captionTimePtr);
     LOG(DEBUG_LEVEL_VERBOSE, DBG_MCC_ENC, "Sending Compressed %d byte FILL packet at time: %02d:%02d:%02d;%02d",
         outputBuffer->numElements, outputBuffer->captionTime.hour, outputBuffer->captionTime.minute,
         outputBuffer->captionTime.second, outputBuffer->captionTime.frame);
@@ -532,9 +560,8 @@ static uint8 handleSkew( Context* rootCtxPtr, CaptionTime* inCaptionTimePtr ) {
  |    This function will convert the time derived from PTS (in Milliseconds)
  |    to frame number, which matches the time specified in SCC or MCC.
  ------------------------------------------------------------------------------*/
-static CaptionTime convertCaptionTime( Context* rootCtxPtr, Buffer* inBufferPtr ) {
+static CaptionTime convertCaptionTime( Context* rootCtxPtr, CaptionTime* inCaptionTimePtr, uint8* dataPtr, uint16 numElements ) {
     MccEncodeCtx* ctxPtr = rootCtxPtr->mccEncodeCtxPtr;
-    CaptionTime* inCaptionTimePtr = &inBufferPtr->captionTime;
     CaptionTime captionTime;
     boolean timeSynch = FALSE;
     int64 actualTimeInMs = 0;
@@ -617,9 +644,9 @@ static CaptionTime convertCaptionTime( Context* rootCtxPtr, Buffer* inBufferPtr
                 printf("%02d:%02d:%02d:%03d | %02d:%02d:%02d:%02d - ", inCaptionTimePtr->hour, inCaptionTimePtr->minute,
                        inCaptionTimePtr->second, inCaptionTimePtr->millisecond, captionTime.hour, captionTime.minute,
                        captionTime.second, captionTime.frame);
-                for( int loop = 0; loop < inBufferPtr->numElements; loop++ ) {
+                for( int loop = 0; loop < numElements; loop++ ) {
                     uint8 msn, lsn;
-                    byteToAscii(inBufferPtr->dataPtr[loop], &msn, &lsn );
+                    byteToAscii(dataPtr[loop], &msn, &lsn );
                     printf("%c%c ", msn, lsn);
                 }
                 printf("\n");
@@ -675,7 +702,7 @@ static boolean sendMccText( Context* ctxPtr, char* textStr, CaptionTime* caption
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    addBoilerplate()
+ |    buildAncPacket()
  |
  | DESCRIPTION:
  |    This method encodes the Anciallary Data (ANC) Packet, which wraps the Caption
@@ -688,58 +715,89 @@ static boolean sendMccText( Context* ctxPtr, char* textStr, CaptionTime* caption
  |    SMPTE ST 334-2 - Caption Distribution Packet (CDP) Definition
  |                     (Specifically: SMPTE ST 334-2:2015 - Revision of SMPTE 334-2-2007)
  |    CEA-708-D - CEA Standard - Digital Television (DTV) Closed Captioning - August 2008
+ |
+ |    The packet is built into the caller's array, of at least MCC_MAX_ANC_PACKET_SIZE
+ |    bytes, and the checksums are summed as the packet is built. The length of the
+ |    packet is returned.
  -------------------------------------------------------------------------------*/
-static Buffer* addBoilerplate( MccEncodeCtx* ctxPtr, Buffer* inBufferPtr ) {
-    ASSERT(inBufferPtr->maxNumElements == inBufferPtr->numElements);
-    ASSERT(!(inBufferPtr->maxNumElements % 3));
-    uint8 ccCount = inBufferPtr->maxNumElements / 3;
-    Buffer* outBufferPtr = NewBuffer(BUFFER_TYPE_BYTES, (inBufferPtr->numElements + 17));
-    outBufferPtr->numElements = inBufferPtr->numElements + 17;
-    uint8* dataPtr = outBufferPtr->dataPtr;
-    
-    dataPtr[0] = ANC_DID_CLOSED_CAPTIONING;
-    dataPtr[1] = ANC_SDID_CEA_708;
-    dataPtr[2] = inBufferPtr->numElements + 13;
-    dataPtr[3] = CDP_IDENTIFIER_VALUE_HIGH;
-    dataPtr[4] = CDP_IDENTIFIER_VALUE_LOW;
-    dataPtr[5] = inBufferPtr->numElements + 13;
-    dataPtr[6] = ((cdpFramerateFromFramerate(inBufferPtr->captionTime.frameRatePerSecTimesOneHundred) << 4) | 0x0F);
-    dataPtr[7] = 0x43;  // Timecode not Present; Service Info not Present; Captions Present
-    dataPtr[8] = (uint8)((ctxPtr->cdpHeaderSequence & 0xF0) >> 8);
-    dataPtr[9] = (uint8)(ctxPtr->cdpHeaderSequence & 0x0F);
-    dataPtr[10] = CC_DATA_ID;
-    dataPtr[11] = ccCount | 0xE0;
-    memcpy( &dataPtr[12], inBufferPtr->dataPtr, inBufferPtr->numElements );
-    dataPtr = &dataPtr[(12+inBufferPtr->numElements)];
+static uint16 buildAncPacket( MccEncodeCtx* ctxPtr, uint8* ccDataPtr, uint16 numBytes, uint32 frameRate, uint8* packetPtr ) {
+    ASSERT(!(numBytes % 3));
+    ASSERT((numBytes + MCC_ANC_PACKET_OVERHEAD) <= MCC_MAX_ANC_PACKET_SIZE);
+    uint8 ccCount = numBytes / 3;
+    uint8 cdpChecksum = 0;
+
+    packetPtr[0] = ANC_DID_CLOSED_CAPTIONING;
+    packetPtr[1] = ANC_SDID_CEA_708;
+    packetPtr[2] = numBytes + 13;
+    packetPtr[3] = CDP_IDENTIFIER_VALUE_HIGH;
+    packetPtr[4] = CDP_IDENTIFIER_VALUE_LOW;
+    packetPtr[5] = numBytes + 13;
+    packetPtr[6] = ((cdpFramerateFromFramerate(frameRate) << 4) | 0x0F);
+    packetPtr[7] = 0x43;  // Timecode not Present; Service Info not Present; Captions Present
+    packetPtr[8] = (uint8)((ctxPtr->cdpHeaderSequence & 0xF0) >> 8);
+    packetPtr[9] = (uint8)(ctxPtr->cdpHeaderSequence & 0x0F);
+    packetPtr[10] = CC_DATA_ID;
+    packetPtr[11] = ccCount | 0xE0;
+
+    for( int loop = 3; loop < 12; loop++ ) {
+        cdpChecksum = cdpChecksum + packetPtr[loop];
+    }
+
+    uint8* dataPtr = &packetPtr[12];
+    for( int loop = 0; loop < numBytes; loop++ ) {
+        dataPtr[loop] = ccDataPtr[loop];
+        cdpChecksum = cdpChecksum + ccDataPtr[loop];
+    }
+
+    dataPtr = &dataPtr[numBytes];
     dataPtr[0] = CDP_FOOTER_ID;
     dataPtr[1] = (uint8)((ctxPtr->cdpHeaderSequence & 0xF0) >> 8);
     dataPtr[2] = (uint8)(ctxPtr->cdpHeaderSequence & 0x0F);
-    dataPtr[3] = 0; // cdp checksum
-    dataPtr[4] = 0; // vanc checksum
 
     //the arithmetic sum of the entire packet (first byte of cdp_identifier to packet_checksum, inclusive) modulo 256 equal zero.
-    for( int loop = 3; loop < (inBufferPtr->numElements + 15); loop++ ) {
-        dataPtr[3] = dataPtr[3] + outBufferPtr->dataPtr[loop];
-    }
+    cdpChecksum = cdpChecksum + dataPtr[0] + dataPtr[1] + dataPtr[2];
+    dataPtr[3] = (~cdpChecksum) + 1;  //Two's complement value is the checksum
+    dataPtr[4] = packetPtr[0] + packetPtr[1] + packetPtr[2];  // vanc checksum
 
-    dataPtr[3] = (~dataPtr[3]) + 1;  //Two's complement value is the checksum
-
-    for( int loop = 0; loop < 3; loop++ ) {
-        dataPtr[4] = dataPtr[4] + outBufferPtr->dataPtr[loop];
-    }
-    
-    FreeBuffer( inBufferPtr );
     ctxPtr->cdpHeaderSequence++;
-    
-    return outBufferPtr;
-} // addBoilerplate()
+
+    return numBytes + MCC_ANC_PACKET_OVERHEAD;
+} // buildAncPacket()
+
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    generateMccLine()
+ |
+ | DESCRIPTION:
+ |    This function writes the timecode and the compressed ANC Packet into the
+ |    line buffer which is kept in the context, and then copies the finished line
+ |    into a buffer which is exactly the right size to send down the pipeline.
+ -------------------------------------------------------------------------------*/
+static Buffer* generateMccLine( MccEncodeCtx* ctxPtr, uint8* packetPtr, uint16 packetLength, CaptionTime* captionTimePtr ) {
+    char* linePtr = ctxPtr->mccLine;
+
+    uint16 lineLength = sprintf(linePtr, "%02d:%02d:%02d:%02d\t", captionTimePtr->hour,
+                                captionTimePtr->minute, captionTimePtr->second, captionTimePtr->frame);
+    lineLength = lineLength + compressData(packetPtr, packetLength, &linePtr[lineLength]);
+    linePtr[lineLength] = '\0';
+    lineLength++;
+    ASSERT(lineLength <= MCC_MAX_LINE_LENGTH);
+
+    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_BYTES, lineLength);
+    outputBuffer->captionTime = *captionTimePtr;
+    outputBuffer->numElements = lineLength;
+    memcpy(outputBuffer->dataPtr, linePtr, lineLength);
+
+    return outputBuffer;
+} // generateMccLine()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    countChars()
+ |    compressData()
  |
  | DESCRIPTION:
- |    This function counts the chars needed for the output text stream.
+ |    This function uses the MCC byte replacment to compress the data, writing the
+ |    resulting characters to the output and returning how many were written.
  |
  |    Per the description in the MCC File:
  |
@@ -762,274 +820,87 @@ static Buffer* addBoilerplate( MccEncodeCtx* ctxPtr, Buffer* inBufferPtr ) {
  |      U  E1h 00h 00h 00h
  |      Z  00h
  -------------------------------------------------------------------------------*/
-static uint16 countChars( uint8* dataPtr, uint16 numElements ) {
-    uint16 numChars = 1;
-    
+static uint16 compressData( uint8* dataPtr, uint16 numElements, char* outDataPtr ) {
+    uint16 numChars = 0;
+    uint8 numCodeBytes;
+
     while( numElements > 0 ) {
-        switch( dataPtr[0] ) {
-            case 0xFA:
-                if( (numElements >= 3) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) ) {
-                    uint8 numFaoos = 0;
-                    while( (numElements >= 3) && (dataPtr[0] == 0xFA) && (dataPtr[1] == 0x00) &&
-                           (dataPtr[2] == 0x00) && (numFaoos < 9) ) {
-                        dataPtr = &dataPtr[3];
-                        numElements = numElements - 3;
-                        numFaoos++;
-                    }
-                    numChars = numChars + 1;
-                } else {
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                    numChars = numChars + 2;
-                }
-                break;
-            case 0xFB:
-            case 0xFC:
-            case 0xFD:
-                if( (numElements >= 3) && (dataPtr[1] == 0x80) && (dataPtr[2] == 0x80) ) {
-                    dataPtr = &dataPtr[3];
-                    numElements = numElements - 3;
-                    numChars = numChars + 1;
-                } else {
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                    numChars = numChars + 2;
-                }
-                break;
-            case 0x96:
-                if( (numElements >= 2) && dataPtr[1] == 0x69 ) {
-                    dataPtr = &dataPtr[2];
-                    numElements = numElements - 2;
-                    numChars = numChars + 1;
-                } else {
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                    numChars = numChars + 2;
-                }
-                break;
-            case 0x61:
-                if( (numElements >= 2) && dataPtr[1] == 0x01 ) {
-                    dataPtr = &dataPtr[2];
-                    numElements = numElements - 2;
-                    numChars = numChars + 1;
-                } else {
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                    numChars = numChars + 2;
-                }
-                break;
-            case 0xE1:
-                if( (numElements >= 4) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) && (dataPtr[3] == 0x00) ) {
-                    dataPtr = &dataPtr[4];
-                    numElements = numElements - 4;
-                    numChars = numChars + 1;
-                } else {
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                    numChars = numChars + 2;
-                }
-                break;
-            case 0x00:
-                dataPtr = &dataPtr[1];
-                numElements = numElements - 1;
-                numChars = numChars + 1;
-                break;
-            default:
-                dataPtr = &dataPtr[1];
-                numElements = numElements - 1;
-                numChars = numChars + 2;
-                break;
+        char code = mccCodeAt(dataPtr, numElements, &numCodeBytes);
+        if( code != '\0' ) {
+            outDataPtr[numChars++] = code;
+            dataPtr = &dataPtr[numCodeBytes];
+            numElements = numElements - numCodeBytes;
+        } else {
+            // Bytes without a replacement character are written out as a single run of hex
+            uint16 runLength = 1;
+            while( (runLength < numElements) && (mccCodeAt(&dataPtr[runLength], (numElements - runLength), &numCodeBytes) == '\0') ) {
+                runLength++;
+            }
+            bytesToHex(dataPtr, runLength, &outDataPtr[numChars]);
+            numChars = numChars + (runLength * 2);
+            dataPtr = &dataPtr[runLength];
+            numElements = numElements - runLength;
         }
     }
+
     return numChars;
-} // countChars()
+} // compressData()
 
 /*------------------------------------------------------------------------------
  | NAME:
- |    compressData()
+ |    mccCodeAt()
  |
  | DESCRIPTION:
- |    This function uses the MCC byte replacment to compress the data.
- |
- |    Per the description in the MCC File:
- |
- |    ANC data bytes may be represented by one ASCII character according
- |    to the following schema:
- |      G  FAh 00h 00h
- |      H  2 x (FAh 00h 00h)
- |      I  3 x (FAh 00h 00h)
- |      J  4 x (FAh 00h 00h)
- |      K  5 x (FAh 00h 00h)
- |      L  6 x (FAh 00h 00h)
- |      M  7 x (FAh 00h 00h)
- |      N  8 x (FAh 00h 00h)
- |      O  9 x (FAh 00h 00h)
- |      P  FBh 80h 80h
- |      Q  FCh 80h 80h
- |      R  FDh 80h 80h
- |      S  96h 69h
- |      T  61h 01h
- |      U  E1h 00h 00h 00h
- |      Z  00h
+ |    This function returns the MCC replacement character for the bytes at the
+ |    start of the data, along with how many bytes it replaces, or '\0' if the
+ |    first byte has to be written out as hex. See compressData() for the schema.
  -------------------------------------------------------------------------------*/
-static void compressData( uint8* dataPtr, uint16 numElements, Buffer* outBufPtr ) {
-    uint8* outDataPtr = &outBufPtr->dataPtr[12];
-    
-    while( numElements > 0 ) {
-        switch( dataPtr[0] ) {
-            case 0xFA:
-                if( (numElements >= 3) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) ) {
-                    uint8 numFaoos = 0;
-                    while( (numElements >= 3) && (dataPtr[0] == 0xFA) && (dataPtr[1] == 0x00) &&
-                          (dataPtr[2] == 0x00) && (numFaoos < 9) ) {
-                        dataPtr = &dataPtr[3];
-                        numElements = numElements - 3;
-                        numFaoos++;
-                    }
-                    switch( numFaoos ) {
-                        case 1:
-                            *outDataPtr = 'G';
-                            break;
-                        case 2:
-                            *outDataPtr = 'H';
-                            break;
-                        case 3:
-                            *outDataPtr = 'I';
-                            break;
-                        case 4:
-                            *outDataPtr = 'J';
-                            break;
-                        case 5:
-                            *outDataPtr = 'K';
-                            break;
-                        case 6:
-                            *outDataPtr = 'L';
-                            break;
-                        case 7:
-                            *outDataPtr = 'M';
-                            break;
-                        case 8:
-                            *outDataPtr = 'N';
-                            break;
-                        case 9:
-                            *outDataPtr = 'O';
-                            break;
-                        default:
-                            LOG(DEBUG_LEVEL_ERROR, DBG_MCC_ENC, "Invalid Branch: %d", numFaoos);
-                    }
-                    outDataPtr = &outDataPtr[1];
-                    outBufPtr->numElements = outBufPtr->numElements + 1;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                } else {
-                    byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                    outDataPtr = &outDataPtr[2];
-                    outBufPtr->numElements = outBufPtr->numElements + 2;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                }
-                break;
-            case 0xFB:
-            case 0xFC:
-            case 0xFD:
-                if( (numElements >= 3) && (dataPtr[1] == 0x80) && (dataPtr[2] == 0x80) ) {
-                    switch( dataPtr[0] ) {
-                        case 0xFB:
-                            *outDataPtr = 'P';
-                            break;
-                        case 0xFC:
-                            *outDataPtr = 'Q';
-                            break;
-                        case 0xFD:
-                            *outDataPtr = 'R';
-                            break;
-                        default:
-                            ASSERT(0);
-                    }
+static char mccCodeAt( uint8* dataPtr, uint16 numElements, uint8* numBytesPtr ) {
+    switch( dataPtr[0] ) {
+        case 0xFA:
+            if( (numElements >= 3) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) ) {
+                uint8 numFaoos = 0;
+                while( (numElements >= 3) && (dataPtr[0] == 0xFA) && (dataPtr[1] == 0x00) &&
+                       (dataPtr[2] == 0x00) && (numFaoos < 9) ) {
                     dataPtr = &dataPtr[3];
                     numElements = numElements - 3;
-                    outDataPtr = &outDataPtr[1];
-                    outBufPtr->numElements = outBufPtr->numElements + 1;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                } else {
-                    byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                    outDataPtr = &outDataPtr[2];
-                    outBufPtr->numElements = outBufPtr->numElements + 2;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
+                    numFaoos++;
                 }
-                break;
-            case 0x96:
-                if( (numElements >= 2) && dataPtr[1] == 0x69 ) {
-                    dataPtr = &dataPtr[2];
-                    numElements = numElements - 2;
-                    *outDataPtr = 'S';
-                    outDataPtr = &outDataPtr[1];
-                    outBufPtr->numElements = outBufPtr->numElements + 1;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                } else {
-                    byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                    outDataPtr = &outDataPtr[2];
-                    outBufPtr->numElements = outBufPtr->numElements + 2;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                }
-                break;
-            case 0x61:
-                if( (numElements >= 2) && dataPtr[1] == 0x01 ) {
-                    dataPtr = &dataPtr[2];
-                    numElements = numElements - 2;
-                    *outDataPtr = 'T';
-                    outDataPtr = &outDataPtr[1];
-                    outBufPtr->numElements = outBufPtr->numElements + 1;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                } else {
-                    byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                    outDataPtr = &outDataPtr[2];
-                    outBufPtr->numElements = outBufPtr->numElements + 2;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                }
-                break;
-            case 0xE1:
-                if( (numElements >= 4) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) && (dataPtr[3] == 0x00) ) {
-                    dataPtr = &dataPtr[4];
-                    numElements = numElements - 4;
-                    *outDataPtr = 'U';
-                    outDataPtr = &outDataPtr[1];
-                    outBufPtr->numElements = outBufPtr->numElements + 1;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                } else {
-                    byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                    outDataPtr = &outDataPtr[2];
-                    outBufPtr->numElements = outBufPtr->numElements + 2;
-                    ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                    dataPtr = &dataPtr[1];
-                    numElements = numElements - 1;
-                }
-                break;
-            case 0x00:
-                dataPtr = &dataPtr[1];
-                numElements = numElements - 1;
-                *outDataPtr = 'Z';
-                outDataPtr = &outDataPtr[1];
-                outBufPtr->numElements = outBufPtr->numElements + 1;
-                ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                break;
-            default:
-                byteToAscii( dataPtr[0], &outDataPtr[0], &outDataPtr[1] );
-                outDataPtr = &outDataPtr[2];
-                outBufPtr->numElements = outBufPtr->numElements + 2;
-                ASSERT(outBufPtr->numElements <= outBufPtr->maxNumElements);
-                dataPtr = &dataPtr[1];
-                numElements = numElements - 1;
-                break;
-        }
+                *numBytesPtr = numFaoos * 3;
+                return 'G' + numFaoos - 1;
+            }
+            break;
+        case 0xFB:
+        case 0xFC:
+        case 0xFD:
+            if( (numElements >= 3) && (dataPtr[1] == 0x80) && (dataPtr[2] == 0x80) ) {
+                *numBytesPtr = 3;
+                return 'P' + (dataPtr[0] - 0xFB);
+            }
+            break;
+        case 0x96:
+            if( (numElements >= 2) && (dataPtr[1] == 0x69) ) {
+                *numBytesPtr = 2;
+                return 'S';
+            }
+            break;
+        case 0x61:
+            if( (numElements >= 2) && (dataPtr[1] == 0x01) ) {
+                *numBytesPtr = 2;
+                return 'T';
+            }
+            break;
+        case 0xE1:
+            if( (numElements >= 4) && (dataPtr[1] == 0x00) && (dataPtr[2] == 0x00) && (dataPtr[3] == 0x00) ) {
+                *numBytesPtr = 4;
+                return 'U';
+            }
+            break;
+        case 0x00:
+            *numBytesPtr = 1;
+            return 'Z';
+        default:
+            break;
     }
-    *outDataPtr = '\0';
-    outBufPtr->numElements = outBufPtr->numElements + 1;
-    ASSERT(outBufPtr->numElements == outBufPtr->maxNumElements);
-} // compressData()
+    return '\0';
+} // mccCodeAt()
@@ -36,6 +36,7 @@
 /*----------------------------------------------------------------------------*/
 
 static Buffer* generateNewCcDataPacket( uint8, uint8, uint8, uint32, uint32 );
+static Buffer* generateFillRun( uint32, uint32, uint32 );
 
 /*----------------------------------------------------------------------------*/
 /*--                       Public Member Functions                          --*/
@@ -163,15 +164,15 @@ uint8 SccEncodeProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
         inBuffer->numElements, frame, ccCount, ctxPtr->nextFrameNum, (ctxPtr->nextFrameNum - frame), (inBuffer->numElements/2) );
     
     // Pad to Current Frame
-    for( uint32 loop = ctxPtr->nextFrameNum; loop < frame; loop++ ) {
-        Buffer* outputBufPtr = generateNewCcDataPacket( CEA608_ZERO_WITH_ODD_PARITY, CEA608_ZERO_WITH_ODD_PARITY, ccCount, ctxPtr->nextFrameNum, ctxPtr->sccFrameRate );
-        LOG(DEBUG_LEVEL_VERBOSE, DBG_SCC_ENC, "SCC Encode: Passing %d bytes of pad at frame %d ", outputBufPtr->numElements, ctxPtr->nextFrameNum );
+    if( frame > ctxPtr->nextFrameNum ) {
+        Buffer* outputBufPtr = generateFillRun( ctxPtr->nextFrameNum, (frame - ctxPtr->nextFrameNum), ctxPtr->sccFrameRate );
+        LOG(DEBUG_LEVEL_VERBOSE, DBG_SCC_ENC, "SCC Encode: Passing %d frames of pad at frame %d ", (frame - ctxPtr->nextFrameNum), ctxPtr->nextFrameNum );
 
         if( PassToSinks(rootCtxPtr, outputBufPtr, &ctxPtr->sinks) == FALSE ) {
             retval = FALSE;
         }
-        
-        ctxPtr->nextFrameNum = ctxPtr->nextFrameNum + 1;
+
+        ctxPtr->nextFrameNum = frame;
     }
     
     // Break up payload into multiple, contiguous frames
@@ -261,20 +262,32 @@ static Buffer* generateNewCcDataPacket( uint8 firstByte, uint8 secondByte, uint8
     frameToTimeCode( frameNum, frameRate, &outputBuffer->captionTime );
     outputBuffer->numElements = outputBuffer->maxNumElements;
     
-    outputBuffer->dataPtr[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    fillCcData(outputBuffer->dataPtr, ccCount);
     outputBuffer->dataPtr[1] = firstByte;
     outputBuffer->dataPtr[2] = secondByte;
-    outputBuffer->dataPtr[3] = VALID_CEA608E_LINE21_FIELD_2_CC;
-    outputBuffer->dataPtr[4] = CEA608_ZERO_WITH_ODD_PARITY;
-    outputBuffer->dataPtr[5] = CEA608_ZERO_WITH_ODD_PARITY;
-    uint8* tmpPtr = &outputBuffer->dataPtr[6];
-    for( int loop = 2; loop < ccCount; loop++ ) {
-        tmpPtr[0] = INVALID_DTVCCC_CHANNEL_PACKET_DATA;
-        tmpPtr[1] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
-        tmpPtr[2] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
-        tmpPtr = &tmpPtr[3];
-    }
     
     return outputBuffer;
 }  // generateNewCcDataPacket()
 
+/*------------------------------------------------------------------------------
+ | NAME:
+ |    generateFillRun()
+ |
+ | DESCRIPTION:
+ |    This method allocates a single buffer describing a run of frames that carry
+ |    nothing but fill, which the sinks expand, or skip, as they see fit. This
+ |    keeps the cost of the gaps between captions independent of their length.
+ -------------------------------------------------------------------------------*/
+static Buffer* generateFillRun( uint32 firstFrameNum, uint32 numFrames, uint32 frameRate ) {
+
+    Buffer* outputBuffer = NewBuffer(BUFFER_TYPE_FILL, 1);
+    frameToTimeCode( firstFrameNum, frameRate, &outputBuffer->captionTime );
+    outputBuffer->numElements = outputBuffer->maxNumElements;
+
+    FillRun* fillRunPtr = (FillRun*)outputBuffer->dataPtr;
+    fillRunPtr->firstFrameNum = firstFrameNum;
+    fillRunPtr->numFrames = numFrames;
+
+    return outputBuffer;
+}  // generateFillRun()
+
@@ -240,26 +240,26 @@ void itest__BufferAllocFreeTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 void itest__BufferAllocFreeExceptionTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
     Buffer* buffPtr;
-    Buffer* buffPtrArr[11];
+    Buffer* buffPtrArr[MAX_BUFFER_ARRAY_SIZE + 1];
 
-    for( int loop = 0; loop < 11; loop++ ) {
+    for( int loop = 0; loop <= MAX_BUFFER_ARRAY_SIZE; loop++ ) {
         buffPtrArr[loop] = NULL;
     }
 
     TEST_START("Test Case: Buffer Allocation/Free Exception Tests - Allocate too many buffers.");
     BufferPoolInit();
     ASSERT_EQ(0, NumAllocatedBuffers());
-    for( int loop = 0; loop < 10; loop++ ) {
+    for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
         buffPtrArr[loop] = NewBuffer(BUFFER_TYPE_BYTES, (100 + loop));
         ASSERT_EQ(loop+1, NumAllocatedBuffers());
     }
-    ASSERT_EQ(10, NumAllocatedBuffers());
-    ERRORS_EXPECTED(61)
+    ASSERT_EQ(MAX_BUFFER_ARRAY_SIZE, NumAllocatedBuffers());
+    ERRORS_EXPECTED((6 * MAX_BUFFER_ARRAY_SIZE) + 1)
     FATAL_ERROR_EXPECTED
-    buffPtrArr[10] = NewBuffer(BUFFER_TYPE_BYTES, 110);
-    for( int loop = 0; loop < 10; loop++ ) {
+    buffPtrArr[MAX_BUFFER_ARRAY_SIZE] = NewBuffer(BUFFER_TYPE_BYTES, (100 + MAX_BUFFER_ARRAY_SIZE));
+    for( int loop = 0; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
         FreeBuffer(buffPtrArr[loop]);
-        ASSERT_EQ(9-loop, NumAllocatedBuffers());
+        ASSERT_EQ((MAX_BUFFER_ARRAY_SIZE - 1) - loop, NumAllocatedBuffers());
     }
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
@@ -0,0 +1,269 @@
+#include <string.h>
+#include <unistd.h>
+
+#include "test_engine.h"
+
+#include "debug.h"
+#include "pipeline_utils.h"
+#include "buffer_utils.h"
+#include "cc_utils.h"
+#include "cache_output.h"
+#include "cc_data_file.h"
+
+/*----------------------------------------------------------------------------*/
+/*--                          Support for Stubs                             --*/
+/*----------------------------------------------------------------------------*/
+
+#define TEST_MAX_NUM_RECEIVED            64
+#define TEST_FRAME_RATE                  3000
+
+#define TEST_CACHE_DIRECTORY             "/tmp"
+#define TEST_CACHE_INPUT_FILENAME        "itest__cache.mcc"
+#define TEST_CACHE_FILENAME              TEST_CACHE_DIRECTORY "/itest__cache." CC_DATA_FILE_EXTENSION
+
+// Written as a Padding Run of ten frames, a Frame, a lone Padding Frame, a Fill Run of twenty
+// frames, and five Frames, which leaves 141 bytes of records, one Index Entry and the Trailer.
+#define TEST_NUM_FRAMES                  37
+#define TEST_RECORDS_END_POS             141
+#define TEST_CACHE_FILE_SIZE             (TEST_RECORDS_END_POS + CC_DATA_FILE_INDEX_ENTRY_SIZE + CC_DATA_FILE_TRAILER_SIZE)
+
+typedef struct {
+    boolean isFillRun;
+    uint32 frameNum;                         // First Frame Number, for a Fill Run
+    uint32 numFrames;                        // Only for a Fill Run
+    uint16 numElements;
+    uint8 data[6];
+} ReceivedFrame;
+
+static uint8 paddingData[] = { 0xFC, 0x80, 0x80, 0xFD, 0x80, 0x80 };
+static uint8 captionData[] = { 0xFC, 0x94, 0x20, 0xFD, 0x80, 0x80 };
+
+ReceivedFrame received[TEST_MAX_NUM_RECEIVED];
+uint8 numReceived;
+uint8 shutdownReceived;
+
+void resetMetrics( void ) {
+    numReceived = 0;
+    shutdownReceived = 0;
+}
+
+static void writeFrame( Context* ctxPtr, uint32 frameNum, uint8* dataPtr ) {
+    Buffer* buffPtr = NewBuffer(BUFFER_TYPE_BYTES, 6);
+    frameToTimeCode(frameNum, TEST_FRAME_RATE, &buffPtr->captionTime);
+    buffPtr->captionTime.dropframe = FALSE;
+    buffPtr->numElements = 6;
+    memcpy(buffPtr->dataPtr, dataPtr, 6);
+    CacheOutProcNextBuffer(ctxPtr, buffPtr);
+}
+
+static void writeFillRun( Context* ctxPtr, uint32 firstFrameNum, uint32 numFrames ) {
+    Buffer* buffPtr = NewBuffer(BUFFER_TYPE_FILL, 1);
+    frameToTimeCode(firstFrameNum, TEST_FRAME_RATE, &buffPtr->captionTime);
+    buffPtr->captionTime.dropframe = FALSE;
+    buffPtr->numElements = buffPtr->maxNumElements;
+    ((FillRun*)buffPtr->dataPtr)->firstFrameNum = firstFrameNum;
+    ((FillRun*)buffPtr->dataPtr)->numFrames = numFrames;
+    CacheOutProcNextBuffer(ctxPtr, buffPtr);
+}
+
+static void writeCacheFile( Context* ctxPtr ) {
+    CacheOutInitialize(ctxPtr);
+    for( uint32 loop = 0; loop < 10; loop++ ) {
+        writeFrame(ctxPtr, loop, paddingData);
+    }
+    writeFrame(ctxPtr, 10, captionData);
+    writeFrame(ctxPtr, 11, paddingData);
+    writeFillRun(ctxPtr, 12, 20);
+    for( uint32 loop = 32; loop < TEST_NUM_FRAMES; loop++ ) {
+        captionData[2] = (uint8)loop;
+        writeFrame(ctxPtr, loop, captionData);
+    }
+    captionData[2] = 0x20;
+    CacheOutShutdown(ctxPtr);
+}
+
+static void readCacheFile( Context* ctxPtr ) {
+    LinkInfo linkInfo;
+    boolean isDone = FALSE;
+
+    linkInfo.linkType = CC_DATA___TEXT_FILE;
+    linkInfo.sourceType = DATA_TYPE_CC_DATA;
+    linkInfo.sinkType = DATA_TYPE_CC_DATA_TXT_FILE;
+    resetMetrics();
+    if( CcDataFileInitialize(ctxPtr, TEST_CACHE_FILENAME) == FALSE ) return;
+    CcDataFileAddSink(ctxPtr, linkInfo);
+    while( isDone == FALSE ) {
+        CcDataFileProcNextBuffer(ctxPtr, &isDone);
+    }
+}
+
+static long truncateCacheFile( long fileSize ) {
+    if( truncate(TEST_CACHE_FILENAME, fileSize) != 0 ) return -1;
+    FILE* filePtr = fopen(TEST_CACHE_FILENAME, "r");
+    fseek(filePtr, 0, SEEK_END);
+    long retval = ftell(filePtr);
+    fclose(filePtr);
+    return retval;
+}
+
+static boolean isFrameReceived( uint8 index, uint32 frameNum, uint8* dataPtr ) {
+    return ((received[index].isFillRun == FALSE) && (received[index].frameNum == frameNum) && (received[index].numElements == 6) &&
+            (memcmp(received[index].data, dataPtr, 6) == 0)) ? TRUE : FALSE;
+}
+
+static boolean isFillRunReceived( uint8 index, uint32 firstFrameNum, uint32 numFrames ) {
+    return ((received[index].isFillRun == TRUE) && (received[index].frameNum == firstFrameNum) &&
+            (received[index].numFrames == numFrames)) ? TRUE : FALSE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*--                        Pipeline Stub Functions                         --*/
+/*----------------------------------------------------------------------------*/
+
+void InitSinks( Sinks* sinks, uint8 linkType ) {
+    sinks->numSinks = 0;
+    sinks->maxSinks = 0;
+    sinks->linkType = linkType;
+    sinks->sink = NULL;
+}
+
+boolean AddSink( Sinks* sinks, LinkInfo* linkInfoPtr ) {
+    sinks->numSinks = 1;
+    return TRUE;
+}
+
+uint8 _PassToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer* buffPtr, Sinks* sinks ) {
+    TEST_ASSERT(numReceived < TEST_MAX_NUM_RECEIVED);
+    TEST_ASSERT(buffPtr->bufferType == BUFFER_TYPE_FILL);
+    received[numReceived].isFillRun = TRUE;
+    received[numReceived].frameNum = ((FillRun*)buffPtr->dataPtr)->firstFrameNum;
+    received[numReceived].numFrames = ((FillRun*)buffPtr->dataPtr)->numFrames;
+    numReceived++;
+    FreeBuffer(buffPtr);
+    return PIPELINE_SUCCESS;
+}
+
+uint8 _PassFrameToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer** framesBufferPtrPtr,
+                         CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements, Sinks* sinks ) {
+    TEST_ASSERT(numReceived < TEST_MAX_NUM_RECEIVED);
+    TEST_ASSERT(numElements <= 6);
+    received[numReceived].isFillRun = FALSE;
+    received[numReceived].frameNum = timeCodeToFrame(captionTimePtr);
+    received[numReceived].numFrames = 1;
+    received[numReceived].numElements = numElements;
+    memcpy(received[numReceived].data, dataPtr, numElements);
+    numReceived++;
+    return PIPELINE_SUCCESS;
+}
+
+uint8 _FlushFramesToSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Buffer** framesBufferPtrPtr, Sinks* sinks ) {
+    return PIPELINE_SUCCESS;
+}
+
+uint8 _ShutdownSinks( char* fileNameStr, int lineNum, Context* ctxPtr, Sinks* sinks ) {
+    shutdownReceived++;
+    return PIPELINE_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/*--                             Test Cases                                 --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | INTEGRATION TESTS: Cache Output / CC Data File Round Trip Tests
+ |
+ | TEST CASES:
+ |    1) Write Padding Runs, Fill Runs and Frames to a CC Data File.
+ |    2) Read every Frame back in the order it was written.
+ |    3) Read back a CC Data File which is missing its Trailer.
+ |    4) Read back a CC Data File which is truncated within a Record.
+ -------------------------------------------------------------------------------*/
+void itest__CacheRoundTripTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    CcDataFileHeader header;
+    Context ctx;
+    memset(&ctx, 0, sizeof(Context));
+    ctx.config.inputFilename = TEST_CACHE_INPUT_FILENAME;
+    strcpy(ctx.config.outputDirectory, TEST_CACHE_DIRECTORY);
+    ctx.config.framesPerBuffer = 1;
+
+    TEST_START("Test Case: Cache Round Trip - Write Padding Runs, Fill Runs and Frames to a CC Data File.");
+    BufferPoolInit();
+    writeCacheFile(&ctx);
+    ASSERT_PTREQ(NULL, ctx.cacheOutputCtxPtr);
+    ASSERT_EQ(0, NumAllocatedBuffers());
+    ASSERT_EQ(TRUE, CcDataFileReadHeader(TEST_CACHE_FILENAME, &header));
+    ASSERT_EQ(CAPTION_TIME_FRAME_NUMBERING, header.timeSource);
+    ASSERT_EQ(FALSE, header.isDropFrame);
+    ASSERT_EQ(TEST_FRAME_RATE, header.frameRateTimesOneHundred);
+    ASSERT_EQ(TEST_CACHE_FILE_SIZE, truncateCacheFile(TEST_CACHE_FILE_SIZE));
+    TEST_END
+
+    TEST_START("Test Case: Cache Round Trip - Read every Frame back in the order it was written.");
+    readCacheFile(&ctx);
+    ASSERT_PTREQ(NULL, ctx.ccDataFileCtxPtr);
+    ASSERT_EQ(1, shutdownReceived);
+    ASSERT_EQ(18, numReceived);
+    for( uint8 loop = 0; loop < 10; loop++ ) {
+        ASSERT_EQ(TRUE, isFrameReceived(loop, loop, paddingData));
+    }
+    ASSERT_EQ(TRUE, isFrameReceived(10, 10, captionData));
+    ASSERT_EQ(TRUE, isFrameReceived(11, 11, paddingData));
+    ASSERT_EQ(TRUE, isFillRunReceived(12, 12, 20));
+    for( uint8 loop = 13; loop < 18; loop++ ) {
+        captionData[2] = (uint8)(loop + 19);
+        ASSERT_EQ(TRUE, isFrameReceived(loop, (loop + 19), captionData));
+    }
+    captionData[2] = 0x20;
+    ASSERT_EQ(0, NumAllocatedBuffers());
+    TEST_END
+
+    TEST_START("Test Case: Cache Round Trip - Read back a CC Data File which is missing its Trailer.");
+    ASSERT_EQ(TEST_RECORDS_END_POS, truncateCacheFile(TEST_RECORDS_END_POS));
+    readCacheFile(&ctx);
+    ASSERT_PTREQ(NULL, ctx.ccDataFileCtxPtr);
+    ASSERT_EQ(1, shutdownReceived);
+    ASSERT_EQ(18, numReceived);
+    ASSERT_EQ(TRUE, isFrameReceived(0, 0, paddingData));
+    ASSERT_EQ(TRUE, isFillRunReceived(12, 12, 20));
+    captionData[2] = 36;
+    ASSERT_EQ(TRUE, isFrameReceived(17, 36, captionData));
+    captionData[2] = 0x20;
+    TEST_END
+
+    TEST_START("Test Case: Cache Round Trip - Read back a CC Data File which is truncated within a Record.");
+    ASSERT_EQ((TEST_RECORDS_END_POS - 5), truncateCacheFile(TEST_RECORDS_END_POS - 5));
+    ERROR_EXPECTED
+    readCacheFile(&ctx);
+    ASSERT_PTREQ(NULL, ctx.ccDataFileCtxPtr);
+    ASSERT_EQ(1, shutdownReceived);
+    ASSERT_EQ(17, numReceived);
+    ASSERT_EQ(TRUE, isFillRunReceived(12, 12, 20));
+    captionData[2] = 35;
+    ASSERT_EQ(TRUE, isFrameReceived(16, 35, captionData));
+    captionData[2] = 0x20;
+    TEST_END
+
+    unlink(TEST_CACHE_FILENAME);
+}  // itest__CacheRoundTripTests()
+
+/*----------------------------------------------------------------------------*/
+/*--                             Test Suite                                 --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ |                         Cache Integration Tests
+ |                         =======================
+ | TESTED FILES:
+ |    cache_output.c
+ |    cc_data_file.c
+ -------------------------------------------------------------------------------*/
+int main( int argc, char* argv[] ) {
+    INIT_TEST_FRAMEWORK( argc, argv )
+
+    TEST_SUITE_START("Test Suite: Writing and Reading back a CC Data File.")
+    itest__CacheRoundTripTests( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
+    SHUTDOWN_TEST_FRAMEWORK
+}  // main()
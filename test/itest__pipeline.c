@@ -6,6 +6,7 @@
 
 #include "debug.h"
 #include "pipeline_utils.h"
+#include "cc_data_file.h"
 
 /*----------------------------------------------------------------------------*/
 /*--                          Support for Stubs                             --*/
@@ -80,6 +81,8 @@
 uint8 whichTest = 0;
 uint8 numEndpointsHit = 0;
 
+char mpegInputFilename[MAX_FILE_NAME_LEN];
+
 boolean dtvccDecodePassSuccessfully;
 boolean line21OutputShutdownSuccessfully;
 boolean mccOutputShutdownSuccessfully;
@@ -87,38 +90,50 @@ boolean mccOutputShutdownSuccessfully;
 uint8 mccDecodeBufferReceived;
 uint8 mccEncodeBufferReceived;
 uint8 line21DecodeBufferReceived;
+uint8 line21ScreenBufferReceived;
 uint8 dtvccDecodeBufferReceived;
+uint8 dtvccWindowBufferReceived;
 uint8 ccDataOutBufferReceived;
 uint8 mccOutBufferReceived;
 uint8 line21OutBufferReceived;
+uint8 cueOutBufferReceived;
 uint8 dtvccOutBufferReceived;
 
 uint8 mccDecodeShutdownReceived;
 uint8 mccEncodeShutdownReceived;
 uint8 line21DecodeShutdownReceived;
+uint8 line21ScreenShutdownReceived;
 uint8 dtvccDecodeShutdownReceived;
+uint8 dtvccWindowShutdownReceived;
 uint8 ccDataOutShutdownReceived;
 uint8 mccOutShutdownReceived;
 uint8 line21OutShutdownReceived;
+uint8 cueOutShutdownReceived;
 uint8 dtvccOutShutdownReceived;
 
 void resetMetrics( void ) {
     mccDecodeBufferReceived = 0;
     mccEncodeBufferReceived = 0;
     line21DecodeBufferReceived = 0;
+    line21ScreenBufferReceived = 0;
     dtvccDecodeBufferReceived = 0;
+    dtvccWindowBufferReceived = 0;
     ccDataOutBufferReceived = 0;
     mccOutBufferReceived = 0;
     line21OutBufferReceived = 0;
+    cueOutBufferReceived = 0;
     dtvccOutBufferReceived = 0;
 
     mccDecodeShutdownReceived = 0;
     mccEncodeShutdownReceived = 0;
     line21DecodeShutdownReceived = 0;
+    line21ScreenShutdownReceived = 0;
     dtvccDecodeShutdownReceived = 0;
+    dtvccWindowShutdownReceived = 0;
     ccDataOutShutdownReceived = 0;
     mccOutShutdownReceived = 0;
     line21OutShutdownReceived = 0;
+    cueOutShutdownReceived = 0;
     dtvccOutShutdownReceived = 0;
 }
 
@@ -788,7 +803,7 @@ boolean MpegFileInitialize( Context* rootCtxPtr, boolean overrideDropframe, bool
     rootCtxPtr->mpegFileCtxPtr = malloc(sizeof(MpegFileCtx));
     MpegFileCtx* ctxPtr = rootCtxPtr->mpegFileCtxPtr;
 
-    strcpy((char*)ctxPtr->buffer, rootCtxPtr->config.inputFilename);
+    strcpy(mpegInputFilename, rootCtxPtr->config.inputFilename);
 
     InitSinks(&ctxPtr->sinks, MPG_FILE___CC_DATA);
 
@@ -869,7 +884,7 @@ boolean DtvccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return AddSink(&rootCtxPtr->dtvccDecodeCtxPtr->sinks, &linkInfo);
 }  // Line21DecodeAddSink()
 
-LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint64 decodeWhichServices ) {
     TEST_ASSERT(rootCtxPtr);
     TEST_ASSERT(!rootCtxPtr->dtvccDecodeCtxPtr);
 
@@ -931,7 +946,7 @@ boolean Line21DecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return AddSink(&rootCtxPtr->line21DecodeCtxPtr->sinks, &linkInfo);
 }  // Line21DecodeAddSink()
 
-LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint8 decodeWhichChannels ) {
     TEST_ASSERT(rootCtxPtr);
     TEST_ASSERT(!rootCtxPtr->line21DecodeCtxPtr);
 
@@ -949,6 +964,114 @@ LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
     return linkInfo;
 }  // Line21DecodeInitialize()
 
+//**************************//
+//**--  Line 21 Screen  --**//
+//**************************//
+
+boolean Line21ScreenProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
+    TEST_ASSERT(inBuffer);
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->line21ScreenCtxPtr);
+
+    line21ScreenBufferReceived++;
+
+    FreeBuffer(inBuffer);
+    return TRUE;
+}  // Line21ScreenProcNextBuffer()
+
+boolean Line21ScreenShutdown( void* rootCtxPtr ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->line21ScreenCtxPtr);
+    Line21ScreenCtx* ctxPtr = ((Context*)rootCtxPtr)->line21ScreenCtxPtr;
+    Sinks sinks = ctxPtr->sinks;
+
+    line21ScreenShutdownReceived++;
+
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->line21ScreenCtxPtr = NULL;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // Line21ScreenShutdown()
+
+boolean Line21ScreenAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(rootCtxPtr->line21ScreenCtxPtr);
+    TEST_ASSERT(linkInfo.sourceType == DATA_TYPE_CAPTION_CUE);
+
+    return AddSink(&rootCtxPtr->line21ScreenCtxPtr->sinks, &linkInfo);
+}  // Line21ScreenAddSink()
+
+LinkInfo Line21ScreenInitialize( Context* rootCtxPtr ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(!rootCtxPtr->line21ScreenCtxPtr);
+
+    rootCtxPtr->line21ScreenCtxPtr = malloc(sizeof(Line21ScreenCtx));
+    Line21ScreenCtx* ctxPtr = rootCtxPtr->line21ScreenCtxPtr;
+
+    InitSinks(&ctxPtr->sinks, LINE21_DATA___CAPTION_CUE);
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = LINE21_DATA___CAPTION_CUE;
+    linkInfo.sourceType = DATA_TYPE_DECODED_608;
+    linkInfo.sinkType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.NextBufferFnPtr = &Line21ScreenProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &Line21ScreenShutdown;
+    return linkInfo;
+}  // Line21ScreenInitialize()
+
+//************************//
+//**--  DTVCC Window  --**//
+//************************//
+
+boolean DtvccWindowProcNextBuffer( void* rootCtxPtr, Buffer* inBuffer ) {
+    TEST_ASSERT(inBuffer);
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->dtvccWindowCtxPtr);
+
+    dtvccWindowBufferReceived++;
+
+    FreeBuffer(inBuffer);
+    return TRUE;
+}  // DtvccWindowProcNextBuffer()
+
+boolean DtvccWindowShutdown( void* rootCtxPtr ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->dtvccWindowCtxPtr);
+    DtvccWindowCtx* ctxPtr = ((Context*)rootCtxPtr)->dtvccWindowCtxPtr;
+    Sinks sinks = ctxPtr->sinks;
+
+    dtvccWindowShutdownReceived++;
+
+    free(ctxPtr);
+    ((Context*)rootCtxPtr)->dtvccWindowCtxPtr = NULL;
+    return ShutdownSinks(rootCtxPtr, &sinks);
+}  // DtvccWindowShutdown()
+
+boolean DtvccWindowAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(rootCtxPtr->dtvccWindowCtxPtr);
+    TEST_ASSERT(linkInfo.sourceType == DATA_TYPE_CAPTION_CUE);
+
+    return AddSink(&rootCtxPtr->dtvccWindowCtxPtr->sinks, &linkInfo);
+}  // DtvccWindowAddSink()
+
+LinkInfo DtvccWindowInitialize( Context* rootCtxPtr ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(!rootCtxPtr->dtvccWindowCtxPtr);
+
+    rootCtxPtr->dtvccWindowCtxPtr = malloc(sizeof(DtvccWindowCtx));
+    DtvccWindowCtx* ctxPtr = rootCtxPtr->dtvccWindowCtxPtr;
+
+    InitSinks(&ctxPtr->sinks, DTVCC_DATA___CAPTION_CUE);
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = DTVCC_DATA___CAPTION_CUE;
+    linkInfo.sourceType = DATA_TYPE_DECODED_708;
+    linkInfo.sinkType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.NextBufferFnPtr = &DtvccWindowProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &DtvccWindowShutdown;
+    return linkInfo;
+}  // DtvccWindowInitialize()
+
 //**********************//
 //**--  MCC Decode  --**//
 //**********************//
@@ -1195,6 +1318,53 @@ LinkInfo Line21OutInitialize( Context* ctxPtr, char* outputFileNameStr ) {
     return linkInfo;
 }  // Line21OutInitialize()
 
+//*******************//
+//**--  Cue Out  --**//
+//*******************//
+
+boolean CueOutProcNextBuffer( void* rootCtxPtr, Buffer* buffPtr ) {
+    TEST_ASSERT(buffPtr);
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->cueOutputCtxPtr);
+
+    cueOutBufferReceived++;
+
+    FreeBuffer(buffPtr);
+    return TRUE;
+} // CueOutProcNextBuffer()
+
+boolean CueOutShutdown( void* rootCtxPtr ) {
+    TEST_ASSERT(rootCtxPtr);
+    TEST_ASSERT(((Context*)rootCtxPtr)->cueOutputCtxPtr);
+
+    cueOutShutdownReceived++;
+
+    ((Context*)rootCtxPtr)->cueOutputCtxPtr->numProducers--;
+    if( ((Context*)rootCtxPtr)->cueOutputCtxPtr->numProducers == 0 ) {
+        free(((Context*)rootCtxPtr)->cueOutputCtxPtr);
+        ((Context*)rootCtxPtr)->cueOutputCtxPtr = NULL;
+    }
+    return TRUE;
+} // CueOutShutdown()
+
+LinkInfo CueOutInitialize( Context* ctxPtr ) {
+    TEST_ASSERT(ctxPtr);
+
+    if( ctxPtr->cueOutputCtxPtr == NULL ) {
+        ctxPtr->cueOutputCtxPtr = malloc(sizeof(CueOutputCtx));
+        ctxPtr->cueOutputCtxPtr->numProducers = 0;
+    }
+    ctxPtr->cueOutputCtxPtr->numProducers++;
+
+    LinkInfo linkInfo;
+    linkInfo.linkType = CAPTION_CUE___SUBTITLE_FILE;
+    linkInfo.sourceType = DATA_TYPE_CAPTION_CUE;
+    linkInfo.sinkType = DATA_TYPE_SUBTITLE_FILE;
+    linkInfo.NextBufferFnPtr = &CueOutProcNextBuffer;
+    linkInfo.ShutdownFnPtr = &CueOutShutdown;
+    return linkInfo;
+}  // CueOutInitialize()
+
 //*******************//
 //**--  MCC Out  --**//
 //*******************//
@@ -1240,6 +1410,11 @@ LinkInfo MccOutInitialize( Context* ctxPtr ) {
 /*--                        Passive Stub Functions                          --*/
 /*----------------------------------------------------------------------------*/
 
+LinkInfo CacheOutInitialize( Context* rootCtxPtr ) { LinkInfo linkInfo; linkInfo.sourceType = 1; return linkInfo; }
+boolean CcDataFileInitialize( Context* rootCtxPtr, char* fileNameStr ) { return TRUE; }
+boolean CcDataFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) { return TRUE; }
+boolean CcDataFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) { return TRUE; }
+boolean CcDataFileReadHeader( char* fileNameStr, CcDataFileHeader* headerPtr ) { return FALSE; }
 boolean DetermineDropFrame( char* fileNameStr, boolean saveMediaInfo, char* artifactPath ) { return TRUE; }
 boolean MovFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) { return TRUE; }
 boolean MovFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) { return TRUE; }
@@ -1753,7 +1928,7 @@ void itest__ThreeSplitPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |                              +-------------+
  | TEST CASES:
  |    1) Establish the Pipeline.
- |    2) Fail to add another Split to the Pipeline.
+ |    2) Grow the List of Sinks past its Initial Size.
  |    3) Pass a Buffer down the Pipeline Successfully.
  |    4) Shutdown Successfully.
  |    5) Split a Buffer Once in the Pipeline.
@@ -1766,7 +1941,6 @@ void itest__FiveSplitPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Context ctx;
     Buffer* buffPtr;
     boolean retval;
-    LinkInfo dummyLI;
 
     memset(&ctx, 0, sizeof(Context));
 
@@ -1774,7 +1948,7 @@ void itest__FiveSplitPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 
     TEST_START("Test Case: Five Split Pipeline - Establish the Pipeline.")
     BufferPoolInit();
-    dummyLI = ElementOneInit( &ctx );
+    ElementOneInit( &ctx );
     ElementOneAddSink(&ctx, ElementTwoInit(&ctx));
     ElementOneAddSink(&ctx, ElementThreeInit(&ctx));
     ElementOneAddSink(&ctx, ElementFourInit(&ctx));
@@ -1782,9 +1956,9 @@ void itest__FiveSplitPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ElementOneAddSink(&ctx, ElementSixInit(&ctx));
     TEST_END
 
-    TEST_START("Test Case: Five Split Pipeline - Fail to add another Split to the Pipeline.")
-    ERROR_EXPECTED
-    ElementOneAddSink(&ctx, dummyLI);
+    TEST_START("Test Case: Five Split Pipeline - Grow the List of Sinks past its Initial Size.")
+    ASSERT_EQ(5, ctx.sccFileCtxPtr->sinks.numSinks);
+    ASSERT_EQ(8, ctx.sccFileCtxPtr->sinks.maxSinks);
     TEST_END
 
     TEST_START("Test Case: Five Split Pipeline - Pass a Buffer down the Pipeline Successfully.")
@@ -1899,6 +2073,7 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_START("Test Case: Mock MCC Pipeline - Establish the Pipeline.")
     BufferPoolInit();
     ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MCC");
     retval = PlumbMccPipeline(&ctx);
@@ -1917,7 +2092,9 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(1, ccDataOutBufferReceived);
     ASSERT_EQ(1, line21OutBufferReceived);
+    ASSERT_EQ(1, line21ScreenBufferReceived);
     ASSERT_EQ(1, dtvccOutBufferReceived);
+    ASSERT_EQ(1, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MccFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -1926,7 +2103,9 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(2, ccDataOutBufferReceived);
     ASSERT_EQ(2, line21OutBufferReceived);
+    ASSERT_EQ(2, line21ScreenBufferReceived);
     ASSERT_EQ(2, dtvccOutBufferReceived);
+    ASSERT_EQ(2, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -1940,7 +2119,10 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(TRUE, ccDataOutShutdownReceived);
     ASSERT_EQ(TRUE, line21OutShutdownReceived);
+    ASSERT_EQ(TRUE, line21ScreenShutdownReceived);
+    ASSERT_EQ(2, cueOutShutdownReceived);
     ASSERT_EQ(TRUE, dtvccOutShutdownReceived);
+    ASSERT_EQ(TRUE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -1950,6 +2132,7 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     resetMetrics();
     memset(&ctx, 0, sizeof(Context));
     ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MCC");
     retval = PlumbMccPipeline( &ctx );
@@ -1961,7 +2144,9 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(1, ccDataOutBufferReceived);
     ASSERT_EQ(1, line21OutBufferReceived);
+    ASSERT_EQ(1, line21ScreenBufferReceived);
     ASSERT_EQ(1, dtvccOutBufferReceived);
+    ASSERT_EQ(1, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MccFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -1970,7 +2155,9 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(2, ccDataOutBufferReceived);
     ASSERT_EQ(2, line21OutBufferReceived);
+    ASSERT_EQ(2, line21ScreenBufferReceived);
     ASSERT_EQ(2, dtvccOutBufferReceived);
+    ASSERT_EQ(2, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     dtvccDecodePassSuccessfully = FALSE;
     retval = MccFileProcNextBuffer( &ctx, &isDone );
@@ -1980,7 +2167,9 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(3, dtvccDecodeBufferReceived);
     ASSERT_EQ(3, ccDataOutBufferReceived);
     ASSERT_EQ(3, line21OutBufferReceived);
+    ASSERT_EQ(3, line21ScreenBufferReceived);
     ASSERT_EQ(3, dtvccOutBufferReceived);
+    ASSERT_EQ(3, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -1994,7 +2183,10 @@ void itest__MockMccPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(TRUE, ccDataOutShutdownReceived);
     ASSERT_EQ(TRUE, line21OutShutdownReceived);
+    ASSERT_EQ(TRUE, line21ScreenShutdownReceived);
+    ASSERT_EQ(2, cueOutShutdownReceived);
     ASSERT_EQ(TRUE, dtvccOutShutdownReceived);
+    ASSERT_EQ(TRUE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 }  // itest__MockMccPipelineTests()
@@ -2040,12 +2232,13 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_START("Test Case: Mock MPEG Pipeline - Establish the Pipeline with Artifacts.")
     BufferPoolInit();
     ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.bailAfterMins = 0;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MCC");
     retval = PlumbMpegPipeline( &ctx );
     ASSERT_EQ(TRUE, retval);
-    ASSERT_STREQ("Test", (char*)ctx.mpegFileCtxPtr->buffer);
+    ASSERT_STREQ("Test", mpegInputFilename);
     TEST_END
 
     TEST_START("Test Case: Mock MPEG Pipeline - Pass two Buffers Successfully to Pipeline with Artifacts.")
@@ -2060,7 +2253,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(1, ccDataOutBufferReceived);
     ASSERT_EQ(1, line21OutBufferReceived);
+    ASSERT_EQ(1, line21ScreenBufferReceived);
     ASSERT_EQ(1, dtvccOutBufferReceived);
+    ASSERT_EQ(1, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -2070,7 +2265,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(2, ccDataOutBufferReceived);
     ASSERT_EQ(2, line21OutBufferReceived);
+    ASSERT_EQ(2, line21ScreenBufferReceived);
     ASSERT_EQ(2, dtvccOutBufferReceived);
+    ASSERT_EQ(2, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2086,7 +2283,10 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(TRUE, ccDataOutShutdownReceived);
     ASSERT_EQ(TRUE, line21OutShutdownReceived);
+    ASSERT_EQ(TRUE, line21ScreenShutdownReceived);
+    ASSERT_EQ(2, cueOutShutdownReceived);
     ASSERT_EQ(TRUE, dtvccOutShutdownReceived);
+    ASSERT_EQ(TRUE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2096,6 +2296,7 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     resetMetrics();
     memset(&ctx, 0, sizeof(Context));
     ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.bailAfterMins = 0;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MCC");
@@ -2109,7 +2310,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(1, ccDataOutBufferReceived);
     ASSERT_EQ(1, line21OutBufferReceived);
+    ASSERT_EQ(1, line21ScreenBufferReceived);
     ASSERT_EQ(1, dtvccOutBufferReceived);
+    ASSERT_EQ(1, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -2119,7 +2322,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(2, ccDataOutBufferReceived);
     ASSERT_EQ(2, line21OutBufferReceived);
+    ASSERT_EQ(2, line21ScreenBufferReceived);
     ASSERT_EQ(2, dtvccOutBufferReceived);
+    ASSERT_EQ(2, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     dtvccDecodePassSuccessfully = FALSE;
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
@@ -2130,7 +2335,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(3, dtvccDecodeBufferReceived);
     ASSERT_EQ(3, ccDataOutBufferReceived);
     ASSERT_EQ(3, line21OutBufferReceived);
+    ASSERT_EQ(3, line21ScreenBufferReceived);
     ASSERT_EQ(3, dtvccOutBufferReceived);
+    ASSERT_EQ(3, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2146,7 +2353,10 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(TRUE, ccDataOutShutdownReceived);
     ASSERT_EQ(TRUE, line21OutShutdownReceived);
+    ASSERT_EQ(TRUE, line21ScreenShutdownReceived);
+    ASSERT_EQ(2, cueOutShutdownReceived);
     ASSERT_EQ(TRUE, dtvccOutShutdownReceived);
+    ASSERT_EQ(TRUE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2154,12 +2364,13 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     BufferPoolInit();
     memset(&ctx, 0, sizeof(Context));
     ctx.config.artifacts = FALSE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.bailAfterMins = 0;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MPEG");
     retval = PlumbMpegPipeline( &ctx );
     ASSERT_EQ(TRUE, retval);
-    ASSERT_STREQ("Test", (char*)ctx.mpegFileCtxPtr->buffer);
+    ASSERT_STREQ("Test", mpegInputFilename);
     TEST_END
 
     TEST_START("Test Case: Mock MPEG Pipeline - Pass two Buffers Successfully to Pipeline without Artifacts.")
@@ -2174,7 +2385,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(0, ccDataOutBufferReceived);
     ASSERT_EQ(0, line21OutBufferReceived);
+    ASSERT_EQ(0, line21ScreenBufferReceived);
     ASSERT_EQ(0, dtvccOutBufferReceived);
+    ASSERT_EQ(0, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -2184,7 +2397,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(0, ccDataOutBufferReceived);
     ASSERT_EQ(0, line21OutBufferReceived);
+    ASSERT_EQ(0, line21ScreenBufferReceived);
     ASSERT_EQ(0, dtvccOutBufferReceived);
+    ASSERT_EQ(0, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2199,7 +2414,10 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(FALSE, ccDataOutShutdownReceived);
     ASSERT_EQ(FALSE, line21OutShutdownReceived);
+    ASSERT_EQ(FALSE, line21ScreenShutdownReceived);
+    ASSERT_EQ(FALSE, cueOutShutdownReceived);
     ASSERT_EQ(FALSE, dtvccOutShutdownReceived);
+    ASSERT_EQ(FALSE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2209,6 +2427,7 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     resetMetrics();
     memset(&ctx, 0, sizeof(Context));
     ctx.config.artifacts = FALSE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
     ctx.config.bailAfterMins = 0;
     ctx.config.inputFilename = "Test";
     sprintf(ctx.config.outputDirectory, "MPEG");
@@ -2222,7 +2441,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, dtvccDecodeBufferReceived);
     ASSERT_EQ(0, ccDataOutBufferReceived);
     ASSERT_EQ(0, line21OutBufferReceived);
+    ASSERT_EQ(0, line21ScreenBufferReceived);
     ASSERT_EQ(0, dtvccOutBufferReceived);
+    ASSERT_EQ(0, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
     ASSERT_EQ(TRUE, retval);
@@ -2232,7 +2453,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(2, dtvccDecodeBufferReceived);
     ASSERT_EQ(0, ccDataOutBufferReceived);
     ASSERT_EQ(0, line21OutBufferReceived);
+    ASSERT_EQ(0, line21ScreenBufferReceived);
     ASSERT_EQ(0, dtvccOutBufferReceived);
+    ASSERT_EQ(0, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     dtvccDecodePassSuccessfully = FALSE;
     retval = MpegFileProcNextBuffer( &ctx, &isDone );
@@ -2243,7 +2466,9 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(3, dtvccDecodeBufferReceived);
     ASSERT_EQ(0, ccDataOutBufferReceived);
     ASSERT_EQ(0, line21OutBufferReceived);
+    ASSERT_EQ(0, line21ScreenBufferReceived);
     ASSERT_EQ(0, dtvccOutBufferReceived);
+    ASSERT_EQ(0, dtvccWindowBufferReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 
@@ -2258,7 +2483,10 @@ void itest__MockMpegPipelineTests( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, dtvccDecodeShutdownReceived);
     ASSERT_EQ(FALSE, ccDataOutShutdownReceived);
     ASSERT_EQ(FALSE, line21OutShutdownReceived);
+    ASSERT_EQ(FALSE, line21ScreenShutdownReceived);
+    ASSERT_EQ(FALSE, cueOutShutdownReceived);
     ASSERT_EQ(FALSE, dtvccOutShutdownReceived);
+    ASSERT_EQ(FALSE, dtvccWindowShutdownReceived);
     ASSERT_EQ(0, NumAllocatedBuffers());
     TEST_END
 }  // itest__MockMpegPipelineTests()
@@ -180,6 +180,29 @@ class TestClass(object):
         os.remove("./tmp/BigBuckBunny_256x144-24fps.mcc")
         os.removedirs("./tmp")
 
+    def test__parallel_sinks_w_frames_per_buffer(self):
+        # Every sink of the default pipeline runs at once on buffers of 256 frames, which
+        # has the most buffers alive at a time, and has to match running them one by one.
+        for out_dir in ['./tmp/default', './tmp/parallel']:
+            if os.path.exists(out_dir) is not True:
+                os.makedirs(out_dir)
+        subprocess.check_call([CAPTION_INSPECTOR_EXE, '-o', './tmp/default',
+                               '../media/BigBuckBunny_256x144-24fps.mcc'])
+        subprocess.check_call([CAPTION_INSPECTOR_EXE, '--parallel-sinks', '--frames-per-buffer', '256',
+                               '-o', './tmp/parallel', '../media/BigBuckBunny_256x144-24fps.mcc'])
+        outputs = ['-C1.608', '-C3.608', '-S1.708', '-S2.708', '-S3.708', '-S4.708', '-S5.708', '-S6.708', '.ccd']
+        for output in outputs:
+            assert os.path.exists('./tmp/parallel/BigBuckBunny_256x144-24fps' + output) is True
+            generated_file = open('./tmp/parallel/BigBuckBunny_256x144-24fps' + output, "r")
+            master_file = open('./tmp/default/BigBuckBunny_256x144-24fps' + output, "r")
+            compare_files(generated_file, master_file, [35, 36] if output == '.ccd' else [1])
+            generated_file.close()
+            master_file.close()
+        for out_dir in ['./tmp/default', './tmp/parallel']:
+            for file_name in os.listdir(out_dir):
+                os.remove(os.path.join(out_dir, file_name))
+            os.removedirs(out_dir)
+
 
 if __name__ == "__main__":
     TestClass().test__get_version()
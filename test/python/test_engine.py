@@ -15,9 +15,9 @@ py_test_suites = ['autodetect_file', 'external_adaptor', 'output_utils']
 py_test_suites_names = {'autodetect_file': 'Test Suite: Autodetect File',
                         'external_adaptor': 'Test Suite: External Adaptor',
                         'output_utils': 'Test Suite: Output Utilities'}
-c_integ_test_suites = ['itest__buffer_utils', 'itest__pipeline_utils']
+c_integ_test_suites = ['itest__buffer_utils', 'itest__pipeline_utils', 'itest__cache_file']
 c_unit_test_suites = ['utest__buffer_utils_c', 'utest__cc_utils_c', 'utest__external_adaptor_c',
-                      'utest__output_utils_c', 'utest__pipeline_utils_c']
+                      'utest__output_utils_c', 'utest__pipeline_utils_c', 'utest__thread_pool_c']
 
 
 def run_test(test_name):
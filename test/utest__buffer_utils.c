@@ -15,8 +15,8 @@ static void free( void* );
 /*--                          Support for Stubs                             --*/
 /*----------------------------------------------------------------------------*/
 
-#define STUB_NUM_ELEMENTS         35
-#define STUB_BUFFER_MEMORY        50
+#define STUB_NUM_ELEMENTS         ((3 * MAX_BUFFER_ARRAY_SIZE) + 5)   // Enough to fill the Buffer Pool and then some
+#define STUB_BUFFER_MEMORY        104
 
 typedef struct {
     boolean allocated;
@@ -76,6 +76,14 @@ static void stubInitMallocStubElems( void ) {
     }
 } // Stub Helper: stubInitMallocStubElems()
 
+static uint8 stubReleaseCalled = 0;
+static void* stubReleaseRefPtr = NULL;
+
+static void stubRelease( void* dataRefPtr ) {
+    stubReleaseCalled++;
+    stubReleaseRefPtr = dataRefPtr;
+} // Stub Helper: stubRelease()
+
 static MallocStubElement* stubGetMallocStubElem( void* ptr ) {
     for( int loop = 0; loop < STUB_NUM_ELEMENTS; loop++ ) {
         if( mallocStubElementArray[loop].memory == ptr ) {
@@ -107,11 +115,12 @@ static uint8 stubCountMallocedElements( void ) {
  |    1) Allocate a Buffer of Bytes.
  |    2) Allocate a Buffer of Line 21 Data.
  |    3) Allocate a Buffer of DTVCC Data.
- |    4) Allocate a Buffer of Invalid Type.
- |    5) Allocate a Buffer with Zero Length.
- |    6) Allocate three Buffers.
- |    7) Allocate too many Buffers.
- |    8) Fail a malloc call.
+ |    4) Allocate a Buffer of Fill.
+ |    5) Allocate a Buffer of Invalid Type.
+ |    6) Allocate a Buffer with Zero Length.
+ |    7) Allocate three Buffers.
+ |    8) Allocate too many Buffers.
+ |    9) Fail a malloc call.
  -------------------------------------------------------------------------------*/
 void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -135,6 +144,7 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(0, buffPtr->captionTime.frameRatePerSecTimesOneHundred);
     ASSERT_EQ(0, buffPtr->numElements);
     ASSERT_EQ(123, buffPtr->maxNumElements);
+    ASSERT_EQ((uint64)NULL, (uint64)buffPtr->annotationPtr);
     ASSERT_EQ(3, stubCountMallocedElements());
     mallocedElemPtr = stubGetMallocStubElem(buffPtr);
     ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
@@ -168,7 +178,7 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(sizeof(Buffer), mallocedElemPtr->size);
     mallocedElemPtr = stubGetMallocStubElem(buffPtr->dataPtr);
     ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
-    ASSERT_EQ(13 * sizeof(Line21Code), mallocedElemPtr->size);
+    ASSERT_EQ(13, mallocedElemPtr->size);
     FreeBuffer(buffPtr);
     ASSERT_EQ(0, stubCountMallocedElements());
     ASSERT_EQ(FALSE, anyMallocErrors);
@@ -195,7 +205,43 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(sizeof(Buffer), mallocedElemPtr->size);
     mallocedElemPtr = stubGetMallocStubElem(buffPtr->dataPtr);
     ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
-    ASSERT_EQ(45 * sizeof(DtvccData), mallocedElemPtr->size);
+    ASSERT_EQ(45, mallocedElemPtr->size);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+
+    TEST_START("Test Case: _NewBuffer() - Allocate a Buffer of Fill.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    ASSERT_EQ(0, stubCountMallocedElements());
+    buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_FILL, 1);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+    ASSERT_EQ(BUFFER_TYPE_FILL, buffPtr->bufferType);
+    ASSERT_EQ(0, buffPtr->numElements);
+    ASSERT_EQ(1, buffPtr->maxNumElements);
+    ASSERT_EQ(3, stubCountMallocedElements());
+    mallocedElemPtr = stubGetMallocStubElem(buffPtr->dataPtr);
+    ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
+    ASSERT_EQ(sizeof(FillRun), mallocedElemPtr->size);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+
+    TEST_START("Test Case: _NewBuffer() - Allocate a Buffer of Caption Cues.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    ASSERT_EQ(0, stubCountMallocedElements());
+    buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_CAPTION_CUE, 2);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+    ASSERT_EQ(BUFFER_TYPE_CAPTION_CUE, buffPtr->bufferType);
+    ASSERT_EQ(0, buffPtr->numElements);
+    ASSERT_EQ(2, buffPtr->maxNumElements);
+    ASSERT_EQ(3, stubCountMallocedElements());
+    mallocedElemPtr = stubGetMallocStubElem(buffPtr->dataPtr);
+    ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
+    ASSERT_EQ(2 * sizeof(CaptionCue), mallocedElemPtr->size);
     FreeBuffer(buffPtr);
     ASSERT_EQ(0, stubCountMallocedElements());
     ASSERT_EQ(FALSE, anyMallocErrors);
@@ -258,7 +304,7 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(sizeof(Buffer), mallocedElemPtr->size);
     mallocedElemPtr = stubGetMallocStubElem(buffTwoPtr->dataPtr);
     ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
-    ASSERT_EQ(31 * sizeof(Line21Code), mallocedElemPtr->size);
+    ASSERT_EQ(31, mallocedElemPtr->size);
     ASSERT_EQ(6, stubCountMallocedElements());
     buffThreePtr = _NewBuffer("filename", 42, BUFFER_TYPE_DTVCC, 54);
     ASSERT_NEQ((uint64)NULL, (uint64)buffThreePtr);
@@ -277,7 +323,7 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(sizeof(Buffer), mallocedElemPtr->size);
     mallocedElemPtr = stubGetMallocStubElem(buffThreePtr->dataPtr);
     ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
-    ASSERT_EQ(54 * sizeof(DtvccData), mallocedElemPtr->size);
+    ASSERT_EQ(54, mallocedElemPtr->size);
     FreeBuffer(buffPtr);
     ASSERT_EQ(6, stubCountMallocedElements());
     FreeBuffer(buffTwoPtr);
@@ -321,7 +367,12 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_LINE_21, 33);
     ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
     ASSERT_EQ(30, stubCountMallocedElements());
-    ERRORS_EXPECTED(61)
+    for( int loop = 10; loop < MAX_BUFFER_ARRAY_SIZE; loop++ ) {
+        buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_BYTES, (100 + loop));
+        ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+        ASSERT_EQ(3 * (loop + 1), stubCountMallocedElements());
+    }
+    ERRORS_EXPECTED((6 * MAX_BUFFER_ARRAY_SIZE) + 1)
     FATAL_ERROR_EXPECTED
     buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_DTVCC, 55);
     ASSERT_EQ(FALSE, anyMallocErrors);
@@ -345,6 +396,8 @@ void utest__NewBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    1) Free a Buffer.
  |    2) Free an Invalid Buffer.
  |    3) Free a NULL Buffer.
+ |    4) Free a Buffer with an Annotation attached.
+ |    5) Free a Buffer which References its Data.
  -------------------------------------------------------------------------------*/
 void utest__FreeBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -402,6 +455,44 @@ void utest__FreeBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(3, stubCountMallocedElements());
     ASSERT_EQ(FALSE, anyMallocErrors);
     TEST_END
+
+    TEST_START("Test Case: FreeBuffer() - Free a Buffer with an Annotation attached.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    ASSERT_EQ(0, stubCountMallocedElements());
+    buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_BYTES, 123);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+    buffPtr->annotationPtr = _NewBuffer("filename", 43, BUFFER_TYPE_LINE_21, 41);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr->annotationPtr);
+    ASSERT_EQ(6, stubCountMallocedElements());
+    AddReader(buffPtr);
+    AddReader(buffPtr);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(6, stubCountMallocedElements());
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+
+    TEST_START("Test Case: FreeBuffer() - Free a Buffer which References its Data.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    stubReleaseCalled = 0;
+    stubReleaseRefPtr = NULL;
+    uint8 refData[9];
+    uint8 refHandle;
+    buffPtr = _NewRefBuffer("filename", 42, BUFFER_TYPE_BYTES, refData, 9, &refHandle, stubRelease);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+    ASSERT_EQ(2, stubCountMallocedElements());
+    ASSERT_PTREQ(refData, buffPtr->dataPtr);
+    ASSERT_EQ(9, buffPtr->numElements);
+    ASSERT_EQ(9, buffPtr->maxNumElements);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(1, stubReleaseCalled);
+    ASSERT_PTREQ(&refHandle, stubReleaseRefPtr);
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
 }  // utest__FreeBuffer()
 
 /*------------------------------------------------------------------------------
@@ -426,6 +517,134 @@ void utest__AddReader( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 }  // utest__AddReader()
 
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: _NewFramesBuffer() / AddFrameToBuffer() / NextBufferFrame()
+ |
+ | TEST CASES:
+ |    1) Allocate a Buffer of Frames.
+ |    2) Add Frames to a Buffer and walk them.
+ |    3) Add a Frame to a full Buffer.
+ |    4) Add a Frame with a different Frame Rate.
+ |    5) Walk a Buffer of Bytes as a single Frame.
+ -------------------------------------------------------------------------------*/
+void utest__NewFramesBuffer( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    MallocStubElement* mallocedElemPtr;
+    Buffer* buffPtr;
+    BufferFrame frame;
+    CaptionTime captionTime;
+    uint8 data[6] = { 0xFC, 0x94, 0x20, 0xFD, 0x80, 0x80 };
+
+    captionTime.hour = 1;
+    captionTime.minute = 2;
+    captionTime.second = 3;
+    captionTime.frame = 4;
+    captionTime.millisecond = 0;
+    captionTime.dropframe = TRUE;
+    captionTime.frameRatePerSecTimesOneHundred = 2997;
+    captionTime.source = CAPTION_TIME_FRAME_NUMBERING;
+
+    TEST_START("Test Case: _NewFramesBuffer() - Allocate a Buffer of Frames.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    buffPtr = _NewFramesBuffer("filename", 42, 3, 12);
+    ASSERT_NEQ((uint64)NULL, (uint64)buffPtr);
+    ASSERT_EQ(BUFFER_TYPE_CC_DATA_FRAMES, buffPtr->bufferType);
+    ASSERT_EQ(0, buffPtr->numFrames);
+    ASSERT_EQ(3, buffPtr->maxNumFrames);
+    ASSERT_EQ(0, buffPtr->numElements);
+    ASSERT_EQ(12, buffPtr->maxNumElements);
+    ASSERT_EQ(4, stubCountMallocedElements());
+    mallocedElemPtr = stubGetMallocStubElem(buffPtr->framePtr);
+    ASSERT_NEQ((uint64)NULL, (uint64)mallocedElemPtr);
+    ASSERT_EQ(3 * sizeof(CcDataFrame), mallocedElemPtr->size);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+
+    TEST_START("Test Case: AddFrameToBuffer() - Add Frames to a Buffer and walk them.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    buffPtr = _NewFramesBuffer("filename", 42, 3, 12);
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 6));
+    captionTime.frame = 5;
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, &data[3], 3));
+    ASSERT_EQ(2, buffPtr->numFrames);
+    ASSERT_EQ(9, buffPtr->numElements);
+    ASSERT_EQ(4, buffPtr->captionTime.frame);
+    ASSERT_EQ(0xFD, buffPtr->dataPtr[6]);
+    StartBufferFrames(buffPtr, &frame);
+    ASSERT_EQ(TRUE, NextBufferFrame(buffPtr, &frame));
+    ASSERT_EQ(0, frame.firstElement);
+    ASSERT_EQ(6, frame.numElements);
+    ASSERT_EQ(4, frame.captionTime.frame);
+    ASSERT_EQ(3, frame.captionTime.second);
+    ASSERT_EQ(2997, frame.captionTime.frameRatePerSecTimesOneHundred);
+    ASSERT_EQ(TRUE, NextBufferFrame(buffPtr, &frame));
+    ASSERT_EQ(6, frame.firstElement);
+    ASSERT_EQ(3, frame.numElements);
+    ASSERT_EQ(5, frame.captionTime.frame);
+    ASSERT_EQ(FALSE, NextBufferFrame(buffPtr, &frame));
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    captionTime.frame = 4;
+    TEST_END
+
+    TEST_START("Test Case: AddFrameToBuffer() - Add a Frame to a full Buffer.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    buffPtr = _NewFramesBuffer("filename", 42, 3, 12);
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 6));
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 6));
+    ASSERT_EQ(FALSE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    ASSERT_EQ(2, buffPtr->numFrames);
+    FreeBuffer(buffPtr);
+    buffPtr = _NewFramesBuffer("filename", 42, 2, 12);
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    ASSERT_EQ(FALSE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    ASSERT_EQ(2, buffPtr->numFrames);
+    ASSERT_EQ(6, buffPtr->numElements);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+
+    TEST_START("Test Case: AddFrameToBuffer() - Add a Frame with a different Frame Rate.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    buffPtr = _NewFramesBuffer("filename", 42, 3, 12);
+    ASSERT_EQ(TRUE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    captionTime.frameRatePerSecTimesOneHundred = 2500;
+    ASSERT_EQ(FALSE, AddFrameToBuffer(buffPtr, &captionTime, data, 3));
+    ASSERT_EQ(1, buffPtr->numFrames);
+    ASSERT_EQ(3, buffPtr->numElements);
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    captionTime.frameRatePerSecTimesOneHundred = 2997;
+    TEST_END
+
+    TEST_START("Test Case: NextBufferFrame() - Walk a Buffer of Bytes as a single Frame.");
+    stubInitMallocStubElems();
+    BufferPoolInit();
+    buffPtr = _NewBuffer("filename", 42, BUFFER_TYPE_BYTES, 6);
+    buffPtr->numElements = 6;
+    buffPtr->captionTime = captionTime;
+    StartBufferFrames(buffPtr, &frame);
+    ASSERT_EQ(TRUE, NextBufferFrame(buffPtr, &frame));
+    ASSERT_EQ(0, frame.firstElement);
+    ASSERT_EQ(6, frame.numElements);
+    ASSERT_EQ(4, frame.captionTime.frame);
+    ASSERT_EQ(FALSE, NextBufferFrame(buffPtr, &frame));
+    FreeBuffer(buffPtr);
+    ASSERT_EQ(0, stubCountMallocedElements());
+    ASSERT_EQ(FALSE, anyMallocErrors);
+    TEST_END
+}  // utest__NewFramesBuffer()
+
 /*------------------------------------------------------------------------------
  | FUNCTION UNDER TEST: CaptionTimeFromPts()
  |
@@ -510,6 +729,10 @@ int main( int argc, char* argv[] ) {
     utest__AddReader( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
 
+    TEST_SUITE_START("Test Suite: buffer_utils.c -- _NewFramesBuffer()");
+    utest__NewFramesBuffer( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
     TEST_SUITE_START("Test Suite: buffer_utils.c -- CaptionTimeFromPts()");
     utest__CaptionTimeFromPts( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
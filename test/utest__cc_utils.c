@@ -4,6 +4,7 @@
 
 #include "test_engine.h"
 #include "../src/utils/cc_utils.c"
+#include "../src/utils/timecode_index.c"
 
 /*----------------------------------------------------------------------------*/
 /*--                             Test Cases                                 --*/
@@ -330,6 +331,446 @@ void utest__timeCodeToFrame( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 
 }  // utest__timeCodeToFrame()
 
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: triageCcData()
+ |
+ | TEST CASES:
+ |    1) Padding Only Frame
+ |    2) Mixed Frame
+ |    3) Oversized Frame
+ -------------------------------------------------------------------------------*/
+void utest__triageCcData( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    CcDataTriage triage;
+    uint8 ccData[3 * (CC_TRIAGE_MAX_CONSTRUCTS + 1)];
+
+    TEST_START("Test Case: triageCcData() - Padding Only Frame.");
+    for( int loop = 0; loop < 20; loop++ ) {
+        ccData[(loop*3)] = INVALID_DTVCCC_CHANNEL_PACKET_DATA;
+        ccData[(loop*3)+1] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+        ccData[(loop*3)+2] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+    }
+    ccData[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    ccData[1] = CEA608_ZERO_WITH_ODD_PARITY;
+    ccData[2] = CEA608_ZERO_WITH_ODD_PARITY;
+    ccData[3] = VALID_CEA608E_LINE21_FIELD_2_CC;
+    ccData[4] = CEA608_ZERO_WITH_ODD_PARITY;
+    ccData[5] = CEA608_ZERO_WITH_ODD_PARITY;
+    triageCcData( ccData, 60, &triage );
+    ASSERT_EQ(0, triage.field1Mask);
+    ASSERT_EQ(0, triage.field2Mask);
+    ASSERT_EQ(0, triage.dtvccStartMask);
+    ASSERT_EQ(0, triage.dtvccDataMask);
+    TEST_END
+
+    TEST_START("Test Case: triageCcData() - Mixed Frame.");
+    ccData[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    ccData[1] = 0x94;
+    ccData[2] = 0x20;
+    ccData[6] = 0xFF;
+    ccData[7] = 0x02;
+    ccData[8] = 0x21;
+    ccData[9] = 0xFE;
+    ccData[10] = 0x41;
+    ccData[11] = 0x00;
+    ccData[21] = VALID_CEA608E_LINE21_FIELD_2_CC;
+    ccData[22] = 0x15;
+    ccData[23] = 0x2C;
+    ccData[27] = 0xF8;
+    ccData[28] = 0x94;
+    ccData[29] = 0x2C;
+    ccData[54] = 0xFB;
+    triageCcData( ccData, 60, &triage );
+    ASSERT_EQ(0x00000001, triage.field1Mask);
+    ASSERT_EQ(0x00000080, triage.field2Mask);
+    ASSERT_EQ(0x00040004, triage.dtvccStartMask);
+    ASSERT_EQ(0x00000008, triage.dtvccDataMask);
+    TEST_END
+
+    TEST_START("Test Case: triageCcData() - Oversized Frame.");
+    triageCcData( ccData, sizeof(ccData), &triage );
+    ASSERT_EQ(CC_TRIAGE_ALL_CONSTRUCTS, triage.field1Mask);
+    ASSERT_EQ(CC_TRIAGE_ALL_CONSTRUCTS, triage.field2Mask);
+    ASSERT_EQ(CC_TRIAGE_ALL_CONSTRUCTS, triage.dtvccStartMask);
+    ASSERT_EQ(CC_TRIAGE_ALL_CONSTRUCTS, triage.dtvccDataMask);
+    TEST_END
+
+}  // utest__triageCcData()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: splitCcData()
+ |
+ | TEST CASES:
+ |    1) Mixed Frame
+ |    2) Frames longer than a Triage
+ -------------------------------------------------------------------------------*/
+void utest__splitCcData( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    Buffer buffer;
+    CcDataPlane* planePtr;
+    uint8 ccData[3 * 2 * CC_TRIAGE_MAX_CONSTRUCTS];
+
+    for( int loop = 0; loop < (2 * CC_TRIAGE_MAX_CONSTRUCTS); loop++ ) {
+        ccData[(loop*3)] = INVALID_DTVCCC_CHANNEL_PACKET_DATA;
+        ccData[(loop*3)+1] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+        ccData[(loop*3)+2] = EMPTY_DTVCC_CHANNEL_PACKET_DATA;
+    }
+    ccData[0] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    ccData[1] = 0x94;
+    ccData[2] = 0x20;
+    ccData[3] = VALID_CEA608E_LINE21_FIELD_2_CC;
+    ccData[4] = CEA608_ZERO_WITH_ODD_PARITY;
+    ccData[5] = CEA608_ZERO_WITH_ODD_PARITY;
+    ccData[6] = 0xFF;
+    ccData[7] = 0x02;
+    ccData[8] = 0x21;
+    ccData[9] = 0xFE;
+    ccData[10] = 0x41;
+    ccData[11] = 0x00;
+    ccData[21] = VALID_CEA608E_LINE21_FIELD_2_CC;
+    ccData[22] = 0x15;
+    ccData[23] = 0x2C;
+    buffer.dataPtr = ccData;
+
+    TEST_START("Test Case: splitCcData() - Mixed Frame.");
+    buffer.numElements = 60;
+    buffer.planesPtr = NULL;
+    splitCcData( &buffer );
+    ASSERT_NEQ((uint64)NULL, (uint64)buffer.planesPtr);
+    planePtr = &buffer.planesPtr->plane[CC_DATA_PLANE_FIELD_1];
+    ASSERT_EQ(1, planePtr->numConstructs);
+    ASSERT_EQ(0, planePtr->indexPtr[0]);
+    ASSERT_EQ(VALID_CEA608E_LINE21_FIELD_1_CC, planePtr->headerPtr[0]);
+    ASSERT_EQ(0x94, planePtr->data1Ptr[0]);
+    ASSERT_EQ(0x20, planePtr->data2Ptr[0]);
+    planePtr = &buffer.planesPtr->plane[CC_DATA_PLANE_FIELD_2];
+    ASSERT_EQ(1, planePtr->numConstructs);
+    ASSERT_EQ(7, planePtr->indexPtr[0]);
+    ASSERT_EQ(0x15, planePtr->data1Ptr[0]);
+    ASSERT_EQ(0x2C, planePtr->data2Ptr[0]);
+    planePtr = &buffer.planesPtr->plane[CC_DATA_PLANE_DTVCC];
+    ASSERT_EQ(2, planePtr->numConstructs);
+    ASSERT_EQ(2, planePtr->indexPtr[0]);
+    ASSERT_EQ(0xFF, planePtr->headerPtr[0]);
+    ASSERT_EQ(0x02, planePtr->data1Ptr[0]);
+    ASSERT_EQ(0x21, planePtr->data2Ptr[0]);
+    ASSERT_EQ(3, planePtr->indexPtr[1]);
+    ASSERT_EQ(0xFE, planePtr->headerPtr[1]);
+    ASSERT_EQ(0x41, planePtr->data1Ptr[1]);
+    free(buffer.planesPtr);
+    TEST_END
+
+    TEST_START("Test Case: splitCcData() - Frames longer than a Triage.");
+    ccData[(40*3)] = VALID_CEA608E_LINE21_FIELD_1_CC;
+    ccData[(40*3)+1] = 0xC1;
+    ccData[(40*3)+2] = 0xC2;
+    ccData[(63*3)] = 0xFF;
+    buffer.numElements = sizeof(ccData);
+    buffer.planesPtr = NULL;
+    splitCcData( &buffer );
+    planePtr = &buffer.planesPtr->plane[CC_DATA_PLANE_FIELD_1];
+    ASSERT_EQ(2, planePtr->numConstructs);
+    ASSERT_EQ(0, planePtr->indexPtr[0]);
+    ASSERT_EQ(40, planePtr->indexPtr[1]);
+    ASSERT_EQ(0xC1, planePtr->data1Ptr[1]);
+    ASSERT_EQ(0xC2, planePtr->data2Ptr[1]);
+    ASSERT_EQ(1, buffer.planesPtr->plane[CC_DATA_PLANE_FIELD_2].numConstructs);
+    planePtr = &buffer.planesPtr->plane[CC_DATA_PLANE_DTVCC];
+    ASSERT_EQ(3, planePtr->numConstructs);
+    ASSERT_EQ(63, planePtr->indexPtr[2]);
+    free(buffer.planesPtr);
+    TEST_END
+}  // utest__splitCcData()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: bytesFromHex()
+ |
+ | TEST CASES:
+ |    1) Valid Mixed Case Run.
+ |    2) Invalid Pair Mid Run.
+ -------------------------------------------------------------------------------*/
+void utest__bytesFromHex( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    uint8 bytes[11];
+    uint16 retval;
+
+    TEST_START("Test Case: bytesFromHex() - Valid Mixed Case Run.");
+    retval = bytesFromHex( "9420aFbE0123456789abCD80", 11, bytes );
+    ASSERT_EQ(11, retval);
+    ASSERT_EQ(0x94, bytes[0]);
+    ASSERT_EQ(0x20, bytes[1]);
+    ASSERT_EQ(0xAF, bytes[2]);
+    ASSERT_EQ(0xBE, bytes[3]);
+    ASSERT_EQ(0x01, bytes[4]);
+    ASSERT_EQ(0x67, bytes[7]);
+    ASSERT_EQ(0x89, bytes[8]);
+    ASSERT_EQ(0xAB, bytes[9]);
+    ASSERT_EQ(0xCD, bytes[10]);
+    TEST_END
+
+    TEST_START("Test Case: bytesFromHex() - Invalid Pair Mid Run.");
+    retval = bytesFromHex( "0123456789ABCDEF01G3", 10, bytes );
+    ASSERT_EQ(9, retval);
+    ASSERT_EQ(0xEF, bytes[7]);
+    ASSERT_EQ(0x01, bytes[8]);
+    retval = bytesFromHex( "0123G56789ABCDEF", 8, bytes );
+    ASSERT_EQ(2, retval);
+    retval = bytesFromHex( "12 4", 2, bytes );
+    ASSERT_EQ(1, retval);
+    TEST_END
+
+}  // utest__bytesFromHex()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: bytesToHex()
+ |
+ | TEST CASES:
+ |    1) Valid Run.
+ -------------------------------------------------------------------------------*/
+void utest__bytesToHex( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    uint8 bytes[11] = { 0x94, 0x20, 0xAF, 0xBE, 0x01, 0x23, 0x45, 0x67, 0x89, 0xFA, 0x0C };
+    char hexStr[23];
+
+    TEST_START("Test Case: bytesToHex() - Valid Run.");
+    bytesToHex( bytes, 11, hexStr );
+    hexStr[22] = '\0';
+    ASSERT_EQ(0, strcmp("9420AFBE0123456789FA0C", hexStr));
+    TEST_END
+
+}  // utest__bytesToHex()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: frameTimeInRun()
+ |
+ | TEST CASES:
+ |    1) Time Code of a Frame in the next Second.
+ |    2) Presentation Time of a Frame in the next Minute.
+ |    3) First Frame of a Run.
+ -------------------------------------------------------------------------------*/
+void utest__frameTimeInRun( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    CaptionTime firstTime;
+    CaptionTime captionTime;
+
+    TEST_START("Test Case: frameTimeInRun() - Time Code in the next Second.");
+    firstTime.hour = 0;
+    firstTime.minute = 0;
+    firstTime.second = 1;
+    firstTime.frame = 28;
+    firstTime.millisecond = 0;
+    firstTime.dropframe = FALSE;
+    firstTime.frameRatePerSecTimesOneHundred = 3000;
+    firstTime.source = CAPTION_TIME_FRAME_NUMBERING;
+    frameTimeInRun( &firstTime, 3, &captionTime );
+    ASSERT_EQ(0, captionTime.minute);
+    ASSERT_EQ(2, captionTime.second);
+    ASSERT_EQ(1, captionTime.frame);
+    ASSERT_EQ(3000, captionTime.frameRatePerSecTimesOneHundred);
+    ASSERT_EQ(CAPTION_TIME_FRAME_NUMBERING, captionTime.source);
+    TEST_END
+
+    TEST_START("Test Case: frameTimeInRun() - Presentation Time in the next Minute.");
+    firstTime.second = 59;
+    firstTime.frame = 0;
+    firstTime.millisecond = 990;
+    firstTime.frameRatePerSecTimesOneHundred = 2997;
+    firstTime.source = CAPTION_TIME_PTS_NUMBERING;
+    frameTimeInRun( &firstTime, 2, &captionTime );
+    ASSERT_EQ(1, captionTime.minute);
+    ASSERT_EQ(0, captionTime.second);
+    ASSERT_EQ(56, captionTime.millisecond);
+    ASSERT_EQ(CAPTION_TIME_PTS_NUMBERING, captionTime.source);
+    TEST_END
+
+    TEST_START("Test Case: frameTimeInRun() - First Frame of a Run.");
+    frameTimeInRun( &firstTime, 0, &captionTime );
+    ASSERT_EQ(0, captionTime.minute);
+    ASSERT_EQ(59, captionTime.second);
+    ASSERT_EQ(990, captionTime.millisecond);
+    TEST_END
+
+}  // utest__frameTimeInRun()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: timeCodeLineToMs()
+ |
+ | TEST CASES:
+ |    1) Line with a No Dropframe Time Code.
+ |    2) Line with a Dropframe Time Code, which is not terminated.
+ |    3) Lines without a Time Code.
+ -------------------------------------------------------------------------------*/
+void utest__timeCodeLineToMs( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    uint32 timeInMs = 0;
+    boolean retval;
+
+    TEST_START("Test Case: timeCodeLineToMs() - No Dropframe Time Code.");
+    retval = timeCodeLineToMs( "01:02:03:15\t9420 9420", 21, 3000, &timeInMs );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(3723500, timeInMs);
+    TEST_END
+
+    TEST_START("Test Case: timeCodeLineToMs() - Unterminated Dropframe Time Code.");
+    char line[11] = { '0', '0', ':', '0', '1', ':', '0', '0', ';', '0', '6' };
+    retval = timeCodeLineToMs( line, 11, 2997, &timeInMs );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(60200, timeInMs);
+    TEST_END
+
+    TEST_START("Test Case: timeCodeLineToMs() - Lines without a Time Code.");
+    ASSERT_EQ(FALSE, timeCodeLineToMs( "\n", 1, 3000, &timeInMs ));
+    ASSERT_EQ(FALSE, timeCodeLineToMs( "Scenarist_SCC V1.0", 18, 3000, &timeInMs ));
+    ASSERT_EQ(FALSE, timeCodeLineToMs( "01:02:03:15", 10, 3000, &timeInMs ));
+    TEST_END
+
+}  // utest__timeCodeLineToMs()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: seekToTimeCode()
+ |
+ | TEST CASES:
+ |    1) Seek to a time between two lines.
+ |    2) Seek to the time of a line.
+ |    3) Seek to a time before the first line.
+ |    4) Seek to a time after the last line.
+ |    5) Seek within a file shorter than a scan.
+ -------------------------------------------------------------------------------*/
+void utest__seekToTimeCode( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    char* line = NULL;
+    size_t len = 0;
+    boolean retval;
+
+    FILE* filePtr = tmpfile();
+    fprintf(filePtr, "Scenarist_SCC V1.0\n\n");
+    long firstLinePos = ftell(filePtr);
+    for( int loop = 0; loop < 2000; loop++ ) {
+        fprintf(filePtr, "%02d:%02d:%02d:15\t9420 9420 942c\n\n", loop / 3600, (loop / 60) % 60, loop % 60);
+    }
+
+    TEST_START("Test Case: seekToTimeCode() - Seek Between Lines.");
+    retval = seekToTimeCode( filePtr, firstLinePos, -1, 3000, 1234000 );
+    ASSERT_EQ(TRUE, retval);
+    getline(&line, &len, filePtr);
+    ASSERT_EQ(0, strncmp("00:20:34:15", line, 11));
+    TEST_END
+
+    TEST_START("Test Case: seekToTimeCode() - Seek to a Line.");
+    retval = seekToTimeCode( filePtr, firstLinePos, -1, 3000, 1234500 );
+    ASSERT_EQ(TRUE, retval);
+    getline(&line, &len, filePtr);
+    ASSERT_EQ(0, strncmp("00:20:34:15", line, 11));
+    TEST_END
+
+    TEST_START("Test Case: seekToTimeCode() - Seek Before the First Line.");
+    retval = seekToTimeCode( filePtr, firstLinePos, -1, 3000, 100 );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(firstLinePos, ftell(filePtr));
+    TEST_END
+
+    TEST_START("Test Case: seekToTimeCode() - Seek After the Last Line.");
+    retval = seekToTimeCode( filePtr, firstLinePos, -1, 3000, 3600000 );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(-1, getline(&line, &len, filePtr));
+    TEST_END
+
+    fclose(filePtr);
+    filePtr = tmpfile();
+    fprintf(filePtr, "00:00:01:00\t9420\n\n00:00:02:00\t9420\n\n00:00:03:00\t9420\n\n");
+
+    TEST_START("Test Case: seekToTimeCode() - Seek in a Short File.");
+    retval = seekToTimeCode( filePtr, 0, -1, 3000, 1500 );
+    ASSERT_EQ(TRUE, retval);
+    getline(&line, &len, filePtr);
+    ASSERT_EQ(0, strncmp("00:00:02:00", line, 11));
+    TEST_END
+
+    fclose(filePtr);
+    free(line);
+}  // utest__seekToTimeCode()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: TimeCodeIndexBuild() / TimeCodeIndexLookup()
+ |
+ | TEST CASES:
+ |    1) Build an index of a file.
+ |    2) Look up a time between two indexed lines.
+ |    3) Look up a time before the first line.
+ |    4) Look up a time after the last line.
+ |    5) Build an index of a file which does not exist.
+ -------------------------------------------------------------------------------*/
+void utest__TimeCodeIndex( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    char fileNameStr[] = "/tmp/utest__TimeCodeIndex_XXXXXX";
+    char* line = NULL;
+    size_t len = 0;
+    TimeCodeIndex* indexPtr;
+    long lowPos;
+    long highPos;
+    long linePos = 0;
+
+    int fileDescriptor = mkstemp(fileNameStr);
+    FILE* filePtr = fdopen(fileDescriptor, "w+");
+    fprintf(filePtr, "Scenarist_SCC V1.0\n\n");
+    long firstLinePos = ftell(filePtr);
+    for( int loop = 0; loop < 2000; loop++ ) {
+        if( loop == 1234 ) linePos = ftell(filePtr);
+        fprintf(filePtr, "%02d:%02d:%02d:15\t9420 9420 942c\n\n", loop / 3600, (loop / 60) % 60, loop % 60);
+    }
+    fflush(filePtr);
+
+    TEST_START("Test Case: TimeCodeIndexBuild() - Build an Index of a File.");
+    indexPtr = TimeCodeIndexBuild( fileNameStr, firstLinePos, 3000 );
+    ASSERT_NEQ((uint64)NULL, (uint64)indexPtr);
+    ASSERT_EQ(firstLinePos, indexPtr->firstLinePos);
+    ASSERT_EQ(14, indexPtr->numEntries);
+    ASSERT_EQ(500, indexPtr->entriesPtr[0].timeInMs);
+    ASSERT_EQ(firstLinePos, indexPtr->entriesPtr[0].fileOffset);
+    for( int loop = 1; loop < indexPtr->numEntries; loop++ ) {
+        ASSERT_EQ(TRUE, indexPtr->entriesPtr[loop].timeInMs > indexPtr->entriesPtr[loop-1].timeInMs);
+        ASSERT_EQ(TRUE, (indexPtr->entriesPtr[loop].fileOffset - indexPtr->entriesPtr[loop-1].fileOffset) >= TIME_CODE_INDEX_SPACING_BYTES);
+    }
+    TEST_END
+
+    TEST_START("Test Case: TimeCodeIndexLookup() - Look up a Time between Indexed Lines.");
+    TimeCodeIndexLookup( indexPtr, 1234000, &lowPos, &highPos );
+    ASSERT_EQ(TRUE, lowPos < linePos);
+    ASSERT_EQ(TRUE, highPos > linePos);
+    ASSERT_EQ(TRUE, (highPos - lowPos) < (2 * TIME_CODE_INDEX_SPACING_BYTES));
+    ASSERT_EQ(TRUE, seekToTimeCode( filePtr, lowPos, highPos, 3000, 1234000 ));
+    ASSERT_EQ(linePos, ftell(filePtr));
+    getline(&line, &len, filePtr);
+    ASSERT_EQ(0, strncmp("00:20:34:15", line, 11));
+    TEST_END
+
+    TEST_START("Test Case: TimeCodeIndexLookup() - Look up a Time before the First Line.");
+    TimeCodeIndexLookup( indexPtr, 100, &lowPos, &highPos );
+    ASSERT_EQ(firstLinePos, lowPos);
+    ASSERT_EQ(firstLinePos, highPos);
+    TEST_END
+
+    TEST_START("Test Case: TimeCodeIndexLookup() - Look up a Time after the Last Line.");
+    TimeCodeIndexLookup( indexPtr, 3600000, &lowPos, &highPos );
+    ASSERT_EQ(indexPtr->entriesPtr[indexPtr->numEntries-1].fileOffset, lowPos);
+    ASSERT_EQ(-1, highPos);
+    ASSERT_EQ(TRUE, seekToTimeCode( filePtr, lowPos, highPos, 3000, 3600000 ));
+    ASSERT_EQ(-1, getline(&line, &len, filePtr));
+    TEST_END
+
+    TimeCodeIndexFree(indexPtr);
+    fclose(filePtr);
+    unlink(fileNameStr);
+
+    TEST_START("Test Case: TimeCodeIndexBuild() - Build an Index of a Missing File.");
+    indexPtr = TimeCodeIndexBuild( fileNameStr, 0, 3000 );
+    ASSERT_EQ((uint64)NULL, (uint64)indexPtr);
+    ASSERT_EQ(ENOENT, errno);
+    TEST_END
+
+    free(line);
+}  // utest__TimeCodeIndex()
+
 /*----------------------------------------------------------------------------*/
 /*--                             Test Suite                                 --*/
 /*----------------------------------------------------------------------------*/
@@ -343,11 +784,22 @@ void utest__timeCodeToFrame( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    byteToAscii()
  |    frameToTimeCode()
  |    timeCodeToFrame()
+ |    triageCcData()
+ |    bytesFromHex()
+ |    bytesToHex()
+ |    frameTimeInRun()
+ |    timeCodeLineToMs()
+ |    seekToTimeCode()
+ |    TimeCodeIndexBuild()
+ |    TimeCodeIndexLookup()
  |
  | UNTESTED FUNCTIONS:
  |    printCaptionsLine()             --  Used only for Debug
  |    numCcConstructsFromFramerate()  --  Too simple to test
  |    cdpFramerateFromFramerate()     --  Too simple to test
+ |    TimeCodeIndexNew()              --  Tested through TimeCodeIndexBuild()
+ |    TimeCodeIndexAdd()              --  Tested through TimeCodeIndexBuild()
+ |    TimeCodeIndexFree()             --  Too simple to test
  -------------------------------------------------------------------------------*/
 int main( int argc, char* argv[] ) {
     INIT_TEST_FRAMEWORK( argc, argv )
@@ -380,5 +832,37 @@ int main( int argc, char* argv[] ) {
     utest__timeCodeToFrame( &tmpNumSuccessfulTests, &tmpNumFailedTests );
     TEST_SUITE_END
 
+    TEST_SUITE_START("Test Suite: cc_utils.c -- triageCcData()");
+    utest__triageCcData( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- splitCcData()");
+    utest__splitCcData( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- bytesFromHex()");
+    utest__bytesFromHex( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- bytesToHex()");
+    utest__bytesToHex( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- frameTimeInRun()");
+    utest__frameTimeInRun( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- timeCodeLineToMs()");
+    utest__timeCodeLineToMs( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: cc_utils.c -- seekToTimeCode()");
+    utest__seekToTimeCode( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: timecode_index.c -- TimeCodeIndexBuild() / TimeCodeIndexLookup()");
+    utest__TimeCodeIndex( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
     SHUTDOWN_TEST_FRAMEWORK
 }  // main()
@@ -22,6 +22,7 @@ const char* captionFileTypeStr[MAX_FILE_TYPE] = {
         "MCC Caption File",         // MCC_CAPTIONS_FILE
         "Binary MPEG File",         // MPEG_BINARY_FILE
         "Binary MOV File",          // MOV_BINARY_FILE
+        "Binary CC Data File",      // CC_DATA_BINARY_FILE
 };
 
 uint8 fakeCtx;
@@ -47,8 +48,11 @@ uint8 MovFileInitializeCalled;
 uint8 MpegFileAddSinkCalled;
 uint8 MpegFileInitializeCalled;
 uint8 SccEncodeAddSinkCalled;
+uint8 SccEncodeInitializeCalled;
+uint8 SccFileAddSinkCalled;
 uint8 SccFileInitializeCalled;
 uint8 AddReaderCalled;
+uint8 BuildPipelineCalled;
 uint8 BufferPoolInitCalled;
 uint8 FreeBufferCalled;
 uint8 stubExternal608CallbackCalled;
@@ -62,6 +66,9 @@ uint8 DrivePipelineCalled;
 uint8 DetermineFileTypeCalled;
 
 Buffer* AddReaderBuffPtr;
+const PipelineNode* BuildPipelineGraph;
+uint8 BuildPipelineNumNodes;
+uint8 BuildPipelineOutputs;
 char* SccFileInitializeFileNameStr;
 uint32 SccFileInitializeFramerate;
 char* MccFileInitializeFileNameStr;
@@ -71,17 +78,14 @@ char* DetermineDropFrameInputFilename;
 char* DetermineDropFrameArtifactPath;
 boolean DetermineDropFrameSaveArtifacts;
 boolean DetermineDropFrame__isDropFrame;
-boolean MpegFileInitializeisDropframe;
-boolean MovFileInitializeisDropframe;
 boolean DetermineDropFrame__wasSuccessful;
-boolean MpegFileInitializeOverrideDf;
-boolean MovFileInitializeOverrideDf;
 boolean fakeIsDebugInitializedVal;
 boolean fakeIsDebugExternallyRoutedVal;
 boolean PlumbMccPipelineReturn;
 boolean PlumbSccPipelineReturn;
 boolean PlumbMpgPipelineReturn;
 boolean PlumbMovPipelineReturn;
+boolean BuildPipelineReturn;
 FileType DetermineFileTypeReturn;
 boolean DtvccDecodeAddSinkReturn;
 boolean Line21DecodeAddSinkReturn;
@@ -93,6 +97,7 @@ boolean MovFileInitializeReturn;
 boolean MpegFileAddSinkReturn;
 boolean MpegFileInitializeReturn;
 boolean SccEncodeAddSinkReturn;
+boolean SccFileAddSinkReturn;
 boolean SccFileInitializeReturn;
 
 void InitStubs( void ) {
@@ -110,8 +115,11 @@ void InitStubs( void ) {
     MpegFileAddSinkCalled = 0;
     MpegFileInitializeCalled = 0;
     SccEncodeAddSinkCalled = 0;
+    SccEncodeInitializeCalled = 0;
+    SccFileAddSinkCalled = 0;
     SccFileInitializeCalled = 0;
     AddReaderCalled = 0;
+    BuildPipelineCalled = 0;
     BufferPoolInitCalled = 0;
     FreeBufferCalled = 0;
     stubExternal608CallbackCalled = 0;
@@ -125,26 +133,27 @@ void InitStubs( void ) {
     DetermineFileTypeCalled = 0;
 
     AddReaderBuffPtr = NULL;
+    BuildPipelineGraph = NULL;
+    BuildPipelineNumNodes = 0;
+    BuildPipelineOutputs = PIPELINE_OUTPUT_NONE;
     SccFileInitializeFileNameStr = NULL;
     SccFileInitializeFramerate = 0;
     MccFileInitializeFileNameStr = NULL;
     MpegFileInitializeFileNameStr = NULL;
+    MovFileInitializeFileNameStr = NULL;
     DetermineDropFrameInputFilename = NULL;
     DetermineDropFrameArtifactPath = NULL;
     DetermineDropFrameSaveArtifacts = FALSE;
     DetermineDropFrame__isDropFrame = FALSE;
-    MpegFileInitializeisDropframe = FALSE;
     DetermineDropFrame__wasSuccessful = FALSE;
-    MpegFileInitializeOverrideDf = FALSE;
-    MovFileInitializeFileNameStr = NULL;
-    MovFileInitializeisDropframe = FALSE;
-    MovFileInitializeOverrideDf = FALSE;
     fakeIsDebugInitializedVal = TRUE;
     fakeIsDebugExternallyRoutedVal = TRUE;
     PlumbMccPipelineReturn = TRUE;
     PlumbSccPipelineReturn = TRUE;
     PlumbMpgPipelineReturn = TRUE;
     PlumbMovPipelineReturn = TRUE;
+    BuildPipelineReturn = TRUE;
+    DetermineFileTypeReturn = UNK_CAPTIONS_FILE;
     DtvccDecodeAddSinkReturn = TRUE;
     Line21DecodeAddSinkReturn = TRUE;
     MccDecodeAddSinkReturn = TRUE;
@@ -155,8 +164,8 @@ void InitStubs( void ) {
     MpegFileAddSinkReturn = TRUE;
     MpegFileInitializeReturn = TRUE;
     SccEncodeAddSinkReturn = TRUE;
+    SccFileAddSinkReturn = TRUE;
     SccFileInitializeReturn = TRUE;
-    DetermineFileTypeReturn = UNK_CAPTIONS_FILE;
 
     line21Codes[0].codeType = LINE21_BASIC_CHARS;
     line21Codes[0].channelNum = 1;
@@ -191,6 +200,8 @@ boolean AnySpuriousFunctionsCalled( void ) {
         (MpegFileAddSinkCalled != 0) ||
         (MpegFileInitializeCalled != 0) ||
         (SccEncodeAddSinkCalled != 0) ||
+        (SccEncodeInitializeCalled != 0) ||
+        (SccFileAddSinkCalled != 0) ||
         (SccFileInitializeCalled != 0) ||
         (BufferPoolInitCalled != 0) ||
         (FreeBufferCalled != 0) ||
@@ -202,6 +213,7 @@ boolean AnySpuriousFunctionsCalled( void ) {
         (PlumbMpgPipelineCalled != 0) ||
         (PlumbMovPipelineCalled != 0) ||
         (DrivePipelineCalled != 0) ||
+        (BuildPipelineCalled != 0) ||
         (DetermineFileTypeCalled != 0) ||
         (AddReaderCalled != 0) ) {
         return TRUE;
@@ -223,7 +235,7 @@ boolean DtvccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return DtvccDecodeAddSinkReturn;
 }
 
-LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint64 decodeWhichServices ) {
     LinkInfo linkInfo;
     linkInfo.sourceType = 1;
 
@@ -238,7 +250,7 @@ boolean Line21DecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return Line21DecodeAddSinkReturn;
 }
 
-LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint8 decodeWhichChannels ) {
     LinkInfo linkInfo;
     linkInfo.sourceType = 1;
 
@@ -281,11 +293,9 @@ boolean MovFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return MovFileAddSinkReturn;
 }
 
-boolean MovFileInitialize( Context* rootCtxPtr, boolean bailAtTwenty ) {
+boolean MovFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     MovFileInitializeCalled++;
     MovFileInitializeFileNameStr = rootCtxPtr->config.inputFilename;
-    MovFileInitializeisDropframe = rootCtxPtr->config.forcedDropframe;
-    MovFileInitializeOverrideDf = rootCtxPtr->config.forceDropframe;
 
     return MovFileInitializeReturn;
 }
@@ -296,11 +306,9 @@ boolean MpegFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return MpegFileAddSinkReturn;
 }
 
-boolean MpegFileInitialize( Context* rootCtxPtr, boolean bailAtTwenty ) {
+boolean MpegFileInitialize( Context* rootCtxPtr, uint8 bailAfterMins ) {
     MpegFileInitializeCalled++;
     MpegFileInitializeFileNameStr = rootCtxPtr->config.inputFilename;
-    MpegFileInitializeisDropframe = rootCtxPtr->config.forcedDropframe;
-    MpegFileInitializeOverrideDf = rootCtxPtr->config.forceDropframe;
 
     return MpegFileInitializeReturn;
 }
@@ -311,6 +319,21 @@ boolean SccEncodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return SccEncodeAddSinkReturn;
 }
 
+LinkInfo SccEncodeInitialize( Context* rootCtxPtr ) {
+    LinkInfo linkInfo;
+    linkInfo.sourceType = 1;
+
+    SccEncodeInitializeCalled++;
+
+    return linkInfo;
+}
+
+boolean SccFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    SccFileAddSinkCalled++;
+
+    return SccFileAddSinkReturn;
+}
+
 boolean SccFileInitialize( Context* rootCtxPtr, char* fileNameStr, uint32 frTimesOneHundred ) {
     SccFileInitializeCalled++;
     SccFileInitializeFileNameStr = fileNameStr;
@@ -351,6 +374,89 @@ FileType DetermineFileType( char* fileNameStr ) {
     return DetermineFileTypeReturn;
 }
 
+static boolean stubSourceInitialize( Context* ctxPtr, uint8 element ) {
+    switch( element ) {
+        case PIPELINE_ELEMENT_SCC_FILE:
+            return SccFileInitialize(ctxPtr, ctxPtr->config.inputFilename, ctxPtr->config.passedInFramerate);
+        case PIPELINE_ELEMENT_MCC_FILE:
+            return MccFileInitialize(ctxPtr, ctxPtr->config.inputFilename);
+        case PIPELINE_ELEMENT_MPEG_FILE:
+            return MpegFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
+        case PIPELINE_ELEMENT_MOV_FILE:
+            return MovFileInitialize(ctxPtr, ctxPtr->config.bailAfterMins);
+        default:
+            TEST_ASSERT(FALSE);
+            return FALSE;
+    }
+}
+
+static LinkInfo stubElementInitialize( Context* ctxPtr, uint8 element ) {
+    LinkInfo linkInfo;
+
+    switch( element ) {
+        case PIPELINE_ELEMENT_SCC_ENCODE:
+            return SccEncodeInitialize(ctxPtr);
+        case PIPELINE_ELEMENT_MCC_DECODE:
+            return MccDecodeInitialize(ctxPtr);
+        case PIPELINE_ELEMENT_LINE21_DECODE:
+            return Line21DecodeInitialize(ctxPtr, FALSE, ctxPtr->config.decodeWhichChannels);
+        case PIPELINE_ELEMENT_DTVCC_DECODE:
+            return DtvccDecodeInitialize(ctxPtr, FALSE, ctxPtr->config.decodeWhichServices);
+        default:
+            TEST_ASSERT(FALSE);
+            memset(&linkInfo, 0, sizeof(LinkInfo));
+            return linkInfo;
+    }
+}
+
+static boolean stubElementAddSink( Context* ctxPtr, uint8 element, LinkInfo linkInfo ) {
+    switch( element ) {
+        case PIPELINE_ELEMENT_SCC_FILE:
+            return SccFileAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_MCC_FILE:
+            return MccFileAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_MPEG_FILE:
+            return MpegFileAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_MOV_FILE:
+            return MovFileAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_SCC_ENCODE:
+            return SccEncodeAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_MCC_DECODE:
+            return MccDecodeAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_LINE21_DECODE:
+            return Line21DecodeAddSink(ctxPtr, linkInfo);
+        case PIPELINE_ELEMENT_DTVCC_DECODE:
+            return DtvccDecodeAddSink(ctxPtr, linkInfo);
+        default:
+            TEST_ASSERT(FALSE);
+            return FALSE;
+    }
+}
+
+// Plumbs the graph through the element stubs in the same order, and with the same early bail, as the real one
+boolean BuildPipeline( Context* ctxPtr, const PipelineNode* graph, uint8 numNodes, uint8 outputs ) {
+    BuildPipelineCalled++;
+    BuildPipelineGraph = graph;
+    BuildPipelineNumNodes = numNodes;
+    BuildPipelineOutputs = outputs;
+
+    if( BuildPipelineReturn == FALSE ) return FALSE;
+
+    if( stubSourceInitialize(ctxPtr, graph[0].element) == FALSE ) return FALSE;
+
+    for( int loop = 1; loop < numNodes; loop++ ) {
+        LinkInfo linkInfo;
+        if( graph[loop].element == PIPELINE_ELEMENT_EXTERNAL ) {
+            linkInfo = *graph[loop].linkInfoPtr;
+        } else {
+            linkInfo = stubElementInitialize(ctxPtr, graph[loop].element);
+        }
+        if( stubElementAddSink(ctxPtr, graph[loop].parent, linkInfo) == FALSE ) return FALSE;
+    }
+
+    return TRUE;
+}
+
 void DrivePipeline( FileType sourceType, Context* ctxPtr ) {
     DrivePipelineCalled++;
 }
@@ -360,6 +466,20 @@ void FreeBuffer( Buffer* bufferToFreePtr ) {
     TEST_ASSERT(bufferToFreePtr == &buffer);
 }
 
+boolean Line21DecodeNextEvent( Buffer* buffPtr, uint16* offsetPtr, Line21Code* codePtr ) {
+    if( *offsetPtr >= buffPtr->numElements ) return FALSE;
+    *codePtr = ((Line21Code*)buffPtr->dataPtr)[*offsetPtr];
+    *offsetPtr = *offsetPtr + 1;
+    return TRUE;
+}
+
+boolean DtvccDecodeNextEvent( Buffer* buffPtr, uint16* offsetPtr, DtvccData* dtvccDataPtr ) {
+    if( *offsetPtr >= buffPtr->numElements ) return FALSE;
+    *dtvccDataPtr = ((DtvccData*)buffPtr->dataPtr)[*offsetPtr];
+    *offsetPtr = *offsetPtr + 1;
+    return TRUE;
+}
+
 boolean PlumbMccPipeline( Context* ctxPtr ) {
     PlumbMccPipelineCalled++;
     return PlumbMccPipelineReturn;
@@ -924,23 +1044,29 @@ void utest__ExtrnlAdptrDriveDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    12) Fail Plumbing because of Invalid File Type.
  |    13) Fail Plumbing because of Failed Mpeg File Initialize.
  |    14) Fail Plumbing because of Failed Mpeg Sink Addition.
- |    15) Fail Plumbing because of Failed Mov File Initialize.
- |    16) Fail Plumbing because of Failed Mov Sink Addition.
- |    17) Fail Plumbing because of Failed Line21 Sink Addition. (MOV)
- |    18) Fail Plumbing because of Failed Dtvcc Sink Addition. (MPEG)
- |    19) Fail Plumbing because of Failed Scc File Initialize.
- |    20) Fail Plumbing because of Failed Scc Sink Addition.
- |    21) Fail Plumbing because of Failed Line21 Sink Addition.
- |    22) Fail Plumbing because of Invalid Framerate.
- |    23) Fail Plumbing because of Failed Mcc File Initialize.
- |    24) Fail Plumbing because of Failed Mcc Sink Addition.
- |    25) Fail Plumbing because of Failed Line21 Sink Addition.
- |    26) Fail Plumbing because of Failed Dtvcc Sink Addition.
+ |    15) Fail Plumbing an MPEG File without FFMPEG.
+ |    16) Fail Plumbing because of Failed Mov File Initialize.
+ |    17) Fail Plumbing because of Failed Mov Sink Addition.
+ |    18) Fail Plumbing because of Failed Line21 Sink Addition. (MOV)
+ |    19) Fail Plumbing because of Failed Dtvcc Sink Addition. (MPEG)
+ |    20) Fail Plumbing because of Failed Scc File Initialize.
+ |    21) Fail Plumbing because of Failed Scc File Sink Addition.
+ |    22) Fail Plumbing because of Failed Scc Encode Sink Addition.
+ |    23) Fail Plumbing because of Failed Line21 Sink Addition. (SCC)
+ |    24) Fail Plumbing because of Invalid Framerate.
+ |    25) Fail Plumbing because of Failed Mcc File Initialize.
+ |    26) Fail Plumbing because of Failed Mcc Sink Addition.
+ |    27) Fail Plumbing because of Failed Line21 Sink Addition. (MCC)
+ |    28) Fail Plumbing because of Failed Dtvcc Sink Addition. (MCC)
+ |    29) Fail Plumbing because the Pipeline could not be Built. (MOV)
+ |    30) Fail Plumbing because the Pipeline could not be Built. (SCC)
+ |    31) Fail Plumbing because the Pipeline could not be Built. (MCC)
  -------------------------------------------------------------------------------*/
 void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
     boolean retval;
 
+#ifndef DONT_COMPILE_FFMPEG
     TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Successfully Plumb a Decode Pipeline for an MPEG File.")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
@@ -951,6 +1077,11 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(TRUE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_PTREQ((void*)mpegDecodeGraph, (void*)BuildPipelineGraph);
+        ASSERT_EQ(PIPELINE_GRAPH_SIZE(mpegDecodeGraph), BuildPipelineNumNodes);
+        ASSERT_EQ(PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708, BuildPipelineOutputs);
+        ASSERT_STREQ("mpeg filename", MpegFileInitializeFileNameStr);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MpegFileInitializeCalled);
         ASSERT_EQ(2, MpegFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
@@ -959,6 +1090,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MpegFileInitializeCalled = 0;
         MpegFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
@@ -967,6 +1099,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         DtvccDecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
+#endif
 
     TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Successfully Plumb a Decode Pipeline for an MOV File.")
         InitStubs();
@@ -978,6 +1111,11 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(TRUE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_PTREQ((void*)movDecodeGraph, (void*)BuildPipelineGraph);
+        ASSERT_EQ(PIPELINE_GRAPH_SIZE(movDecodeGraph), BuildPipelineNumNodes);
+        ASSERT_EQ(PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708, BuildPipelineOutputs);
+        ASSERT_STREQ("mov filename", MovFileInitializeFileNameStr);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MovFileInitializeCalled);
         ASSERT_EQ(2, MovFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
@@ -986,6 +1124,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MovFileInitializeCalled = 0;
         MovFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
@@ -1005,15 +1144,26 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(TRUE, pipelineEstablished);
         ASSERT_EQ(1, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_PTREQ((void*)sccDecodeGraph, (void*)BuildPipelineGraph);
+        ASSERT_EQ(PIPELINE_GRAPH_SIZE(sccDecodeGraph), BuildPipelineNumNodes);
+        ASSERT_EQ(PIPELINE_OUTPUT_608, BuildPipelineOutputs);
+        ASSERT_STREQ("scc filename", SccFileInitializeFileNameStr);
+        ASSERT_EQ(2400, SccFileInitializeFramerate);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, SccFileInitializeCalled);
-        ASSERT_EQ(1, SccEncodeAddSinkCalled);
+        ASSERT_EQ(1, SccEncodeInitializeCalled);
+        ASSERT_EQ(1, SccFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
+        ASSERT_EQ(1, SccEncodeAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         SccFileInitializeCalled = 0;
-        SccEncodeAddSinkCalled = 0;
+        SccEncodeInitializeCalled = 0;
+        SccFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
+        SccEncodeAddSinkCalled = 0;
         Line21DecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1028,23 +1178,29 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(TRUE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_PTREQ((void*)mccDecodeGraph, (void*)BuildPipelineGraph);
+        ASSERT_EQ(PIPELINE_GRAPH_SIZE(mccDecodeGraph), BuildPipelineNumNodes);
+        ASSERT_EQ(PIPELINE_OUTPUT_608 | PIPELINE_OUTPUT_708, BuildPipelineOutputs);
+        ASSERT_STREQ("mcc filename", MccFileInitializeFileNameStr);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MccFileInitializeCalled);
         ASSERT_EQ(1, MccDecodeInitializeCalled);
         ASSERT_EQ(1, MccFileAddSinkCalled);
-        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
-        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
         ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MccFileInitializeCalled = 0;
         MccDecodeInitializeCalled = 0;
         MccFileAddSinkCalled = 0;
-        MccDecodeAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
-        Line21DecodeAddSinkCalled = 0;
+        MccDecodeAddSinkCalled = 0;
         DtvccDecodeInitializeCalled = 0;
+        Line21DecodeAddSinkCalled = 0;
         DtvccDecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1157,6 +1313,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
+#ifndef DONT_COMPILE_FFMPEG
     TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Mpeg File Initialize.")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
@@ -1169,9 +1326,11 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MpegFileInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MpegFileInitializeCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1188,16 +1347,28 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MpegFileInitializeCalled);
         ASSERT_EQ(1, MpegFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MpegFileInitializeCalled = 0;
         MpegFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
+#else
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing an MPEG File without FFMPEG.")
+        InitStubs();
+        retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
+        ASSERT_EQ(TRUE, retval);
+        DetermineFileTypeReturn = MPEG_BINARY_FILE;
+        FATAL_ERROR_EXPECTED
+        retval = ExtrnlAdptrPlumbFileDecodePipeline("mpeg filename", 2600);
+    TEST_END
+#endif
 
     TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Mov File Initialize.")
         InitStubs();
@@ -1211,9 +1382,11 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MovFileInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MovFileInitializeCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1230,11 +1403,13 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MovFileInitializeCalled);
         ASSERT_EQ(1, MovFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MovFileInitializeCalled = 0;
         MovFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
@@ -1253,6 +1428,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MovFileInitializeCalled);
         ASSERT_EQ(2, MovFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
@@ -1260,6 +1436,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(1, DtvccDecodeInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MovFileInitializeCalled = 0;
         MovFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
@@ -1268,7 +1445,8 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Dtvcc Sink Addition. (MPEG).")
+#ifndef DONT_COMPILE_FFMPEG
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Dtvcc Sink Addition. (MPEG)")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
         ASSERT_EQ(TRUE, retval);
@@ -1280,6 +1458,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MpegFileInitializeCalled);
         ASSERT_EQ(2, MpegFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
@@ -1288,6 +1467,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MpegFileInitializeCalled = 0;
         MpegFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
@@ -1296,6 +1476,7 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         DtvccDecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
+#endif
 
     TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Scc File Initialize.")
         InitStubs();
@@ -1309,14 +1490,41 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
+        ASSERT_EQ(1, SccFileInitializeCalled);
+        BufferPoolInitCalled = 0;
+        DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
+        SccFileInitializeCalled = 0;
+        ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Scc File Sink Addition.")
+        InitStubs();
+        retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
+        ASSERT_EQ(TRUE, retval);
+        DetermineFileTypeReturn = SCC_CAPTIONS_FILE;
+        SccFileAddSinkReturn = FALSE;
+        ERROR_EXPECTED
+        retval = ExtrnlAdptrPlumbFileDecodePipeline("scc filename", 2400);
+        ASSERT_EQ(FALSE, retval);
+        ASSERT_EQ(FALSE, pipelineEstablished);
+        ASSERT_EQ(0, numberOfShutdowns);
+        ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, SccFileInitializeCalled);
+        ASSERT_EQ(1, SccEncodeInitializeCalled);
+        ASSERT_EQ(1, SccFileAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         SccFileInitializeCalled = 0;
+        SccEncodeInitializeCalled = 0;
+        SccFileAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Scc Sink Addition.")
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Scc Encode Sink Addition.")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
         ASSERT_EQ(TRUE, retval);
@@ -1328,18 +1536,24 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, SccFileInitializeCalled);
-        ASSERT_EQ(1, SccEncodeAddSinkCalled);
+        ASSERT_EQ(1, SccEncodeInitializeCalled);
+        ASSERT_EQ(1, SccFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
+        ASSERT_EQ(1, SccEncodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         SccFileInitializeCalled = 0;
-        SccEncodeAddSinkCalled = 0;
+        SccEncodeInitializeCalled = 0;
+        SccFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
+        SccEncodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Line21 Sink Addition.")
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Line21 Sink Addition. (SCC)")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
         ASSERT_EQ(TRUE, retval);
@@ -1351,15 +1565,21 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, SccFileInitializeCalled);
-        ASSERT_EQ(1, SccEncodeAddSinkCalled);
+        ASSERT_EQ(1, SccEncodeInitializeCalled);
+        ASSERT_EQ(1, SccFileAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
+        ASSERT_EQ(1, SccEncodeAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         SccFileInitializeCalled = 0;
-        SccEncodeAddSinkCalled = 0;
+        SccEncodeInitializeCalled = 0;
+        SccFileAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
+        SccEncodeAddSinkCalled = 0;
         Line21DecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1392,9 +1612,11 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MccFileInitializeCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MccFileInitializeCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
@@ -1411,18 +1633,20 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MccFileInitializeCalled);
         ASSERT_EQ(1, MccDecodeInitializeCalled);
         ASSERT_EQ(1, MccFileAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MccFileInitializeCalled = 0;
         MccDecodeInitializeCalled = 0;
         MccFileAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Line21 Sink Addition.")
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Line21 Sink Addition. (MCC)")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
         ASSERT_EQ(TRUE, retval);
@@ -1434,26 +1658,28 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MccFileInitializeCalled);
         ASSERT_EQ(1, MccDecodeInitializeCalled);
         ASSERT_EQ(1, MccFileAddSinkCalled);
-        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
-        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MccFileInitializeCalled = 0;
         MccDecodeInitializeCalled = 0;
         MccFileAddSinkCalled = 0;
-        MccDecodeAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
-        Line21DecodeAddSinkCalled = 0;
+        MccDecodeAddSinkCalled = 0;
         DtvccDecodeInitializeCalled = 0;
+        Line21DecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Dtvcc Sink Addition.")
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because of Failed Dtvcc Sink Addition. (MCC)")
         InitStubs();
         retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
         ASSERT_EQ(TRUE, retval);
@@ -1465,26 +1691,85 @@ void utest__ExtrnlAdptrPlumbFileDecodePipeline( TEST_SUITE_RECEIVED_ARGUMENTS )
         ASSERT_EQ(FALSE, pipelineEstablished);
         ASSERT_EQ(0, numberOfShutdowns);
         ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
         ASSERT_EQ(1, MccFileInitializeCalled);
         ASSERT_EQ(1, MccDecodeInitializeCalled);
         ASSERT_EQ(1, MccFileAddSinkCalled);
-        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, Line21DecodeInitializeCalled);
-        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+        ASSERT_EQ(2, MccDecodeAddSinkCalled);
         ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+        ASSERT_EQ(1, Line21DecodeAddSinkCalled);
         ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
         BufferPoolInitCalled = 0;
         DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
         MccFileInitializeCalled = 0;
         MccDecodeInitializeCalled = 0;
         MccFileAddSinkCalled = 0;
-        MccDecodeAddSinkCalled = 0;
         Line21DecodeInitializeCalled = 0;
-        Line21DecodeAddSinkCalled = 0;
+        MccDecodeAddSinkCalled = 0;
         DtvccDecodeInitializeCalled = 0;
+        Line21DecodeAddSinkCalled = 0;
         DtvccDecodeAddSinkCalled = 0;
         ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
+
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because the Pipeline could not be Built. (MOV)")
+        InitStubs();
+        retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
+        ASSERT_EQ(TRUE, retval);
+        DetermineFileTypeReturn = MOV_BINARY_FILE;
+        BuildPipelineReturn = FALSE;
+        ERROR_EXPECTED
+        retval = ExtrnlAdptrPlumbFileDecodePipeline("mov filename", 2600);
+        ASSERT_EQ(FALSE, retval);
+        ASSERT_EQ(FALSE, pipelineEstablished);
+        ASSERT_EQ(0, numberOfShutdowns);
+        ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
+        BufferPoolInitCalled = 0;
+        DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
+        ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because the Pipeline could not be Built. (SCC)")
+        InitStubs();
+        retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
+        ASSERT_EQ(TRUE, retval);
+        DetermineFileTypeReturn = SCC_CAPTIONS_FILE;
+        BuildPipelineReturn = FALSE;
+        ERROR_EXPECTED
+        retval = ExtrnlAdptrPlumbFileDecodePipeline("scc filename", 2400);
+        ASSERT_EQ(FALSE, retval);
+        ASSERT_EQ(FALSE, pipelineEstablished);
+        ASSERT_EQ(0, numberOfShutdowns);
+        ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
+        BufferPoolInitCalled = 0;
+        DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
+        ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: utest__ExtrnlAdptrPlumbFileDecodePipeline() - Fail Plumbing because the Pipeline could not be Built. (MCC)")
+        InitStubs();
+        retval = ExtrnlAdptrInitialize( stubExternal608Callback, stubExternal708Callback, stubExternalEndDataCallback );
+        ASSERT_EQ(TRUE, retval);
+        DetermineFileTypeReturn = MCC_CAPTIONS_FILE;
+        BuildPipelineReturn = FALSE;
+        ERROR_EXPECTED
+        retval = ExtrnlAdptrPlumbFileDecodePipeline("mcc filename", 2600);
+        ASSERT_EQ(FALSE, retval);
+        ASSERT_EQ(FALSE, pipelineEstablished);
+        ASSERT_EQ(0, numberOfShutdowns);
+        ASSERT_EQ(1, DetermineFileTypeCalled);
+        ASSERT_EQ(1, BuildPipelineCalled);
+        BufferPoolInitCalled = 0;
+        DetermineFileTypeCalled = 0;
+        BuildPipelineCalled = 0;
+        ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
 }  // utest__ExtrnlAdptrPlumbFileDecodePipeline()
 
 /*----------------------------------------------------------------------------*/
@@ -9,14 +9,26 @@
 /*--                          Support for Stubs                             --*/
 /*----------------------------------------------------------------------------*/
 
+uint8 CacheOutInitializeCalled;
+uint8 CcDataFileAddSinkCalled;
+uint8 CcDataFileInitializeCalled;
+uint8 CcDataFileReadHeaderCalled;
 uint8 CcDataOutInitializeCalled;
+uint8 CueOutInitializeCalled;
 uint8 DetermineDropFrameCalled;
 uint8 DtvccDecodeAddSinkCalled;
 uint8 DtvccDecodeInitializeCalled;
+uint64 DtvccDecodeInitializeServices;
 uint8 DtvccOutInitializeCalled;
+boolean DtvccOutInitializeMsNotFrame;
+uint8 DtvccWindowAddSinkCalled;
+uint8 DtvccWindowInitializeCalled;
 uint8 Line21DecodeAddSinkCalled;
 uint8 Line21DecodeInitializeCalled;
+uint8 Line21DecodeInitializeChannels;
 uint8 Line21OutInitializeCalled;
+uint8 Line21ScreenAddSinkCalled;
+uint8 Line21ScreenInitializeCalled;
 uint8 MccDecodeAddSinkCalled;
 uint8 MccDecodeInitializeCalled;
 uint8 MccEncodeAddSinkCalled;
@@ -37,11 +49,25 @@ uint8 SccFileInitializeCalled;
 uint8 SeiDecodeAddSinkCalled;
 uint8 SeiDecodeInitializeCalled;
 uint8 AddReaderCalled;
+uint8 NewBufferCalled;
+uint8 NewFramesBufferCalled;
+uint8 NewRefBufferCalled;
+uint8 StubReleaseFunctionCalled;
+uint8 AddFrameToBufferCalled;
+uint8 splitCcDataCalled;
+uint8 ThreadPoolCreateCalled;
+uint8 ThreadPoolRunCalled;
+uint32 ThreadPoolRunNumTasks;
+uint8 ThreadPoolDestroyCalled;
 uint8 StubNextBufferFunctionCalled;
 uint8 StubShutdownFunctionCalled;
 uint8 StubDriveCounter;
 
 Buffer* AddReaderBuffPtr;
+Buffer StubBuffer;
+uint8 StubBufferData[2 * MCC_MAX_CC_DATA_BYTES];
+Buffer StubFramesBuffer;
+boolean FailAddFrameToBuffer;
 void* StubNextBufferFunctionRootCtxPtr;
 Buffer* StubNextBufferFunctionInBuffer;
 boolean FailStubNextBufferFunction__Call1;
@@ -57,6 +83,9 @@ char* CcDataOutInitializeFileNameStr;
 char* MccOutInitializeFileNameStr;
 char* MpegFileInitializeFileNameStr;
 char* MovFileInitializeFileNameStr;
+char* CcDataFileInitializeFileNameStr;
+boolean CcDataFileReadHeader__wasSuccessful;
+uint8 CcDataFileReadHeader__timeSource;
 char* DetermineDropFrameInputFilename;
 char* DetermineDropFrameArtifactPath;
 boolean DetermineDropFrameSaveArtifacts;
@@ -68,14 +97,26 @@ boolean MpegFileInitializeOverrideDf;
 boolean MovFileInitializeOverrideDf;
 
 void InitStubs( void ) {
+    CacheOutInitializeCalled = 0;
+    CcDataFileAddSinkCalled = 0;
+    CcDataFileInitializeCalled = 0;
+    CcDataFileReadHeaderCalled = 0;
     CcDataOutInitializeCalled = 0;
+    CueOutInitializeCalled = 0;
     DetermineDropFrameCalled = 0;
     DtvccDecodeAddSinkCalled = 0;
     DtvccDecodeInitializeCalled = 0;
+    DtvccDecodeInitializeServices = DECODE_ALL_SERVICES;
     DtvccOutInitializeCalled = 0;
+    DtvccOutInitializeMsNotFrame = FALSE;
+    DtvccWindowAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
     Line21DecodeAddSinkCalled = 0;
     Line21DecodeInitializeCalled = 0;
+    Line21DecodeInitializeChannels = DECODE_ALL_CHANNELS;
     Line21OutInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    Line21ScreenInitializeCalled = 0;
     MccDecodeAddSinkCalled = 0;
     MccDecodeInitializeCalled = 0;
     MccEncodeAddSinkCalled = 0;
@@ -96,11 +137,21 @@ void InitStubs( void ) {
     SeiDecodeAddSinkCalled = 0;
     SeiDecodeInitializeCalled = 0;
     AddReaderCalled = 0;
+    NewBufferCalled = 0;
+    NewFramesBufferCalled = 0;
+    NewRefBufferCalled = 0;
+    StubReleaseFunctionCalled = 0;
+    AddFrameToBufferCalled = 0;
+    splitCcDataCalled = 0;
+    ThreadPoolCreateCalled = 0;
+    ThreadPoolRunCalled = 0;
+    ThreadPoolDestroyCalled = 0;
     StubNextBufferFunctionCalled = 0;
     StubShutdownFunctionCalled = 0;
     StubDriveCounter = 0;
 
     AddReaderBuffPtr = NULL;
+    FailAddFrameToBuffer = FALSE;
     StubNextBufferFunctionRootCtxPtr = NULL;
     StubNextBufferFunctionInBuffer = NULL;
     FailStubNextBufferFunction__Call1 = FALSE;
@@ -125,17 +176,29 @@ void InitStubs( void ) {
     MovFileInitializeFileNameStr = NULL;
     MovFileInitializeisDropframe = FALSE;
     MovFileInitializeOverrideDf = FALSE;
+    CcDataFileInitializeFileNameStr = NULL;
+    CcDataFileReadHeader__wasSuccessful = TRUE;
+    CcDataFileReadHeader__timeSource = CAPTION_TIME_PTS_NUMBERING;
 }
 
 boolean AnySpuriousFunctionsCalled( void ) {
-    if( (CcDataOutInitializeCalled = 0) ||
+    if( (CacheOutInitializeCalled != 0) ||
+        (CcDataFileAddSinkCalled != 0) ||
+        (CcDataFileInitializeCalled != 0) ||
+        (CcDataFileReadHeaderCalled != 0) ||
+        (CcDataOutInitializeCalled = 0) ||
+        (CueOutInitializeCalled != 0) ||
         (DetermineDropFrameCalled != 0) ||
         (DtvccDecodeAddSinkCalled != 0) ||
         (DtvccDecodeInitializeCalled != 0) ||
         (DtvccOutInitializeCalled != 0) ||
+        (DtvccWindowAddSinkCalled != 0) ||
+        (DtvccWindowInitializeCalled != 0) ||
         (Line21DecodeAddSinkCalled != 0) ||
         (Line21DecodeInitializeCalled != 0) ||
         (Line21OutInitializeCalled != 0) ||
+        (Line21ScreenAddSinkCalled != 0) ||
+        (Line21ScreenInitializeCalled != 0) ||
         (MccDecodeAddSinkCalled != 0) ||
         (MccDecodeInitializeCalled != 0) ||
         (MccEncodeAddSinkCalled != 0) ||
@@ -155,7 +218,16 @@ boolean AnySpuriousFunctionsCalled( void ) {
         (SccFileInitializeCalled != 0) ||
         (SeiDecodeAddSinkCalled != 0) ||
         (SeiDecodeInitializeCalled != 0) ||
+        (ThreadPoolCreateCalled != 0) ||
+        (ThreadPoolRunCalled != 0) ||
+        (ThreadPoolDestroyCalled != 0) ||
         (AddReaderCalled != 0) ||
+        (NewBufferCalled != 0) ||
+        (NewFramesBufferCalled != 0) ||
+        (NewRefBufferCalled != 0) ||
+        (StubReleaseFunctionCalled != 0) ||
+        (AddFrameToBufferCalled != 0) ||
+        (splitCcDataCalled != 0) ||
         (StubNextBufferFunctionCalled != 0) ||
         (StubShutdownFunctionCalled != 0) ) {
         return TRUE;
@@ -168,6 +240,48 @@ boolean AnySpuriousFunctionsCalled( void ) {
 /*--                           Stub Functions                               --*/
 /*----------------------------------------------------------------------------*/
 
+LinkInfo CacheOutInitialize( Context* rootCtxPtr ) {
+    LinkInfo linkInfo;
+    linkInfo.sourceType = 1;
+
+    CacheOutInitializeCalled++;
+
+    return linkInfo;
+}
+
+boolean CcDataFileAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    boolean retval = TRUE;
+
+    CcDataFileAddSinkCalled++;
+
+    return retval;
+}
+
+boolean CcDataFileInitialize( Context* rootCtxPtr, char* fileNameStr ) {
+    boolean retval = TRUE;
+
+    CcDataFileInitializeCalled++;
+    CcDataFileInitializeFileNameStr = fileNameStr;
+
+    return retval;
+}
+
+boolean CcDataFileProcNextBuffer( Context* rootCtxPtr, boolean* isDonePtr ) {
+    boolean retval = TRUE;
+
+    return retval;
+}
+
+boolean CcDataFileReadHeader( char* fileNameStr, CcDataFileHeader* headerPtr ) {
+    CcDataFileReadHeaderCalled++;
+    headerPtr->version = CC_DATA_FILE_VERSION;
+    headerPtr->timeSource = CcDataFileReadHeader__timeSource;
+    headerPtr->isDropFrame = TRUE;
+    headerPtr->frameRateTimesOneHundred = 2997;
+
+    return CcDataFileReadHeader__wasSuccessful;
+}
+
 LinkInfo CcDataOutInitialize( Context* rootCtxPtr ) {
     LinkInfo linkInfo;
     linkInfo.sourceType = 1;
@@ -178,6 +292,15 @@ LinkInfo CcDataOutInitialize( Context* rootCtxPtr ) {
     return linkInfo;
 }
 
+LinkInfo CueOutInitialize( Context* rootCtxPtr ) {
+    LinkInfo linkInfo;
+    linkInfo.sourceType = 1;
+
+    CueOutInitializeCalled++;
+
+    return linkInfo;
+}
+
 boolean DetermineDropFrame( char* fileNameStr, boolean saveMediaInfo, char* artifactPath ) {
 
     DetermineDropFrameCalled++;
@@ -198,11 +321,12 @@ boolean DtvccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return retval;
 }
 
-LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo DtvccDecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint64 decodeWhichServices ) {
     LinkInfo linkInfo;
     linkInfo.sourceType = 1;
 
     DtvccDecodeInitializeCalled++;
+    DtvccDecodeInitializeServices = decodeWhichServices;
 
     return linkInfo;
 }
@@ -212,11 +336,29 @@ LinkInfo DtvccOutInitialize( Context* rootCtxPtr, boolean nullEtxSuppressed, boo
     linkInfo.sourceType = 1;
 
     DtvccOutInitializeCalled++;
+    DtvccOutInitializeMsNotFrame = msNotFrame;
     DtvccOutInitializeFileNameStr = rootCtxPtr->config.outputDirectory;
 
     return linkInfo;
 }
 
+boolean DtvccWindowAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    boolean retval = TRUE;
+
+    DtvccWindowAddSinkCalled++;
+
+    return retval;
+}
+
+LinkInfo DtvccWindowInitialize( Context* rootCtxPtr ) {
+    LinkInfo linkInfo;
+    linkInfo.sourceType = 1;
+
+    DtvccWindowInitializeCalled++;
+
+    return linkInfo;
+}
+
 boolean Line21DecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     boolean retval = TRUE;
 
@@ -225,11 +367,12 @@ boolean Line21DecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     return retval;
 }
 
-LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly ) {
+LinkInfo Line21DecodeInitialize( Context* rootCtxPtr, boolean processOnly, uint8 decodeWhichChannels ) {
     LinkInfo linkInfo;
     linkInfo.sourceType = 1;
 
     Line21DecodeInitializeCalled++;
+    Line21DecodeInitializeChannels = decodeWhichChannels;
 
     return linkInfo;
 }
@@ -244,6 +387,23 @@ LinkInfo Line21OutInitialize( Context* ctxPtr ) {
     return linkInfo;
 }
 
+boolean Line21ScreenAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
+    boolean retval = TRUE;
+
+    Line21ScreenAddSinkCalled++;
+
+    return retval;
+}
+
+LinkInfo Line21ScreenInitialize( Context* rootCtxPtr ) {
+    LinkInfo linkInfo;
+    linkInfo.sourceType = 1;
+
+    Line21ScreenInitializeCalled++;
+
+    return linkInfo;
+}
+
 boolean MccDecodeAddSink( Context* rootCtxPtr, LinkInfo linkInfo ) {
     boolean retval = TRUE;
 
@@ -433,6 +593,78 @@ void AddReader( Buffer* buffPtr ) {
     AddReaderBuffPtr = buffPtr;
 }
 
+Buffer* _NewBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint16 size ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "_NewBuffer(%d, %d) Called", bufferType, size);
+    NewBufferCalled++;
+    StubBuffer.bufferType = bufferType;
+    StubBuffer.dataPtr = StubBufferData;
+    StubBuffer.numElements = 0;
+    StubBuffer.maxNumElements = size;
+    return &StubBuffer;
+}
+
+Buffer* _NewFramesBuffer( char* fileNameStr, int lineNum, uint16 maxFrames, uint16 size ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "_NewFramesBuffer(%d, %d) Called", maxFrames, size);
+    NewFramesBufferCalled++;
+    StubFramesBuffer.bufferType = BUFFER_TYPE_CC_DATA_FRAMES;
+    StubFramesBuffer.numElements = 0;
+    StubFramesBuffer.maxNumElements = size;
+    StubFramesBuffer.numFrames = 0;
+    StubFramesBuffer.maxNumFrames = maxFrames;
+    return &StubFramesBuffer;
+}
+
+Buffer* _NewRefBuffer( char* fileNameStr, int lineNum, uint8 bufferType, uint8* dataPtr, uint16 numElements, void* dataRefPtr, BufferReleaseFnPtr releaseFnPtr ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "_NewRefBuffer(%d, %d) Called", bufferType, numElements);
+    NewRefBufferCalled++;
+    StubBuffer.bufferType = bufferType;
+    StubBuffer.dataPtr = dataPtr;
+    StubBuffer.numElements = numElements;
+    StubBuffer.maxNumElements = numElements;
+    StubBuffer.dataRefPtr = dataRefPtr;
+    StubBuffer.releaseFnPtr = releaseFnPtr;
+    return &StubBuffer;
+}
+
+boolean AddFrameToBuffer( Buffer* buffPtr, CaptionTime* captionTimePtr, uint8* dataPtr, uint16 numElements ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "AddFrameToBuffer(%p, %d) Called", buffPtr, numElements);
+    AddFrameToBufferCalled++;
+    if( (FailAddFrameToBuffer == TRUE) || (buffPtr->numFrames == buffPtr->maxNumFrames) ) {
+        FailAddFrameToBuffer = FALSE;
+        return FALSE;
+    }
+    buffPtr->numFrames++;
+    buffPtr->numElements = buffPtr->numElements + numElements;
+    return TRUE;
+}
+
+void StubReleaseFunction( void* dataRefPtr ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "StubReleaseFunction(%p) Called", dataRefPtr);
+    StubReleaseFunctionCalled++;
+}
+
+void splitCcData( Buffer* buffPtr ) {
+    LOG(TEST_DEBUG_LEVEL_INFO, TEST_SECTION, "splitCcData(%p) Called", buffPtr);
+    splitCcDataCalled++;
+}
+
+ThreadPool* ThreadPoolCreate( uint8 numThreads ) {
+    ThreadPoolCreateCalled++;
+    return NULL;
+}
+
+void ThreadPoolRun( ThreadPool* poolPtr, ThreadPoolTaskFnPtr taskFnPtr, void* taskArgPtr, uint32 numTasks ) {
+    ThreadPoolRunCalled++;
+    ThreadPoolRunNumTasks = numTasks;
+    for( uint32 loop = 0; loop < numTasks; loop++ ) {
+        taskFnPtr(taskArgPtr, loop);
+    }
+}
+
+void ThreadPoolDestroy( ThreadPool* poolPtr ) {
+    ThreadPoolDestroyCalled++;
+}
+
 boolean StubNextBufferFunction( void* rootCtxPtr, Buffer* inBuffer ) {
     boolean retval = TRUE;
 
@@ -484,6 +716,9 @@ void utest__InitSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     sinks.linkType = 0;
     InitSinks( &sinks, 101 );
     ASSERT_EQ(101, sinks.linkType);
+    ASSERT_EQ(0, sinks.numSinks);
+    ASSERT_EQ(0, sinks.maxSinks);
+    ASSERT_PTREQ(NULL, sinks.sink);
     TEST_END
 
     TEST_START("Test Case: InitSinks() - Unsuccessfully Init a NULL Pointer.");
@@ -506,7 +741,8 @@ void utest__InitSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |     7) Add InValid Sink: Bad Sink Type.
  |     8) Add NULL Sink.
  |     9) Add NULL Link Info.
- |    10) Add Too Many Sinks.
+ |    10) Add More Sinks than there is Initial Room For.
+ |    11) Add Too Many Sinks.
  -------------------------------------------------------------------------------*/
 void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -517,7 +753,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     LinkInfo linkInfoThree;
 
     TEST_START("Test Case: AddSink() - Add a Valid Sink.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -528,7 +764,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add Two Valid Sinks.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -547,7 +783,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add Three Valid Sinks.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -573,7 +809,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSinks() - Add InValid Sink: Bad Link Type in Sink.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MAX_LINK_TYPE;
     linkInfo.linkType = SEI_DATA___TEXT_FILE;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -583,7 +819,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSinks() - Add InValid Sink: Bad Link Type.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MAX_LINK_TYPE + 5;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -594,7 +830,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add InValid Sink: Bad Source Type.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
@@ -604,7 +840,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add InValid Sink: Bad Sink Type.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = MAX_DATA_TYPE;
@@ -614,7 +850,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add NULL Sink.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = MAX_DATA_TYPE;
@@ -625,7 +861,7 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 
     TEST_START("Test Case: AddSink() - Add NULL Link Info.");
-    sinks.numSinks = 0;
+    InitSinks(&sinks, UNKNOWN_LINK_TYPE);
     sinks.linkType = MCC_FILE___MCC_DATA;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = MAX_DATA_TYPE;
@@ -635,9 +871,31 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     retval = AddSink( &sinks, NULL );
     TEST_END
 
-    TEST_START("Test Case: AddSink() - Add Too Many Sink.");
+    TEST_START("Test Case: AddSink() - Add More Sinks than there is Initial Room For.");
+    InitSinks(&sinks, MCC_FILE___MCC_DATA);
+    linkInfo.linkType = MCC_DATA___CC_DATA;
+    linkInfo.sinkType = DATA_TYPE_MCC_DATA;
+    linkInfo.sourceType = DATA_TYPE_CC_DATA;
+    for( int loop = 0; loop < 6; loop++ ) {
+        retval = AddSink( &sinks, &linkInfo );
+        ASSERT_EQ(TRUE, retval);
+    }
+    linkInfoTwo.linkType = LINE21_DATA___TEXT_FILE;
+    linkInfoTwo.sinkType = DATA_TYPE_DECODED_608;
+    linkInfoTwo.sourceType = DATA_TYPE_608_TXT_FILE;
+    retval = AddSink( &sinks, &linkInfoTwo );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(7, sinks.numSinks);
+    ASSERT_EQ(8, sinks.maxSinks);
+    ASSERT_STRUCTEQ(&linkInfo, &sinks.sink[5], sizeof(LinkInfo));
+    ASSERT_STRUCTEQ(&linkInfoTwo, &sinks.sink[6], sizeof(LinkInfo));
+    free(sinks.sink);
+    TEST_END
+
+    TEST_START("Test Case: AddSink() - Add Too Many Sinks.");
+    InitSinks(&sinks, MCC_FILE___MCC_DATA);
     sinks.numSinks = MAX_NUMBER_OF_SINKS;
-    sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.maxSinks = MAX_NUMBER_OF_SINKS;
     linkInfo.linkType = MCC_DATA___CC_DATA;
     linkInfo.sinkType = DATA_TYPE_MCC_DATA;
     linkInfo.sourceType = DATA_TYPE_CC_DATA;
@@ -653,16 +911,17 @@ void utest__AddSink( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  | TEST CASES:
  |      1) Pass to One Sink.
  |      2) Pass to Two Sinks.
- |      3) Pass to Max Number of Sinks.
- |      4) Pass to Multiple Sinks with Different Return Values.
- |      5) Pass to No Sinks.
- |      6) Pass to Too Many Sinks.
- |      7) Pass a NULL Context.
- |      8) Pass a NULL Buffer.
- |      9) Pass a NULL Sinks List.
- |     10) Pass a NULL Sink.
- |     11) Pass an Invalid Link Type in Sinks.
- |     12) Pass an Invalid Sink Link Type in Sinks.
+ |      3) Pass to Three Sinks on the Sink Thread Pool.
+ |      4) Pass to Five Sinks.
+ |      5) Pass to Multiple Sinks with Different Return Values.
+ |      6) Pass to No Sinks.
+ |      7) Pass to More Sinks than are in the List.
+ |      8) Pass a NULL Context.
+ |      9) Pass a NULL Buffer.
+ |     10) Pass a NULL Sinks List.
+ |     11) Pass a NULL Sink.
+ |     12) Pass an Invalid Link Type in Sinks.
+ |     13) Pass an Invalid Sink Link Type in Sinks.
  -------------------------------------------------------------------------------*/
 void utest__PassToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -670,6 +929,11 @@ void utest__PassToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Context ctx;
     Buffer buff;
     Sinks sinks;
+    LinkInfo sinkList[5];
+    ctx.sinkPoolPtr = NULL;
+
+    sinks.sink = sinkList;
+    sinks.maxSinks = 5;
 
     TEST_START("Test Case: PassToSinks() - Pass to One Sink.");
     sinks.linkType = MCC_FILE___MCC_DATA;
@@ -718,7 +982,42 @@ void utest__PassToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: PassToSinks() - Pass to Max Number of Sinks.");
+    TEST_START("Test Case: PassToSinks() - Pass to Three Sinks on the Sink Thread Pool.");
+    sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.numSinks = 3;
+    sinks.sink[0].linkType = MCC_DATA___CC_DATA;
+    sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
+    sinks.sink[0].sinkType = DATA_TYPE_CC_DATA;
+    sinks.sink[0].NextBufferFnPtr = StubNextBufferFunction;
+    sinks.sink[0].ShutdownFnPtr = StubShutdownFunction;
+    sinks.sink[1].linkType = MCC_DATA___CC_DATA;
+    sinks.sink[1].sourceType = DATA_TYPE_MCC_DATA;
+    sinks.sink[1].sinkType = DATA_TYPE_CC_DATA;
+    sinks.sink[1].NextBufferFnPtr = StubNextBufferFunction;
+    sinks.sink[1].ShutdownFnPtr = StubShutdownFunction;
+    sinks.sink[2].linkType = MCC_DATA___CC_DATA;
+    sinks.sink[2].sourceType = DATA_TYPE_MCC_DATA;
+    sinks.sink[2].sinkType = DATA_TYPE_CC_DATA;
+    sinks.sink[2].NextBufferFnPtr = StubNextBufferFunction;
+    sinks.sink[2].ShutdownFnPtr = StubShutdownFunction;
+    ctx.sinkPoolPtr = (ThreadPool*)&sinks;
+    InitStubs();
+    retval = PassToSinks(&ctx, &buff, &sinks);
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(3, AddReaderCalled);
+    ASSERT_EQ(1, ThreadPoolRunCalled);
+    ASSERT_EQ(2, ThreadPoolRunNumTasks);
+    ASSERT_EQ(3, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(&ctx, StubNextBufferFunctionRootCtxPtr);
+    ASSERT_PTREQ(&buff, StubNextBufferFunctionInBuffer);
+    ctx.sinkPoolPtr = NULL;
+    AddReaderCalled = 0;
+    ThreadPoolRunCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassToSinks() - Pass to Five Sinks.");
     sinks.linkType = MCC_FILE___MCC_DATA;
     sinks.numSinks = 5;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
@@ -806,11 +1105,11 @@ void utest__PassToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
-    TEST_START("Test Case: PassToSinks() - Pass to Too Many Sinks.");
+    TEST_START("Test Case: PassToSinks() - Pass to More Sinks than are in the List.");
     ERROR_EXPECTED
     FATAL_ERROR_EXPECTED
     sinks.linkType = MCC_FILE___MCC_DATA;
-    sinks.numSinks = MAX_NUMBER_OF_SINKS + 1;
+    sinks.numSinks = sinks.maxSinks + 1;
     InitStubs();
     retval = PassToSinks(&ctx, &buff, &sinks);
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
@@ -910,20 +1209,240 @@ void utest__PassToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 }  // utest__PassToSinks()
 
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: PassFrameToSinks()
+ |
+ | TEST CASES:
+ |      1) Pass a Frame a Buffer at a time.
+ |      2) Gather Frames until the Buffer is full.
+ |      3) Pass on a Buffer which a Frame does not fit in.
+ |      4) Pass a Frame too large to gather on its own.
+ |      5) Flush a partial Buffer.
+ |      6) Flush with no Buffer.
+ |      7) Split Buffers into Planes on the way out.
+ |      8) Pass a NULL Frames Buffer.
+ |      9) Pass a Frame by Reference a Buffer at a time.
+ |     10) Pass a Frame by Reference into a Buffer of Frames.
+ -------------------------------------------------------------------------------*/
+void utest__PassFrameToSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    uint8 retval;
+    Context ctx;
+    Sinks sinks;
+    LinkInfo sinkList[1];
+    Buffer* framesBufferPtr = NULL;
+    CaptionTime captionTime;
+    uint8 data[MCC_MAX_CC_DATA_BYTES + 3];
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.planarCcData = FALSE;
+
+    sinks.sink = sinkList;
+    sinks.maxSinks = 1;
+    sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.numSinks = 1;
+    sinks.sink[0].linkType = MCC_DATA___CC_DATA;
+    sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
+    sinks.sink[0].sinkType = DATA_TYPE_CC_DATA;
+    sinks.sink[0].NextBufferFnPtr = StubNextBufferFunction;
+    sinks.sink[0].ShutdownFnPtr = StubShutdownFunction;
+    memset(data, 0, sizeof(data));
+    memset(&captionTime, 0, sizeof(captionTime));
+
+    TEST_START("Test Case: PassFrameToSinks() - Pass a Frame a Buffer at a time.");
+    ctx.config.framesPerBuffer = 1;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, NewBufferCalled);
+    ASSERT_EQ(BUFFER_TYPE_BYTES, StubBuffer.bufferType);
+    ASSERT_EQ(6, StubBuffer.numElements);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(&StubBuffer, StubNextBufferFunctionInBuffer);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameToSinks() - Gather Frames until the Buffer is full.");
+    ctx.config.framesPerBuffer = 3;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, NewFramesBufferCalled);
+    ASSERT_EQ(3 * MCC_MAX_CC_DATA_BYTES, StubFramesBuffer.maxNumElements);
+    ASSERT_PTREQ(&StubFramesBuffer, framesBufferPtr);
+    ASSERT_EQ(0, StubNextBufferFunctionCalled);
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(0, StubNextBufferFunctionCalled);
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, NewFramesBufferCalled);
+    ASSERT_EQ(3, AddFrameToBufferCalled);
+    ASSERT_EQ(3, StubFramesBuffer.numFrames);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(&StubFramesBuffer, StubNextBufferFunctionInBuffer);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameToSinks() - Pass on a Buffer which a Frame does not fit in.");
+    ctx.config.framesPerBuffer = 3;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(0, StubNextBufferFunctionCalled);
+    FailAddFrameToBuffer = TRUE;
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_EQ(2, NewFramesBufferCalled);
+    ASSERT_EQ(3, AddFrameToBufferCalled);
+    ASSERT_EQ(1, StubFramesBuffer.numFrames);
+    ASSERT_PTREQ(&StubFramesBuffer, framesBufferPtr);
+    framesBufferPtr = NULL;
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameToSinks() - Pass a Frame too large to gather on its own.");
+    ctx.config.framesPerBuffer = 3;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, MCC_MAX_CC_DATA_BYTES + 3, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(2, StubNextBufferFunctionCalled);
+    ASSERT_EQ(1, NewBufferCalled);
+    ASSERT_EQ(MCC_MAX_CC_DATA_BYTES + 3, StubBuffer.numElements);
+    ASSERT_PTREQ(&StubBuffer, StubNextBufferFunctionInBuffer);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewBufferCalled = 0;
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: FlushFramesToSinks() - Flush a partial Buffer.");
+    ctx.config.framesPerBuffer = 3;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(0, StubNextBufferFunctionCalled);
+    retval = FlushFramesToSinks(&ctx, &framesBufferPtr, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(&StubFramesBuffer, StubNextBufferFunctionInBuffer);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: FlushFramesToSinks() - Flush with no Buffer.");
+    InitStubs();
+    retval = FlushFramesToSinks(&ctx, &framesBufferPtr, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameToSinks() - Split Buffers into Planes on the way out.");
+    ctx.config.planarCcData = TRUE;
+    ctx.config.framesPerBuffer = 1;
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, splitCcDataCalled);
+    ctx.config.framesPerBuffer = 3;
+    retval = PassFrameToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks);
+    ASSERT_EQ(1, splitCcDataCalled);
+    retval = FlushFramesToSinks(&ctx, &framesBufferPtr, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(2, splitCcDataCalled);
+    ASSERT_EQ(2, StubNextBufferFunctionCalled);
+    ctx.config.planarCcData = FALSE;
+    splitCcDataCalled = 0;
+    NewBufferCalled = 0;
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameToSinks() - Pass a NULL Frames Buffer.");
+    FATAL_ERROR_EXPECTED
+    InitStubs();
+    retval = PassFrameToSinks(&ctx, NULL, &captionTime, data, 6, &sinks);
+    TEST_END
+
+    TEST_START("Test Case: PassFrameRefToSinks() - Pass a Frame by Reference a Buffer at a time.");
+    ctx.config.framesPerBuffer = 1;
+    InitStubs();
+    retval = PassFrameRefToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks, StubReleaseFunction, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, NewRefBufferCalled);
+    ASSERT_EQ(0, NewBufferCalled);
+    ASSERT_PTREQ(data, StubBuffer.dataPtr);
+    ASSERT_EQ(6, StubBuffer.numElements);
+    ASSERT_PTREQ(&sinks, StubBuffer.dataRefPtr);
+    ASSERT_EQ(0, StubReleaseFunctionCalled);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(&StubBuffer, StubNextBufferFunctionInBuffer);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewRefBufferCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PassFrameRefToSinks() - Pass a Frame by Reference into a Buffer of Frames.");
+    ctx.config.framesPerBuffer = 3;
+    InitStubs();
+    retval = PassFrameRefToSinks(&ctx, &framesBufferPtr, &captionTime, data, 6, &sinks, StubReleaseFunction, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(0, NewRefBufferCalled);
+    ASSERT_EQ(1, NewFramesBufferCalled);
+    ASSERT_EQ(1, AddFrameToBufferCalled);
+    ASSERT_EQ(1, StubReleaseFunctionCalled);
+    ASSERT_EQ(0, StubNextBufferFunctionCalled);
+    retval = FlushFramesToSinks(&ctx, &framesBufferPtr, &sinks);
+    ASSERT_EQ(PIPELINE_SUCCESS, retval);
+    ASSERT_EQ(1, StubNextBufferFunctionCalled);
+    ASSERT_PTREQ(NULL, framesBufferPtr);
+    NewFramesBufferCalled = 0;
+    AddFrameToBufferCalled = 0;
+    StubReleaseFunctionCalled = 0;
+    AddReaderCalled = 0;
+    StubNextBufferFunctionCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+}  // utest__PassFrameToSinks()
+
 /*------------------------------------------------------------------------------
  | FUNCTION UNDER TEST: ShutdownSinks()
  |
  | TEST CASES:
  |      1) Shutdown One Sink.
  |      2) Shutdown Two Sinks.
- |      3) Shutdown Max Number of Sinks.
+ |      3) Shutdown Five Sinks.
  |      4) Shutdown Multiple Sinks with Different Return Values.
  |      5) Shutdown No Sinks.
- |      6) Pass a NULL Context.
- |      7) Pass a NULL Sinks List.
- |      8) Pass a NULL Sink.
- |      9) Pass an Invalid Link Type in Sinks.
- |     10) Pass an Invalid Sink Link Type in Sinks.
+ |      6) Shutdown More Sinks than are in the List.
+ |      7) Pass a NULL Context.
+ |      8) Pass a NULL Sinks List.
+ |      9) Pass a NULL Sink.
+ |     10) Pass an Invalid Link Type in Sinks.
+ |     11) Pass an Invalid Sink Link Type in Sinks.
  -------------------------------------------------------------------------------*/
 void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -933,6 +1452,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 
     TEST_START("Test Case: ShutdownSinks() - Shutdown One Sink.")
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 1;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -944,12 +1465,17 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(TRUE, retval);
     ASSERT_EQ(1, StubShutdownFunctionCalled);
     ASSERT_PTREQ(&ctx, StubShutdownFunctionRootCtxPtr);
+    ASSERT_EQ(0, sinks.numSinks);
+    ASSERT_EQ(0, sinks.maxSinks);
+    ASSERT_PTREQ(NULL, sinks.sink);
     StubShutdownFunctionCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
     TEST_START("Test Case: ShutdownSinks() - Shutdown Two Sinks.")
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 2;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -970,8 +1496,10 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(FALSE, AnySpuriousFunctionsCalled());
     TEST_END
 
-    TEST_START("Test Case: ShutdownSinks() - Shutdown Max Number of Sinks.")
+    TEST_START("Test Case: ShutdownSinks() - Shutdown Five Sinks.")
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 5;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1009,6 +1537,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 
     TEST_START("Test Case: ShutdownSinks() - Shutdown Multiple Sinks with Different Return Values.")
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 4;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1042,17 +1572,21 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 
     TEST_START("Test Case: ShutdownSinks() - Shutdown No Sinks.");
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 0;
     InitStubs();
     retval = ShutdownSinks(&ctx, &sinks);
     ASSERT_EQ(FALSE, AnySpuriousFunctionsCalled());
     TEST_END
 
-    TEST_START("Test Case: ShutdownSinks() - Shutdown Too Many Sinks.");
+    TEST_START("Test Case: ShutdownSinks() - Shutdown More Sinks than are in the List.");
     ERROR_EXPECTED
     FATAL_ERROR_EXPECTED
     sinks.linkType = MCC_FILE___MCC_DATA;
-    sinks.numSinks = MAX_NUMBER_OF_SINKS + 1;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
+    sinks.numSinks = sinks.maxSinks + 1;
     InitStubs();
     retval = ShutdownSinks(&ctx, &sinks);
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
@@ -1061,6 +1595,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_START("Test Case: ShutdownSinks() - Pass a NULL Context.")
     FATAL_ERROR_EXPECTED
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 1;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1088,6 +1624,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ERROR_EXPECTED
     FATAL_ERROR_EXPECTED
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 1;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1102,6 +1640,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_START("Test Case: ShutdownSinks() - Pass an Invalid Link Type in Sinks.");
     FATAL_ERROR_EXPECTED
     sinks.linkType = MAX_LINK_TYPE;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 1;
     sinks.sink[0].linkType = MCC_DATA___CC_DATA;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1115,6 +1655,8 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_START("Test Case: ShutdownSinks() - Pass an Invalid Sink Link Type in Sinks.");
     FATAL_ERROR_EXPECTED
     sinks.linkType = MCC_FILE___MCC_DATA;
+    sinks.sink = malloc(5 * sizeof(LinkInfo));
+    sinks.maxSinks = 5;
     sinks.numSinks = 1;
     sinks.sink[0].linkType = MAX_LINK_TYPE + 1;
     sinks.sink[0].sourceType = DATA_TYPE_MCC_DATA;
@@ -1126,6 +1668,160 @@ void utest__ShutdownSinks( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_END
 }  // utest__ShutdownSinks()
 
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: BuildPipeline()
+ |
+ | TEST CASES:
+ |    1) Build only the Branches needed for the Selected Outputs.
+ |    2) Build a Pipeline ending in an External Sink.
+ |    3) Build a Pipeline which Runs its Sinks in Parallel.
+ |    4) Build a Pipeline which doesn't start with a Source.
+ |    5) Build a Pipeline with an Incompatible Link.
+ |    6) Build a Pipeline with a Node ahead of its Parent.
+ |    7) Build a Pipeline with a Sink after the CC Data Output.
+ -------------------------------------------------------------------------------*/
+void utest__BuildPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    boolean retval;
+    Context ctx;
+    LinkInfo externalLinkInfo;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.inputFilename = "Who";
+    strcpy(ctx.config.outputDirectory, "Cares?");
+    ctx.config.decodeWhichChannels = DECODE_ALL_CHANNELS;
+    ctx.config.decodeWhichServices = DECODE_ALL_SERVICES;
+
+    const PipelineNode prunedGraph[] = {
+        { PIPELINE_ELEMENT_MCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+        { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_OUTPUT_NONE,                         NULL },
+        { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+        { PIPELINE_ELEMENT_LINE21_OUTPUT,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL },
+        { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_CCD,                          NULL }
+    };
+
+    const PipelineNode externalGraph[] = {
+        { PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE, NULL },
+        { PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_OUTPUT_NONE, NULL },
+        { PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_608,  NULL },
+        { PIPELINE_ELEMENT_EXTERNAL,      PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,  &externalLinkInfo }
+    };
+
+    const PipelineNode noSourceGraph[] = {
+        { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_NONE,       PIPELINE_OUTPUT_NONE, NULL },
+        { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_MCC_DECODE, PIPELINE_OUTPUT_CCD,  NULL }
+    };
+
+    const PipelineNode incompatibleGraph[] = {
+        { PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_ELEMENT_NONE,     PIPELINE_OUTPUT_NONE, NULL },
+        { PIPELINE_ELEMENT_LINE21_OUTPUT, PIPELINE_ELEMENT_MCC_FILE, PIPELINE_OUTPUT_608,  NULL }
+    };
+
+    const PipelineNode outOfOrderGraph[] = {
+        { PIPELINE_ELEMENT_MCC_FILE,       PIPELINE_ELEMENT_NONE,       PIPELINE_OUTPUT_NONE, NULL },
+        { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_MCC_DECODE, PIPELINE_OUTPUT_CCD,  NULL },
+        { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_MCC_FILE,   PIPELINE_OUTPUT_NONE, NULL }
+    };
+
+    const PipelineNode ccdNotLastGraph[] = {
+        { PIPELINE_ELEMENT_MCC_FILE,       PIPELINE_ELEMENT_NONE,          PIPELINE_OUTPUT_NONE,                         NULL },
+        { PIPELINE_ELEMENT_MCC_DECODE,     PIPELINE_ELEMENT_MCC_FILE,      PIPELINE_OUTPUT_NONE,                         NULL },
+        { PIPELINE_ELEMENT_CC_DATA_OUTPUT, PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_CCD,                          NULL },
+        { PIPELINE_ELEMENT_LINE21_DECODE,  PIPELINE_ELEMENT_MCC_DECODE,    PIPELINE_OUTPUT_DETECT | PIPELINE_OUTPUT_CCD, NULL },
+        { PIPELINE_ELEMENT_LINE21_OUTPUT,  PIPELINE_ELEMENT_LINE21_DECODE, PIPELINE_OUTPUT_608,                          NULL }
+    };
+
+    TEST_START("Test Case: BuildPipeline() - Build only the Branches needed for the Selected Outputs.");
+    InitStubs();
+    retval = BuildPipeline( &ctx, prunedGraph, PIPELINE_GRAPH_SIZE(prunedGraph), PIPELINE_OUTPUT_CCD );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, MccFileInitializeCalled);
+    ASSERT_EQ(1, MccFileAddSinkCalled);
+    ASSERT_EQ(1, MccDecodeInitializeCalled);
+    ASSERT_EQ(2, MccDecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(1, CcDataOutInitializeCalled);
+    MccFileInitializeCalled = 0;
+    MccFileAddSinkCalled = 0;
+    MccDecodeInitializeCalled = 0;
+    MccDecodeAddSinkCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    CcDataOutInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline ending in an External Sink.");
+    InitStubs();
+    externalLinkInfo.linkType = LINE21_DATA___TEXT_FILE;
+    externalLinkInfo.sourceType = DATA_TYPE_DECODED_608;
+    externalLinkInfo.sinkType = DATA_TYPE_608_TXT_FILE;
+    retval = BuildPipeline( &ctx, externalGraph, PIPELINE_GRAPH_SIZE(externalGraph), PIPELINE_OUTPUT_608 );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, MccFileInitializeCalled);
+    ASSERT_EQ(1, MccFileAddSinkCalled);
+    ASSERT_EQ(1, MccDecodeInitializeCalled);
+    ASSERT_EQ(1, MccDecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    MccFileInitializeCalled = 0;
+    MccFileAddSinkCalled = 0;
+    MccDecodeInitializeCalled = 0;
+    MccDecodeAddSinkCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    Line21DecodeAddSinkCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline which Runs its Sinks in Parallel.");
+    InitStubs();
+    ctx.config.parallelSinks = TRUE;
+    retval = BuildPipeline( &ctx, prunedGraph, PIPELINE_GRAPH_SIZE(prunedGraph), PIPELINE_OUTPUT_CCD );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, ThreadPoolCreateCalled);
+    ctx.config.parallelSinks = FALSE;
+    ThreadPoolCreateCalled = 0;
+    MccFileInitializeCalled = 0;
+    MccFileAddSinkCalled = 0;
+    MccDecodeInitializeCalled = 0;
+    MccDecodeAddSinkCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    CcDataOutInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline which doesn't start with a Source.");
+    InitStubs();
+    ERROR_EXPECTED
+    retval = BuildPipeline( &ctx, noSourceGraph, PIPELINE_GRAPH_SIZE(noSourceGraph), PIPELINE_OUTPUT_ALL );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline with an Incompatible Link.");
+    InitStubs();
+    ERROR_EXPECTED
+    retval = BuildPipeline( &ctx, incompatibleGraph, PIPELINE_GRAPH_SIZE(incompatibleGraph), PIPELINE_OUTPUT_ALL );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline with a Node ahead of its Parent.");
+    InitStubs();
+    ERROR_EXPECTED
+    retval = BuildPipeline( &ctx, outOfOrderGraph, PIPELINE_GRAPH_SIZE(outOfOrderGraph), PIPELINE_OUTPUT_ALL );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: BuildPipeline() - Build a Pipeline with a Sink after the CC Data Output.");
+    InitStubs();
+    ERROR_EXPECTED
+    retval = BuildPipeline( &ctx, ccdNotLastGraph, PIPELINE_GRAPH_SIZE(ccdNotLastGraph), PIPELINE_OUTPUT_ALL );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+}  // utest__BuildPipeline()
+
 /*------------------------------------------------------------------------------
  | FUNCTION UNDER TEST: PlumbSccPipeline()
  |
@@ -1142,6 +1838,9 @@ void utest__PlumbSccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     char* outputFilename = "Cares?";
     boolean retval;
     Context ctx;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
 
     TEST_START("Test Case: PlumbSccPipeline() - Successfully Plumb SCC Pipeline with Artifacts.")
     InitStubs();
@@ -1154,7 +1853,9 @@ void utest__PlumbSccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, SccFileInitializeCalled);
     ASSERT_EQ(1, SccFileAddSinkCalled);
     ASSERT_EQ(3, SccEncodeAddSinkCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, SccEncodeInitializeCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
@@ -1162,6 +1863,7 @@ void utest__PlumbSccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccEncodeAddSinkCalled);
     ASSERT_EQ(1, MccOutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(1, CueOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, SccFileInitializeFileNameStr);
     ASSERT_EQ(2400, SccFileInitializeFramerate);
     ASSERT_PTREQ(ctx.config.outputDirectory, Line21OutInitializeFileNameStr);
@@ -1176,6 +1878,9 @@ void utest__PlumbSccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     MccOutInitializeCalled = 0;
     MccEncodeAddSinkCalled = 0;
     CcDataOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1267,8 +1972,9 @@ void utest__PlumbSccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  | TEST CASES:
  |    1) Successfully Plumb MCC Pipeline with Artifacts.
  |    2) Successfully Plumb MCC Pipeline without Artifacts.
- |    3) Pass a NULL Input Filename.
- |    4) Pass a NULL Output Filename.
+ |    3) Plumb MCC Pipeline Decoding only Selected Channels and Services.
+ |    4) Pass a NULL Input Filename.
+ |    5) Pass a NULL Output Filename.
  -------------------------------------------------------------------------------*/
 void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -1276,6 +1982,9 @@ void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     char* outputFilename = "Cares?";
     boolean retval;
     Context ctx;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
 
     TEST_START("Test Case: PlumbMccPipeline() - Successfully Plumb MCC Pipeline with Artifacts.");
     InitStubs();
@@ -1289,12 +1998,17 @@ void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccDecodeInitializeCalled);
     ASSERT_EQ(3, MccDecodeAddSinkCalled);
     ASSERT_EQ(1, DtvccDecodeInitializeCalled);
-    ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, DtvccOutInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, MccFileInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, DtvccOutInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, Line21OutInitializeFileNameStr);
@@ -1310,6 +2024,11 @@ void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     DtvccOutInitializeCalled = 0;
     Line21OutInitializeCalled = 0;
     CcDataOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1339,6 +2058,30 @@ void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
+    TEST_START("Test Case: PlumbMccPipeline() - Plumb MCC Pipeline Decoding only Selected Channels and Services.");
+    InitStubs();
+    ctx.config.artifacts = FALSE;
+    ctx.config.inputFilename = inputFilename;
+    ctx.config.decodeWhichChannels = LINE21_CHANNEL_SELECT(LINE21_CHANNEL_1);
+    ctx.config.decodeWhichServices = DTVCC_SERVICE_SELECT(1) | DTVCC_SERVICE_SELECT(2);
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbMccPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(0x01, Line21DecodeInitializeChannels);
+    ASSERT_EQ(0x03, DtvccDecodeInitializeServices);
+    ctx.config.decodeWhichChannels = DECODE_ALL_CHANNELS;
+    ctx.config.decodeWhichServices = DECODE_ALL_SERVICES;
+    MccFileInitializeCalled = 0;
+    MccFileAddSinkCalled = 0;
+    MccDecodeInitializeCalled = 0;
+    MccDecodeAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
     TEST_START("Test Case: PlumbMccPipeline() - Pass a NULL Input Filename.");
     ERROR_EXPECTED
     InitStubs();
@@ -1393,9 +2136,10 @@ void utest__PlumbMccPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    3) Successfully Plumb MPEG DF Pipeline without Artifacts.
  |    4) Successfully Plumb MPEG NDF Pipeline without Artifacts.
  |    5) Successfully Plumb MPEG Ambiguous Dropframe Pipeline without Artifacts.
- |    6) Pass a NULL Input Filename.
- |    7) Pass a NULL Output Filename.
- |    8) Pass a NULL Artifact Path.
+ |    6) Plumb MPEG Pipeline with only the 708 Outputs Selected.
+ |    7) Pass a NULL Input Filename.
+ |    8) Pass a NULL Output Filename.
+ |    9) Pass a NULL Artifact Path.
  -------------------------------------------------------------------------------*/
 void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -1403,6 +2147,9 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     char* outputFilename = "Cares?";
     boolean retval;
     Context ctx;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
 
     TEST_START("Test Case: PlumbMpegPipeline() - Successfully Plumb MPEG DF Pipeline with Artifacts.");
     InitStubs();
@@ -1419,12 +2166,17 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccEncodeInitializeCalled);
     ASSERT_EQ(1, MccEncodeAddSinkCalled);
     ASSERT_EQ(1, DtvccDecodeInitializeCalled);
-    ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, DtvccOutInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
     ASSERT_EQ(1, MccOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, MpegFileInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, MccOutInitializeFileNameStr);
@@ -1440,6 +2192,11 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Line21OutInitializeCalled = 0;
     CcDataOutInitializeCalled = 0;
     MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1458,12 +2215,17 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccEncodeInitializeCalled);
     ASSERT_EQ(1, MccEncodeAddSinkCalled);
     ASSERT_EQ(1, DtvccDecodeInitializeCalled);
-    ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, DtvccOutInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
     ASSERT_EQ(1, MccOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, MpegFileInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, MccOutInitializeFileNameStr);
@@ -1479,6 +2241,11 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Line21OutInitializeCalled = 0;
     CcDataOutInitializeCalled = 0;
     MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1550,6 +2317,42 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
+    TEST_START("Test Case: PlumbMpegPipeline() - Plumb MPEG Pipeline with only the 708 Outputs Selected.");
+    InitStubs();
+    DetermineDropFrame__isDropFrame = TRUE;
+    DetermineDropFrame__wasSuccessful = TRUE;
+    ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_708;
+    ctx.config.bailAfterMins = 0;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbMpegPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, MpegFileInitializeCalled);
+    ASSERT_EQ(1, MpegFileAddSinkCalled);
+    ASSERT_EQ(0, MccEncodeInitializeCalled);
+    ASSERT_EQ(0, MccOutInitializeCalled);
+    ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccOutInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
+    ASSERT_EQ(1, CueOutInitializeCalled);
+    ASSERT_EQ(0, Line21DecodeInitializeCalled);
+    ASSERT_EQ(0, Line21OutInitializeCalled);
+    ASSERT_EQ(0, CcDataOutInitializeCalled);
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
+    MpegFileInitializeCalled = 0;
+    MpegFileAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    DtvccDecodeAddSinkCalled = 0;
+    DtvccOutInitializeCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
     TEST_START("Test Case: PlumbMpegPipeline() - Pass a NULL Input Filename.");
     InitStubs();
     DetermineDropFrame__isDropFrame = TRUE;
@@ -1644,6 +2447,7 @@ void utest__PlumbMpegPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    6) Pass a NULL Input Filename.
  |    7) Pass a NULL Output Filename.
  |    8) Pass a NULL Artifact Path.
+ |    9) Successfully Plumb MOV Pipeline with the Cache Output.
  -------------------------------------------------------------------------------*/
 void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
@@ -1651,6 +2455,9 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     char* outputFilename = "Cares?";
     boolean retval;
     Context ctx;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
 
     TEST_START("Test Case: PlumbMovPipeline() - Successfully Plumb MPEG DF Pipeline with Artifacts.");
     InitStubs();
@@ -1667,12 +2474,17 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccEncodeInitializeCalled);
     ASSERT_EQ(1, MccEncodeAddSinkCalled);
     ASSERT_EQ(1, DtvccDecodeInitializeCalled);
-    ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, DtvccOutInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
     ASSERT_EQ(1, MccOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, MovFileInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, MccOutInitializeFileNameStr);
@@ -1688,6 +2500,11 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Line21OutInitializeCalled = 0;
     CcDataOutInitializeCalled = 0;
     MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1706,12 +2523,17 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(1, MccEncodeInitializeCalled);
     ASSERT_EQ(1, MccEncodeAddSinkCalled);
     ASSERT_EQ(1, DtvccDecodeInitializeCalled);
-    ASSERT_EQ(1, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
     ASSERT_EQ(1, Line21DecodeInitializeCalled);
-    ASSERT_EQ(1, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
     ASSERT_EQ(1, DtvccOutInitializeCalled);
     ASSERT_EQ(1, Line21OutInitializeCalled);
     ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
     ASSERT_EQ(1, MccOutInitializeCalled);
     ASSERT_PTREQ(inputFilename, MovFileInitializeFileNameStr);
     ASSERT_PTREQ(ctx.config.outputDirectory, MccOutInitializeFileNameStr);
@@ -1727,6 +2549,11 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     Line21OutInitializeCalled = 0;
     CcDataOutInitializeCalled = 0;
     MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
 
@@ -1878,8 +2705,202 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     ASSERT_EQ(0, MccOutInitializeCalled);
     ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
     TEST_END
+
+    TEST_START("Test Case: PlumbMovPipeline() - Successfully Plumb MOV Pipeline with the Cache Output.");
+    InitStubs();
+    ctx.config.artifacts = FALSE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL | PIPELINE_OUTPUT_CACHE;
+    ctx.config.bailAfterMins = 0;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbMovPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, MovFileInitializeCalled);
+    ASSERT_EQ(4, MovFileAddSinkCalled);
+    ASSERT_EQ(1, MccEncodeInitializeCalled);
+    ASSERT_EQ(1, MccEncodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(1, MccOutInitializeCalled);
+    ASSERT_EQ(1, CacheOutInitializeCalled);
+    MovFileInitializeCalled = 0;
+    MovFileAddSinkCalled = 0;
+    MccEncodeInitializeCalled = 0;
+    MccEncodeAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    MccOutInitializeCalled = 0;
+    CacheOutInitializeCalled = 0;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
 }  // utest__PlumbMovPipeline()
 
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: PlumbCcDataPipeline()
+ |
+ | TEST CASES:
+ |    1) Successfully Plumb CC Data Pipeline timed by Presentation Time.
+ |    2) Successfully Plumb CC Data Pipeline timed by Time Code without Artifacts.
+ |    3) Never Plumb the Cache Output from a CC Data File.
+ |    4) Pass a File that isn't a CC Data File.
+ |    5) Pass a NULL Input Filename.
+ -------------------------------------------------------------------------------*/
+void utest__PlumbCcDataPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    char* inputFilename = "Who";
+    char* outputFilename = "Cares?";
+    boolean retval;
+    Context ctx;
+    ctx.config.parallelSinks = FALSE;
+    ctx.sinkPoolPtr = NULL;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
+
+    TEST_START("Test Case: PlumbCcDataPipeline() - Successfully Plumb CC Data Pipeline timed by Presentation Time.");
+    InitStubs();
+    CcDataFileReadHeader__timeSource = CAPTION_TIME_PTS_NUMBERING;
+    ctx.config.artifacts = TRUE;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbCcDataPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, CcDataFileReadHeaderCalled);
+    ASSERT_EQ(1, CcDataFileInitializeCalled);
+    ASSERT_EQ(4, CcDataFileAddSinkCalled);
+    ASSERT_EQ(1, MccEncodeInitializeCalled);
+    ASSERT_EQ(1, MccEncodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+    ASSERT_EQ(2, DtvccDecodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccWindowInitializeCalled);
+    ASSERT_EQ(1, DtvccWindowAddSinkCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(2, Line21DecodeAddSinkCalled);
+    ASSERT_EQ(1, Line21ScreenInitializeCalled);
+    ASSERT_EQ(1, Line21ScreenAddSinkCalled);
+    ASSERT_EQ(1, DtvccOutInitializeCalled);
+    ASSERT_EQ(TRUE, DtvccOutInitializeMsNotFrame);
+    ASSERT_EQ(1, Line21OutInitializeCalled);
+    ASSERT_EQ(1, CcDataOutInitializeCalled);
+    ASSERT_EQ(2, CueOutInitializeCalled);
+    ASSERT_EQ(1, MccOutInitializeCalled);
+    ASSERT_PTREQ(inputFilename, CcDataFileInitializeFileNameStr);
+    CcDataFileReadHeaderCalled = 0;
+    CcDataFileInitializeCalled = 0;
+    CcDataFileAddSinkCalled = 0;
+    MccEncodeInitializeCalled = 0;
+    MccEncodeAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    DtvccDecodeAddSinkCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    Line21DecodeAddSinkCalled = 0;
+    DtvccOutInitializeCalled = 0;
+    Line21OutInitializeCalled = 0;
+    CcDataOutInitializeCalled = 0;
+    MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PlumbCcDataPipeline() - Successfully Plumb CC Data Pipeline timed by Time Code without Artifacts.");
+    InitStubs();
+    CcDataFileReadHeader__timeSource = CAPTION_TIME_FRAME_NUMBERING;
+    ctx.config.artifacts = FALSE;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbCcDataPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(1, CcDataFileReadHeaderCalled);
+    ASSERT_EQ(1, CcDataFileInitializeCalled);
+    ASSERT_EQ(3, CcDataFileAddSinkCalled);
+    ASSERT_EQ(1, MccEncodeInitializeCalled);
+    ASSERT_EQ(1, MccEncodeAddSinkCalled);
+    ASSERT_EQ(1, DtvccDecodeInitializeCalled);
+    ASSERT_EQ(1, Line21DecodeInitializeCalled);
+    ASSERT_EQ(1, MccOutInitializeCalled);
+    ASSERT_PTREQ(NULL, DtvccOutInitializeFileNameStr);
+    ASSERT_PTREQ(NULL, Line21OutInitializeFileNameStr);
+    ASSERT_PTREQ(NULL, CcDataOutInitializeFileNameStr);
+    CcDataFileReadHeaderCalled = 0;
+    CcDataFileInitializeCalled = 0;
+    CcDataFileAddSinkCalled = 0;
+    MccEncodeInitializeCalled = 0;
+    MccEncodeAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    MccOutInitializeCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PlumbCcDataPipeline() - Never Plumb the Cache Output from a CC Data File.");
+    InitStubs();
+    CcDataFileReadHeader__timeSource = CAPTION_TIME_FRAME_NUMBERING;
+    ctx.config.artifacts = TRUE;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL | PIPELINE_OUTPUT_CACHE;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    retval = PlumbCcDataPipeline( &ctx );
+    ASSERT_EQ(TRUE, retval);
+    ASSERT_EQ(4, CcDataFileAddSinkCalled);
+    ASSERT_EQ(1, DtvccOutInitializeCalled);
+    ASSERT_EQ(FALSE, DtvccOutInitializeMsNotFrame);
+    ASSERT_EQ(0, CacheOutInitializeCalled);
+    CcDataFileReadHeaderCalled = 0;
+    CcDataFileInitializeCalled = 0;
+    CcDataFileAddSinkCalled = 0;
+    MccEncodeInitializeCalled = 0;
+    MccEncodeAddSinkCalled = 0;
+    DtvccDecodeInitializeCalled = 0;
+    DtvccDecodeAddSinkCalled = 0;
+    Line21DecodeInitializeCalled = 0;
+    Line21DecodeAddSinkCalled = 0;
+    DtvccOutInitializeCalled = 0;
+    Line21OutInitializeCalled = 0;
+    CcDataOutInitializeCalled = 0;
+    MccOutInitializeCalled = 0;
+    Line21ScreenInitializeCalled = 0;
+    Line21ScreenAddSinkCalled = 0;
+    DtvccWindowInitializeCalled = 0;
+    DtvccWindowAddSinkCalled = 0;
+    CueOutInitializeCalled = 0;
+    ctx.config.outputs = PIPELINE_OUTPUT_ALL;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PlumbCcDataPipeline() - Pass a File that isn't a CC Data File.");
+    InitStubs();
+    CcDataFileReadHeader__wasSuccessful = FALSE;
+    ctx.config.artifacts = TRUE;
+    ctx.config.inputFilename = inputFilename;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    ERROR_EXPECTED
+    retval = PlumbCcDataPipeline( &ctx );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ(1, CcDataFileReadHeaderCalled);
+    ASSERT_EQ(0, CcDataFileInitializeCalled);
+    ASSERT_EQ(0, CcDataFileAddSinkCalled);
+    CcDataFileReadHeaderCalled = 0;
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+
+    TEST_START("Test Case: PlumbCcDataPipeline() - Pass a NULL Input Filename.");
+    InitStubs();
+    ctx.config.artifacts = TRUE;
+    ctx.config.inputFilename = NULL;
+    strcpy(ctx.config.outputDirectory, outputFilename);
+    ERROR_EXPECTED
+    retval = PlumbCcDataPipeline( &ctx );
+    ASSERT_EQ(FALSE, retval);
+    ASSERT_EQ(0, CcDataFileReadHeaderCalled);
+    ASSERT_EQ(0, CcDataFileInitializeCalled);
+    ASSERT_EQ(0, CcDataFileAddSinkCalled);
+    ASSERT_EQ_MSG(FALSE, AnySpuriousFunctionsCalled(), "Unexpected Functions Called.");
+    TEST_END
+}  // utest__PlumbCcDataPipeline()
+
 /*------------------------------------------------------------------------------
  | FUNCTION UNDER TEST: DrivePipeline()
  |
@@ -1892,6 +2913,7 @@ void utest__PlumbMovPipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
 void utest__DrivePipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
     TEST_INITIALIZE
     Context ctx;
+    ctx.sinkPoolPtr = NULL;
 
     TEST_START("Test Case: DrivePipeline() - Successfully Drive the Pipeline.");
     InitStubs();
@@ -1930,6 +2952,7 @@ void utest__DrivePipeline( TEST_SUITE_RECEIVED_ARGUMENTS ) {
  |    pipeline_utils.c - AddSink()
  |    pipeline_utils.c - PassToSinks()
  |    pipeline_utils.c - ShutdownSinks()
+ |    pipeline_utils.c - BuildPipeline()
  |    pipeline_utils.c - PlumbSccPipeline()
  |    pipeline_utils.c - PlumbMccPipeline()
  |    pipeline_utils.c - PlumbMpegPipeline()
@@ -1945,6 +2968,10 @@ int main( int argc, char* argv[] ) {
     utest__PassToSinks( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
 
+    TEST_SUITE_START("Test Suite: pipeline_utils.c -- PassFrameToSinks()");
+    utest__PassFrameToSinks( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
     TEST_SUITE_START("Test Suite: pipeline_utils.c -- ShutdownSinks()");
     utest__ShutdownSinks( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
@@ -1957,6 +2984,10 @@ int main( int argc, char* argv[] ) {
     utest__AddSink( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
 
+    TEST_SUITE_START("Test Suite: pipeline_utils.c -- BuildPipeline()");
+    utest__BuildPipeline( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
     TEST_SUITE_START("Test Suite: pipeline_utils.c -- PlumbSccPipeline()");
     utest__PlumbSccPipeline( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
@@ -1973,6 +3004,10 @@ int main( int argc, char* argv[] ) {
     utest__PlumbMovPipeline( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
 
+    TEST_SUITE_START("Test Suite: pipeline_utils.c -- PlumbCcDataPipeline()");
+    utest__PlumbCcDataPipeline( TEST_SUITE_PASSED_ARGUMENTS );
+    TEST_SUITE_END
+
     TEST_SUITE_START("Test Suite: pipeline_utils.c -- DrivePipeline()");
     utest__DrivePipeline( TEST_SUITE_PASSED_ARGUMENTS );
     TEST_SUITE_END
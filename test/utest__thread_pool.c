@@ -0,0 +1,206 @@
+#include "test_engine.h"
+#include "../src/utils/thread_pool.c"
+
+/*----------------------------------------------------------------------------*/
+/*--                          Support for Tasks                             --*/
+/*----------------------------------------------------------------------------*/
+
+#define TEST_MAX_NUM_TASKS        500
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_barrier_t barrier;
+    boolean useBarrier;
+    uint32 numTasksRun;
+    uint32 timesRun[TEST_MAX_NUM_TASKS];
+    pthread_t ranOn[TEST_MAX_NUM_TASKS];
+} TaskRecord;
+
+static void initTaskRecord( TaskRecord* recordPtr, uint8 barrierCount ) {
+    pthread_mutex_init(&recordPtr->mutex, NULL);
+    recordPtr->useBarrier = FALSE;
+    if( barrierCount != 0 ) {
+        pthread_barrier_init(&recordPtr->barrier, NULL, barrierCount);
+        recordPtr->useBarrier = TRUE;
+    }
+    recordPtr->numTasksRun = 0;
+    for( int loop = 0; loop < TEST_MAX_NUM_TASKS; loop++ ) {
+        recordPtr->timesRun[loop] = 0;
+    }
+}  // initTaskRecord()
+
+static void shutdownTaskRecord( TaskRecord* recordPtr ) {
+    if( recordPtr->useBarrier == TRUE ) {
+        pthread_barrier_destroy(&recordPtr->barrier);
+    }
+    pthread_mutex_destroy(&recordPtr->mutex);
+}  // shutdownTaskRecord()
+
+static void recordTask( void* recordVoidPtr, uint32 taskIndex ) {
+    TaskRecord* recordPtr = (TaskRecord*)recordVoidPtr;
+
+    // Every thread in the pool has to reach the barrier before any task finishes
+    if( recordPtr->useBarrier == TRUE ) {
+        pthread_barrier_wait(&recordPtr->barrier);
+    }
+
+    pthread_mutex_lock(&recordPtr->mutex);
+    recordPtr->numTasksRun++;
+    recordPtr->timesRun[taskIndex]++;
+    recordPtr->ranOn[taskIndex] = pthread_self();
+    pthread_mutex_unlock(&recordPtr->mutex);
+}  // recordTask()
+
+static uint32 numTasksRunOnce( TaskRecord* recordPtr, uint32 numTasks ) {
+    uint32 retval = 0;
+    for( int loop = 0; loop < numTasks; loop++ ) {
+        if( recordPtr->timesRun[loop] == 1 ) retval++;
+    }
+    return retval;
+}  // numTasksRunOnce()
+
+static uint32 numTasksRunOnCaller( TaskRecord* recordPtr, uint32 numTasks ) {
+    uint32 retval = 0;
+    for( int loop = 0; loop < numTasks; loop++ ) {
+        if( (recordPtr->timesRun[loop] != 0) && pthread_equal(recordPtr->ranOn[loop], pthread_self()) ) retval++;
+    }
+    return retval;
+}  // numTasksRunOnCaller()
+
+/*----------------------------------------------------------------------------*/
+/*--                             Test Cases                                 --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: ThreadPoolCreate()
+ |
+ | TEST CASES:
+ |    1) Single Thread starts no Workers.
+ |    2) Workers started are one fewer than the Threads.
+ |    3) Too many Threads are limited to the maximum.
+ -------------------------------------------------------------------------------*/
+void utest__ThreadPoolCreate( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    ThreadPool* poolPtr;
+
+    TEST_START("Test Case: ThreadPoolCreate() - Single Thread starts no Workers.");
+    poolPtr = ThreadPoolCreate(1);
+    ASSERT_NEQ((uint64)NULL, (uint64)poolPtr);
+    ASSERT_EQ(0, poolPtr->numThreads);
+    ThreadPoolDestroy(poolPtr);
+    TEST_END
+
+    TEST_START("Test Case: ThreadPoolCreate() - Workers started are one fewer than the Threads.");
+    poolPtr = ThreadPoolCreate(4);
+    ASSERT_NEQ((uint64)NULL, (uint64)poolPtr);
+    ASSERT_EQ(3, poolPtr->numThreads);
+    ThreadPoolDestroy(poolPtr);
+    TEST_END
+
+    TEST_START("Test Case: ThreadPoolCreate() - Too many Threads are limited to the maximum.");
+    poolPtr = ThreadPoolCreate(THREAD_POOL_MAX_THREADS + 10);
+    ASSERT_NEQ((uint64)NULL, (uint64)poolPtr);
+    ASSERT_EQ(THREAD_POOL_MAX_THREADS - 1, poolPtr->numThreads);
+    ThreadPoolDestroy(poolPtr);
+    TEST_END
+}  // utest__ThreadPoolCreate()
+
+/*------------------------------------------------------------------------------
+ | FUNCTION UNDER TEST: ThreadPoolRun()
+ |
+ | TEST CASES:
+ |    1) No Tasks in the Batch.
+ |    2) Single Thread runs every Task on the Caller.
+ |    3) Caller takes part in the Batch alongside the Workers.
+ |    4) More Tasks than Threads each run exactly once.
+ |    5) Several Batches on the same Pool.
+ -------------------------------------------------------------------------------*/
+void utest__ThreadPoolRun( TEST_SUITE_RECEIVED_ARGUMENTS ) {
+    TEST_INITIALIZE
+    ThreadPool* poolPtr;
+    TaskRecord record;
+
+    TEST_START("Test Case: ThreadPoolRun() - No Tasks in the Batch.");
+    initTaskRecord(&record, 0);
+    poolPtr = ThreadPoolCreate(4);
+    ThreadPoolRun(poolPtr, &recordTask, &record, 0);
+    ASSERT_EQ(0, record.numTasksRun);
+    ThreadPoolDestroy(poolPtr);
+    shutdownTaskRecord(&record);
+    TEST_END
+
+    TEST_START("Test Case: ThreadPoolRun() - Single Thread runs every Task on the Caller.");
+    initTaskRecord(&record, 0);
+    poolPtr = ThreadPoolCreate(1);
+    ThreadPoolRun(poolPtr, &recordTask, &record, 10);
+    ASSERT_EQ(10, record.numTasksRun);
+    ASSERT_EQ(10, numTasksRunOnce(&record, 10));
+    ASSERT_EQ(10, numTasksRunOnCaller(&record, 10));
+    ThreadPoolDestroy(poolPtr);
+    shutdownTaskRecord(&record);
+    TEST_END
+
+    // Each Task waits until all four Threads are in a Task, which only happens if the Caller runs one
+    TEST_START("Test Case: ThreadPoolRun() - Caller takes part in the Batch alongside the Workers.");
+    initTaskRecord(&record, 4);
+    poolPtr = ThreadPoolCreate(4);
+    ThreadPoolRun(poolPtr, &recordTask, &record, 4);
+    ASSERT_EQ(4, record.numTasksRun);
+    ASSERT_EQ(4, numTasksRunOnce(&record, 4));
+    ASSERT_EQ(1, numTasksRunOnCaller(&record, 4));
+    ThreadPoolDestroy(poolPtr);
+    shutdownTaskRecord(&record);
+    TEST_END
+
+    TEST_START("Test Case: ThreadPoolRun() - More Tasks than Threads each run exactly once.");
+    initTaskRecord(&record, 0);
+    poolPtr = ThreadPoolCreate(3);
+    ThreadPoolRun(poolPtr, &recordTask, &record, TEST_MAX_NUM_TASKS);
+    ASSERT_EQ(TEST_MAX_NUM_TASKS, record.numTasksRun);
+    ASSERT_EQ(TEST_MAX_NUM_TASKS, numTasksRunOnce(&record, TEST_MAX_NUM_TASKS));
+    ASSERT_EQ(TEST_MAX_NUM_TASKS, poolPtr->numTasksDone);
+    ThreadPoolDestroy(poolPtr);
+    shutdownTaskRecord(&record);
+    TEST_END
+
+    TEST_START("Test Case: ThreadPoolRun() - Several Batches on the same Pool.");
+    poolPtr = ThreadPoolCreate(3);
+    initTaskRecord(&record, 0);
+    ThreadPoolRun(poolPtr, &recordTask, &record, 7);
+    ASSERT_EQ(7, record.numTasksRun);
+    ASSERT_EQ(7, numTasksRunOnce(&record, 7));
+    shutdownTaskRecord(&record);
+    initTaskRecord(&record, 0);
+    ThreadPoolRun(poolPtr, &recordTask, &record, 50);
+    ASSERT_EQ(50, record.numTasksRun);
+    ASSERT_EQ(50, numTasksRunOnce(&record, 50));
+    shutdownTaskRecord(&record);
+    ThreadPoolDestroy(poolPtr);
+    TEST_END
+}  // utest__ThreadPoolRun()
+
+/*----------------------------------------------------------------------------*/
+/*--                             Test Suite                                 --*/
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+ | TESTED FUNCTIONS:
+ |    ThreadPoolCreate()
+ |    ThreadPoolRun()
+ |
+ | UNTESTED FUNCTIONS:
+ |    ThreadPoolDestroy()          --  Too simple to test
+ -------------------------------------------------------------------------------*/
+int main( int argc, char* argv[] ) {
+    INIT_TEST_FRAMEWORK( argc, argv )
+
+    TEST_SUITE_START("Test Suite: thread_pool.c -- ThreadPoolCreate()");
+    utest__ThreadPoolCreate( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    TEST_SUITE_START("Test Suite: thread_pool.c -- ThreadPoolRun()");
+    utest__ThreadPoolRun( &tmpNumSuccessfulTests, &tmpNumFailedTests );
+    TEST_SUITE_END
+
+    SHUTDOWN_TEST_FRAMEWORK
+}  // main()